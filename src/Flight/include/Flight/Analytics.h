@@ -60,6 +60,17 @@ public:
      */
     std::pair<std::int64_t, double> firstMovementHeading() const noexcept;
 
+    /*!
+     * Returns the recorded position which is closest to the given \p latitude and \p longitude.
+     * Only the samples of those parts of the track which may contain the closest position are
+     * visited, based on the Position#getTrackOverview.
+     *
+     * \param latitude
+     *        the latitude [degrees]
+     * \param longitude
+     *        the longitude [degrees]
+     * \return the closest position; the earliest one in case of equal distances
+     */
     PositionData closestPosition(double latitude, double longitude) const noexcept;
 
 private:
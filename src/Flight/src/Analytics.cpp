@@ -21,8 +21,11 @@
  * OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
  * DEALINGS IN THE SOFTWARE.
  */
+#include <vector>
+#include <algorithm>
 #include <utility>
 #include <limits>
+#include <cstddef>
 #include <cstdint>
 
 #include <QtGlobal>
@@ -35,6 +38,7 @@
 #include <Model/Aircraft.h>
 #include <Model/Position.h>
 #include <Model/PositionData.h>
+#include <Model/TrackOverview.h>
 #include "Analytics.h"
 
 namespace  {
@@ -99,14 +103,36 @@ PositionData Analytics::closestPosition(double latitude, double longitude) const
 {
     PositionData positionData;
     double minimumDistance = std::numeric_limits<double>::max();
+    std::size_t minimumIndex {0};
+    const SkyMath::Coordinate coordinate {latitude, longitude};
 
-    Position &position = d->aircraft.getPosition();
-    for (const auto &pos : position) {
-        const double distance = SkyMath::geodesicDistance(SkyMath::Coordinate(latitude, longitude),
-                                                          SkyMath::Coordinate(pos.latitude, pos.longitude));
-        if (minimumDistance > distance) {
-            positionData = pos;
-            minimumDistance = distance;
+    // Visit the buckets in order of their lower distance bound, and only visit the samples
+    // of those buckets which may contain a position at least as close as found so far
+    const Position &position = d->aircraft.getPosition();
+    const auto buckets = position.getTrackOverview(TrackOverview::Resolution::OneMinute);
+    std::vector<std::pair<double, std::size_t>> lowerBounds;
+    lowerBounds.reserve(buckets.size());
+    for (std::size_t i = 0; i < buckets.size(); ++i) {
+        const auto &center = buckets[i].center;
+        const double distance = SkyMath::geodesicDistance(coordinate, SkyMath::Coordinate(center.latitude, center.longitude));
+        lowerBounds.emplace_back(distance - buckets[i].radius, i);
+    }
+    std::sort(lowerBounds.begin(), lowerBounds.end());
+
+    for (const auto &[lowerBound, bucketIndex] : lowerBounds) {
+        if (lowerBound > minimumDistance) {
+            break;
+        }
+        const auto &bucket = buckets[bucketIndex];
+        for (std::size_t i = bucket.firstIndex; i < bucket.firstIndex + bucket.sampleCount; ++i) {
+            const auto &pos = position[i];
+            const double distance = SkyMath::geodesicDistance(coordinate, SkyMath::Coordinate(pos.latitude, pos.longitude));
+            // In case of equal distances the earliest position wins
+            if (minimumDistance > distance || (minimumDistance == distance && i < minimumIndex)) {
+                positionData = pos;
+                minimumDistance = distance;
+                minimumIndex = i;
+            }
         }
     }
     return positionData;
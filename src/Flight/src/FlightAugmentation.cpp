@@ -41,6 +41,7 @@
 #include <Model/Light.h>
 #include <Model/LightData.h>
 #include <Model/TimeVariableData.h>
+#include <Model/SampleCursor.h>
 #include "Analytics.h"
 #include "FlightAugmentation.h"
 
@@ -133,6 +134,10 @@ void FlightAugmentation::augmentAttitudeAndVelocity(Aircraft &aircraft) noexcept
         attitudeCount = attitude.count();
     }
 
+    // The current and next positions are interpolated alternately: separate cursors keep
+    // the search from being restarted for each interpolation
+    SampleCursor<PositionData> currentPositionCursor;
+    SampleCursor<PositionData> nextPositionCursor;
     for (std::size_t i = 0; i < attitudeCount; ++i) {
 
         if (i < attitudeCount - 1) {
@@ -140,8 +145,8 @@ void FlightAugmentation::augmentAttitudeAndVelocity(Aircraft &aircraft) noexcept
             const auto currentTimestamp = currentAttitudeData.timestamp;
             const auto nextTimeStamp = attitude[i + 1].timestamp;
 
-            const auto currentPositionData = position.interpolate(currentTimestamp, NoTimeOffset);
-            const auto nextPositionData = position.interpolate(nextTimeStamp, NoTimeOffset);
+            const auto &currentPositionData = position.interpolate(currentTimestamp, NoTimeOffset, currentPositionCursor);
+            const auto &nextPositionData = position.interpolate(nextTimeStamp, NoTimeOffset, nextPositionCursor);
             const SkyMath::Coordinate currentPosition {currentPositionData.latitude, currentPositionData.longitude};
             const SkyMath::Coordinate nextPosition {nextPositionData.latitude, nextPositionData.longitude};
 
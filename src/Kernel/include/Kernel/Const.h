@@ -38,6 +38,16 @@ namespace Const
      */
     constexpr inline const char *DotLogbookExtension {".sdlog"};
 
+    /*!
+     * The plain (deduplicated) logbook backup file extension (without leading dot).
+     */
+    constexpr inline const char *BackupExtension {"sdbackup"};
+
+    /*!
+     * The (deduplicated) logbook backup file extension, with a leading dot.
+     */
+    constexpr inline const char *DotBackupExtension {".sdbackup"};
+
     /*!
      * The logbook connection name that is used for the application.
      */
@@ -53,6 +63,11 @@ namespace Const
      */
     constexpr inline const char *ExportConnectionName {"Export"};
 
+    /*!
+     * The logbook connection name that is used for storing recordings incrementally, in the background.
+     */
+    constexpr inline const char *RecordingJournalConnectionName {"RecordingJournal"};
+
     /*!
      * Suffix indicating zulu time including whitespace, ready to be appended to a formated date/time string.
      */
@@ -87,6 +102,10 @@ namespace Const
 
     // Export
     constexpr inline const char *CsvExportPluginUuid {"e718d4d2-da18-422b-921d-625315b75ca8"};
+    constexpr inline const char *GpxExportPluginUuid {"8bfbf034-fa1b-4e12-bb95-242f47160d17"};
+    constexpr inline const char *IgcExportPluginUuid {"6f77d397-3ee0-435f-9b13-c4b9eb7b227e"};
+    constexpr inline const char *JsonExportPluginUuid {"877d0356-e762-4301-8eed-acff245c665e"};
+    constexpr inline const char *KmlExportPluginUuid {"55d58092-6234-4902-a318-d0dc76bbcda6"};
 
     // Location export
     constexpr inline const char *CsvLocationExportPluginUuid {"55352368-9550-41d1-b314-95faa0296af0"};
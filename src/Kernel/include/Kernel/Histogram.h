@@ -0,0 +1,89 @@
+/**
+ * Sky Dolly - The Black Sheep for Your Flight Recordings
+ *
+ * Copyright (c) 2020 - 2025 Oliver Knoll
+ *
+ * MIT License
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this
+ * software and associated documentation files (the "Software"), to deal in the Software
+ * without restriction, including without limitation the rights to use, copy, modify, merge,
+ * publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons
+ * to whom the Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or
+ * substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED *AS IS*, WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR
+ * PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE
+ * FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+ * OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ */
+#ifndef HISTOGRAM_H
+#define HISTOGRAM_H
+
+#include <vector>
+#include <limits>
+#include <cstdint>
+#include <cstddef>
+
+#include "KernelLib.h"
+
+/*!
+ * A histogram with buckets of equal width, starting at 0. Values beyond the
+ * last bucket are counted in the last bucket, negative values in the first bucket.
+ *
+ * Besides the bucket counts the exact minimum, maximum and mean of all added
+ * values are maintained as well.
+ */
+class KERNEL_API Histogram final
+{
+public:
+    /*!
+     * Creates a histogram with \p bucketCount buckets of the given \p bucketWidth.
+     *
+     * \param bucketWidth
+     *        the width of each bucket; must be > 0
+     * \param bucketCount
+     *        the number of buckets; must be > 0
+     */
+    explicit Histogram(double bucketWidth = 1.0, std::size_t bucketCount = 64) noexcept;
+    Histogram(const Histogram &rhs) = default;
+    Histogram(Histogram &&rhs) noexcept = default;
+    Histogram &operator=(const Histogram &rhs) = default;
+    Histogram &operator=(Histogram &&rhs) noexcept = default;
+    ~Histogram() = default;
+
+    void add(double value) noexcept;
+    void clear() noexcept;
+
+    std::uint64_t getCount() const noexcept;
+    double getMinimum() const noexcept;
+    double getMaximum() const noexcept;
+    double getMean() const noexcept;
+
+    /*!
+     * Returns the approximated \p percentile: the upper bound of the bucket which contains
+     * the \p percentile, but never more than the effective maximum value.
+     *
+     * \param percentile
+     *        the percentile [0.0, 100.0]
+     * \return the approximated percentile value; 0.0 if no values have been added yet
+     */
+    double getPercentile(double percentile) const noexcept;
+
+    double getBucketWidth() const noexcept;
+    const std::vector<std::uint64_t> &getBuckets() const noexcept;
+
+private:
+    std::vector<std::uint64_t> m_buckets;
+    double m_bucketWidth;
+    std::uint64_t m_count {0};
+    double m_sum {0.0};
+    double m_minimum {std::numeric_limits<double>::max()};
+    double m_maximum {std::numeric_limits<double>::lowest()};
+};
+
+#endif // HISTOGRAM_H
@@ -0,0 +1,449 @@
+/**
+ * Sky Dolly - The Black Sheep for Your Flight Recordings
+ *
+ * Copyright (c) 2020 - 2025 Oliver Knoll
+ *
+ * MIT License
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this
+ * software and associated documentation files (the "Software"), to deal in the Software
+ * without restriction, including without limitation the rights to use, copy, modify, merge,
+ * publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons
+ * to whom the Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or
+ * substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED *AS IS*, WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR
+ * PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE
+ * FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+ * OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ */
+#ifndef SEGMENTEDVECTOR_H
+#define SEGMENTEDVECTOR_H
+
+#include <vector>
+#include <memory>
+#include <iterator>
+#include <utility>
+#include <stdexcept>
+#include <type_traits>
+#include <bit>
+#include <algorithm>
+#include <cstring>
+#include <cstddef>
+
+/*!
+ * A sequence container which stores its elements in segments (blocks) of \p SegmentSize
+ * elements each, with constant time random access.
+ *
+ * The first \p SegmentSize elements are stored in geometrically growing segments, starting
+ * with \p FirstSegmentSize elements (FirstSegmentSize, FirstSegmentSize, 2 * FirstSegmentSize,
+ * ..., SegmentSize / 2), so small containers only occupy little memory.
+ *
+ * In contrast to a \c std::vector growing the container never moves (copies) existing elements:
+ * new segments are simply added to the segment table, so appending is free of latency spikes,
+ * even for millions of elements, and the addresses of the stored elements remain stable.
+ *
+ * Segments are retained when the container is cleared and are re-used for subsequent appends.
+ *
+ * Only appending at the end is supported. Trivially copyable elements are copied segment-wise
+ * in bulk (\c memcpy), see #append and #copy.
+ */
+template <typename T, std::size_t SegmentSize = 4096, std::size_t FirstSegmentSize = std::min<std::size_t>(16, SegmentSize)>
+class SegmentedVector
+{
+    static_assert(SegmentSize > 0 && std::has_single_bit(SegmentSize), "SegmentSize must be a power of two");
+    static_assert(FirstSegmentSize > 0 && std::has_single_bit(FirstSegmentSize) && FirstSegmentSize <= SegmentSize,
+                  "FirstSegmentSize must be a power of two, not larger than SegmentSize");
+
+    template <bool IsConst>
+    class BasicIterator
+    {
+    public:
+        using iterator_category = std::random_access_iterator_tag;
+        using iterator_concept = std::random_access_iterator_tag;
+        using value_type = T;
+        using difference_type = std::ptrdiff_t;
+        using pointer = std::conditional_t<IsConst, const T *, T *>;
+        using reference = std::conditional_t<IsConst, const T &, T &>;
+        using Container = std::conditional_t<IsConst, const SegmentedVector, SegmentedVector>;
+
+        BasicIterator() noexcept = default;
+        BasicIterator(Container *container, std::size_t index) noexcept
+            : m_container(container),
+              m_index(index)
+        {}
+
+        // Conversion from iterator to const_iterator
+        template <bool WasConst, typename = std::enable_if_t<IsConst && !WasConst>>
+        BasicIterator(const BasicIterator<WasConst> &rhs) noexcept
+            : m_container(rhs.m_container),
+              m_index(rhs.m_index)
+        {}
+
+        reference operator*() const noexcept { return (*m_container)[m_index]; }
+        pointer operator->() const noexcept { return &(*m_container)[m_index]; }
+        reference operator[](difference_type n) const noexcept { return (*m_container)[m_index + n]; }
+
+        BasicIterator &operator++() noexcept { ++m_index; return *this; }
+        BasicIterator operator++(int) noexcept { auto it = *this; ++m_index; return it; }
+        BasicIterator &operator--() noexcept { --m_index; return *this; }
+        BasicIterator operator--(int) noexcept { auto it = *this; --m_index; return it; }
+        BasicIterator &operator+=(difference_type n) noexcept { m_index += n; return *this; }
+        BasicIterator &operator-=(difference_type n) noexcept { m_index -= n; return *this; }
+
+        friend BasicIterator operator+(BasicIterator it, difference_type n) noexcept { it += n; return it; }
+        friend BasicIterator operator+(difference_type n, BasicIterator it) noexcept { it += n; return it; }
+        friend BasicIterator operator-(BasicIterator it, difference_type n) noexcept { it -= n; return it; }
+        friend difference_type operator-(const BasicIterator &lhs, const BasicIterator &rhs) noexcept
+        {
+            return static_cast<difference_type>(lhs.m_index) - static_cast<difference_type>(rhs.m_index);
+        }
+
+        friend bool operator==(const BasicIterator &lhs, const BasicIterator &rhs) noexcept { return lhs.m_index == rhs.m_index; }
+        friend auto operator<=>(const BasicIterator &lhs, const BasicIterator &rhs) noexcept { return lhs.m_index <=> rhs.m_index; }
+
+    private:
+        friend class BasicIterator<!IsConst>;
+        Container *m_container {nullptr};
+        std::size_t m_index {0};
+    };
+
+public:
+    using value_type = T;
+    using size_type = std::size_t;
+    using difference_type = std::ptrdiff_t;
+    using reference = T &;
+    using const_reference = const T &;
+    using iterator = BasicIterator<false>;
+    using const_iterator = BasicIterator<true>;
+
+    SegmentedVector() noexcept = default;
+
+    SegmentedVector(const SegmentedVector &rhs)
+    {
+        reserve(rhs.m_size);
+        for (size_type segment = 0, index = 0; index < rhs.m_size; index += segmentSize(segment), ++segment) {
+            append(rhs.m_segments[segment], std::min(segmentSize(segment), rhs.m_size - index));
+        }
+    }
+
+    SegmentedVector(SegmentedVector &&rhs) noexcept
+        : m_segments(std::move(rhs.m_segments)),
+          m_size(std::exchange(rhs.m_size, 0))
+    {}
+
+    SegmentedVector &operator=(const SegmentedVector &rhs)
+    {
+        if (this != &rhs) {
+            SegmentedVector copy {rhs};
+            swap(copy);
+        }
+        return *this;
+    }
+
+    SegmentedVector &operator=(SegmentedVector &&rhs) noexcept
+    {
+        if (this != &rhs) {
+            SegmentedVector moved {std::move(rhs)};
+            swap(moved);
+        }
+        return *this;
+    }
+
+    ~SegmentedVector()
+    {
+        clear();
+        deallocateSegments();
+    }
+
+    void swap(SegmentedVector &rhs) noexcept
+    {
+        m_segments.swap(rhs.m_segments);
+        std::swap(m_size, rhs.m_size);
+    }
+
+    size_type size() const noexcept
+    {
+        return m_size;
+    }
+
+    bool empty() const noexcept
+    {
+        return m_size == 0;
+    }
+
+    /*!
+     * Returns the number of elements that can be stored without allocating another segment.
+     *
+     * \return the number of elements the allocated segments can hold
+     */
+    size_type capacity() const noexcept
+    {
+        const size_type segmentCount = m_segments.size();
+        if (segmentCount <= GrowingSegmentCount) {
+            return segmentCount > 0 ? FirstSegmentSize << (segmentCount - 1) : 0;
+        }
+        return (segmentCount - GrowingSegmentCount + 1) * SegmentSize;
+    }
+
+    /*!
+     * Allocates segments until at least \p size elements can be stored. Existing elements are
+     * never moved.
+     *
+     * \param size
+     *        the requested capacity
+     */
+    void reserve(size_type size)
+    {
+        while (capacity() < size) {
+            allocateSegment();
+        }
+    }
+
+    T &operator[](size_type index) noexcept
+    {
+        const auto [segment, offset] = locate(index);
+        return m_segments[segment][offset];
+    }
+
+    const T &operator[](size_type index) const noexcept
+    {
+        const auto [segment, offset] = locate(index);
+        return m_segments[segment][offset];
+    }
+
+    T &at(size_type index)
+    {
+        if (index >= m_size) {
+            throw std::out_of_range("SegmentedVector::at: index out of range");
+        }
+        return (*this)[index];
+    }
+
+    const T &at(size_type index) const
+    {
+        if (index >= m_size) {
+            throw std::out_of_range("SegmentedVector::at: index out of range");
+        }
+        return (*this)[index];
+    }
+
+    T &front() noexcept
+    {
+        return (*this)[0];
+    }
+
+    const T &front() const noexcept
+    {
+        return (*this)[0];
+    }
+
+    T &back() noexcept
+    {
+        return (*this)[m_size - 1];
+    }
+
+    const T &back() const noexcept
+    {
+        return (*this)[m_size - 1];
+    }
+
+    void push_back(const T &value)
+    {
+        emplace_back(value);
+    }
+
+    void push_back(T &&value)
+    {
+        emplace_back(std::move(value));
+    }
+
+    template <typename... Args>
+    T &emplace_back(Args&&... args)
+    {
+        if (m_size == capacity()) {
+            allocateSegment();
+        }
+        T *element = &(*this)[m_size];
+        std::construct_at(element, std::forward<Args>(args)...);
+        ++m_size;
+        return *element;
+    }
+
+    /*!
+     * Appends \p count copies of \p value.
+     *
+     * \param count
+     *        the number of elements to be appended
+     * \param value
+     *        the value to be copied
+     */
+    void append(size_type count, const T &value)
+    {
+        reserve(m_size + count);
+        for (size_type i = 0; i < count; ++i) {
+            emplace_back(value);
+        }
+    }
+
+    /*!
+     * Appends the \p count contiguous elements starting at \p values.
+     *
+     * \param values
+     *        the elements to be appended; must not point into this container
+     * \param count
+     *        the number of elements to be appended
+     */
+    void append(const T *values, size_type count)
+    {
+        reserve(m_size + count);
+        while (count > 0) {
+            const auto [segment, offset] = locate(m_size);
+            const size_type n = std::min(segmentSize(segment) - offset, count);
+            T *destination = m_segments[segment] + offset;
+            if constexpr (std::is_trivially_copyable_v<T>) {
+                std::memcpy(destination, values, n * sizeof(T));
+            } else {
+                std::uninitialized_copy_n(values, n, destination);
+            }
+            m_size += n;
+            values += n;
+            count -= n;
+        }
+    }
+
+    /*!
+     * Copies the \p count elements starting at \p index into the contiguous \p destination.
+     *
+     * \param index
+     *        the index of the first element to be copied; \p index + \p count must not exceed the #size
+     * \param count
+     *        the number of elements to be copied
+     * \param destination
+     *        the contiguous, already constructed elements to be assigned
+     */
+    void copy(size_type index, size_type count, T *destination) const
+    {
+        while (count > 0) {
+            const auto [segment, offset] = locate(index);
+            const size_type n = std::min(segmentSize(segment) - offset, count);
+            const T *source = m_segments[segment] + offset;
+            if constexpr (std::is_trivially_copyable_v<T>) {
+                std::memcpy(destination, source, n * sizeof(T));
+            } else {
+                std::copy_n(source, n, destination);
+            }
+            index += n;
+            destination += n;
+            count -= n;
+        }
+    }
+
+    /*!
+     * Removes all elements and frees all allocated segments.
+     *
+     * \sa clear
+     */
+    void release() noexcept
+    {
+        clear();
+        deallocateSegments();
+        m_segments.clear();
+        m_segments.shrink_to_fit();
+    }
+
+    /*!
+     * Removes all elements. The allocated segments are retained for re-use.
+     *
+     * \sa release
+     */
+    void clear() noexcept
+    {
+        if constexpr (!std::is_trivially_destructible_v<T>) {
+            for (size_type i = 0; i < m_size; ++i) {
+                std::destroy_at(&(*this)[i]);
+            }
+        }
+        m_size = 0;
+    }
+
+    iterator begin() noexcept
+    {
+        return iterator(this, 0);
+    }
+
+    const_iterator begin() const noexcept
+    {
+        return const_iterator(this, 0);
+    }
+
+    iterator end() noexcept
+    {
+        return iterator(this, m_size);
+    }
+
+    const_iterator end() const noexcept
+    {
+        return const_iterator(this, m_size);
+    }
+
+    const_iterator cbegin() const noexcept
+    {
+        return const_iterator(this, 0);
+    }
+
+    const_iterator cend() const noexcept
+    {
+        return const_iterator(this, m_size);
+    }
+
+private:
+    static constexpr size_type Shift = std::countr_zero(SegmentSize);
+    static constexpr size_type Mask = SegmentSize - 1;
+    static constexpr size_type FirstShift = std::countr_zero(FirstSegmentSize);
+    // The number of segments holding the first SegmentSize elements
+    static constexpr size_type GrowingSegmentCount = Shift - FirstShift + 1;
+
+    static constexpr size_type segmentSize(size_type segment) noexcept
+    {
+        if (segment >= GrowingSegmentCount) {
+            return SegmentSize;
+        }
+        return segment > 0 ? FirstSegmentSize << (segment - 1) : FirstSegmentSize;
+    }
+
+    // Returns the segment and the offset within that segment of the element at index
+    static constexpr std::pair<size_type, size_type> locate(size_type index) noexcept
+    {
+        if (index >= SegmentSize) {
+            return {GrowingSegmentCount - 1 + (index >> Shift), index & Mask};
+        } else if (index < FirstSegmentSize) {
+            return {0, index};
+        }
+        // Segment k > 0 of the growing segments starts at index FirstSegmentSize << (k - 1)
+        const auto highestBit = static_cast<size_type>(std::bit_width(index)) - 1;
+        return {highestBit - FirstShift + 1, index - (size_type(1) << highestBit)};
+    }
+
+    void allocateSegment()
+    {
+        m_segments.push_back(std::allocator<T>().allocate(segmentSize(m_segments.size())));
+    }
+
+    void deallocateSegments() noexcept
+    {
+        for (size_type segment = 0; segment < m_segments.size(); ++segment) {
+            std::allocator<T>().deallocate(m_segments[segment], segmentSize(segment));
+        }
+    }
+
+    // The segment table: growing it only copies the segment pointers, never the elements
+    std::vector<T *> m_segments;
+    size_type m_size {0};
+};
+
+#endif // SEGMENTEDVECTOR_H
@@ -117,6 +117,25 @@ public:
      */
     void setBackupBeforeMigrationEnabled(bool enable) noexcept;
 
+    /*!
+     * Returns whether periodic logbook backups are deduplicated and compressed, that is
+     * only the data which has changed since previous backups is stored.
+     *
+     * \return \c true if backups are deduplicated; \c false if each backup is a full
+     *         copy of the logbook
+     */
+    bool isBackupDeduplicationEnabled() const noexcept;
+
+    /*!
+     * Enables or disables deduplicated backups.
+     *
+     * \param enable
+     *        set to \c true if backups are to be deduplicated and compressed;
+     *        set to \c false if each backup is to be a full copy of the logbook
+     * \sa backupDeduplicationChanged
+     */
+    void setBackupDeduplicationEnabled(bool enable) noexcept;
+
     /*!
      * Returns the SkyConnect plugin UUID: an attempt to instantiate and use this plugin
      * is made upon application launch.
@@ -281,6 +300,123 @@ public:
      */
     void setMaximumSimulationRate(int rate) noexcept;
 
+    /*!
+     * Returns whether the sampled data of loaded flights is kept in a compact encoding in
+     * memory, which is only decoded on demand for replay.
+     *
+     * \return \c true if the sampled data of loaded flights is compactly encoded; \c false else
+     */
+    bool isCompactSampleMemoryEnabled() const noexcept;
+
+    /*!
+     * Enables the compact encoding of the sampled data of loaded flights.
+     *
+     * \param enable
+     *        set to \c true in order to compactly encode the sampled data of loaded flights;
+     *        \c false else
+     * \sa compactSampleMemoryChanged
+     */
+    void setCompactSampleMemoryEnabled(bool enable) noexcept;
+
+    // ******************
+    // Recording Settings
+    // ******************
+
+    /*!
+     * Returns whether recordings are incrementally stored into the logbook while
+     * still recording.
+     *
+     * \return \c true if recorded samples are periodically stored into the logbook
+     *         in the background; \c false if the recording is only stored once stopped
+     */
+    bool isIncrementalPersistenceEnabled() const noexcept;
+
+    /*!
+     * Enables the incremental persistence of recordings.
+     *
+     * \param enable
+     *        set to \c true in order to periodically store recorded samples into the
+     *        logbook while recording; \c false else
+     * \sa incrementalPersistenceChanged
+     */
+    void setIncrementalPersistenceEnabled(bool enable) noexcept;
+
+    /*!
+     * Returns the interval at which recorded samples are stored into the logbook,
+     * in case incremental persistence is enabled.
+     *
+     * \return the incremental persistence interval [seconds]
+     * \sa isIncrementalPersistenceEnabled
+     */
+    int getIncrementalPersistenceIntervalSeconds() const noexcept;
+
+    /*!
+     * Sets the interval at which recorded samples are stored into the logbook.
+     *
+     * \param seconds
+     *        the incremental persistence interval [seconds]
+     * \sa incrementalPersistenceChanged
+     */
+    void setIncrementalPersistenceIntervalSeconds(int seconds) noexcept;
+
+    /*!
+     * Returns whether captured samples are adaptively recorded: samples are only kept
+     * when a value leaves a tolerance band around the previously kept sample, or when
+     * the maximum sample interval has expired.
+     *
+     * \return \c true if only changing samples are recorded; \c false if every captured
+     *         sample is recorded
+     * \sa getAdaptiveSamplingMaxIntervalMSec
+     */
+    bool isAdaptiveSamplingEnabled() const noexcept;
+
+    /*!
+     * Enables the adaptive sampling during recording.
+     *
+     * \param enable
+     *        set to \c true in order to only record changing samples; \c false in order
+     *        to record every captured sample
+     * \sa adaptiveSamplingChanged
+     */
+    void setAdaptiveSamplingEnabled(bool enable) noexcept;
+
+    /*!
+     * Returns the maximum time between two recorded samples, in case adaptive sampling
+     * is enabled.
+     *
+     * \return the maximum sample interval [milliseconds]
+     * \sa isAdaptiveSamplingEnabled
+     */
+    int getAdaptiveSamplingMaxIntervalMSec() const noexcept;
+
+    /*!
+     * Sets the maximum time between two recorded samples.
+     *
+     * \param msec
+     *        the maximum sample interval [milliseconds]
+     * \sa adaptiveSamplingChanged
+     */
+    void setAdaptiveSamplingMaxIntervalMSec(int msec) noexcept;
+
+    /*!
+     * Returns the maximum deviation by which the position data of a recorded aircraft
+     * is simplified after it has been stored in the logbook.
+     *
+     * \return the maximum deviation [meters]; 0 if the position data is stored as recorded
+     * \sa TrackSimplification#simplify
+     */
+    double getCompactOnStoreMaxDeviation() const noexcept;
+
+    /*!
+     * Sets the maximum deviation by which the position data of a recorded aircraft is
+     * simplified after it has been stored in the logbook.
+     *
+     * \param maxDeviation
+     *        the maximum deviation [meters]; set to 0 in order to store the position data as recorded
+     * \sa compactOnStoreChanged
+     */
+    void setCompactOnStoreMaxDeviation(double maxDeviation) noexcept;
+
     // ***********************
     // User Interface Settings
     // ***********************
@@ -399,6 +535,40 @@ public:
      */
     void setStyleKey(QString styleKey) noexcept;
 
+    /*!
+     * Returns the rate at which the simulation variables are refreshed in the user interface,
+     * independent of the replay or recording rate.
+     *
+     * \return the user interface refresh rate [Hz]
+     */
+    int getUiRefreshRate() const noexcept;
+
+    /*!
+     * Sets the rate at which the simulation variables are refreshed in the user interface.
+     *
+     * \param refreshRate
+     *        the user interface refresh rate [Hz]
+     * \sa uiRefreshRateChanged
+     */
+    void setUiRefreshRate(int refreshRate) noexcept;
+
+    /*!
+     * Returns whether performance trace events are recorded.
+     *
+     * \return \c true if tracing is enabled; \c false else
+     * \sa Trace
+     */
+    bool isTracingEnabled() const noexcept;
+
+    /*!
+     * Sets whether performance trace events are recorded.
+     *
+     * \param enable
+     *        set to \c true in order to record trace events; \c false else
+     * \sa tracingChanged
+     */
+    void setTracingEnabled(bool enable) noexcept;
+
     /*!
      * Returns whether the flight deletion confirmation is enabled or not.
      *
@@ -625,6 +795,13 @@ signals:
      */
     void backupBeforeMigrationChanged(bool enable);
 
+    /*!
+     * Emitted whenever the backup deduplication option has changed.
+     *
+     * \sa changed
+     */
+    void backupDeduplicationChanged(bool enable);
+
     /*!
      * Emitted wheneverthe SkyConnect plugin UUID has changed.
      *
@@ -723,6 +900,34 @@ signals:
      */
     void maximumSimulationRateChanged(int rate);
 
+    /*!
+     * Emitted whenever the compact sample memory option has changed.
+     *
+     * \sa changed
+     */
+    void compactSampleMemoryChanged(bool enable);
+
+    /*!
+     * Emitted whenever the incremental persistence option or its interval has changed.
+     *
+     * \sa changed
+     */
+    void incrementalPersistenceChanged();
+
+    /*!
+     * Emitted whenever the adaptive sampling option or its maximum sample interval has changed.
+     *
+     * \sa changed
+     */
+    void adaptiveSamplingChanged();
+
+    /*!
+     * Emitted whenever the maximum deviation of the compact on store option has changed.
+     *
+     * \sa changed
+     */
+    void compactOnStoreChanged();
+
     /*!
      * Emitted wheneverthe user interface style key has changed
      *
@@ -730,6 +935,24 @@ signals:
      */
     void styleKeyChanged(const QString &key);
 
+    /*!
+     * Emitted whenever the user interface refresh rate has changed.
+     *
+     * \param refreshRate
+     *        the new user interface refresh rate [Hz]
+     * \sa changed
+     */
+    void uiRefreshRateChanged(int refreshRate);
+
+    /*!
+     * Emitted whenever the tracing option has changed.
+     *
+     * \param enable
+     *        \c true if trace events are recorded; \c false else
+     * \sa changed
+     */
+    void tracingChanged(bool enable);
+
     /*!
      * Emitted wheneverthe default button text visibility for the minimal UI has changed.
      *
@@ -264,6 +264,88 @@ namespace SkyMath
         return interpolateHermite180(y0 - T(180), y1 - T(180), y2 - T(180), y3 - T(180), mu, tension, bias) + T(180);
     }
 
+    /*!
+     * Interpolates between \p y1 and \p y2 and the support values \p y0 and
+     * \p y3 using Hermite (cubic) interpolation, taking the timestamps \p t0,
+     * \p t1, \p t2 and \p t3 of the (possibly non-uniformly spaced) values
+     * into account: the tangents are scaled by the ratio of the adjacent time
+     * intervals.
+     *
+     * For uniformly spaced values the result is the same as with #interpolateHermite
+     * (with default tension and bias); for sparse or irregularly spaced values (e.g.
+     * simplified tracks) overshooting is avoided.
+     *
+     * \param y0
+     *        first support value
+     * \param y1
+     *        first interpolation value
+     * \param y2
+     *        second interpolation value
+     * \param y3
+     *        second support value
+     * \param t0
+     *        the timestamp of \p y0
+     * \param t1
+     *        the timestamp of \p y1
+     * \param t2
+     *        the timestamp of \p y2
+     * \param t3
+     *        the timestamp of \p y3
+     * \param mu
+     *        interpolation factor in [0.0, 1.0]
+     * \sa #interpolateHermite
+     */
+    template <typename T>
+    constexpr T interpolateTimedHermite(
+        T y0, T y1, T y2, T y3,
+        std::int64_t t0, std::int64_t t1, std::int64_t t2, std::int64_t t3,
+        T mu) noexcept
+    {
+        const auto dt = t2 - t1;
+        const T s0 = t1 - t0 > 0 ? T(dt) / T(t1 - t0) : T(0);
+        const T s1 = t3 - t2 > 0 ? T(dt) / T(t3 - t2) : T(0);
+        const T m0 = ((y1 - y0) * s0 + (y2 - y1)) / T(2);
+        const T m1 = ((y2 - y1) + (y3 - y2) * s1) / T(2);
+
+        const T mu2 = mu * mu;
+        const T mu3 = mu2 * mu;
+        const T a0 =  T(2) * mu3 - T(3) * mu2 + T(1);
+        const T a1 =         mu3 - T(2) * mu2 + mu;
+        const T a2 =         mu3 -        mu2;
+        const T a3 = -T(2) * mu3 + T(3) * mu2;
+
+        return (a0 * y1 + a1 * m0 + a2 * m1 + a3 * y2);
+    }
+
+    /*!
+     * Interpolates circular values in a range of [-180, 180[ using Hermite
+     * (cubic) interpolation, taking the timestamps of the values into account.
+     *
+     * \sa #interpolateTimedHermite
+     */
+    template <typename T>
+    constexpr T interpolateTimedHermite180(
+        T y0, T y1, T y2, T y3,
+        std::int64_t t0, std::int64_t t1, std::int64_t t2, std::int64_t t3,
+        T mu) noexcept
+    {
+        T y0n, y1n, y2n, y3n;
+
+        // Normalise sample points y0, y1, y2 and y3
+        y0n = y0;
+        y1n = normalise180(y0, y1);
+        y2n = normalise180(y1n, y2);
+        y3n = normalise180(y2n, y3);
+
+        T v = interpolateTimedHermite(y0n, y1n, y2n, y3n, t0, t1, t2, t3, mu);
+        if (v < - T(180)) {
+           v += T(360);
+        } else if (v >= T(180)) {
+           v -= T(360);
+        }
+        return v;
+    }
+
     /*!
      * Interpolates between \p p1 and \p p2 using linear interpolation.
      *
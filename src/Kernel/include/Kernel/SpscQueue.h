@@ -0,0 +1,157 @@
+/**
+ * Sky Dolly - The Black Sheep for Your Flight Recordings
+ *
+ * Copyright (c) 2020 - 2025 Oliver Knoll
+ *
+ * MIT License
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this
+ * software and associated documentation files (the "Software"), to deal in the Software
+ * without restriction, including without limitation the rights to use, copy, modify, merge,
+ * publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons
+ * to whom the Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or
+ * substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED *AS IS*, WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR
+ * PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE
+ * FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+ * OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ */
+#ifndef SPSCQUEUE_H
+#define SPSCQUEUE_H
+
+#include <algorithm>
+#include <memory>
+#include <atomic>
+#include <bit>
+#include <utility>
+#include <cstddef>
+
+/*!
+ * A bounded, lock-free single-producer/single-consumer (SPSC) ring buffer.
+ *
+ * Exactly one thread may push elements and exactly one (possibly other) thread may pop them;
+ * neither side ever blocks. When the queue is full #tryPush fails and the caller decides
+ * how to handle the overflow.
+ *
+ * The capacity is rounded up to the next power of two.
+ */
+template <typename T>
+class SpscQueue
+{
+public:
+    explicit SpscQueue(std::size_t capacity)
+        : m_capacity(std::bit_ceil(std::max(capacity, std::size_t(2)))),
+          m_mask(m_capacity - 1),
+          m_buffer(std::make_unique<T[]>(m_capacity))
+    {}
+
+    SpscQueue(const SpscQueue &rhs) = delete;
+    SpscQueue(SpscQueue &&rhs) = delete;
+    SpscQueue &operator=(const SpscQueue &rhs) = delete;
+    SpscQueue &operator=(SpscQueue &&rhs) = delete;
+    ~SpscQueue() = default;
+
+    /*!
+     * Appends a copy of \p value at the end of the queue. To be called by the producer only.
+     *
+     * \param value
+     *        the value to be enqueued
+     * \return \c true if the value has been enqueued; \c false if the queue is full
+     */
+    bool tryPush(const T &value) noexcept
+    {
+        const auto head = m_head.load(std::memory_order_relaxed);
+        if (head - m_cachedTail == m_capacity) {
+            m_cachedTail = m_tail.load(std::memory_order_acquire);
+            if (head - m_cachedTail == m_capacity) {
+                return false;
+            }
+        }
+        m_buffer[head & m_mask] = value;
+        m_head.store(head + 1, std::memory_order_release);
+        return true;
+    }
+
+    /*!
+     * Removes the first element of the queue and moves it into \p value. To be called by the
+     * consumer only.
+     *
+     * \param value
+     *        receives the dequeued value
+     * \return \c true if a value has been dequeued; \c false if the queue is empty
+     */
+    bool tryPop(T &value) noexcept
+    {
+        const auto tail = m_tail.load(std::memory_order_relaxed);
+        if (tail == m_cachedHead) {
+            m_cachedHead = m_head.load(std::memory_order_acquire);
+            if (tail == m_cachedHead) {
+                return false;
+            }
+        }
+        value = std::move(m_buffer[tail & m_mask]);
+        m_tail.store(tail + 1, std::memory_order_release);
+        return true;
+    }
+
+    /*!
+     * Removes all currently available elements, in order, and passes each of them to \p consumer.
+     * To be called by the consumer only.
+     *
+     * \param consumer
+     *        the function which is called for each dequeued element
+     * \return the number of dequeued elements
+     */
+    template <typename Consumer>
+    std::size_t consumeAll(Consumer &&consumer) noexcept
+    {
+        const auto tail = m_tail.load(std::memory_order_relaxed);
+        const auto head = m_head.load(std::memory_order_acquire);
+        m_cachedHead = head;
+        for (auto i = tail; i != head; ++i) {
+            consumer(m_buffer[i & m_mask]);
+        }
+        m_tail.store(head, std::memory_order_release);
+        return head - tail;
+    }
+
+    /*!
+     * Returns the number of enqueued elements. The value is only a snapshot when called
+     * concurrently with the producer or consumer.
+     *
+     * \return the number of elements in the queue
+     */
+    std::size_t size() const noexcept
+    {
+        return m_head.load(std::memory_order_acquire) - m_tail.load(std::memory_order_acquire);
+    }
+
+    std::size_t capacity() const noexcept
+    {
+        return m_capacity;
+    }
+
+private:
+    // Avoid false sharing between the producer and consumer indices
+    static constexpr std::size_t CacheLineSize = 64;
+
+    const std::size_t m_capacity;
+    const std::size_t m_mask;
+    const std::unique_ptr<T[]> m_buffer;
+
+    // Written by the producer only; monotonically increasing
+    alignas(CacheLineSize) std::atomic<std::size_t> m_head {0};
+    // The consumer index, as last seen by the producer
+    std::size_t m_cachedTail {0};
+    // Written by the consumer only; monotonically increasing
+    alignas(CacheLineSize) std::atomic<std::size_t> m_tail {0};
+    // The producer index, as last seen by the consumer
+    std::size_t m_cachedHead {0};
+};
+
+#endif // SPSCQUEUE_H
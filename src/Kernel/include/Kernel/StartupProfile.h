@@ -0,0 +1,112 @@
+/**
+ * Sky Dolly - The Black Sheep for Your Flight Recordings
+ *
+ * Copyright (c) 2020 - 2025 Oliver Knoll
+ *
+ * MIT License
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this
+ * software and associated documentation files (the "Software"), to deal in the Software
+ * without restriction, including without limitation the rights to use, copy, modify, merge,
+ * publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons
+ * to whom the Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or
+ * substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED *AS IS*, WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR
+ * PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE
+ * FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+ * OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ */
+#ifndef STARTUPPROFILE_H
+#define STARTUPPROFILE_H
+
+#include <vector>
+#include <cstdint>
+
+#include "KernelLib.h"
+
+/*!
+ * Measures the time spent in the phases of the application start, from the start of the
+ * application (#start) until the main window has been painted for the first time (#finish).
+ *
+ * Phases are measured with the RAII Phase; phases may be nested (e.g. the logbook migration
+ * is part of connecting with the logbook), and phases which complete after the first paint
+ * (e.g. deferred initialisation) are recorded as well.
+ *
+ * The profile is only meant to be recorded by the main thread.
+ */
+class KERNEL_API StartupProfile final
+{
+public:
+    struct PhaseTime
+    {
+        // A string literal
+        const char *name {nullptr};
+        // Relative to the start of the application [microseconds]
+        std::int64_t start {0};
+        // [microseconds]
+        std::int64_t duration {0};
+    };
+
+    /*!
+     * Measures the time spent in the scope of a phase.
+     */
+    class KERNEL_API Phase final
+    {
+    public:
+        /*!
+         * Begins the phase \p name.
+         *
+         * \param name
+         *        the name of the phase; must be a string literal
+         */
+        explicit Phase(const char *name) noexcept;
+        Phase(const Phase &rhs) = delete;
+        Phase(Phase &&rhs) = delete;
+        Phase &operator=(const Phase &rhs) = delete;
+        Phase &operator=(Phase &&rhs) = delete;
+        ~Phase();
+
+    private:
+        const char *m_name;
+        std::int64_t m_start;
+    };
+
+    /*!
+     * Marks the start of the application; to be called first thing in \c main.
+     */
+    static void start() noexcept;
+
+    /*!
+     * Marks the first paint of the main window. Only the first call has an effect.
+     */
+    static void finish() noexcept;
+
+    /*!
+     * Returns whether the first paint of the main window has been marked.
+     *
+     * \return \c true if #finish has been called; \c false else
+     */
+    static bool isFinished() noexcept;
+
+    /*!
+     * Returns the time from the start of the application until the first paint of the
+     * main window.
+     *
+     * \return the startup time [microseconds]; 0 if not yet finished
+     */
+    static std::int64_t getStartupTime() noexcept;
+
+    /*!
+     * Returns the recorded phases, in the order of their completion.
+     *
+     * \return the recorded phases
+     */
+    static std::vector<PhaseTime> getPhases() noexcept;
+};
+
+#endif // STARTUPPROFILE_H
@@ -0,0 +1,172 @@
+/**
+ * Sky Dolly - The Black Sheep for Your Flight Recordings
+ *
+ * Copyright (c) 2020 - 2025 Oliver Knoll
+ *
+ * MIT License
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this
+ * software and associated documentation files (the "Software"), to deal in the Software
+ * without restriction, including without limitation the rights to use, copy, modify, merge,
+ * publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons
+ * to whom the Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or
+ * substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED *AS IS*, WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR
+ * PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE
+ * FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+ * OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ */
+#ifndef TRACE_H
+#define TRACE_H
+
+#include <vector>
+#include <cstdint>
+#include <cstddef>
+
+class QIODevice;
+
+#include "KernelLib.h"
+
+/*!
+ * A low-overhead tracing facility which records scoped timings, instant events and counters,
+ * for diagnosing stalls after the fact.
+ *
+ * Tracing is always compiled in but disabled by default; while disabled each trace point costs
+ * a single relaxed atomic load. While enabled each thread records its events into its own
+ * lock-free buffer (no locking on the recording path), which is periodically collected into a
+ * bounded history of the most recent events. The history can be exported in the Chrome trace
+ * event format (JSON), which can be opened with chrome://tracing or https://ui.perfetto.dev.
+ *
+ * Names and categories must be string literals (or otherwise outlive the trace), as only the
+ * pointers are recorded.
+ */
+class KERNEL_API Trace final
+{
+public:
+    enum struct Type: std::uint8_t
+    {
+        // A duration
+        Complete,
+        // A point in time
+        Instant,
+        // A value at a point in time
+        Counter
+    };
+
+    struct Event
+    {
+        const char *category {nullptr};
+        const char *name {nullptr};
+        // Relative to the trace epoch [microseconds]
+        std::int64_t timestamp {0};
+        // Complete events only [microseconds]
+        std::int64_t duration {0};
+        // Counter events only
+        std::int64_t value {0};
+        std::uint32_t threadId {0};
+        Type type {Type::Complete};
+    };
+
+    static constexpr const char *Replay {"Replay"};
+    static constexpr const char *Recording {"Recording"};
+    static constexpr const char *Persistence {"Persistence"};
+    static constexpr const char *Migration {"Migration"};
+    static constexpr const char *Import {"Import"};
+    static constexpr const char *Export {"Export"};
+    static constexpr const char *UserInterface {"UserInterface"};
+
+    /*!
+     * Measures the time spent in a scope and records it as a complete event, provided that
+     * tracing is enabled when the scope is entered.
+     */
+    class KERNEL_API Scope final
+    {
+    public:
+        Scope(const char *category, const char *name) noexcept;
+        Scope(const Scope &rhs) = delete;
+        Scope(Scope &&rhs) = delete;
+        Scope &operator=(const Scope &rhs) = delete;
+        Scope &operator=(Scope &&rhs) = delete;
+        ~Scope();
+
+    private:
+        const char *m_category;
+        const char *m_name;
+        // Negative if tracing was disabled when the scope was entered
+        std::int64_t m_start;
+    };
+
+    /*!
+     * Returns whether events are recorded.
+     *
+     * \return \c true if tracing is enabled; \c false else
+     */
+    static bool isEnabled() noexcept;
+
+    /*!
+     * Enables or disables the recording of events. Already recorded events are kept.
+     *
+     * \param enable
+     *        set to \c true in order to record events; \c false else
+     */
+    static void setEnabled(bool enable) noexcept;
+
+    /*!
+     * Returns the current trace time.
+     *
+     * \return the time since the trace epoch [microseconds]
+     */
+    static std::int64_t now() noexcept;
+
+    /*!
+     * Records a complete event \p name which started at \p start and lasted for \p duration.
+     */
+    static void complete(const char *category, const char *name, std::int64_t start, std::int64_t duration) noexcept;
+
+    /*!
+     * Records an instant event \p name at the current trace time.
+     */
+    static void instant(const char *category, const char *name) noexcept;
+
+    /*!
+     * Records the \p value of the counter \p name at the current trace time.
+     */
+    static void counter(const char *category, const char *name, std::int64_t value) noexcept;
+
+    /*!
+     * Collects the events which have been recorded by all threads so far and returns the
+     * history of the most recent events.
+     *
+     * \return the recorded events, per thread in the order of their completion
+     */
+    static std::vector<Event> getEvents() noexcept;
+
+    /*!
+     * Returns the number of events which have been dropped because the buffer of the
+     * recording thread was full.
+     *
+     * \return the number of dropped events
+     */
+    static std::size_t getDroppedEventCount() noexcept;
+
+    /*!
+     * Discards all recorded events.
+     */
+    static void clear() noexcept;
+
+    /*!
+     * Exports the recorded events to \p io in the Chrome trace event format (JSON).
+     *
+     * \param io
+     *        the opened device to which the events are written
+     * \return \c true on success; \c false else
+     */
+    static bool exportChromeTrace(QIODevice &io) noexcept;
+};
+
+#endif // TRACE_H
@@ -0,0 +1,111 @@
+/**
+ * Sky Dolly - The Black Sheep for Your Flight Recordings
+ *
+ * Copyright (c) 2020 - 2025 Oliver Knoll
+ *
+ * MIT License
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this
+ * software and associated documentation files (the "Software"), to deal in the Software
+ * without restriction, including without limitation the rights to use, copy, modify, merge,
+ * publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons
+ * to whom the Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or
+ * substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED *AS IS*, WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR
+ * PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE
+ * FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+ * OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ */
+#include <algorithm>
+#include <limits>
+#include <cmath>
+#include <cstdint>
+#include <cstddef>
+
+#include "Histogram.h"
+
+// PUBLIC
+
+Histogram::Histogram(double bucketWidth, std::size_t bucketCount) noexcept
+    : m_buckets(std::max(bucketCount, std::size_t(1)), 0),
+      m_bucketWidth(bucketWidth > 0.0 ? bucketWidth : 1.0)
+{}
+
+void Histogram::add(double value) noexcept
+{
+    const auto lastIndex = m_buckets.size() - 1;
+    std::size_t index {0};
+    if (value > 0.0) {
+        const auto bucket = std::floor(value / m_bucketWidth);
+        index = bucket < static_cast<double>(lastIndex) ? static_cast<std::size_t>(bucket) : lastIndex;
+    }
+    ++m_buckets[index];
+    ++m_count;
+    m_sum += value;
+    m_minimum = std::min(m_minimum, value);
+    m_maximum = std::max(m_maximum, value);
+}
+
+void Histogram::clear() noexcept
+{
+    std::fill(m_buckets.begin(), m_buckets.end(), 0);
+    m_count = 0;
+    m_sum = 0.0;
+    m_minimum = std::numeric_limits<double>::max();
+    m_maximum = std::numeric_limits<double>::lowest();
+}
+
+std::uint64_t Histogram::getCount() const noexcept
+{
+    return m_count;
+}
+
+double Histogram::getMinimum() const noexcept
+{
+    return m_count > 0 ? m_minimum : 0.0;
+}
+
+double Histogram::getMaximum() const noexcept
+{
+    return m_count > 0 ? m_maximum : 0.0;
+}
+
+double Histogram::getMean() const noexcept
+{
+    return m_count > 0 ? m_sum / static_cast<double>(m_count) : 0.0;
+}
+
+double Histogram::getPercentile(double percentile) const noexcept
+{
+    double value {0.0};
+    if (m_count > 0) {
+        const auto rank = static_cast<std::uint64_t>(std::ceil(std::clamp(percentile, 0.0, 100.0) / 100.0 * static_cast<double>(m_count)));
+        const auto target = std::max(rank, std::uint64_t(1));
+        std::uint64_t cumulative {0};
+        std::size_t index {0};
+        while (index < m_buckets.size()) {
+            cumulative += m_buckets[index];
+            if (cumulative >= target) {
+                break;
+            }
+            ++index;
+        }
+        value = std::min(static_cast<double>(index + 1) * m_bucketWidth, m_maximum);
+    }
+    return value;
+}
+
+double Histogram::getBucketWidth() const noexcept
+{
+    return m_bucketWidth;
+}
+
+const std::vector<std::uint64_t> &Histogram::getBuckets() const noexcept
+{
+    return m_buckets;
+}
@@ -21,6 +21,7 @@
  * OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
  * DEALINGS IN THE SOFTWARE.
  */
+#include <algorithm>
 #include <mutex>
 #include <utility>
 
@@ -63,6 +64,7 @@ struct SettingsPrivate
 
     QString logbookPath;
     bool backupBeforeMigration {DefaultBackupBeforeMigration};
+    bool backupDeduplication {DefaultBackupDeduplication};
     QUuid skyConnectPluginUuid;
     bool windowStayOnTop {DefaultWindowStayOnTop};
     bool minimalUi {DefaultMinimalUi};
@@ -83,8 +85,18 @@ struct SettingsPrivate
     bool repeatCanopyOpen {DefaultRepeatCanopyOpen};
     int maximumSimulationRate {DefaultMaximumSimulationRate};
     Replay::TimeMode replayTimeMode {DefaultReplayTimeMode};
+    bool compactSampleMemory {DefaultCompactSampleMemory};
+
+    // Recording options
+    bool incrementalPersistence {DefaultIncrementalPersistence};
+    int incrementalPersistenceIntervalSeconds {DefaultIncrementalPersistenceIntervalSeconds};
+    bool adaptiveSampling {DefaultAdaptiveSampling};
+    int adaptiveSamplingMaxIntervalMSec {DefaultAdaptiveSamplingMaxIntervalMSec};
+    double compactOnStoreMaxDeviation {DefaultCompactOnStoreMaxDeviation};
 
     QString styleKey {Settings::DefaultStyleKey};
+    int uiRefreshRate {DefaultUiRefreshRate};
+    bool tracing {DefaultTracing};
 
     bool deleteFlightConfirmation {DefaultDeleteFlightConfirmation};
     bool deleteAircraftConfirmation {DefaultDeleteAircraftConfirmation};
@@ -104,6 +116,7 @@ struct SettingsPrivate
 
     static constexpr QUuid DefaultSkyConnectPluginUuid {};
     static constexpr bool DefaultBackupBeforeMigration {true};
+    static constexpr bool DefaultBackupDeduplication {true};
     static constexpr bool DefaultWindowStayOnTop {false};
     static constexpr bool DefaultMinimalUi {false};
     static constexpr bool DefaultModuleSelectorVisible {true};
@@ -114,6 +127,7 @@ struct SettingsPrivate
     static constexpr bool DefaultReplayLoop {false};
     static constexpr Replay::SpeedUnit DefaultReplaySpeedUnit {Replay::SpeedUnit::Absolute};
     static constexpr Replay::TimeMode DefaultReplayTimeMode {Replay::TimeMode::SimulationTime};
+    static constexpr bool DefaultCompactSampleMemory {false};
 
     // The T-45 Goshawk properly reacts to the CANOPY_OPEN simulation variable; so there is at least
     // one well-behaving aircraft (the Fiat "Gina" G-91 still needs this option set though)
@@ -123,6 +137,17 @@ struct SettingsPrivate
     // Also refer to: https://docs.flightsimulator.com/html/Programming_Tools/Programming_APIs.htm#SIMULATION%20RATE
     static constexpr int DefaultMaximumSimulationRate {8};    
 
+    static constexpr bool DefaultIncrementalPersistence {false};
+    static constexpr int DefaultIncrementalPersistenceIntervalSeconds {10};
+    static constexpr bool DefaultAdaptiveSampling {true};
+    static constexpr int DefaultAdaptiveSamplingMaxIntervalMSec {1000};
+    static constexpr double DefaultCompactOnStoreMaxDeviation {0.0};
+
+    static constexpr int DefaultUiRefreshRate {10};
+    static constexpr int MinUiRefreshRate {1};
+    static constexpr int MaxUiRefreshRate {60};
+    static constexpr bool DefaultTracing {false};
+
     static constexpr bool DefaultDeleteFlightConfirmation {true};
     static constexpr bool DefaultDeleteAircraftConfirmation {true};
     static constexpr bool DefaultDeleteLocationConfirmation {true};
@@ -191,6 +216,19 @@ void Settings::setBackupBeforeMigrationEnabled(bool enable) noexcept
     }
 }
 
+bool Settings::isBackupDeduplicationEnabled() const noexcept
+{
+    return d->backupDeduplication;
+}
+
+void Settings::setBackupDeduplicationEnabled(bool enable) noexcept
+{
+    if (d->backupDeduplication != enable) {
+        d->backupDeduplication = enable;
+        emit backupDeduplicationChanged(d->backupDeduplication);
+    }
+}
+
 QUuid Settings::getSkyConnectPluginUuid() const noexcept
 {
     return d->skyConnectPluginUuid;
@@ -317,6 +355,88 @@ void Settings::setMaximumSimulationRate(int rate) noexcept
     }
 }
 
+bool Settings::isCompactSampleMemoryEnabled() const noexcept
+{
+    return d->compactSampleMemory;
+}
+
+void Settings::setCompactSampleMemoryEnabled(bool enable) noexcept
+{
+    if (d->compactSampleMemory != enable) {
+        d->compactSampleMemory = enable;
+        emit compactSampleMemoryChanged(d->compactSampleMemory);
+    }
+}
+
+// ******************
+// Recording Settings
+// ******************
+
+bool Settings::isIncrementalPersistenceEnabled() const noexcept
+{
+    return d->incrementalPersistence;
+}
+
+void Settings::setIncrementalPersistenceEnabled(bool enable) noexcept
+{
+    if (d->incrementalPersistence != enable) {
+        d->incrementalPersistence = enable;
+        emit incrementalPersistenceChanged();
+    }
+}
+
+int Settings::getIncrementalPersistenceIntervalSeconds() const noexcept
+{
+    return d->incrementalPersistenceIntervalSeconds;
+}
+
+void Settings::setIncrementalPersistenceIntervalSeconds(int seconds) noexcept
+{
+    if (d->incrementalPersistenceIntervalSeconds != seconds) {
+        d->incrementalPersistenceIntervalSeconds = seconds;
+        emit incrementalPersistenceChanged();
+    }
+}
+
+bool Settings::isAdaptiveSamplingEnabled() const noexcept
+{
+    return d->adaptiveSampling;
+}
+
+void Settings::setAdaptiveSamplingEnabled(bool enable) noexcept
+{
+    if (d->adaptiveSampling != enable) {
+        d->adaptiveSampling = enable;
+        emit adaptiveSamplingChanged();
+    }
+}
+
+int Settings::getAdaptiveSamplingMaxIntervalMSec() const noexcept
+{
+    return d->adaptiveSamplingMaxIntervalMSec;
+}
+
+void Settings::setAdaptiveSamplingMaxIntervalMSec(int msec) noexcept
+{
+    if (d->adaptiveSamplingMaxIntervalMSec != msec) {
+        d->adaptiveSamplingMaxIntervalMSec = msec;
+        emit adaptiveSamplingChanged();
+    }
+}
+
+double Settings::getCompactOnStoreMaxDeviation() const noexcept
+{
+    return d->compactOnStoreMaxDeviation;
+}
+
+void Settings::setCompactOnStoreMaxDeviation(double maxDeviation) noexcept
+{
+    if (d->compactOnStoreMaxDeviation != maxDeviation) {
+        d->compactOnStoreMaxDeviation = maxDeviation;
+        emit compactOnStoreChanged();
+    }
+}
+
 // ***********************
 // User Interface Settings
 // ***********************
@@ -406,6 +526,33 @@ void Settings::setStyleKey(QString styleKey) noexcept
     }
 }
 
+int Settings::getUiRefreshRate() const noexcept
+{
+    return d->uiRefreshRate;
+}
+
+void Settings::setUiRefreshRate(int refreshRate) noexcept
+{
+    const int rate = std::clamp(refreshRate, SettingsPrivate::MinUiRefreshRate, SettingsPrivate::MaxUiRefreshRate);
+    if (d->uiRefreshRate != rate) {
+        d->uiRefreshRate = rate;
+        emit uiRefreshRateChanged(d->uiRefreshRate);
+    }
+}
+
+bool Settings::isTracingEnabled() const noexcept
+{
+    return d->tracing;
+}
+
+void Settings::setTracingEnabled(bool enable) noexcept
+{
+    if (d->tracing != enable) {
+        d->tracing = enable;
+        emit tracingChanged(d->tracing);
+    }
+}
+
 bool Settings::isDeleteFlightConfirmationEnabled() const noexcept
 {
     return d->deleteFlightConfirmation;
@@ -595,6 +742,7 @@ void Settings::store() const noexcept
     {
         d->settings.setValue("Path", d->logbookPath);
         d->settings.setValue("BackupBeforeMigration", d->backupBeforeMigration);
+        d->settings.setValue("BackupDeduplication", d->backupDeduplication);
     }
     d->settings.endGroup();
     d->settings.beginGroup("Plugins");
@@ -612,12 +760,23 @@ void Settings::store() const noexcept
         d->settings.setValue("RepeatCanopyOpen", d->repeatCanopyOpen);
         d->settings.setValue("MaximumSimulationRate", d->maximumSimulationRate);
         d->settings.setValue("ReplayTimeMode", Enum::underly(d->replayTimeMode));
+        d->settings.setValue("CompactSampleMemory", d->compactSampleMemory);
+    }
+    d->settings.endGroup();
+    d->settings.beginGroup("Recording");
+    {
+        d->settings.setValue("IncrementalPersistence", d->incrementalPersistence);
+        d->settings.setValue("IncrementalPersistenceIntervalSeconds", d->incrementalPersistenceIntervalSeconds);
+        d->settings.setValue("AdaptiveSampling", d->adaptiveSampling);
+        d->settings.setValue("AdaptiveSamplingMaxIntervalMSec", d->adaptiveSamplingMaxIntervalMSec);
+        d->settings.setValue("CompactOnStoreMaxDeviation", d->compactOnStoreMaxDeviation);
     }
     d->settings.endGroup();
     d->settings.beginGroup("UI");
     {
         // UI styles
         d->settings.setValue("StyleKey", d->styleKey);
+        d->settings.setValue("UiRefreshRate", d->uiRefreshRate);
 
         // Confirmations
         d->settings.setValue("DeleteFlightConfirmation", d->deleteFlightConfirmation);
@@ -655,6 +814,11 @@ void Settings::store() const noexcept
         d->settings.setValue("AircraftType", d->importAircraftType);
     }
     d->settings.endGroup();
+    d->settings.beginGroup("Diagnostics");
+    {
+        d->settings.setValue("Tracing", d->tracing);
+    }
+    d->settings.endGroup();
     d->settings.beginGroup("_Preview");
     {
         d->settings.setValue("PreviewInfoDialogCount", d->previewInfoDialogCount);
@@ -683,6 +847,7 @@ void Settings::restore() noexcept
     {
         d->logbookPath = d->settings.value("Path", d->defaultLogbookPath).toString();
         d->backupBeforeMigration = d->settings.value("BackupBeforeMigration", SettingsPrivate::DefaultBackupBeforeMigration).toBool();
+        d->backupDeduplication = d->settings.value("BackupDeduplication", SettingsPrivate::DefaultBackupDeduplication).toBool();
     }
     d->settings.endGroup();
     d->settings.beginGroup("Plugins");
@@ -713,6 +878,7 @@ void Settings::restore() noexcept
         enumValue = d->settings.value("ReplayTimeMode", Enum::underly(SettingsPrivate::DefaultReplayTimeMode)).toInt(&ok);
         d->replayTimeMode = ok && Enum::contains<Replay::TimeMode>(enumValue) ? static_cast<Replay::TimeMode>(enumValue) : SettingsPrivate::DefaultReplayTimeMode;
         d->repeatCanopyOpen = d->settings.value("RepeatCanopyOpen", SettingsPrivate::DefaultRepeatCanopyOpen).toBool();
+        d->compactSampleMemory = d->settings.value("CompactSampleMemory", SettingsPrivate::DefaultCompactSampleMemory).toBool();
         int maximumSimulationRateValue = d->settings.value("MaximumSimulationRate", SettingsPrivate::DefaultMaximumSimulationRate).toInt(&ok);
         if (ok) {
             d->maximumSimulationRate = maximumSimulationRateValue;
@@ -724,10 +890,52 @@ void Settings::restore() noexcept
         }
     }
     d->settings.endGroup();
+    d->settings.beginGroup("Recording");
+    {
+        d->incrementalPersistence = d->settings.value("IncrementalPersistence", SettingsPrivate::DefaultIncrementalPersistence).toBool();
+        int intervalSeconds = d->settings.value("IncrementalPersistenceIntervalSeconds", SettingsPrivate::DefaultIncrementalPersistenceIntervalSeconds).toInt(&ok);
+        if (ok && intervalSeconds > 0) {
+            d->incrementalPersistenceIntervalSeconds = intervalSeconds;
+        } else {
+#ifdef DEBUG
+            qWarning() << "The incremental persistence interval in the settings could not be parsed, so setting value to default value:" << SettingsPrivate::DefaultIncrementalPersistenceIntervalSeconds;
+#endif
+            d->incrementalPersistenceIntervalSeconds = SettingsPrivate::DefaultIncrementalPersistenceIntervalSeconds;
+        }
+        d->adaptiveSampling = d->settings.value("AdaptiveSampling", SettingsPrivate::DefaultAdaptiveSampling).toBool();
+        int maxIntervalMSec = d->settings.value("AdaptiveSamplingMaxIntervalMSec", SettingsPrivate::DefaultAdaptiveSamplingMaxIntervalMSec).toInt(&ok);
+        if (ok && maxIntervalMSec > 0) {
+            d->adaptiveSamplingMaxIntervalMSec = maxIntervalMSec;
+        } else {
+#ifdef DEBUG
+            qWarning() << "The adaptive sampling maximum interval in the settings could not be parsed, so setting value to default value:" << SettingsPrivate::DefaultAdaptiveSamplingMaxIntervalMSec;
+#endif
+            d->adaptiveSamplingMaxIntervalMSec = SettingsPrivate::DefaultAdaptiveSamplingMaxIntervalMSec;
+        }
+        double maxDeviation = d->settings.value("CompactOnStoreMaxDeviation", SettingsPrivate::DefaultCompactOnStoreMaxDeviation).toDouble(&ok);
+        if (ok && maxDeviation >= 0.0) {
+            d->compactOnStoreMaxDeviation = maxDeviation;
+        } else {
+#ifdef DEBUG
+            qWarning() << "The compact on store maximum deviation in the settings could not be parsed, so setting value to default value:" << SettingsPrivate::DefaultCompactOnStoreMaxDeviation;
+#endif
+            d->compactOnStoreMaxDeviation = SettingsPrivate::DefaultCompactOnStoreMaxDeviation;
+        }
+    }
+    d->settings.endGroup();
     d->settings.beginGroup("UI");
     {
         // UI styles
         d->styleKey = d->settings.value("StyleKey", DefaultStyleKey).toString();
+        const int uiRefreshRate = d->settings.value("UiRefreshRate", SettingsPrivate::DefaultUiRefreshRate).toInt(&ok);
+        if (ok && uiRefreshRate >= SettingsPrivate::MinUiRefreshRate && uiRefreshRate <= SettingsPrivate::MaxUiRefreshRate) {
+            d->uiRefreshRate = uiRefreshRate;
+        } else {
+#ifdef DEBUG
+            qWarning() << "The user interface refresh rate in the settings could not be parsed, so setting value to default value:" << SettingsPrivate::DefaultUiRefreshRate;
+#endif
+            d->uiRefreshRate = SettingsPrivate::DefaultUiRefreshRate;
+        }
 
         // Confirmations
         d->deleteFlightConfirmation = d->settings.value("DeleteFlightConfirmation", SettingsPrivate::DefaultDeleteFlightConfirmation).toBool();
@@ -764,6 +972,11 @@ void Settings::restore() noexcept
         d->importAircraftType = d->settings.value("AircraftType", SettingsPrivate::DefaultImportAircraftType).toString();
     }
     d->settings.endGroup();
+    d->settings.beginGroup("Diagnostics");
+    {
+        d->tracing = d->settings.value("Tracing", SettingsPrivate::DefaultTracing).toBool();
+    }
+    d->settings.endGroup();
     d->settings.beginGroup("_Preview");
     {
         d->previewInfoDialogCount = d->settings.value("PreviewInfoDialogCount", SettingsPrivate::DefaultPreviewInfoDialogCount + SettingsPrivate::PreviewInfoDialogBase).toInt(&ok);
@@ -800,6 +1013,8 @@ void Settings::frenchConnection() noexcept
             this, &Settings::changed);
     connect(this, &Settings::backupBeforeMigrationChanged,
             this, &Settings::changed);
+    connect(this, &Settings::backupDeduplicationChanged,
+            this, &Settings::changed);
     connect(this, &Settings::skyConnectPluginUuidChanged,
             this, &Settings::changed);
     connect(this, &Settings::stayOnTopChanged,
@@ -828,8 +1043,20 @@ void Settings::frenchConnection() noexcept
             this, &Settings::changed);
     connect(this, &Settings::maximumSimulationRateChanged,
             this, &Settings::changed);
+    connect(this, &Settings::compactSampleMemoryChanged,
+            this, &Settings::changed);
+    connect(this, &Settings::incrementalPersistenceChanged,
+            this, &Settings::changed);
+    connect(this, &Settings::adaptiveSamplingChanged,
+            this, &Settings::changed);
+    connect(this, &Settings::compactOnStoreChanged,
+            this, &Settings::changed);
     connect(this, &Settings::styleKeyChanged,
             this, &Settings::changed);
+    connect(this, &Settings::uiRefreshRateChanged,
+            this, &Settings::changed);
+    connect(this, &Settings::tracingChanged,
+            this, &Settings::changed);
     connect(this, &Settings::defaultMinimalUiButtonTextVisibilityChanged,
             this, &Settings::changed);
     connect(this, &Settings::defaultMinimalUiNonEssentialButtonVisibilityChanged,
@@ -0,0 +1,96 @@
+/**
+ * Sky Dolly - The Black Sheep for Your Flight Recordings
+ *
+ * Copyright (c) 2020 - 2025 Oliver Knoll
+ *
+ * MIT License
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this
+ * software and associated documentation files (the "Software"), to deal in the Software
+ * without restriction, including without limitation the rights to use, copy, modify, merge,
+ * publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons
+ * to whom the Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or
+ * substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED *AS IS*, WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR
+ * PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE
+ * FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+ * OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ */
+#include <vector>
+#include <chrono>
+#include <cstdint>
+
+#ifdef DEBUG
+#include <QDebug>
+#endif
+
+#include "StartupProfile.h"
+
+namespace
+{
+    using Clock = std::chrono::steady_clock;
+
+    Clock::time_point startTime {Clock::now()};
+    std::int64_t startupTime {0};
+    bool finished {false};
+    std::vector<StartupProfile::PhaseTime> phases;
+
+    inline std::int64_t getElapsedTime() noexcept
+    {
+        return std::chrono::duration_cast<std::chrono::microseconds>(Clock::now() - ::startTime).count();
+    }
+}
+
+// PUBLIC
+
+StartupProfile::Phase::Phase(const char *name) noexcept
+    : m_name(name),
+      m_start(::getElapsedTime())
+{}
+
+StartupProfile::Phase::~Phase()
+{
+    ::phases.push_back({m_name, m_start, ::getElapsedTime() - m_start});
+}
+
+void StartupProfile::start() noexcept
+{
+    ::startTime = Clock::now();
+    ::phases.clear();
+    ::startupTime = 0;
+    ::finished = false;
+}
+
+void StartupProfile::finish() noexcept
+{
+    if (!::finished) {
+        ::startupTime = ::getElapsedTime();
+        ::finished = true;
+#ifdef DEBUG
+        for (const auto &phase : ::phases) {
+            qDebug() << "StartupProfile::finish: phase:" << phase.name << "start:" << phase.start / 1000.0 << "ms duration:" << phase.duration / 1000.0 << "ms";
+        }
+        qDebug() << "StartupProfile::finish: application start to first paint:" << ::startupTime / 1000.0 << "ms";
+#endif
+    }
+}
+
+bool StartupProfile::isFinished() noexcept
+{
+    return ::finished;
+}
+
+std::int64_t StartupProfile::getStartupTime() noexcept
+{
+    return ::startupTime;
+}
+
+std::vector<StartupProfile::PhaseTime> StartupProfile::getPhases() noexcept
+{
+    return ::phases;
+}
@@ -0,0 +1,360 @@
+/**
+ * Sky Dolly - The Black Sheep for Your Flight Recordings
+ *
+ * Copyright (c) 2020 - 2025 Oliver Knoll
+ *
+ * MIT License
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this
+ * software and associated documentation files (the "Software"), to deal in the Software
+ * without restriction, including without limitation the rights to use, copy, modify, merge,
+ * publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons
+ * to whom the Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or
+ * substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED *AS IS*, WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR
+ * PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE
+ * FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+ * OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ */
+#include <memory>
+#include <vector>
+#include <deque>
+#include <unordered_map>
+#include <algorithm>
+#include <mutex>
+#include <condition_variable>
+#include <thread>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstddef>
+
+#include <QByteArray>
+#include <QString>
+#include <QThread>
+#include <QIODevice>
+#include <QCoreApplication>
+
+#include "SpscQueue.h"
+#include "Trace.h"
+
+namespace
+{
+    using namespace std::chrono_literals;
+    using Clock = std::chrono::steady_clock;
+
+    // Per recording thread; with 48 bytes per event: 384 KiB
+    constexpr std::size_t ThreadBufferCapacity {8192};
+    // The most recent events; with 48 bytes per event: 12 MiB
+    constexpr std::size_t HistoryCapacity {262144};
+    // The thread buffers are collected often enough to not overflow, even at high replay frame rates
+    constexpr auto CollectInterval {250ms};
+    // The exported JSON is written in chunks of this size
+    constexpr qsizetype ExportChunkSize {1024 * 1024};
+
+    struct ThreadBuffer
+    {
+        ThreadBuffer(std::uint32_t threadId) noexcept
+            : queue(ThreadBufferCapacity),
+              threadId(threadId)
+        {}
+
+        // Produced by the recording thread, consumed by the collector
+        SpscQueue<Trace::Event> queue;
+        const std::uint32_t threadId;
+    };
+
+    struct Collector
+    {
+        Collector() = default;
+        Collector(const Collector &rhs) = delete;
+        Collector(Collector &&rhs) = delete;
+        Collector &operator=(const Collector &rhs) = delete;
+        Collector &operator=(Collector &&rhs) = delete;
+        ~Collector()
+        {
+            stop();
+        }
+
+        // Protects all members below, including the consumer side of the thread buffers
+        std::mutex mutex;
+        std::vector<std::shared_ptr<ThreadBuffer>> threadBuffers;
+        std::unordered_map<std::uint32_t, QString> threadNames;
+        std::uint32_t nextThreadId {1};
+        std::deque<Trace::Event> history;
+        std::condition_variable condition;
+        bool running {false};
+        std::thread thread;
+
+        void start() noexcept
+        {
+            std::lock_guard lock {mutex};
+            if (!running) {
+                running = true;
+                thread = std::thread(&Collector::run, this);
+            }
+        }
+
+        void stop() noexcept
+        {
+            {
+                std::lock_guard lock {mutex};
+                running = false;
+            }
+            condition.notify_all();
+            if (thread.joinable()) {
+                thread.join();
+            }
+        }
+
+        // The mutex must be locked
+        void collect() noexcept
+        {
+            for (auto &buffer : threadBuffers) {
+                buffer->queue.consumeAll([this](const Trace::Event &event) {
+                    if (history.size() == HistoryCapacity) {
+                        history.pop_front();
+                    }
+                    history.push_back(event);
+                });
+            }
+            // The buffers of finished threads are only referenced by the collector anymore
+            std::erase_if(threadBuffers, [](const std::shared_ptr<ThreadBuffer> &buffer) {
+                return buffer.use_count() == 1 && buffer->queue.size() == 0;
+            });
+        }
+
+    private:
+        void run() noexcept
+        {
+            std::unique_lock lock {mutex};
+            while (running) {
+                condition.wait_for(lock, CollectInterval, [this]() { return !running; });
+                collect();
+            }
+        }
+    };
+
+    const Clock::time_point epoch {Clock::now()};
+    std::atomic_bool enabled {false};
+    std::atomic<std::size_t> droppedEventCount {0};
+    thread_local std::shared_ptr<ThreadBuffer> threadBuffer;
+
+    Collector &getCollector() noexcept
+    {
+        static Collector collector;
+        return collector;
+    }
+
+    QString getCurrentThreadName(std::uint32_t threadId) noexcept
+    {
+        QString threadName;
+        const QThread *currentThread = QThread::currentThread();
+        const QCoreApplication *application = QCoreApplication::instance();
+        if (application != nullptr && currentThread == application->thread()) {
+            threadName = QStringLiteral("Main");
+        } else if (currentThread != nullptr && !currentThread->objectName().isEmpty()) {
+            threadName = currentThread->objectName();
+        } else {
+            threadName = QStringLiteral("Thread %1").arg(threadId);
+        }
+        return threadName;
+    }
+
+    ThreadBuffer &getThreadBuffer() noexcept
+    {
+        if (!::threadBuffer) {
+            // Only once per thread
+            auto &collector = getCollector();
+            std::lock_guard lock {collector.mutex};
+            const std::uint32_t threadId = collector.nextThreadId++;
+            ::threadBuffer = std::make_shared<ThreadBuffer>(threadId);
+            collector.threadBuffers.push_back(::threadBuffer);
+            collector.threadNames[threadId] = getCurrentThreadName(threadId);
+        }
+        return *::threadBuffer;
+    }
+
+    inline void record(Trace::Event event) noexcept
+    {
+        auto &buffer = getThreadBuffer();
+        event.threadId = buffer.threadId;
+        if (!buffer.queue.tryPush(event)) {
+            ::droppedEventCount.fetch_add(1, std::memory_order_relaxed);
+        }
+    }
+
+    void appendString(QByteArray &json, QByteArrayView string) noexcept
+    {
+        json.append('"');
+        for (const char c : string) {
+            if (c == '"' || c == '\\') {
+                json.append('\\').append(c);
+            } else if (static_cast<unsigned char>(c) < 0x20) {
+                json.append("\\u00").append(QByteArray::number(static_cast<unsigned char>(c), 16).rightJustified(2, '0'));
+            } else {
+                json.append(c);
+            }
+        }
+        json.append('"');
+    }
+
+    void appendCommon(QByteArray &json, const Trace::Event &event, const char *phase, qint64 processId) noexcept
+    {
+        json.append("{\"name\":");
+        appendString(json, event.name);
+        json.append(",\"cat\":");
+        appendString(json, event.category);
+        json.append(",\"ph\":\"").append(phase)
+            .append("\",\"ts\":").append(QByteArray::number(event.timestamp))
+            .append(",\"pid\":").append(QByteArray::number(processId))
+            .append(",\"tid\":").append(QByteArray::number(event.threadId));
+    }
+}
+
+// PUBLIC
+
+Trace::Scope::Scope(const char *category, const char *name) noexcept
+    : m_category(category),
+      m_name(name),
+      m_start(::enabled.load(std::memory_order_relaxed) ? Trace::now() : -1)
+{}
+
+Trace::Scope::~Scope()
+{
+    if (m_start >= 0) {
+        Trace::complete(m_category, m_name, m_start, Trace::now() - m_start);
+    }
+}
+
+bool Trace::isEnabled() noexcept
+{
+    return ::enabled.load(std::memory_order_relaxed);
+}
+
+void Trace::setEnabled(bool enable) noexcept
+{
+    ::enabled.store(enable, std::memory_order_relaxed);
+    if (enable) {
+        getCollector().start();
+    } else {
+        getCollector().stop();
+    }
+}
+
+std::int64_t Trace::now() noexcept
+{
+    return std::chrono::duration_cast<std::chrono::microseconds>(Clock::now() - ::epoch).count();
+}
+
+void Trace::complete(const char *category, const char *name, std::int64_t start, std::int64_t duration) noexcept
+{
+    if (::enabled.load(std::memory_order_relaxed)) {
+        ::record({category, name, start, duration, 0, 0, Type::Complete});
+    }
+}
+
+void Trace::instant(const char *category, const char *name) noexcept
+{
+    if (::enabled.load(std::memory_order_relaxed)) {
+        ::record({category, name, now(), 0, 0, 0, Type::Instant});
+    }
+}
+
+void Trace::counter(const char *category, const char *name, std::int64_t value) noexcept
+{
+    if (::enabled.load(std::memory_order_relaxed)) {
+        ::record({category, name, now(), 0, value, 0, Type::Counter});
+    }
+}
+
+std::vector<Trace::Event> Trace::getEvents() noexcept
+{
+    auto &collector = getCollector();
+    std::lock_guard lock {collector.mutex};
+    collector.collect();
+    return {collector.history.cbegin(), collector.history.cend()};
+}
+
+std::size_t Trace::getDroppedEventCount() noexcept
+{
+    return ::droppedEventCount.load(std::memory_order_relaxed);
+}
+
+void Trace::clear() noexcept
+{
+    auto &collector = getCollector();
+    std::lock_guard lock {collector.mutex};
+    collector.collect();
+    collector.history.clear();
+    ::droppedEventCount.store(0, std::memory_order_relaxed);
+}
+
+bool Trace::exportChromeTrace(QIODevice &io) noexcept
+{
+    std::vector<Event> events;
+    std::unordered_map<std::uint32_t, QString> threadNames;
+    {
+        auto &collector = getCollector();
+        std::lock_guard lock {collector.mutex};
+        collector.collect();
+        events.assign(collector.history.cbegin(), collector.history.cend());
+        threadNames = collector.threadNames;
+    }
+
+    const qint64 processId = QCoreApplication::applicationPid();
+    QByteArray json;
+    json.reserve(ExportChunkSize + 1024);
+    json.append("{\"displayTimeUnit\":\"ms\",\"traceEvents\":[");
+    bool ok {true};
+    bool first {true};
+    for (const auto &[threadId, threadName] : threadNames) {
+        if (!first) {
+            json.append(',');
+        }
+        first = false;
+        json.append("{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":").append(QByteArray::number(processId))
+            .append(",\"tid\":").append(QByteArray::number(threadId))
+            .append(",\"args\":{\"name\":");
+        appendString(json, threadName.toUtf8());
+        json.append("}}");
+    }
+    for (const auto &event : events) {
+        if (!first) {
+            json.append(',');
+        }
+        first = false;
+        switch (event.type) {
+        case Type::Complete:
+            appendCommon(json, event, "X", processId);
+            json.append(",\"dur\":").append(QByteArray::number(event.duration)).append('}');
+            break;
+        case Type::Instant:
+            appendCommon(json, event, "i", processId);
+            // Thread scope
+            json.append(",\"s\":\"t\"}");
+            break;
+        case Type::Counter:
+            appendCommon(json, event, "C", processId);
+            json.append(",\"args\":{\"value\":").append(QByteArray::number(event.value)).append("}}");
+            break;
+        }
+        if (json.size() >= ExportChunkSize) {
+            ok = io.write(json) == json.size();
+            if (!ok) {
+                break;
+            }
+            json.clear();
+        }
+    }
+    if (ok) {
+        json.append("]}\n");
+        ok = io.write(json) == json.size();
+    }
+    return ok;
+}
@@ -25,42 +25,131 @@
 #define ABSTRACTCOMPONENT_H
 
 #include <vector>
+#include <atomic>
+#include <mutex>
+#include <shared_mutex>
 #include <cstdint>
 #include <type_traits>
+#include <utility>
+#include <cstddef>
 
+#include <Kernel/SegmentedVector.h>
 #include "TimeVariableData.h"
+#include "CompactSamples.h"
 #include "SkySearch.h"
+#include "SampleCursor.h"
 #include "AircraftInfo.h"
 #include "ModelLib.h"
 
-template <typename T>
+/*!
+ * The base class of all components holding sampled data of type \p T.
+ *
+ * Components with a \p Codec support a compact encoding of their sampled data, which is only
+ * decoded on demand: see #compact. The const accessors may be called concurrently by several
+ * threads (e.g. the replay, the background seek and the user interface): the on-demand decoding
+ * is synchronised.
+ */
+template <typename T, typename Codec = void>
 class MODEL_API AbstractComponent
 {
     static_assert(std::is_base_of<TimeVariableData, T>::value, "T must inherit from TimeVariableData");
+    static_assert(std::is_trivially_copyable_v<T>, "T must be trivially copyable");
+    static_assert(std::is_trivially_destructible_v<T>, "T must be trivially destructible");
+    static_assert(!std::is_polymorphic_v<T>, "T must not have virtual functions");
 public:
-    using Data = typename std::vector<T>;
+    /*!
+     * The sampled data is stored in segments: appending new samples during recording never
+     * moves already recorded samples.
+     */
+    using Data = SegmentedVector<T>;
     using Iterator = typename Data::iterator;
     using ConstIterator = typename Data::const_iterator;
+    using CompactData = CompactSamples<Codec>;
+
+    static constexpr bool IsCompactable = !std::is_void_v<Codec>;
 
     explicit AbstractComponent(const AircraftInfo &aircraftInfo) noexcept
         : m_aircraftInfo(aircraftInfo)
     {}
 
     AbstractComponent() noexcept = default;
-    AbstractComponent(const AbstractComponent &rhs) = default;
-    AbstractComponent(AbstractComponent &&rhs) noexcept = default;
+    AbstractComponent(const AbstractComponent &rhs)
+        : m_aircraftInfo(rhs.m_aircraftInfo)
+    {
+        std::shared_lock lock {rhs.m_expandMutex};
+        m_data = rhs.m_data;
+        m_compactData = rhs.m_compactData;
+        m_compact = rhs.m_compact;
+        m_expanded.store(rhs.m_expanded.load(std::memory_order_relaxed), std::memory_order_relaxed);
+        m_generation = rhs.m_generation;
+    }
+
+    AbstractComponent(AbstractComponent &&rhs) noexcept
+        : m_data(std::move(rhs.m_data)),
+          m_compactData(std::move(rhs.m_compactData)),
+          m_compact(rhs.m_compact),
+          m_expanded(rhs.m_expanded.load(std::memory_order_relaxed)),
+          m_generation(rhs.m_generation),
+          m_aircraftInfo(rhs.m_aircraftInfo)
+    {}
+
     AbstractComponent &operator=(const AbstractComponent &rhs) = default;
     AbstractComponent &operator=(AbstractComponent &&rhs) noexcept = default;
     virtual ~AbstractComponent() = default;
 
-    void setData(const Data &data) noexcept
+    void setData(const std::vector<T> &data) noexcept
+    {
+        setData(data.data(), data.size());
+    }
+
+    /*!
+     * Replaces the sampled data with the \p count contiguous samples starting at \p data,
+     * which are copied in bulk.
+     *
+     * \param data
+     *        the samples, for instance memory-mapped from a file
+     * \param count
+     *        the number of samples
+     */
+    void setData(const T *data, std::size_t count) noexcept
+    {
+        discardCompactData();
+        markModified();
+        m_data.clear();
+        m_data.append(data, count);
+    }
+
+    void setData(std::vector<T> &&data) noexcept
     {
-        m_data = data;
+        setData(std::as_const(data));
+        data.clear();
     }
 
-    void setData(Data &&data) noexcept
+    /*!
+     * Copies the \p count samples starting at \p index in bulk.
+     *
+     * \param index
+     *        the index of the first sample to be copied
+     * \param count
+     *        the number of samples to be copied; \p index + \p count must not exceed the #count
+     * \return the copied samples
+     */
+    std::vector<T> copyData(std::size_t index, std::size_t count) const noexcept
     {
-        m_data = std::move(data);
+        expand();
+        std::vector<T> data(count);
+        m_data.copy(index, count, data.data());
+        return data;
+    }
+
+    /*!
+     * Copies all samples in bulk.
+     *
+     * \return the copied samples
+     */
+    std::vector<T> copyData() const noexcept
+    {
+        return copyData(0, count());
     }
 
     /*!
@@ -76,6 +165,7 @@ public:
      */
     void upsertLast(const T &data) noexcept
     {
+        decompact();
         if (m_data.size() > 0 && m_data.back() == data)  {
             // Same timestamp -> replace
             m_data.back() = data;
@@ -97,6 +187,7 @@ public:
      */
     void upsert(const T &data) noexcept
     {
+        decompact();
         auto result = std::find_if(m_data.begin(), m_data.end(),
                                   [&data] (const TimeVariableData &d) { return d.timestamp == data.timestamp; });
         if (result != m_data.end()) {
@@ -115,6 +206,11 @@ public:
      */
     const T &getFirst() const noexcept
     {
+        if constexpr (IsCompactable) {
+            if (m_compact) {
+                return m_compactData.front();
+            }
+        }
         return m_data.front();
     }
 
@@ -126,22 +222,34 @@ public:
      */
     const T &getLast() const noexcept
     {
+        if constexpr (IsCompactable) {
+            if (m_compact) {
+                return m_compactData.back();
+            }
+        }
         return m_data.back();
     }
 
     std::size_t count() const noexcept
     {
+        if constexpr (IsCompactable) {
+            if (m_compact) {
+                return m_compactData.size();
+            }
+        }
         return m_data.size();
     }
 
     void reserve(typename Data::size_type size)
     {
+        decompact();
         m_data.reserve(size);
     }
 
     void insert(typename Data::size_type count, const T &value)
     {
-        m_data.insert(m_data.end(), count, value);
+        decompact();
+        m_data.append(count, value);
     }
 
     typename Data::size_type capacity() const noexcept
@@ -151,97 +259,284 @@ public:
 
     void clear() noexcept
     {
+        discardCompactData();
+        markModified();
         m_data.clear();
-        m_currentTimestamp = TimeVariableData::InvalidTime;
-        m_currentIndex = SkySearch::InvalidIndex;
     }
 
+    // The non-const accessors allow modifying the sampled data, which discards the compact encoding
+
     Iterator begin() noexcept
     {
+        decompact();
         return m_data.begin();
     }
 
     ConstIterator begin() const noexcept
     {
+        expand();
         return m_data.begin();
     }
 
     Iterator end() noexcept
     {
+        decompact();
         return m_data.end();
     }
 
     ConstIterator end() const noexcept
     {
+        expand();
         return m_data.end();
     }
 
     ConstIterator cbegin() const noexcept
     {
+        expand();
         return m_data.cbegin();
     }
 
     ConstIterator cend() const noexcept
     {
+        expand();
         return m_data.cend();
     }
 
     T &operator[](std::size_t index) noexcept
     {
+        decompact();
         return m_data[index];
     }
 
     const T &operator[](std::size_t index) const noexcept
     {
+        expand();
         return m_data[index];
     }
 
-    virtual const T &interpolate(std::int64_t timestamp, TimeVariableData::Access access) const noexcept = 0;
+    /*!
+     * Encodes the sampled data compactly and frees the (decoded) sampled data. The samples
+     * are decoded on demand by #interpolate, without decoding the entire sampled data.
+     *
+     * Any other (const) access to the samples decodes the entire sampled data again, which then
+     * replaces the compact encoding (only the number of samples and the first and last sample are
+     * kept), until this method is called again. Modifying the sampled data - including any non-const
+     * access to the samples - discards the compact encoding as well.
+     *
+     * Like any modification of the sampled data this method must not be called while the
+     * component is being interpolated by other threads.
+     *
+     * \return \c true if the sampled data is compactly encoded; \c false if this component does
+     *         not support a compact encoding, or if not all samples could be encoded within the
+     *         precision guarantees of the \p Codec, in which case the sampled data is left as is
+     * \sa isCompact
+     */
+    bool compact() noexcept
+    {
+        bool ok {false};
+        if constexpr (IsCompactable) {
+            ok = isCompact() || m_compactData.encode(m_data);
+            if (ok) {
+                m_compact = true;
+                m_data.release();
+                m_expanded.store(false, std::memory_order_release);
+            }
+        }
+        return ok;
+    }
+
+    /*!
+     * Returns whether the sampled data is compactly encoded.
+     *
+     * \return \c true if the sampled data is compactly encoded; \c false else
+     * \sa compact
+     */
+    bool isCompact() const noexcept
+    {
+        return m_compact && !m_expanded.load(std::memory_order_acquire);
+    }
+
+    /*!
+     * Returns the modification generation of the sampled data: a new generation is drawn
+     * whenever the sampled data is modified (or may be modified, by non-const access).
+     * Generations are unique within the process, so data derived from the sampled data
+     * (e.g. an overview) is outdated whenever the generation differs.
+     *
+     * \return the modification generation of the sampled data
+     * \sa SampleCursorGeneration#next
+     */
+    std::uint64_t getGeneration() const noexcept
+    {
+        return m_generation;
+    }
+
+    /*!
+     * Returns the memory occupied by the sampled data, that is by the allocated segments
+     * and the compact encoding, if any.
+     *
+     * \return the allocated memory [bytes]
+     */
+    std::size_t getMemoryUsage() const noexcept
+    {
+        std::size_t size {0};
+        if constexpr (IsCompactable) {
+            // The samples may be decoded concurrently
+            std::shared_lock lock {m_expandMutex};
+            size = m_data.capacity() * sizeof(T) + m_compactData.getMemoryUsage();
+        } else {
+            size = m_data.capacity() * sizeof(T);
+        }
+        return size;
+    }
+
+    /*!
+     * Interpolates the sampled data at the given \p timestamp. The search hint and the interpolated
+     * result are kept in the given \p cursor, which is owned by the caller: the component itself is
+     * not modified, so it may be interpolated concurrently by several threads, each with its own cursor.
+     *
+     * \param timestamp
+     *        the timestamp of the data to be interpolated [milliseconds]
+     * \param access
+     *        the way the sampled data is accessed
+     * \param cursor
+     *        the interpolation state of the caller
+     * \return the interpolated data, stored in the \p cursor; only valid as long as the \p cursor
+     *         is not used for another interpolation
+     */
+    virtual const T &interpolate(std::int64_t timestamp, TimeVariableData::Access access, SampleCursor<T> &cursor) const noexcept = 0;
 
 protected:
     inline const Data &getData() const noexcept
     {
+        expand();
         return m_data;
     }
 
-    inline const AircraftInfo &getAircraftInfo() const noexcept
+    /*!
+     * Locks the compactly encoded samples, such that they are not released by a concurrent decoding
+     * of the entire sampled data. The returned lock only owns the lock if the sampled data is (still)
+     * compactly encoded, in which case the #getCompactData may be accessed while the lock is held.
+     *
+     * \return the lock on the compactly encoded samples
+     */
+    inline std::shared_lock<std::shared_mutex> lockCompactData() const noexcept
     {
-        return m_aircraftInfo;
+        std::shared_lock<std::shared_mutex> lock;
+        if constexpr (IsCompactable) {
+            if (!m_expanded.load(std::memory_order_acquire)) {
+                lock = std::shared_lock {m_expandMutex};
+                if (m_expanded.load(std::memory_order_relaxed)) {
+                    lock.unlock();
+                }
+            }
+        }
+        return lock;
     }
 
-    inline std::int64_t getCurrentTimestamp() const noexcept
+    /*!
+     * Returns the compactly encoded samples, which are only valid while being locked.
+     *
+     * \return the compactly encoded samples
+     * \sa lockCompactData
+     */
+    inline const auto &getCompactData() const noexcept
     {
-        return m_currentTimestamp;
+        return m_compactData;
     }
-    inline void setCurrentTimestamp(std::int64_t timestamp) const noexcept
+
+    inline const AircraftInfo &getAircraftInfo() const noexcept
     {
-        m_currentTimestamp = timestamp;
+        return m_aircraftInfo;
     }
 
-    inline int getCurrentIndex() const noexcept
+    /*!
+     * Binds the \p cursor to this component: a cursor which was last used with another component,
+     * or before the sampled data has been modified, or whose index hint lies past the sampled data,
+     * is reset.
+     *
+     * \param cursor
+     *        the cursor to be bound
+     * \param timestamp
+     *        the (adjusted) timestamp to be interpolated [milliseconds]
+     * \param access
+     *        the way the sampled data is accessed
+     * \return \c true if the \p cursor already holds the interpolated data for \p timestamp and \p access;
+     *         \c false if the data needs to be interpolated
+     */
+    inline bool bindCursor(SampleCursor<T> &cursor, std::int64_t timestamp, TimeVariableData::Access access) const noexcept
     {
-        return m_currentIndex;
+        if (cursor.component != this || cursor.generation != m_generation || cursor.index >= static_cast<int>(count())) {
+            cursor.reset();
+            cursor.component = this;
+            cursor.generation = m_generation;
+        }
+        return cursor.timestamp == timestamp && cursor.access == access;
     }
-    inline void setCurrentIndex(int index) const noexcept
+
+private:
+    // The compact encoding is only available for components with a codec
+    struct NoCompactData {};
+
+    // Decoded on demand from the compact encoding
+    mutable Data m_data;
+    // The encoded samples are released once decoded on demand
+    mutable std::conditional_t<IsCompactable, CompactData, NoCompactData> m_compactData;
+    bool m_compact {false};
+    // Whether the m_data holds all samples; only false while compact and not yet decoded again.
+    // Published with release semantics once the samples have been decoded, at which point the
+    // encoded samples have been released
+    mutable std::atomic_bool m_expanded {true};
+    std::uint64_t m_generation {SampleCursorGeneration::next()};
+    const AircraftInfo &m_aircraftInfo;
+    // Serialises the decoding of the compactly encoded samples (exclusive), and protects the
+    // encoded samples from being released while being interpolated (shared)
+    mutable std::shared_mutex m_expandMutex;
+
+    // The sampled data is about to be modified: any bound cursor becomes stale
+    inline void markModified() noexcept
     {
-        m_currentIndex = index;
+        m_generation = SampleCursorGeneration::next();
     }
 
-    inline TimeVariableData::Access getCurrentAccess() const noexcept
+    // Decodes the compactly encoded samples, if not already done, and releases the encoded samples;
+    // the first caller decodes, concurrent callers wait until the decoded samples have been published
+    inline void expand() const noexcept
     {
-        return m_currentAccess;
+        if constexpr (IsCompactable) {
+            if (!m_expanded.load(std::memory_order_acquire)) {
+                std::unique_lock lock {m_expandMutex};
+                if (!m_expanded.load(std::memory_order_relaxed)) {
+                    m_compactData.decode(m_data);
+                    m_compactData.releaseSamples();
+                    m_expanded.store(true, std::memory_order_release);
+                }
+            }
+        }
     }
-    inline void setCurrentAccess(TimeVariableData::Access access) const noexcept
+
+    // The sampled data is about to be modified: decodes and discards the compactly encoded samples
+    inline void decompact() noexcept
     {
-        m_currentAccess = access;
+        markModified();
+        if constexpr (IsCompactable) {
+            if (m_compact) {
+                expand();
+                discardCompactData();
+            }
+        }
     }
 
-private:
-    Data m_data;
-    const AircraftInfo &m_aircraftInfo;
-    mutable std::int64_t m_currentTimestamp {TimeVariableData::InvalidTime};
-    mutable int m_currentIndex {SkySearch::InvalidIndex};
-    mutable TimeVariableData::Access m_currentAccess {TimeVariableData::Access::Linear};
+    // The sampled data is about to be replaced: discards the compactly encoded samples
+    inline void discardCompactData() noexcept
+    {
+        if constexpr (IsCompactable) {
+            if (m_compact) {
+                m_compactData.clear();
+                m_compact = false;
+                m_expanded.store(true, std::memory_order_release);
+            }
+        }
+    }
 };
 
 #endif // ABSTRACTCOMPONENT_H
@@ -25,6 +25,7 @@
 #define AIRCRAFT_H
 
 #include <memory>
+#include <cstddef>
 #include <cstdint>
 
 class QDateTime;
@@ -86,6 +87,21 @@ public:
      */
     bool hasRecording() const noexcept;
 
+    /*!
+     * Encodes the sampled data of the components which support a compact encoding, currently
+     * the position and engine data. The samples are decoded on demand for replay.
+     *
+     * \sa AbstractComponent#compact
+     */
+    void compact() noexcept;
+
+    /*!
+     * Returns the memory occupied by the sampled data of all components.
+     *
+     * \return the allocated memory [bytes]
+     */
+    std::size_t getMemoryUsage() const noexcept;
+
     void clear() noexcept;
 
     bool operator==(const Aircraft &rhs) const noexcept;
@@ -28,6 +28,7 @@
 
 #include "AircraftHandleData.h"
 #include "AircraftInfo.h"
+#include "SampleCursor.h"
 #include "AbstractComponent.h"
 #include "ModelLib.h"
 
@@ -36,10 +37,7 @@ class MODEL_API AircraftHandle final : public AbstractComponent<AircraftHandleDa
 public:
     explicit AircraftHandle(const AircraftInfo &aircraftInfo) noexcept;
 
-    const AircraftHandleData &interpolate(std::int64_t timestamp, TimeVariableData::Access access) const noexcept override;
-
-private:
-    mutable AircraftHandleData m_currentData;
+    const AircraftHandleData &interpolate(std::int64_t timestamp, TimeVariableData::Access access, SampleCursor<AircraftHandleData> &cursor) const noexcept override;
 };
 
 #endif // AIRCRAFTHANDLE_H
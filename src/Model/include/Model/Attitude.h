@@ -26,6 +26,7 @@
 
 #include "AttitudeData.h"
 #include "AircraftInfo.h"
+#include "SampleCursor.h"
 #include "AbstractComponent.h"
 #include "ModelLib.h"
 
@@ -34,10 +35,7 @@ class MODEL_API Attitude final : public AbstractComponent<AttitudeData>
 public:
     explicit Attitude(const AircraftInfo &aircraftInfo) noexcept;
 
-    const AttitudeData &interpolate(std::int64_t timestamp, TimeVariableData::Access access) const noexcept override;
-
-private:
-    mutable AttitudeData m_currentData;
+    const AttitudeData &interpolate(std::int64_t timestamp, TimeVariableData::Access access, SampleCursor<AttitudeData> &cursor) const noexcept override;
 };
 
 #endif // ATTITUDE_H
@@ -0,0 +1,279 @@
+/**
+ * Sky Dolly - The Black Sheep for Your Flight Recordings
+ *
+ * Copyright (c) 2020 - 2025 Oliver Knoll
+ *
+ * MIT License
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this
+ * software and associated documentation files (the "Software"), to deal in the Software
+ * without restriction, including without limitation the rights to use, copy, modify, merge,
+ * publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons
+ * to whom the Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or
+ * substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED *AS IS*, WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR
+ * PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE
+ * FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+ * OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ */
+#ifndef COMPACTSAMPLES_H
+#define COMPACTSAMPLES_H
+
+#include <vector>
+#include <algorithm>
+#include <utility>
+#include <limits>
+#include <cstddef>
+#include <cstdint>
+
+/*!
+ * A read-only, compact encoding of sampled data of type \c Codec::Sample.
+ *
+ * The samples are stored in blocks of \p BlockSize samples each. The timestamps are stored
+ * as unsigned 32 bit offsets [milliseconds] relative to the timestamp of the first sample
+ * of each block, in their own array, such that searching them touches as little memory as
+ * possible. The sample values are encoded by the \c Codec, relative to a per-block
+ * \c Codec::Reference.
+ *
+ * The \c Codec must provide:
+ *
+ * - the types \c Sample, \c Reference and \c Encoded
+ * - <code>static Reference makeReference(const Sample &first)</code>
+ * - <code>static bool encode(const Sample &sample, const Reference &reference, Encoded &encoded)</code>,
+ *   returning \c false if the \c sample cannot be encoded within the precision guarantees of the codec
+ * - <code>static void decode(const Encoded &encoded, const Reference &reference, Sample &sample)</code>
+ *
+ * \sa PositionCodec
+ * \sa EngineCodec
+ */
+template <typename Codec>
+class CompactSamples
+{
+public:
+    using value_type = typename Codec::Sample;
+    using Reference = typename Codec::Reference;
+    using Encoded = typename Codec::Encoded;
+
+    static constexpr std::size_t BlockSize {4096};
+
+    /*!
+     * A view on the timestamps only, which supports the SkySearch functions: the samples
+     * returned by #at only carry their timestamp.
+     */
+    class Timestamps
+    {
+    public:
+        struct Sample
+        {
+            std::int64_t timestamp;
+        };
+
+        explicit Timestamps(const CompactSamples &samples) noexcept
+            : m_samples(samples)
+        {}
+
+        std::size_t size() const noexcept
+        {
+            return m_samples.size();
+        }
+
+        Sample at(std::size_t index) const noexcept
+        {
+            return {m_samples.getTimestamp(index)};
+        }
+
+        Sample front() const noexcept
+        {
+            return at(0);
+        }
+
+        Sample back() const noexcept
+        {
+            return at(size() - 1);
+        }
+
+    private:
+        const CompactSamples &m_samples;
+    };
+
+    /*!
+     * Encodes the sampled \p data, replacing any previously encoded samples. The \p data must
+     * be sorted by ascending timestamp.
+     *
+     * \param data
+     *        the sampled data to be encoded
+     * \return \c true if all samples could be encoded within the precision guarantees of the
+     *         codec; \c false else, in which case no samples are encoded
+     */
+    template <typename Data>
+    bool encode(const Data &data) noexcept
+    {
+        clear();
+        bool ok {true};
+        const std::size_t size = data.size();
+        m_blocks.reserve((size + BlockSize - 1) / BlockSize);
+        for (std::size_t i = 0; ok && i < size; ++i) {
+            const value_type &sample = data[i];
+            if (i % BlockSize == 0) {
+                Block block;
+                block.timestamp = sample.timestamp;
+                block.reference = Codec::makeReference(sample);
+                const std::size_t blockSize = std::min(BlockSize, size - i);
+                block.timestampOffsets.reserve(blockSize);
+                block.samples.reserve(blockSize);
+                m_blocks.push_back(std::move(block));
+            }
+            auto &block = m_blocks.back();
+            const std::int64_t timestampOffset = sample.timestamp - block.timestamp;
+            Encoded encoded;
+            ok = timestampOffset >= 0 && timestampOffset <= std::numeric_limits<std::uint32_t>::max() &&
+                 Codec::encode(sample, block.reference, encoded);
+            if (ok) {
+                block.timestampOffsets.push_back(static_cast<std::uint32_t>(timestampOffset));
+                block.samples.push_back(encoded);
+            }
+        }
+        if (ok) {
+            m_size = size;
+            if (size > 0) {
+                m_first = at(0);
+                m_last = at(size - 1);
+            }
+        } else {
+            clear();
+        }
+        return ok;
+    }
+
+    /*!
+     * Decodes all samples and appends them to the \p data.
+     *
+     * \param data
+     *        the sampled data receiving the decoded samples
+     */
+    template <typename Data>
+    void decode(Data &data) const
+    {
+        data.reserve(data.size() + m_size);
+        for (const auto &block : m_blocks) {
+            const std::size_t blockSize = block.samples.size();
+            for (std::size_t i = 0; i < blockSize; ++i) {
+                value_type sample;
+                Codec::decode(block.samples[i], block.reference, sample);
+                sample.timestamp = block.timestamp + block.timestampOffsets[i];
+                data.push_back(std::move(sample));
+            }
+        }
+    }
+
+    /*!
+     * Decodes the sample at \p index, which must be valid.
+     *
+     * \param index
+     *        the index of the sample to be decoded
+     * \return the decoded sample
+     */
+    value_type at(std::size_t index) const noexcept
+    {
+        const auto &block = m_blocks[index / BlockSize];
+        const std::size_t blockIndex = index % BlockSize;
+        value_type sample;
+        Codec::decode(block.samples[blockIndex], block.reference, sample);
+        sample.timestamp = block.timestamp + block.timestampOffsets[blockIndex];
+        return sample;
+    }
+
+    std::int64_t getTimestamp(std::size_t index) const noexcept
+    {
+        const auto &block = m_blocks[index / BlockSize];
+        return block.timestamp + block.timestampOffsets[index % BlockSize];
+    }
+
+    Timestamps getTimestamps() const noexcept
+    {
+        return Timestamps(*this);
+    }
+
+    /*!
+     * Returns the decoded first sample. There must be at least one sample, otherwise the
+     * behaviour is undefined.
+     */
+    const value_type &front() const noexcept
+    {
+        return m_first;
+    }
+
+    /*!
+     * Returns the decoded last sample. There must be at least one sample, otherwise the
+     * behaviour is undefined.
+     */
+    const value_type &back() const noexcept
+    {
+        return m_last;
+    }
+
+    std::size_t size() const noexcept
+    {
+        return m_size;
+    }
+
+    bool empty() const noexcept
+    {
+        return m_size == 0;
+    }
+
+    void clear() noexcept
+    {
+        m_blocks.clear();
+        m_blocks.shrink_to_fit();
+        m_size = 0;
+        m_first = value_type();
+        m_last = value_type();
+    }
+
+    /*!
+     * Releases the encoded samples, once they have been decoded. Only the number of samples and
+     * the first and last sample remain available.
+     */
+    void releaseSamples() noexcept
+    {
+        m_blocks.clear();
+        m_blocks.shrink_to_fit();
+    }
+
+    /*!
+     * Returns the memory occupied by the encoded samples.
+     *
+     * \return the allocated memory [bytes]
+     */
+    std::size_t getMemoryUsage() const noexcept
+    {
+        std::size_t size = m_blocks.capacity() * sizeof(Block);
+        for (const auto &block : m_blocks) {
+            size += block.timestampOffsets.capacity() * sizeof(std::uint32_t) + block.samples.capacity() * sizeof(Encoded);
+        }
+        return size;
+    }
+
+private:
+    struct Block
+    {
+        // The timestamp of the first sample in the block [milliseconds]
+        std::int64_t timestamp {0};
+        Reference reference;
+        std::vector<std::uint32_t> timestampOffsets;
+        std::vector<Encoded> samples;
+    };
+
+    std::vector<Block> m_blocks;
+    std::size_t m_size {0};
+    value_type m_first;
+    value_type m_last;
+};
+
+#endif // COMPACTSAMPLES_H
@@ -25,18 +25,18 @@
 #define ENGINE_H
 
 #include "EngineData.h"
+#include "EngineCodec.h"
 #include "AircraftInfo.h"
+#include "SampleCursor.h"
 #include "AbstractComponent.h"
 #include "ModelLib.h"
 
-class MODEL_API Engine final : public AbstractComponent<EngineData>
+class MODEL_API Engine final : public AbstractComponent<EngineData, EngineCodec>
 {
 public:
     explicit Engine(const AircraftInfo &aircraftInfo) noexcept;
 
-    const EngineData &interpolate(std::int64_t timestamp, TimeVariableData::Access access) const noexcept override;
-private:
-    mutable EngineData m_currentData;
+    const EngineData &interpolate(std::int64_t timestamp, TimeVariableData::Access access, SampleCursor<EngineData> &cursor) const noexcept override;
 };
 
 #endif // ENGINE_H
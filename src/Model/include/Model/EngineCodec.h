@@ -0,0 +1,148 @@
+/**
+ * Sky Dolly - The Black Sheep for Your Flight Recordings
+ *
+ * Copyright (c) 2020 - 2025 Oliver Knoll
+ *
+ * MIT License
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this
+ * software and associated documentation files (the "Software"), to deal in the Software
+ * without restriction, including without limitation the rights to use, copy, modify, merge,
+ * publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons
+ * to whom the Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or
+ * substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED *AS IS*, WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR
+ * PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE
+ * FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+ * OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ */
+#ifndef ENGINECODEC_H
+#define ENGINECODEC_H
+
+#include <iterator>
+#include <cstdint>
+
+#include "EngineData.h"
+
+/*!
+ * Encodes EngineData compactly and losslessly, for CompactSamples: the lever and cowl flap
+ * positions are kept as is, while the battery, starter and combustion states are packed
+ * into a single bit field.
+ */
+struct EngineCodec
+{
+    using Sample = EngineData;
+
+    // The engine data is encoded without any block reference
+    struct Reference {};
+
+    struct Encoded
+    {
+        std::int16_t throttleLeverPosition1 {0};
+        std::int16_t throttleLeverPosition2 {0};
+        std::int16_t throttleLeverPosition3 {0};
+        std::int16_t throttleLeverPosition4 {0};
+        std::int16_t propellerLeverPosition1 {0};
+        std::int16_t propellerLeverPosition2 {0};
+        std::int16_t propellerLeverPosition3 {0};
+        std::int16_t propellerLeverPosition4 {0};
+        std::uint8_t mixtureLeverPosition1 {0};
+        std::uint8_t mixtureLeverPosition2 {0};
+        std::uint8_t mixtureLeverPosition3 {0};
+        std::uint8_t mixtureLeverPosition4 {0};
+        std::uint8_t cowlFlapPosition1 {0};
+        std::uint8_t cowlFlapPosition2 {0};
+        std::uint8_t cowlFlapPosition3 {0};
+        std::uint8_t cowlFlapPosition4 {0};
+        // Bits 0 - 3: electrical master battery, 4 - 7: general engine starter,
+        // 8 - 11: general engine combustion of the engines 1 - 4
+        std::uint16_t states {0};
+    };
+
+    static inline Reference makeReference([[maybe_unused]] const EngineData &first) noexcept
+    {
+        return {};
+    }
+
+    static inline bool encode(const EngineData &engineData, [[maybe_unused]] const Reference &reference, Encoded &encoded) noexcept
+    {
+        encoded.throttleLeverPosition1 = engineData.throttleLeverPosition1;
+        encoded.throttleLeverPosition2 = engineData.throttleLeverPosition2;
+        encoded.throttleLeverPosition3 = engineData.throttleLeverPosition3;
+        encoded.throttleLeverPosition4 = engineData.throttleLeverPosition4;
+        encoded.propellerLeverPosition1 = engineData.propellerLeverPosition1;
+        encoded.propellerLeverPosition2 = engineData.propellerLeverPosition2;
+        encoded.propellerLeverPosition3 = engineData.propellerLeverPosition3;
+        encoded.propellerLeverPosition4 = engineData.propellerLeverPosition4;
+        encoded.mixtureLeverPosition1 = engineData.mixtureLeverPosition1;
+        encoded.mixtureLeverPosition2 = engineData.mixtureLeverPosition2;
+        encoded.mixtureLeverPosition3 = engineData.mixtureLeverPosition3;
+        encoded.mixtureLeverPosition4 = engineData.mixtureLeverPosition4;
+        encoded.cowlFlapPosition1 = engineData.cowlFlapPosition1;
+        encoded.cowlFlapPosition2 = engineData.cowlFlapPosition2;
+        encoded.cowlFlapPosition3 = engineData.cowlFlapPosition3;
+        encoded.cowlFlapPosition4 = engineData.cowlFlapPosition4;
+
+        const bool states[] {
+            engineData.electricalMasterBattery1, engineData.electricalMasterBattery2, engineData.electricalMasterBattery3, engineData.electricalMasterBattery4,
+            engineData.generalEngineStarter1, engineData.generalEngineStarter2, engineData.generalEngineStarter3, engineData.generalEngineStarter4,
+            engineData.generalEngineCombustion1, engineData.generalEngineCombustion2, engineData.generalEngineCombustion3, engineData.generalEngineCombustion4
+        };
+        encoded.states = 0;
+        for (std::uint16_t i = 0; i < std::size(states); ++i) {
+            if (states[i]) {
+                encoded.states |= static_cast<std::uint16_t>(1u << i);
+            }
+        }
+        return true;
+    }
+
+    /*!
+     * Decodes the \p encoded engine data, except for the timestamp.
+     */
+    static inline void decode(const Encoded &encoded, [[maybe_unused]] const Reference &reference, EngineData &engineData) noexcept
+    {
+        engineData.throttleLeverPosition1 = encoded.throttleLeverPosition1;
+        engineData.throttleLeverPosition2 = encoded.throttleLeverPosition2;
+        engineData.throttleLeverPosition3 = encoded.throttleLeverPosition3;
+        engineData.throttleLeverPosition4 = encoded.throttleLeverPosition4;
+        engineData.propellerLeverPosition1 = encoded.propellerLeverPosition1;
+        engineData.propellerLeverPosition2 = encoded.propellerLeverPosition2;
+        engineData.propellerLeverPosition3 = encoded.propellerLeverPosition3;
+        engineData.propellerLeverPosition4 = encoded.propellerLeverPosition4;
+        engineData.mixtureLeverPosition1 = encoded.mixtureLeverPosition1;
+        engineData.mixtureLeverPosition2 = encoded.mixtureLeverPosition2;
+        engineData.mixtureLeverPosition3 = encoded.mixtureLeverPosition3;
+        engineData.mixtureLeverPosition4 = encoded.mixtureLeverPosition4;
+        engineData.cowlFlapPosition1 = encoded.cowlFlapPosition1;
+        engineData.cowlFlapPosition2 = encoded.cowlFlapPosition2;
+        engineData.cowlFlapPosition3 = encoded.cowlFlapPosition3;
+        engineData.cowlFlapPosition4 = encoded.cowlFlapPosition4;
+
+        engineData.electricalMasterBattery1 = isSet(encoded, 0);
+        engineData.electricalMasterBattery2 = isSet(encoded, 1);
+        engineData.electricalMasterBattery3 = isSet(encoded, 2);
+        engineData.electricalMasterBattery4 = isSet(encoded, 3);
+        engineData.generalEngineStarter1 = isSet(encoded, 4);
+        engineData.generalEngineStarter2 = isSet(encoded, 5);
+        engineData.generalEngineStarter3 = isSet(encoded, 6);
+        engineData.generalEngineStarter4 = isSet(encoded, 7);
+        engineData.generalEngineCombustion1 = isSet(encoded, 8);
+        engineData.generalEngineCombustion2 = isSet(encoded, 9);
+        engineData.generalEngineCombustion3 = isSet(encoded, 10);
+        engineData.generalEngineCombustion4 = isSet(encoded, 11);
+    }
+
+private:
+    static inline bool isSet(const Encoded &encoded, int bit) noexcept
+    {
+        return (encoded.states & (1u << bit)) != 0;
+    }
+};
+
+#endif // ENGINECODEC_H
@@ -26,6 +26,7 @@
 
 #include "LightData.h"
 #include "AircraftInfo.h"
+#include "SampleCursor.h"
 #include "AbstractComponent.h"
 #include "ModelLib.h"
 
@@ -34,9 +35,7 @@ class MODEL_API Light final : public AbstractComponent<LightData>
 public:
     explicit Light(const AircraftInfo &aircraftInfo) noexcept;
 
-    const LightData &interpolate(std::int64_t timestamp, TimeVariableData::Access access) const noexcept override;
-private:
-    mutable LightData m_currentData;
+    const LightData &interpolate(std::int64_t timestamp, TimeVariableData::Access access, SampleCursor<LightData> &cursor) const noexcept override;
 };
 
 #endif // LIGHT_H
@@ -24,20 +24,48 @@
 #ifndef POSITION_H
 #define POSITION_H
 
+#include <memory>
+#include <vector>
+
 #include "PositionData.h"
+#include "PositionCodec.h"
+#include "TrackOverview.h"
 #include "AircraftInfo.h"
+#include "SampleCursor.h"
 #include "AbstractComponent.h"
 #include "ModelLib.h"
 
-class MODEL_API Position final : public AbstractComponent<PositionData>
+struct PositionPrivate;
+
+class MODEL_API Position final : public AbstractComponent<PositionData, PositionCodec>
 {
 public:
     explicit Position(const AircraftInfo &aircraftInfo) noexcept;
+    Position(const Position &rhs) = delete;
+    Position(Position &&rhs) noexcept;
+    Position &operator=(const Position &rhs) = delete;
+    Position &operator=(Position &&rhs) = delete;
+    ~Position() override;
 
-    const PositionData &interpolate(std::int64_t timestamp, TimeVariableData::Access access) const noexcept override;
+    const PositionData &interpolate(std::int64_t timestamp, TimeVariableData::Access access, SampleCursor<PositionData> &cursor) const noexcept override;
+
+    /*!
+     * Returns the overview of the position data at the given \p resolution. The overview
+     * of all resolutions is built lazily on first access, and rebuilt whenever the position
+     * data has been modified since, as indicated by its generation.
+     *
+     * This method is thread-safe.
+     *
+     * \param resolution
+     *        the bucket duration of the overview
+     * \return the buckets containing at least one sample, in ascending order of time
+     */
+    std::vector<TrackOverview::Bucket> getTrackOverview(TrackOverview::Resolution resolution) const noexcept;
 
 private:
-    mutable PositionData m_currentData;
+    std::unique_ptr<PositionPrivate> d;
+
+    void updateTrackOverview() const noexcept;
 };
 
 #endif // POSITION_H
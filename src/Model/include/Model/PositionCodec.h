@@ -0,0 +1,127 @@
+/**
+ * Sky Dolly - The Black Sheep for Your Flight Recordings
+ *
+ * Copyright (c) 2020 - 2025 Oliver Knoll
+ *
+ * MIT License
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this
+ * software and associated documentation files (the "Software"), to deal in the Software
+ * without restriction, including without limitation the rights to use, copy, modify, merge,
+ * publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons
+ * to whom the Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or
+ * substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED *AS IS*, WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR
+ * PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE
+ * FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+ * OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ */
+#ifndef POSITIONCODEC_H
+#define POSITIONCODEC_H
+
+#include <cmath>
+#include <cstdint>
+
+#include "PositionData.h"
+
+/*!
+ * Encodes PositionData compactly, for CompactSamples.
+ *
+ * - latitude and longitude are quantised to signed 32 bit fixed-point values with a resolution
+ *   of 1e-7 degrees, that is the position error is at most 0.5e-7 degrees (about 6 mm)
+ * - all altitudes are stored as single precision offsets relative to the altitude of the first
+ *   sample of the block; offsets up to 131072 feet are supported, with an error of less than
+ *   0.01 feet
+ */
+struct PositionCodec
+{
+    using Sample = PositionData;
+
+    struct Reference
+    {
+        double altitude {0.0};
+    };
+
+    struct Encoded
+    {
+        std::int32_t latitude {0};
+        std::int32_t longitude {0};
+        float altitude {0.0f};
+        float indicatedAltitude {0.0f};
+        float calibratedIndicatedAltitude {0.0f};
+        float pressureAltitude {0.0f};
+    };
+
+    static constexpr double DegreesPerUnit {1e-7};
+    static constexpr double MaxAltitudeOffset {131072.0};
+
+    static inline Reference makeReference(const PositionData &first) noexcept
+    {
+        return {first.altitude};
+    }
+
+    /*!
+     * Encodes the \p positionData relative to the \p reference.
+     *
+     * \param positionData
+     *        the position data to be encoded
+     * \param reference
+     *        the reference of the block the \p positionData belongs to
+     * \param encoded
+     *        receives the encoded position data
+     * \return \c true if the \p positionData could be encoded within the precision guarantees;
+     *         \c false else
+     */
+    static inline bool encode(const PositionData &positionData, const Reference &reference, Encoded &encoded) noexcept
+    {
+        bool ok = encodeDegrees(positionData.latitude, encoded.latitude) &&
+                  encodeDegrees(positionData.longitude, encoded.longitude);
+        ok = ok && encodeAltitude(positionData.altitude, reference, encoded.altitude);
+        ok = ok && encodeAltitude(positionData.indicatedAltitude, reference, encoded.indicatedAltitude);
+        ok = ok && encodeAltitude(positionData.calibratedIndicatedAltitude, reference, encoded.calibratedIndicatedAltitude);
+        ok = ok && encodeAltitude(positionData.pressureAltitude, reference, encoded.pressureAltitude);
+        return ok;
+    }
+
+    /*!
+     * Decodes the \p encoded position data, except for the timestamp.
+     */
+    static inline void decode(const Encoded &encoded, const Reference &reference, PositionData &positionData) noexcept
+    {
+        positionData.latitude = static_cast<double>(encoded.latitude) * DegreesPerUnit;
+        positionData.longitude = static_cast<double>(encoded.longitude) * DegreesPerUnit;
+        positionData.altitude = reference.altitude + static_cast<double>(encoded.altitude);
+        positionData.indicatedAltitude = reference.altitude + static_cast<double>(encoded.indicatedAltitude);
+        positionData.calibratedIndicatedAltitude = reference.altitude + static_cast<double>(encoded.calibratedIndicatedAltitude);
+        positionData.pressureAltitude = reference.altitude + static_cast<double>(encoded.pressureAltitude);
+    }
+
+private:
+    static inline bool encodeDegrees(double degrees, std::int32_t &encoded) noexcept
+    {
+        // Also fails for NaN
+        const double units = std::round(degrees / DegreesPerUnit);
+        const bool ok = std::abs(units) <= 2147483647.0;
+        if (ok) {
+            encoded = static_cast<std::int32_t>(units);
+        }
+        return ok;
+    }
+
+    static inline bool encodeAltitude(double altitude, const Reference &reference, float &encoded) noexcept
+    {
+        const double offset = altitude - reference.altitude;
+        const bool ok = std::abs(offset) <= MaxAltitudeOffset;
+        if (ok) {
+            encoded = static_cast<float>(offset);
+        }
+        return ok;
+    }
+};
+
+#endif // POSITIONCODEC_H
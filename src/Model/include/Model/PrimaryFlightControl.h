@@ -26,6 +26,7 @@
 
 #include "PrimaryFlightControlData.h"
 #include "AircraftInfo.h"
+#include "SampleCursor.h"
 #include "AbstractComponent.h"
 #include "ModelLib.h"
 
@@ -34,10 +35,7 @@ class MODEL_API PrimaryFlightControl final : public AbstractComponent<PrimaryFli
 public:
     explicit PrimaryFlightControl(const AircraftInfo &aircraftInfo) noexcept;
 
-    const PrimaryFlightControlData &interpolate(std::int64_t timestamp, TimeVariableData::Access access) const noexcept override;
-
-private:
-    mutable PrimaryFlightControlData m_currentData;
+    const PrimaryFlightControlData &interpolate(std::int64_t timestamp, TimeVariableData::Access access, SampleCursor<PrimaryFlightControlData> &cursor) const noexcept override;
 };
 
 #endif // PRIMARYFLIGHTCONTROL_H
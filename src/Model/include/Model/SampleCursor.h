@@ -0,0 +1,93 @@
+/**
+ * Sky Dolly - The Black Sheep for Your Flight Recordings
+ *
+ * Copyright (c) 2020 - 2025 Oliver Knoll
+ *
+ * MIT License
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this
+ * software and associated documentation files (the "Software"), to deal in the Software
+ * without restriction, including without limitation the rights to use, copy, modify, merge,
+ * publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons
+ * to whom the Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or
+ * substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED *AS IS*, WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR
+ * PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE
+ * FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+ * OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ */
+#ifndef SAMPLECURSOR_H
+#define SAMPLECURSOR_H
+
+#include <type_traits>
+#include <cstdint>
+
+#include "TimeVariableData.h"
+#include "SkySearch.h"
+#include "ModelLib.h"
+
+namespace SampleCursorGeneration
+{
+    /*!
+     * Returns a new modification generation for sampled data, unique within the process
+     * (and never 0, which denotes an unbound cursor).
+     *
+     * Components draw a new generation whenever their sampled data is modified, so cursors
+     * bound to the component before the modification are recognised as stale - even when a
+     * component is replaced by another one at the same address.
+     *
+     * \return the new generation
+     */
+    MODEL_API std::uint64_t next() noexcept;
+}
+
+/*!
+ * The interpolation state of a single consumer of an AbstractComponent: the index hint into
+ * the sampled data and the last interpolation result.
+ *
+ * Each consumer owns its own cursor(s), so interleaved access at different timestamps by
+ * different consumers does not invalidate each other's search hints. As all interpolation
+ * state is kept in the cursor the components may be interpolated from several threads
+ * concurrently, as long as each thread uses its own cursor(s) and the sampled data is not
+ * modified at the same time.
+ *
+ * A cursor is bound to the component - and the modification generation of its sampled data -
+ * it was last used with: using it with another component, or after the sampled data has been
+ * modified (e.g. cleared and filled again), simply resets it.
+ *
+ * \sa AbstractComponent#interpolate
+ */
+template <typename T>
+struct SampleCursor
+{
+    static_assert(std::is_base_of<TimeVariableData, T>::value, "T must inherit from TimeVariableData");
+
+    // The component this cursor was last used with
+    const void *component {nullptr};
+    // The modification generation of the component's sampled data when this cursor was bound
+    std::uint64_t generation {0};
+    // The (adjusted) timestamp of the last interpolation [milliseconds]
+    std::int64_t timestamp {TimeVariableData::InvalidTime};
+    // The index hint: the lower index of the last interpolation interval
+    int index {SkySearch::InvalidIndex};
+    TimeVariableData::Access access {TimeVariableData::Access::Linear};
+    // The last interpolated data
+    T data;
+
+    inline void reset() noexcept
+    {
+        component = nullptr;
+        generation = 0;
+        timestamp = TimeVariableData::InvalidTime;
+        index = SkySearch::InvalidIndex;
+        access = TimeVariableData::Access::Linear;
+        data.reset();
+    }
+};
+
+#endif // SAMPLECURSOR_H
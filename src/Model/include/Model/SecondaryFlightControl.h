@@ -26,6 +26,7 @@
 
 #include "SecondaryFlightControlData.h"
 #include "AircraftInfo.h"
+#include "SampleCursor.h"
 #include "AbstractComponent.h"
 #include "ModelLib.h"
 
@@ -34,10 +35,7 @@ class MODEL_API SecondaryFlightControl final : public AbstractComponent<Secondar
 public:
     explicit SecondaryFlightControl(const AircraftInfo &aircraftInfo) noexcept;
 
-    const SecondaryFlightControlData &interpolate(std::int64_t timestamp, TimeVariableData::Access access) const noexcept override;
-
-private:
-    mutable SecondaryFlightControlData m_currentData;
+    const SecondaryFlightControlData &interpolate(std::int64_t timestamp, TimeVariableData::Access access, SampleCursor<SecondaryFlightControlData> &cursor) const noexcept override;
 };
 
 #endif // SECONDARYFLIGHTCONTROL_H
@@ -25,12 +25,16 @@
 #define SKYSEARCH_H
 
 #include <type_traits>
-#include <vector>
 #include <limits>
 #include <cstdint>
 
 #include "TimeVariableData.h"
 
+/*!
+ * Search and interpolation support functions for sampled data. The \c Data container
+ * (e.g. \c std::vector or SegmentedVector) must provide random access to elements
+ * of type \c T, with ascending timestamps.
+ */
 namespace SkySearch {
 
     constexpr int InvalidIndex = -1;
@@ -74,8 +78,8 @@ namespace SkySearch {
      *        the higher starting index <= lastIndex and >= lowIndex
      * \return the lower index i of the interval [i, j], or \p InvalidIndex if not found
      */
-    template <typename T>
-    int binaryIntervalSearch(const std::vector<T> &data, std::int64_t timestamp, int lowIndex, int highIndex) noexcept
+    template <typename Data>
+    int binaryIntervalSearch(const Data &data, std::int64_t timestamp, int lowIndex, int highIndex) noexcept
     {
         int index {InvalidIndex};
         if (data.size() == 0 || data.at(lowIndex).timestamp > timestamp || data.at(highIndex).timestamp < timestamp) {
@@ -113,8 +117,8 @@ namespace SkySearch {
         return index;
     }
 
-    template <typename T>
-    int linearIntervalSearch(const std::vector<T> &data, std::int64_t timestamp, int startIndex) noexcept
+    template <typename Data>
+    int linearIntervalSearch(const Data &data, std::int64_t timestamp, int startIndex) noexcept
     {
         int index {startIndex};
         if (data.size() == 0 || data.at(startIndex).timestamp > timestamp || data.back().timestamp < timestamp) {
@@ -145,8 +149,8 @@ namespace SkySearch {
     /*!
      *  Updates the \p startIndex with the last index having a timestamp <= the given \p timestamp.
      */
-    template <typename T>
-    int updateStartIndex(const std::vector<T> &data, int startIndex, std::int64_t timestamp) noexcept
+    template <typename Data>
+    int updateStartIndex(const Data &data, int startIndex, std::int64_t timestamp) noexcept
     {
         int index {startIndex};
         int size = data.size();
@@ -204,103 +208,153 @@ namespace SkySearch {
         return index;
     }
 
-    template <typename T>
-    bool getCubicInterpolationSupportData(const std::vector<T> &data, std::int64_t timestamp, std::int64_t interpolationWindow, int &startIndex, const T **p0, const T **p1, const T **p2, const T **p3) noexcept
+    /*!
+     * Returns the indices of the four support points p0, p1, p2, p3 for a cubic interpolation at
+     * the given \p timestamp, or \c InvalidIndex if no sample lies within the \p interpolationWindow.
+     *
+     * Only the timestamps of the \p data are accessed, so \p data may also be a view which merely
+     * provides the timestamps of the samples.
+     *
+     * \return \c true if valid support indices exist; \c false else
+     * \sa getCubicInterpolationSupportData
+     */
+    template <typename Data>
+    bool getCubicInterpolationSupportIndices(const Data &data, std::int64_t timestamp, std::int64_t interpolationWindow, int &startIndex, int &i0, int &i1, int &i2, int &i3) noexcept
     {
-        static_assert(std::is_base_of<TimeVariableData, T>::value, "T not derived from TimeVariableData");
-
+        const int size = static_cast<int>(data.size());
         startIndex = updateStartIndex(data, startIndex, timestamp);
         if (startIndex != InvalidIndex) {
 
-            *p1 = &data.at(startIndex);
+            i1 = startIndex;
             // Is p1 within the interpolation window?
-            if ((timestamp - (*p1)->timestamp) <= interpolationWindow) {
+            if ((timestamp - data.at(i1).timestamp) <= interpolationWindow) {
 
                 if (startIndex > 0) {
-                   *p0 = &data.at(startIndex - 1);
+                   i0 = startIndex - 1;
                 } else {
-                   *p0 = *p1;
+                   i0 = i1;
                 }
-                if (startIndex < data.size() - 1) {
-                   if (startIndex < data.size() - 2) {
-                       *p2 = &data.at(startIndex + 1);
-                       *p3 = &data.at(startIndex + 2);
+                if (startIndex < size - 1) {
+                   if (startIndex < size - 2) {
+                       i2 = startIndex + 1;
+                       i3 = startIndex + 2;
                    } else {
                        // p1 is the second to last data
-                       *p2 = &data.at(startIndex + 1);
-                       *p3 = *p2;
+                       i2 = startIndex + 1;
+                       i3 = i2;
                    }
                 } else {
                     // p1 is the last data
-                    *p2 = *p3 = *p1;
+                    i2 = i3 = i1;
                 }
 
                 // Is p2 within the interpolation window?
-                if (((*p2)->timestamp - timestamp) > interpolationWindow) {
-                    *p2 = *p3 = *p1;
+                if ((data.at(i2).timestamp - timestamp) > interpolationWindow) {
+                    i2 = i3 = i1;
                 }
 
             } else {
-                *p0 = *p1 = *p2 = *p3 = nullptr;
+                i0 = i1 = i2 = i3 = InvalidIndex;
             }
 
         } else {
             // We are outside the sampled data time interval: either before the first (even with timestamp = 0;
             // sampled data does not necessarily start with timestamp = 0) or after the last sample point
-            if (data.size() > 0) {
+            if (size > 0) {
                 if (timestamp < data.front().timestamp) {
                     // We always start with the first sample point (regardless of the interpolation window)
-                    *p0 = *p1 = *p2 = *p3 = &data.front();
+                    i0 = i1 = i2 = i3 = 0;
                 } else if (timestamp <= data.back().timestamp + interpolationWindow) {
-                    *p0 = *p1 = *p2 = *p3 = &data.back();
+                    i0 = i1 = i2 = i3 = size - 1;
                 } else {
-                    *p0 = *p1 = *p2 = *p3 = nullptr;
+                    i0 = i1 = i2 = i3 = InvalidIndex;
                 }
             } else {
-                *p0 = *p1 = *p2 = *p3 = nullptr;
+                i0 = i1 = i2 = i3 = InvalidIndex;
             }
         }
 
-        return *p0 != nullptr;
+        return i0 != InvalidIndex;
     }
 
-    template <typename T>
-    bool getLinearInterpolationSupportData(const std::vector<T> &data, std::int64_t timestamp, std::int64_t interpolationWindow, int &startIndex, const T **p1, const T **p2) noexcept
+    template <typename Data, typename T = typename Data::value_type>
+    bool getCubicInterpolationSupportData(const Data &data, std::int64_t timestamp, std::int64_t interpolationWindow, int &startIndex, const T **p0, const T **p1, const T **p2, const T **p3) noexcept
     {
         static_assert(std::is_base_of<TimeVariableData, T>::value, "T not derived from TimeVariableData");
 
+        int i0 {InvalidIndex}, i1 {InvalidIndex}, i2 {InvalidIndex}, i3 {InvalidIndex};
+        if (getCubicInterpolationSupportIndices(data, timestamp, interpolationWindow, startIndex, i0, i1, i2, i3)) {
+            *p0 = &data.at(i0);
+            *p1 = &data.at(i1);
+            *p2 = &data.at(i2);
+            *p3 = &data.at(i3);
+        } else {
+            *p0 = *p1 = *p2 = *p3 = nullptr;
+        }
+        return *p0 != nullptr;
+    }
+
+    /*!
+     * Returns the indices of the two support points p1, p2 for a linear interpolation at
+     * the given \p timestamp, or \c InvalidIndex if no sample lies within the \p interpolationWindow.
+     *
+     * Only the timestamps of the \p data are accessed, so \p data may also be a view which merely
+     * provides the timestamps of the samples.
+     *
+     * \return \c true if valid support indices exist; \c false else
+     * \sa getLinearInterpolationSupportData
+     */
+    template <typename Data>
+    bool getLinearInterpolationSupportIndices(const Data &data, std::int64_t timestamp, std::int64_t interpolationWindow, int &startIndex, int &i1, int &i2) noexcept
+    {
+        const int size = static_cast<int>(data.size());
         startIndex = updateStartIndex(data, startIndex, timestamp);
         if (startIndex != InvalidIndex) {
 
-            *p1 = &data.at(startIndex);
+            i1 = startIndex;
             // Is p1 within the interpolation window?
-            if ((timestamp - (*p1)->timestamp) <= interpolationWindow) {
+            if ((timestamp - data.at(i1).timestamp) <= interpolationWindow) {
 
-                if (startIndex < data.size() - 1) {
-                    *p2 = &data.at(startIndex + 1);
+                if (startIndex < size - 1) {
+                    i2 = startIndex + 1;
                 } else {
                     // p1 is the last data
-                    *p2 = *p1;
+                    i2 = i1;
                 }
 
                 // Is p2 within the interpolation window?
-                if (((*p2)->timestamp - timestamp) > interpolationWindow) {
-                    *p2 = *p1;
+                if ((data.at(i2).timestamp - timestamp) > interpolationWindow) {
+                    i2 = i1;
                 }
 
             } else {
-                *p1 = *p2 = nullptr;
+                i1 = i2 = InvalidIndex;
             }
 
         } else {
             // We are past the last sample point
-            if (data.size() > 0 && timestamp - data.back().timestamp <= interpolationWindow) {
-                *p1 = *p2 = &data.back();
+            if (size > 0 && timestamp - data.back().timestamp <= interpolationWindow) {
+                i1 = i2 = size - 1;
             } else {
-                *p1 = *p2 = nullptr;
+                i1 = i2 = InvalidIndex;
             }
         }
 
+        return i1 != InvalidIndex;
+    }
+
+    template <typename Data, typename T = typename Data::value_type>
+    bool getLinearInterpolationSupportData(const Data &data, std::int64_t timestamp, std::int64_t interpolationWindow, int &startIndex, const T **p1, const T **p2) noexcept
+    {
+        static_assert(std::is_base_of<TimeVariableData, T>::value, "T not derived from TimeVariableData");
+
+        int i1 {InvalidIndex}, i2 {InvalidIndex};
+        if (getLinearInterpolationSupportIndices(data, timestamp, interpolationWindow, startIndex, i1, i2)) {
+            *p1 = &data.at(i1);
+            *p2 = &data.at(i2);
+        } else {
+            *p1 = *p2 = nullptr;
+        }
         return *p1 != nullptr;
     }
 
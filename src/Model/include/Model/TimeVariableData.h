@@ -29,6 +29,11 @@
 
 #include "ModelLib.h"
 
+/*!
+ * The common base of all sampled data. The sampled data is kept trivially copyable: no virtual
+ * functions (including the destructor) and only trivially copyable members, such that
+ * the samples can be copied in bulk (\c memcpy), for instance into a BLOB.
+ */
 struct MODEL_API TimeVariableData
 {
     TimeVariableData() = default;
@@ -36,7 +41,7 @@ struct MODEL_API TimeVariableData
     TimeVariableData(TimeVariableData &&rhs) = default;
     TimeVariableData &operator=(const TimeVariableData &rhs) = default;
     TimeVariableData &operator=(TimeVariableData &&rhs) = default;
-    virtual ~TimeVariableData() = default;
+    ~TimeVariableData() = default;
 
     /*!
      * Defines the way (use case) the sampled data is accessed. A distinction is made for the seek access:
@@ -0,0 +1,120 @@
+/**
+ * Sky Dolly - The Black Sheep for Your Flight Recordings
+ *
+ * Copyright (c) 2020 - 2025 Oliver Knoll
+ *
+ * MIT License
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this
+ * software and associated documentation files (the "Software"), to deal in the Software
+ * without restriction, including without limitation the rights to use, copy, modify, merge,
+ * publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons
+ * to whom the Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or
+ * substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED *AS IS*, WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR
+ * PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE
+ * FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+ * OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ */
+#ifndef TRACKOVERVIEW_H
+#define TRACKOVERVIEW_H
+
+#include <cstdint>
+#include <cstddef>
+
+#include "PositionData.h"
+
+/*!
+ * The multi-resolution (level of detail) overview of the position data of an aircraft:
+ * the samples are summarised in buckets of fixed duration, such that overview queries
+ * only need to process the buckets instead of all samples.
+ *
+ * \sa Position#getTrackOverview
+ */
+namespace TrackOverview
+{
+    /*!
+     * The bucket duration of the available levels of detail.
+     */
+    enum struct Resolution: std::uint8_t
+    {
+        /*! One second buckets */
+        OneSecond,
+        /*! Ten second buckets */
+        TenSeconds,
+        /*! One minute buckets */
+        OneMinute,
+        /*! Number of available resolutions */
+        Count
+    };
+
+    /*!
+     * Returns the bucket duration of the given \p resolution.
+     *
+     * \param resolution
+     *        the resolution of the overview
+     * \return the duration of each bucket [milliseconds]
+     */
+    constexpr std::int64_t getBucketDuration(Resolution resolution) noexcept
+    {
+        switch (resolution) {
+        case Resolution::OneSecond:
+            return 1000;
+        case Resolution::TenSeconds:
+            return 10'000;
+        case Resolution::OneMinute:
+        case Resolution::Count:
+            break;
+        }
+        return 60'000;
+    }
+
+    /*!
+     * The minimum, maximum and average value of a bucket.
+     */
+    struct Range
+    {
+        double minimum {0.0};
+        double maximum {0.0};
+        double average {0.0};
+    };
+
+    /*!
+     * Summarises all position samples within [startTimestamp, endTimestamp).
+     *
+     * Note that the longitude range is not meaningful for buckets crossing the
+     * antimeridian; use the \c center and \c radius for spatial queries instead.
+     */
+    struct Bucket
+    {
+        /*! The start of the bucket, inclusive [milliseconds] (without the time offset of the aircraft) */
+        std::int64_t startTimestamp {0};
+        /*! The end of the bucket, exclusive [milliseconds] (without the time offset of the aircraft) */
+        std::int64_t endTimestamp {0};
+        /*! The index of the first sample within the bucket */
+        std::size_t firstIndex {0};
+        /*! The number of samples within the bucket; always greater than 0 */
+        std::size_t sampleCount {0};
+
+        /*! [degrees] */
+        Range latitude;
+        /*! [degrees] */
+        Range longitude;
+        /*! [feet] */
+        Range altitude;
+        /*! The ground speed, derived from consecutive samples [meters per second] */
+        Range groundSpeed;
+
+        /*! A sample within the bucket, serving as center of the bounding circle */
+        PositionData center;
+        /*! The geodesic distance from the \c center to the most distant sample within the bucket [meters] */
+        double radius {0.0};
+    };
+}
+
+#endif // TRACKOVERVIEW_H
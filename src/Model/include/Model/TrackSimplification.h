@@ -0,0 +1,236 @@
+/**
+ * Sky Dolly - The Black Sheep for Your Flight Recordings
+ *
+ * Copyright (c) 2020 - 2025 Oliver Knoll
+ *
+ * MIT License
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this
+ * software and associated documentation files (the "Software"), to deal in the Software
+ * without restriction, including without limitation the rights to use, copy, modify, merge,
+ * publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons
+ * to whom the Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or
+ * substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED *AS IS*, WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR
+ * PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE
+ * FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+ * OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ */
+#ifndef TRACKSIMPLIFICATION_H
+#define TRACKSIMPLIFICATION_H
+
+#include <vector>
+#include <utility>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+
+#include <Kernel/Convert.h>
+#include <Kernel/SkyMath.h>
+#include "PositionData.h"
+
+/*!
+ * Error-bounded simplification of position tracks.
+ *
+ * The track is first simplified with a Douglas-Peucker variant which measures the deviation of each
+ * sample to the \e time-synchronised point on the line between the two enclosing kept samples (taking
+ * latitude, longitude, altitude and time into account). For replay the result is then refined against
+ * the Hermite interpolation which is used by Position#interpolate: samples are re-inserted until every
+ * original sample lies within the given maximum deviation of the interpolated, simplified track.
+ *
+ * The \c Data container (e.g. \c std::vector or SegmentedVector) must provide random access to PositionData
+ * with ascending timestamps.
+ */
+namespace TrackSimplification
+{
+    /*!
+     * The default maximum deviation of the simplified track [meters].
+     */
+    constexpr double DefaultMaxDeviation = 2.0;
+
+    /*!
+     * The interpolation with which the simplified track is reconstructed.
+     */
+    enum struct Interpolation: std::uint8_t
+    {
+        /*! Straight line segments, typically for export (e.g. KML, GPX) */
+        Linear,
+        /*! Hermite (cubic) interpolation, as used on replay */
+        Hermite
+    };
+
+    /*!
+     * Returns the \p timestamp normalised to [0.0, 1.0] with respect to the timestamps of \p p1 and \p p2.
+     */
+    inline double normaliseTimestamp(const PositionData &p1, const PositionData &p2, std::int64_t timestamp) noexcept
+    {
+        const auto t2 = p2.timestamp - p1.timestamp;
+        return t2 != 0 ? static_cast<double>(timestamp - p1.timestamp) / static_cast<double>(t2) : 0.0;
+    }
+
+    /*!
+     * Returns the approximate distance between the two given positions [meters]. For short distances
+     * the local tangent plane is a good approximation, which is sufficient for measuring deviations.
+     */
+    inline double distance(double latitude1, double longitude1, double altitude1,
+                           double latitude2, double longitude2, double altitude2) noexcept
+    {
+        const double meanLatitude = Convert::degreesToRadians((latitude1 + latitude2) / 2.0);
+        const double dx = Convert::degreesToRadians(std::remainder(longitude2 - longitude1, 360.0)) * std::cos(meanLatitude) * SkyMath::EarthRadius;
+        const double dy = Convert::degreesToRadians(latitude2 - latitude1) * SkyMath::EarthRadius;
+        const double dz = Convert::feetToMeters(altitude2 - altitude1);
+        return std::sqrt(dx * dx + dy * dy + dz * dz);
+    }
+
+    /*!
+     * Returns the synchronised distance of \p sample to the linearly interpolated position
+     * between \p p1 and \p p2 at the time of \p sample [meters].
+     */
+    inline double synchronisedDistance(const PositionData &p1, const PositionData &p2, const PositionData &sample) noexcept
+    {
+        const double tn = normaliseTimestamp(p1, p2, sample.timestamp);
+        const double latitude = SkyMath::interpolateLinear(p1.latitude, p2.latitude, tn);
+        const double longitude = p1.longitude + std::remainder(p2.longitude - p1.longitude, 360.0) * tn;
+        const double altitude = SkyMath::interpolateLinear(p1.altitude, p2.altitude, tn);
+        return distance(latitude, longitude, altitude, sample.latitude, sample.longitude, sample.altitude);
+    }
+
+    /*!
+     * Returns the distance of \p sample to the Hermite interpolated position between \p p1 and \p p2
+     * (with support points \p p0 and \p p3) at the time of \p sample [meters].
+     */
+    inline double hermiteDistance(const PositionData &p0, const PositionData &p1, const PositionData &p2, const PositionData &p3, const PositionData &sample) noexcept
+    {
+        const double tn = normaliseTimestamp(p1, p2, sample.timestamp);
+        const double latitude = SkyMath::interpolateTimedHermite(p0.latitude, p1.latitude, p2.latitude, p3.latitude, p0.timestamp, p1.timestamp, p2.timestamp, p3.timestamp, tn);
+        const double longitude = SkyMath::interpolateTimedHermite180(p0.longitude, p1.longitude, p2.longitude, p3.longitude, p0.timestamp, p1.timestamp, p2.timestamp, p3.timestamp, tn);
+        const double altitude = SkyMath::interpolateTimedHermite(p0.altitude, p1.altitude, p2.altitude, p3.altitude, p0.timestamp, p1.timestamp, p2.timestamp, p3.timestamp, tn);
+        return distance(latitude, longitude, altitude, sample.latitude, sample.longitude, sample.altitude);
+    }
+
+    /*!
+     * Simplifies the position \p data such that the interpolated track deviates at most
+     * \p maxDeviation meters from the original samples.
+     *
+     * \param data
+     *        the position data to be simplified, with ascending timestamps
+     * \param maxDeviation
+     *        the maximum deviation [meters]
+     * \param interpolation
+     *        the interpolation with which the simplified track is reconstructed
+     * \return the ascending indices of the samples to be kept; the first and last sample are always kept
+     */
+    template <typename Data>
+    std::vector<std::size_t> simplifiedIndices(const Data &data, double maxDeviation, Interpolation interpolation = Interpolation::Hermite) noexcept
+    {
+        const std::size_t count = data.size();
+        std::vector<std::size_t> indices;
+        if (count <= 2) {
+            for (std::size_t i = 0; i < count; ++i) {
+                indices.push_back(i);
+            }
+            return indices;
+        }
+
+        std::vector<bool> keep(count, false);
+        keep.front() = true;
+        keep.back() = true;
+
+        // Douglas-Peucker with synchronised (time-aware) distances; iterative, in order
+        // to avoid deep recursion on long tracks
+        std::vector<std::pair<std::size_t, std::size_t>> stack;
+        stack.emplace_back(0, count - 1);
+        while (!stack.empty()) {
+            const auto [first, last] = stack.back();
+            stack.pop_back();
+            double maxDistance {0.0};
+            std::size_t maxIndex {first};
+            for (std::size_t i = first + 1; i < last; ++i) {
+                const double d = synchronisedDistance(data[first], data[last], data[i]);
+                if (d > maxDistance) {
+                    maxDistance = d;
+                    maxIndex = i;
+                }
+            }
+            if (maxDistance > maxDeviation) {
+                keep[maxIndex] = true;
+                stack.emplace_back(first, maxIndex);
+                stack.emplace_back(maxIndex, last);
+            }
+        }
+
+        const auto collectKeptIndices = [&keep, &indices, count]() {
+            indices.clear();
+            for (std::size_t i = 0; i < count; ++i) {
+                if (keep[i]) {
+                    indices.push_back(i);
+                }
+            }
+        };
+        collectKeptIndices();
+
+        // Refinement against the Hermite interpolation: re-insert the worst sample of each segment
+        // which exceeds the maximum deviation, until all segments are within the tolerance
+        bool refined {interpolation == Interpolation::Hermite};
+        while (refined) {
+            refined = false;
+            const std::size_t keptCount = indices.size();
+            for (std::size_t k = 0; k + 1 < keptCount; ++k) {
+                const std::size_t i1 = indices[k];
+                const std::size_t i2 = indices[k + 1];
+                const std::size_t i0 = k > 0 ? indices[k - 1] : i1;
+                const std::size_t i3 = k + 2 < keptCount ? indices[k + 2] : i2;
+                double maxDistance {0.0};
+                std::size_t maxIndex {i1};
+                for (std::size_t i = i1 + 1; i < i2; ++i) {
+                    const double d = hermiteDistance(data[i0], data[i1], data[i2], data[i3], data[i]);
+                    if (d > maxDistance) {
+                        maxDistance = d;
+                        maxIndex = i;
+                    }
+                }
+                if (maxDistance > maxDeviation) {
+                    keep[maxIndex] = true;
+                    refined = true;
+                }
+            }
+            if (refined) {
+                collectKeptIndices();
+            }
+        }
+
+        return indices;
+    }
+
+    /*!
+     * Simplifies the position \p data such that the interpolated track deviates at most
+     * \p maxDeviation meters from the original samples.
+     *
+     * \param data
+     *        the position data to be simplified, with ascending timestamps
+     * \param maxDeviation
+     *        the maximum deviation [meters]
+     * \param interpolation
+     *        the interpolation with which the simplified track is reconstructed
+     * \return the kept samples
+     * \sa simplifiedIndices
+     */
+    template <typename Data>
+    std::vector<PositionData> simplify(const Data &data, double maxDeviation, Interpolation interpolation = Interpolation::Hermite) noexcept
+    {
+        std::vector<PositionData> simplifiedData;
+        const auto indices = simplifiedIndices(data, maxDeviation, interpolation);
+        simplifiedData.reserve(indices.size());
+        for (const auto index : indices) {
+            simplifiedData.push_back(data[index]);
+        }
+        return simplifiedData;
+    }
+}
+
+#endif // TRACKSIMPLIFICATION_H
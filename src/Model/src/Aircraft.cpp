@@ -23,6 +23,7 @@
  */
 #include <algorithm>
 #include <memory>
+#include <cstddef>
 #include <cstdint>
 
 #include <Kernel/Const.h>
@@ -193,6 +194,23 @@ bool Aircraft::hasRecording() const noexcept
     return d->position.count() > 0;
 }
 
+void Aircraft::compact() noexcept
+{
+    d->position.compact();
+    d->engine.compact();
+}
+
+std::size_t Aircraft::getMemoryUsage() const noexcept
+{
+    return d->position.getMemoryUsage() +
+           d->attitude.getMemoryUsage() +
+           d->engine.getMemoryUsage() +
+           d->primaryFlightControl.getMemoryUsage() +
+           d->secondaryFlightControl.getMemoryUsage() +
+           d->aircraftHandle.getMemoryUsage() +
+           d->light.getMemoryUsage();
+}
+
 void Aircraft::clear() noexcept
 {
     d->aircraftInfo.clear();
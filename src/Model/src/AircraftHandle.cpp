@@ -28,6 +28,7 @@
 #include <Kernel/SkyMath.h>
 #include "TimeVariableData.h"
 #include "SkySearch.h"
+#include "SampleCursor.h"
 #include "AircraftInfo.h"
 #include "AircraftHandleData.h"
 #include "AircraftHandle.h"
@@ -38,15 +39,15 @@ AircraftHandle::AircraftHandle(const AircraftInfo &aircraftInfo) noexcept
     : AbstractComponent(aircraftInfo)
 {}
 
-const AircraftHandleData &AircraftHandle::interpolate(std::int64_t timestamp, TimeVariableData::Access access) const noexcept
+const AircraftHandleData &AircraftHandle::interpolate(std::int64_t timestamp, TimeVariableData::Access access, SampleCursor<AircraftHandleData> &cursor) const noexcept
 {
     const AircraftHandleData *p1 {nullptr}, *p2 {nullptr};
     const auto timeOffset = access != TimeVariableData::Access::NoTimeOffset ? getAircraftInfo().timeOffset : 0;
     const auto adjustedTimestamp = std::max(timestamp + timeOffset, std::int64_t(0));
 
-    if (getCurrentTimestamp() != adjustedTimestamp || getCurrentAccess() != access) {
+    if (!bindCursor(cursor, adjustedTimestamp, access)) {
 
-        int currentIndex = getCurrentIndex();
+        int currentIndex = cursor.index;
         double tn {0.0};
         switch (access) {
         case TimeVariableData::Access::Linear:
@@ -73,35 +74,35 @@ const AircraftHandleData &AircraftHandle::interpolate(std::int64_t timestamp, Ti
         }
 
         if (p1 != nullptr) {
-            m_currentData.brakeLeftPosition = SkyMath::interpolateLinear(p1->brakeLeftPosition, p2->brakeLeftPosition, tn);
-            m_currentData.brakeRightPosition = SkyMath::interpolateLinear(p1->brakeRightPosition, p2->brakeRightPosition, tn);
-            m_currentData.gearSteerPosition = SkyMath::interpolateLinear(p1->gearSteerPosition, p2->gearSteerPosition, tn);
-            m_currentData.waterRudderHandlePosition = SkyMath::interpolateLinear(p1->waterRudderHandlePosition, p2->waterRudderHandlePosition, tn);
-            m_currentData.tailhookPosition = SkyMath::interpolateLinear(p1->tailhookPosition, p2->tailhookPosition, tn);
-            m_currentData.canopyOpen = SkyMath::interpolateLinear(p1->canopyOpen, p2->canopyOpen, tn);
-            m_currentData.leftWingFolding = SkyMath::interpolateLinear(p1->leftWingFolding, p2->leftWingFolding, tn);
-            m_currentData.rightWingFolding = SkyMath::interpolateLinear(p1->rightWingFolding, p2->rightWingFolding, tn);
+            cursor.data.brakeLeftPosition = SkyMath::interpolateLinear(p1->brakeLeftPosition, p2->brakeLeftPosition, tn);
+            cursor.data.brakeRightPosition = SkyMath::interpolateLinear(p1->brakeRightPosition, p2->brakeRightPosition, tn);
+            cursor.data.gearSteerPosition = SkyMath::interpolateLinear(p1->gearSteerPosition, p2->gearSteerPosition, tn);
+            cursor.data.waterRudderHandlePosition = SkyMath::interpolateLinear(p1->waterRudderHandlePosition, p2->waterRudderHandlePosition, tn);
+            cursor.data.tailhookPosition = SkyMath::interpolateLinear(p1->tailhookPosition, p2->tailhookPosition, tn);
+            cursor.data.canopyOpen = SkyMath::interpolateLinear(p1->canopyOpen, p2->canopyOpen, tn);
+            cursor.data.leftWingFolding = SkyMath::interpolateLinear(p1->leftWingFolding, p2->leftWingFolding, tn);
+            cursor.data.rightWingFolding = SkyMath::interpolateLinear(p1->rightWingFolding, p2->rightWingFolding, tn);
             // No interpolation for boolean values
-            m_currentData.gearHandlePosition = p1->gearHandlePosition;
-            m_currentData.tailhookHandlePosition = p1->tailhookHandlePosition;
-            m_currentData.foldingWingHandlePosition = p1->foldingWingHandlePosition;
-            m_currentData.smokeEnabled = p1->smokeEnabled;
-            m_currentData.timestamp = adjustedTimestamp;
+            cursor.data.gearHandlePosition = p1->gearHandlePosition;
+            cursor.data.tailhookHandlePosition = p1->tailhookHandlePosition;
+            cursor.data.foldingWingHandlePosition = p1->foldingWingHandlePosition;
+            cursor.data.smokeEnabled = p1->smokeEnabled;
+            cursor.data.timestamp = adjustedTimestamp;
         } else {
             // Certain aircraft override the CANOPY OPEN, so values need to be repeatedly set
             if (Settings::getInstance().isRepeatCanopyOpenEnabled()) {
-                m_currentData.timestamp = adjustedTimestamp;
+                cursor.data.timestamp = adjustedTimestamp;
             } else {
                 // No recorded data (and no repeat), or the timestamp exceeds the timestamp of the last recorded data
-                m_currentData.reset();
+                cursor.data.reset();
             }
         }
 
-        setCurrentIndex(currentIndex);
-        setCurrentTimestamp(adjustedTimestamp);
-        setCurrentAccess(access);
+        cursor.index = currentIndex;
+        cursor.timestamp = adjustedTimestamp;
+        cursor.access = access;
     }
-    return m_currentData;
+    return cursor.data;
 }
 
 template class AbstractComponent<AircraftHandleData>;
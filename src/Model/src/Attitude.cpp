@@ -31,6 +31,7 @@
 #include <Kernel/SkyMath.h>
 #include "TimeVariableData.h"
 #include "SkySearch.h"
+#include "SampleCursor.h"
 #include "AircraftInfo.h"
 #include "AttitudeData.h"
 #include "Attitude.h"
@@ -46,14 +47,14 @@ Attitude::Attitude(const AircraftInfo &aircraftInfo) noexcept
     : AbstractComponent(aircraftInfo)
 {}
 
-const AttitudeData &Attitude::interpolate(std::int64_t timestamp, TimeVariableData::Access access) const noexcept
+const AttitudeData &Attitude::interpolate(std::int64_t timestamp, TimeVariableData::Access access, SampleCursor<AttitudeData> &cursor) const noexcept
 {
     const AttitudeData *p0 {nullptr}, *p1 {nullptr}, *p2 {nullptr}, *p3 {nullptr};
     const auto timeOffset = access != TimeVariableData::Access::NoTimeOffset ? getAircraftInfo().timeOffset : 0;
     const auto adjustedTimestamp = std::max(timestamp + timeOffset, std::int64_t(0));
 
-    if (getCurrentTimestamp() != adjustedTimestamp || getCurrentAccess() != access) {
-        int currentIndex = getCurrentIndex();
+    if (!bindCursor(cursor, adjustedTimestamp, access)) {
+        int currentIndex = cursor.index;
         double tn {0.0};
         // Attitude data is always interpolated within an "infinite" interpolation window, in order to
         // take imported "sparse flight plans" into account
@@ -64,31 +65,31 @@ const AttitudeData &Attitude::interpolate(std::int64_t timestamp, TimeVariableDa
             // Aircraft attitude
 
             // Pitch: [-90, 90] - no discontinuity at +/- 90
-            m_currentData.pitch = SkyMath::interpolateHermite(p0->pitch, p1->pitch, p2->pitch, p3->pitch, tn, ::Tension);
+            cursor.data.pitch = SkyMath::interpolateHermite(p0->pitch, p1->pitch, p2->pitch, p3->pitch, tn, ::Tension);
             // Bank: [-180, 180] - discontinuity at +/- 180
-            m_currentData.bank  = SkyMath::interpolateHermite180(p0->bank, p1->bank, p2->bank, p3->bank, tn, ::Tension);
+            cursor.data.bank  = SkyMath::interpolateHermite180(p0->bank, p1->bank, p2->bank, p3->bank, tn, ::Tension);
             // Heading: [0, 360] - discontinuity at 0/360
-            m_currentData.trueHeading = SkyMath::interpolateHermite360(p0->trueHeading, p1->trueHeading, p2->trueHeading, p3->trueHeading, tn, ::Tension);
+            cursor.data.trueHeading = SkyMath::interpolateHermite360(p0->trueHeading, p1->trueHeading, p2->trueHeading, p3->trueHeading, tn, ::Tension);
 
             // Velocity
-            m_currentData.velocityBodyX = SkyMath::interpolateLinear(p1->velocityBodyX, p2->velocityBodyX, tn);
-            m_currentData.velocityBodyY = SkyMath::interpolateLinear(p1->velocityBodyY, p2->velocityBodyY, tn);
-            m_currentData.velocityBodyZ = SkyMath::interpolateLinear(p1->velocityBodyZ, p2->velocityBodyZ, tn);
+            cursor.data.velocityBodyX = SkyMath::interpolateLinear(p1->velocityBodyX, p2->velocityBodyX, tn);
+            cursor.data.velocityBodyY = SkyMath::interpolateLinear(p1->velocityBodyY, p2->velocityBodyY, tn);
+            cursor.data.velocityBodyZ = SkyMath::interpolateLinear(p1->velocityBodyZ, p2->velocityBodyZ, tn);
 
             // On ground (boolean value - no interpolation)
-            m_currentData.onGround = p1->onGround;
+            cursor.data.onGround = p1->onGround;
 
-            m_currentData.timestamp = adjustedTimestamp;
+            cursor.data.timestamp = adjustedTimestamp;
         } else {
             // No recorded data, or the timestamp exceeds the timestamp of the last recorded data
-            m_currentData.reset();
+            cursor.data.reset();
         }
 
-        setCurrentIndex(currentIndex);
-        setCurrentTimestamp(adjustedTimestamp);
-        setCurrentAccess(access);
+        cursor.index = currentIndex;
+        cursor.timestamp = adjustedTimestamp;
+        cursor.access = access;
     }
-    return m_currentData;
+    return cursor.data;
 }
 
 template class AbstractComponent<AttitudeData>;
@@ -22,13 +22,16 @@
  * DEALINGS IN THE SOFTWARE.
  */
 #include <algorithm>
+#include <array>
 #include <cstdint>
 
 #include <Kernel/SkyMath.h>
 #include "TimeVariableData.h"
 #include "SkySearch.h"
+#include "SampleCursor.h"
 #include "AircraftInfo.h"
 #include "EngineData.h"
+#include "EngineCodec.h"
 #include "Engine.h"
 
 // PUBLIC
@@ -37,20 +40,35 @@ Engine::Engine(const AircraftInfo &aircraftInfo) noexcept
     : AbstractComponent(aircraftInfo)
 {}
 
-const EngineData &Engine::interpolate(std::int64_t timestamp, TimeVariableData::Access access) const noexcept
+const EngineData &Engine::interpolate(std::int64_t timestamp, TimeVariableData::Access access, SampleCursor<EngineData> &cursor) const noexcept
 {
     const EngineData *p1 {nullptr}, *p2 {nullptr};
     const auto timeOffset = access != TimeVariableData::Access::NoTimeOffset ? getAircraftInfo().timeOffset : 0;
     const auto adjustedTimestamp = std::max(timestamp + timeOffset, std::int64_t(0));
 
-    if (getCurrentTimestamp() != adjustedTimestamp || getCurrentAccess() != access) {
-        int currentIndex = getCurrentIndex();
+    if (!bindCursor(cursor, adjustedTimestamp, access)) {
+        int currentIndex = cursor.index;
         double tn {0.0};
+        // The decoded support points, in case the engine data is compactly encoded
+        std::array<EngineData, 2> support;
+        const auto compactLock = lockCompactData();
+        const bool compact = compactLock.owns_lock();
         switch (access) {
         case TimeVariableData::Access::Linear:
             [[fallthrough]];
         case TimeVariableData::Access::NoTimeOffset:
-            if (SkySearch::getLinearInterpolationSupportData(getData(), adjustedTimestamp, SkySearch::DefaultInterpolationWindow, currentIndex, &p1, &p2)) {
+            if (compact) {
+                // Only decode the support points
+                const auto &compactData = getCompactData();
+                int i1 {SkySearch::InvalidIndex}, i2 {SkySearch::InvalidIndex};
+                if (SkySearch::getLinearInterpolationSupportIndices(compactData.getTimestamps(), adjustedTimestamp, SkySearch::DefaultInterpolationWindow, currentIndex, i1, i2)) {
+                    support[0] = compactData.at(i1);
+                    support[1] = compactData.at(i2);
+                    p1 = &support[0];
+                    p2 = &support[1];
+                    tn = SkySearch::normaliseTimestamp(*p1, *p2, adjustedTimestamp);
+                }
+            } else if (SkySearch::getLinearInterpolationSupportData(getData(), adjustedTimestamp, SkySearch::DefaultInterpolationWindow, currentIndex, &p1, &p2)) {
                 tn = SkySearch::normaliseTimestamp(*p1, *p2, adjustedTimestamp);
             }
             break;
@@ -59,9 +77,18 @@ const EngineData &Engine::interpolate(std::int64_t timestamp, TimeVariableData::
         case TimeVariableData::Access::ContinuousSeek:
             // Get the last sample data just before the seeked position
             // (that sample point may lie far outside of the "sample window")
-            currentIndex = SkySearch::updateStartIndex(getData(), currentIndex, adjustedTimestamp);
+            if (compact) {
+                currentIndex = SkySearch::updateStartIndex(getCompactData().getTimestamps(), currentIndex, adjustedTimestamp);
+            } else {
+                currentIndex = SkySearch::updateStartIndex(getData(), currentIndex, adjustedTimestamp);
+            }
             if (currentIndex != SkySearch::InvalidIndex) {
-                p1 = &getData().at(currentIndex);
+                if (compact) {
+                    support[0] = getCompactData().at(currentIndex);
+                    p1 = &support[0];
+                } else {
+                    p1 = &getData().at(currentIndex);
+                }
                 p2 = p1;
                 tn = 0.0;
             } else {
@@ -71,47 +98,47 @@ const EngineData &Engine::interpolate(std::int64_t timestamp, TimeVariableData::
         }
 
         if (p1 != nullptr) {
-            m_currentData.throttleLeverPosition1 = SkyMath::interpolateLinear(p1->throttleLeverPosition1, p2->throttleLeverPosition1, tn);
-            m_currentData.throttleLeverPosition2 = SkyMath::interpolateLinear(p1->throttleLeverPosition2, p2->throttleLeverPosition2, tn);
-            m_currentData.throttleLeverPosition3 = SkyMath::interpolateLinear(p1->throttleLeverPosition3, p2->throttleLeverPosition3, tn);
-            m_currentData.throttleLeverPosition4 = SkyMath::interpolateLinear(p1->throttleLeverPosition4, p2->throttleLeverPosition4, tn);
-            m_currentData.propellerLeverPosition1 = SkyMath::interpolateLinear(p1->propellerLeverPosition1, p2->propellerLeverPosition1, tn);
-            m_currentData.propellerLeverPosition2 = SkyMath::interpolateLinear(p1->propellerLeverPosition2, p2->propellerLeverPosition2, tn);
-            m_currentData.propellerLeverPosition3 = SkyMath::interpolateLinear(p1->propellerLeverPosition3, p2->propellerLeverPosition3, tn);
-            m_currentData.propellerLeverPosition4 = SkyMath::interpolateLinear(p1->propellerLeverPosition4, p2->propellerLeverPosition4, tn);
-            m_currentData.mixtureLeverPosition1 = SkyMath::interpolateLinear(p1->mixtureLeverPosition1, p2->mixtureLeverPosition1, tn);
-            m_currentData.mixtureLeverPosition2 = SkyMath::interpolateLinear(p1->mixtureLeverPosition2, p2->mixtureLeverPosition2, tn);
-            m_currentData.mixtureLeverPosition3 = SkyMath::interpolateLinear(p1->mixtureLeverPosition3, p2->mixtureLeverPosition3, tn);
-            m_currentData.mixtureLeverPosition4 = SkyMath::interpolateLinear(p1->mixtureLeverPosition4, p2->mixtureLeverPosition4, tn);
-            m_currentData.cowlFlapPosition1 = SkyMath::interpolateLinear(p1->cowlFlapPosition1, p2->cowlFlapPosition1, tn);
-            m_currentData.cowlFlapPosition2 = SkyMath::interpolateLinear(p1->cowlFlapPosition2, p2->cowlFlapPosition2, tn);
-            m_currentData.cowlFlapPosition3 = SkyMath::interpolateLinear(p1->cowlFlapPosition3, p2->cowlFlapPosition3, tn);
-            m_currentData.cowlFlapPosition4 = SkyMath::interpolateLinear(p1->cowlFlapPosition4, p2->cowlFlapPosition4, tn);
+            cursor.data.throttleLeverPosition1 = SkyMath::interpolateLinear(p1->throttleLeverPosition1, p2->throttleLeverPosition1, tn);
+            cursor.data.throttleLeverPosition2 = SkyMath::interpolateLinear(p1->throttleLeverPosition2, p2->throttleLeverPosition2, tn);
+            cursor.data.throttleLeverPosition3 = SkyMath::interpolateLinear(p1->throttleLeverPosition3, p2->throttleLeverPosition3, tn);
+            cursor.data.throttleLeverPosition4 = SkyMath::interpolateLinear(p1->throttleLeverPosition4, p2->throttleLeverPosition4, tn);
+            cursor.data.propellerLeverPosition1 = SkyMath::interpolateLinear(p1->propellerLeverPosition1, p2->propellerLeverPosition1, tn);
+            cursor.data.propellerLeverPosition2 = SkyMath::interpolateLinear(p1->propellerLeverPosition2, p2->propellerLeverPosition2, tn);
+            cursor.data.propellerLeverPosition3 = SkyMath::interpolateLinear(p1->propellerLeverPosition3, p2->propellerLeverPosition3, tn);
+            cursor.data.propellerLeverPosition4 = SkyMath::interpolateLinear(p1->propellerLeverPosition4, p2->propellerLeverPosition4, tn);
+            cursor.data.mixtureLeverPosition1 = SkyMath::interpolateLinear(p1->mixtureLeverPosition1, p2->mixtureLeverPosition1, tn);
+            cursor.data.mixtureLeverPosition2 = SkyMath::interpolateLinear(p1->mixtureLeverPosition2, p2->mixtureLeverPosition2, tn);
+            cursor.data.mixtureLeverPosition3 = SkyMath::interpolateLinear(p1->mixtureLeverPosition3, p2->mixtureLeverPosition3, tn);
+            cursor.data.mixtureLeverPosition4 = SkyMath::interpolateLinear(p1->mixtureLeverPosition4, p2->mixtureLeverPosition4, tn);
+            cursor.data.cowlFlapPosition1 = SkyMath::interpolateLinear(p1->cowlFlapPosition1, p2->cowlFlapPosition1, tn);
+            cursor.data.cowlFlapPosition2 = SkyMath::interpolateLinear(p1->cowlFlapPosition2, p2->cowlFlapPosition2, tn);
+            cursor.data.cowlFlapPosition3 = SkyMath::interpolateLinear(p1->cowlFlapPosition3, p2->cowlFlapPosition3, tn);
+            cursor.data.cowlFlapPosition4 = SkyMath::interpolateLinear(p1->cowlFlapPosition4, p2->cowlFlapPosition4, tn);
 
             // No interpolation for battery and starter/combustion states (boolean)
-            m_currentData.electricalMasterBattery1 = p1->electricalMasterBattery1;
-            m_currentData.electricalMasterBattery2 = p1->electricalMasterBattery2;
-            m_currentData.electricalMasterBattery3 = p1->electricalMasterBattery3;
-            m_currentData.electricalMasterBattery4 = p1->electricalMasterBattery4;
-            m_currentData.generalEngineStarter1 = p1->generalEngineStarter1;
-            m_currentData.generalEngineStarter2 = p1->generalEngineStarter2;
-            m_currentData.generalEngineStarter3 = p1->generalEngineStarter3;
-            m_currentData.generalEngineStarter4 = p1->generalEngineStarter4;
-            m_currentData.generalEngineCombustion1 = p1->generalEngineCombustion1;
-            m_currentData.generalEngineCombustion2 = p1->generalEngineCombustion2;
-            m_currentData.generalEngineCombustion3 = p1->generalEngineCombustion3;
-            m_currentData.generalEngineCombustion4 = p1->generalEngineCombustion4;
-            m_currentData.timestamp = adjustedTimestamp;
+            cursor.data.electricalMasterBattery1 = p1->electricalMasterBattery1;
+            cursor.data.electricalMasterBattery2 = p1->electricalMasterBattery2;
+            cursor.data.electricalMasterBattery3 = p1->electricalMasterBattery3;
+            cursor.data.electricalMasterBattery4 = p1->electricalMasterBattery4;
+            cursor.data.generalEngineStarter1 = p1->generalEngineStarter1;
+            cursor.data.generalEngineStarter2 = p1->generalEngineStarter2;
+            cursor.data.generalEngineStarter3 = p1->generalEngineStarter3;
+            cursor.data.generalEngineStarter4 = p1->generalEngineStarter4;
+            cursor.data.generalEngineCombustion1 = p1->generalEngineCombustion1;
+            cursor.data.generalEngineCombustion2 = p1->generalEngineCombustion2;
+            cursor.data.generalEngineCombustion3 = p1->generalEngineCombustion3;
+            cursor.data.generalEngineCombustion4 = p1->generalEngineCombustion4;
+            cursor.data.timestamp = adjustedTimestamp;
         } else {
             // No recorded data, or the timestamp exceeds the timestamp of the last recorded data
-            m_currentData.reset();
+            cursor.data.reset();
         }
 
-        setCurrentIndex(currentIndex);
-        setCurrentTimestamp(adjustedTimestamp);
-        setCurrentAccess(access);
+        cursor.index = currentIndex;
+        cursor.timestamp = adjustedTimestamp;
+        cursor.access = access;
     }
-    return m_currentData;
+    return cursor.data;
 }
 
-template class AbstractComponent<EngineData>;
+template class AbstractComponent<EngineData, EngineCodec>;
@@ -27,6 +27,7 @@
 #include <Kernel/SkyMath.h>
 #include "TimeVariableData.h"
 #include "SkySearch.h"
+#include "SampleCursor.h"
 #include "AircraftInfo.h"
 #include "LightData.h"
 #include "Light.h"
@@ -38,14 +39,14 @@ Light::Light(const AircraftInfo &aircraftInfo) noexcept
     : AbstractComponent(aircraftInfo)
 {}
 
-const LightData &Light::interpolate(std::int64_t timestamp, TimeVariableData::Access access) const noexcept
+const LightData &Light::interpolate(std::int64_t timestamp, TimeVariableData::Access access, SampleCursor<LightData> &cursor) const noexcept
 {
     const LightData *p1 {nullptr}, *p2 {nullptr};
     const auto timeOffset = access != TimeVariableData::Access::NoTimeOffset ? getAircraftInfo().timeOffset : 0;
     const auto adjustedTimestamp = std::max(timestamp + timeOffset, std::int64_t(0));
 
-    if (getCurrentTimestamp() != adjustedTimestamp || getCurrentAccess() != access) {
-        int currentIndex = getCurrentIndex();
+    if (!bindCursor(cursor, adjustedTimestamp, access)) {
+        int currentIndex = cursor.index;
         switch (access) {
         case TimeVariableData::Access::Linear:
             [[fallthrough]];
@@ -69,18 +70,18 @@ const LightData &Light::interpolate(std::int64_t timestamp, TimeVariableData::Ac
 
         if (p1 != nullptr) {
             // No interpolation for light states
-            m_currentData.lightStates = p1->lightStates;
-            m_currentData.timestamp = adjustedTimestamp;
+            cursor.data.lightStates = p1->lightStates;
+            cursor.data.timestamp = adjustedTimestamp;
         } else {
             // No recorded data, or the timestamp exceeds the timestamp of the last recorded data
-            m_currentData.reset();
+            cursor.data.reset();
         }
 
-        setCurrentIndex(currentIndex);
-        setCurrentTimestamp(adjustedTimestamp);
-        setCurrentAccess(access);
+        cursor.index = currentIndex;
+        cursor.timestamp = adjustedTimestamp;
+        cursor.access = access;
     }
-    return m_currentData;
+    return cursor.data;
 }
 
 template class AbstractComponent<LightData>;
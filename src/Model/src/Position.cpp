@@ -21,71 +21,265 @@
  * OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
  * DEALINGS IN THE SOFTWARE.
  */
+#include <memory>
+#include <vector>
+#include <array>
+#include <mutex>
 #include <algorithm>
+#include <cstddef>
 #include <cstdint>
 
 #ifdef DEBUG
 #include <QDebug>
 #endif
 
+#include <Kernel/Enum.h>
 #include <Kernel/SkyMath.h>
 #include "TimeVariableData.h"
 #include "SkySearch.h"
+#include "SampleCursor.h"
 #include "AircraftInfo.h"
 #include "PositionData.h"
+#include "PositionCodec.h"
+#include "TrackOverview.h"
 #include "Position.h"
 
 namespace
 {
     constexpr double Tension = 0.0;
+    // Each coarser level merges this many buckets of the previous (finer) level
+    constexpr std::array<std::int64_t, Enum::underly(TrackOverview::Resolution::Count)> MergeFactors {1, 10, 6};
+
+    inline void initialise(TrackOverview::Range &range, double value) noexcept
+    {
+        range.minimum = value;
+        range.maximum = value;
+        range.average = value;
+    }
+
+    // Accumulates the sum into the average, which is to be divided by the count afterwards
+    inline void accumulate(TrackOverview::Range &range, double value) noexcept
+    {
+        range.minimum = std::min(range.minimum, value);
+        range.maximum = std::max(range.maximum, value);
+        range.average += value;
+    }
+
+    inline double distance(const PositionData &p1, const PositionData &p2) noexcept
+    {
+        return SkyMath::geodesicDistance(SkyMath::Coordinate(p1.latitude, p1.longitude),
+                                         SkyMath::Coordinate(p2.latitude, p2.longitude));
+    }
 }
 
+struct PositionPrivate
+{
+    std::mutex overviewMutex;
+    std::array<std::vector<TrackOverview::Bucket>, Enum::underly(TrackOverview::Resolution::Count)> overview;
+    // The generation of the position data from which the overview has been built
+    bool overviewValid {false};
+    std::uint64_t overviewGeneration {0};
+};
+
 // PUBLIC
 
 Position::Position(const AircraftInfo &aircraftInfo) noexcept
-    : AbstractComponent(aircraftInfo)
+    : AbstractComponent(aircraftInfo),
+      d {std::make_unique<PositionPrivate>()}
 {}
 
-const PositionData &Position::interpolate(std::int64_t timestamp, TimeVariableData::Access access) const noexcept
+Position::Position(Position &&rhs) noexcept = default;
+Position::~Position() = default;
+
+const PositionData &Position::interpolate(std::int64_t timestamp, TimeVariableData::Access access, SampleCursor<PositionData> &cursor) const noexcept
 {
     const PositionData *p0 {nullptr}, *p1 {nullptr}, *p2 {nullptr}, *p3 {nullptr};
     const auto timeOffset = access != TimeVariableData::Access::NoTimeOffset ? getAircraftInfo().timeOffset : 0;
     const auto adjustedTimestamp = std::max(timestamp + timeOffset, std::int64_t(0));
 
-    if (getCurrentTimestamp() != adjustedTimestamp || getCurrentAccess() != access) {
-        int currentIndex = getCurrentIndex();
+    if (!bindCursor(cursor, adjustedTimestamp, access)) {
+        int currentIndex = cursor.index;
         double tn {0.0};
+        // The decoded support points, in case the position data is compactly encoded
+        std::array<PositionData, 4> support;
         // Position data is always interpolated within an "infinite" interpolation window, in order to
         // take imported "sparse flight plans" into account
-        if (SkySearch::getCubicInterpolationSupportData(getData(), adjustedTimestamp, SkySearch::InfinitetInterpolationWindow, currentIndex, &p0, &p1, &p2, &p3)) {
+        const auto compactLock = lockCompactData();
+        if (compactLock.owns_lock()) {
+            // Only decode the support points
+            const auto &compactData = getCompactData();
+            int i0 {SkySearch::InvalidIndex}, i1 {SkySearch::InvalidIndex}, i2 {SkySearch::InvalidIndex}, i3 {SkySearch::InvalidIndex};
+            if (SkySearch::getCubicInterpolationSupportIndices(compactData.getTimestamps(), adjustedTimestamp, SkySearch::InfinitetInterpolationWindow, currentIndex, i0, i1, i2, i3)) {
+                support[0] = compactData.at(i0);
+                support[1] = compactData.at(i1);
+                support[2] = compactData.at(i2);
+                support[3] = compactData.at(i3);
+                p0 = &support[0];
+                p1 = &support[1];
+                p2 = &support[2];
+                p3 = &support[3];
+                tn = SkySearch::normaliseTimestamp(*p1, *p2, adjustedTimestamp);
+            }
+        } else if (SkySearch::getCubicInterpolationSupportData(getData(), adjustedTimestamp, SkySearch::InfinitetInterpolationWindow, currentIndex, &p0, &p1, &p2, &p3)) {
             tn = SkySearch::normaliseTimestamp(*p1, *p2, adjustedTimestamp);
         }
         if (p1 != nullptr) {
             // Aircraft position
 
             // Latitude: [-90, 90] - no discontinuity at +/- 90
-            m_currentData.latitude  = SkyMath::interpolateHermite(p0->latitude, p1->latitude, p2->latitude, p3->latitude, tn);
+            cursor.data.latitude  = SkyMath::interpolateTimedHermite(p0->latitude, p1->latitude, p2->latitude, p3->latitude, p0->timestamp, p1->timestamp, p2->timestamp, p3->timestamp, tn);
             // Longitude: [-180, 180] - discontinuity at the +/- 180 meridian
-            m_currentData.longitude = SkyMath::interpolateHermite180(p0->longitude, p1->longitude, p2->longitude, p3->longitude, tn);
+            cursor.data.longitude = SkyMath::interpolateTimedHermite180(p0->longitude, p1->longitude, p2->longitude, p3->longitude, p0->timestamp, p1->timestamp, p2->timestamp, p3->timestamp, tn);
             // Altitude [open range]
-            m_currentData.altitude  = SkyMath::interpolateHermite(p0->altitude, p1->altitude, p2->altitude, p3->altitude, tn);
+            cursor.data.altitude  = SkyMath::interpolateTimedHermite(p0->altitude, p1->altitude, p2->altitude, p3->altitude, p0->timestamp, p1->timestamp, p2->timestamp, p3->timestamp, tn);
             // The following altitudes are not used for replay - only for display and analytical purposes,
             // so linear interpolation is sufficient
-            m_currentData.indicatedAltitude  = SkyMath::interpolateLinear(p1->indicatedAltitude, p2->indicatedAltitude, tn);
-            m_currentData.calibratedIndicatedAltitude  = SkyMath::interpolateLinear(p1->calibratedIndicatedAltitude, p2->calibratedIndicatedAltitude, tn);
-            m_currentData.pressureAltitude  = SkyMath::interpolateLinear(p1->pressureAltitude, p2->pressureAltitude, tn);
+            cursor.data.indicatedAltitude  = SkyMath::interpolateLinear(p1->indicatedAltitude, p2->indicatedAltitude, tn);
+            cursor.data.calibratedIndicatedAltitude  = SkyMath::interpolateLinear(p1->calibratedIndicatedAltitude, p2->calibratedIndicatedAltitude, tn);
+            cursor.data.pressureAltitude  = SkyMath::interpolateLinear(p1->pressureAltitude, p2->pressureAltitude, tn);
 
-            m_currentData.timestamp = adjustedTimestamp;
+            cursor.data.timestamp = adjustedTimestamp;
         } else {
             // No recorded data, or the timestamp exceeds the timestamp of the last recorded data
-            m_currentData.reset();
+            cursor.data.reset();
         }
 
-        setCurrentIndex(currentIndex);
-        setCurrentTimestamp(adjustedTimestamp);
-        setCurrentAccess(access);
+        cursor.index = currentIndex;
+        cursor.timestamp = adjustedTimestamp;
+        cursor.access = access;
     }
-    return m_currentData;
+    return cursor.data;
+}
+
+std::vector<TrackOverview::Bucket> Position::getTrackOverview(TrackOverview::Resolution resolution) const noexcept
+{
+    std::lock_guard lock {d->overviewMutex};
+    updateTrackOverview();
+    return d->overview[Enum::underly(resolution)];
+}
+
+// PRIVATE
+
+void Position::updateTrackOverview() const noexcept
+{
+    const auto generation = getGeneration();
+    if (d->overviewValid && d->overviewGeneration == generation) {
+        return;
+    }
+    const auto &data = getData();
+    const std::size_t sampleCount = data.size();
+
+    // Finest level: one pass over all samples
+    auto &buckets = d->overview.front();
+    buckets.clear();
+    const std::int64_t duration = TrackOverview::getBucketDuration(TrackOverview::Resolution::OneSecond);
+    std::size_t speedCount {0};
+    const auto finishBucket = [&data, &speedCount](TrackOverview::Bucket &bucket) {
+        const auto count = static_cast<double>(bucket.sampleCount);
+        bucket.latitude.average /= count;
+        bucket.longitude.average /= count;
+        bucket.altitude.average /= count;
+        if (speedCount > 0) {
+            bucket.groundSpeed.average /= static_cast<double>(speedCount);
+        }
+        bucket.center = data[bucket.firstIndex + bucket.sampleCount / 2];
+        for (std::size_t i = bucket.firstIndex; i < bucket.firstIndex + bucket.sampleCount; ++i) {
+            bucket.radius = std::max(bucket.radius, ::distance(bucket.center, data[i]));
+        }
+    };
+    for (std::size_t i = 0; i < sampleCount; ++i) {
+        const PositionData &positionData = data[i];
+        const std::int64_t startTimestamp = positionData.timestamp - positionData.timestamp % duration;
+        if (buckets.empty() || buckets.back().startTimestamp != startTimestamp) {
+            if (!buckets.empty()) {
+                finishBucket(buckets.back());
+            }
+            TrackOverview::Bucket bucket;
+            bucket.startTimestamp = startTimestamp;
+            bucket.endTimestamp = startTimestamp + duration;
+            bucket.firstIndex = i;
+            ::initialise(bucket.latitude, positionData.latitude);
+            ::initialise(bucket.longitude, positionData.longitude);
+            ::initialise(bucket.altitude, positionData.altitude);
+            bucket.groundSpeed = {};
+            buckets.push_back(bucket);
+            speedCount = 0;
+        } else {
+            auto &bucket = buckets.back();
+            ::accumulate(bucket.latitude, positionData.latitude);
+            ::accumulate(bucket.longitude, positionData.longitude);
+            ::accumulate(bucket.altitude, positionData.altitude);
+        }
+        auto &bucket = buckets.back();
+        ++bucket.sampleCount;
+        if (i > 0 && positionData.timestamp > data[i - 1].timestamp) {
+            const double groundSpeed = ::distance(data[i - 1], positionData) * 1000.0 / static_cast<double>(positionData.timestamp - data[i - 1].timestamp);
+            if (speedCount == 0) {
+                ::initialise(bucket.groundSpeed, groundSpeed);
+            } else {
+                ::accumulate(bucket.groundSpeed, groundSpeed);
+            }
+            ++speedCount;
+        }
+    }
+    if (!buckets.empty()) {
+        finishBucket(buckets.back());
+    }
+
+    // Coarser levels: merge the buckets of the previous level, weighted by their sample count
+    for (std::size_t level = 1; level < d->overview.size(); ++level) {
+        const auto &fineBuckets = d->overview[level - 1];
+        auto &coarseBuckets = d->overview[level];
+        coarseBuckets.clear();
+        const std::int64_t coarseDuration = TrackOverview::getBucketDuration(static_cast<TrackOverview::Resolution>(level));
+        std::size_t first {0};
+        while (first < fineBuckets.size()) {
+            const std::int64_t startTimestamp = fineBuckets[first].startTimestamp - fineBuckets[first].startTimestamp % coarseDuration;
+            std::size_t last = first;
+            while (last + 1 < fineBuckets.size() && fineBuckets[last + 1].startTimestamp < startTimestamp + coarseDuration) {
+                ++last;
+            }
+            TrackOverview::Bucket bucket = fineBuckets[first];
+            bucket.startTimestamp = startTimestamp;
+            bucket.endTimestamp = startTimestamp + coarseDuration;
+            bucket.center = fineBuckets[first + (last - first) / 2].center;
+            bucket.radius = 0.0;
+            bucket.sampleCount = 0;
+            bucket.latitude.average = 0.0;
+            bucket.longitude.average = 0.0;
+            bucket.altitude.average = 0.0;
+            bucket.groundSpeed.average = 0.0;
+            for (std::size_t i = first; i <= last; ++i) {
+                const auto &fineBucket = fineBuckets[i];
+                const auto weight = static_cast<double>(fineBucket.sampleCount);
+                bucket.sampleCount += fineBucket.sampleCount;
+                bucket.latitude.minimum = std::min(bucket.latitude.minimum, fineBucket.latitude.minimum);
+                bucket.latitude.maximum = std::max(bucket.latitude.maximum, fineBucket.latitude.maximum);
+                bucket.latitude.average += fineBucket.latitude.average * weight;
+                bucket.longitude.minimum = std::min(bucket.longitude.minimum, fineBucket.longitude.minimum);
+                bucket.longitude.maximum = std::max(bucket.longitude.maximum, fineBucket.longitude.maximum);
+                bucket.longitude.average += fineBucket.longitude.average * weight;
+                bucket.altitude.minimum = std::min(bucket.altitude.minimum, fineBucket.altitude.minimum);
+                bucket.altitude.maximum = std::max(bucket.altitude.maximum, fineBucket.altitude.maximum);
+                bucket.altitude.average += fineBucket.altitude.average * weight;
+                bucket.groundSpeed.minimum = std::min(bucket.groundSpeed.minimum, fineBucket.groundSpeed.minimum);
+                bucket.groundSpeed.maximum = std::max(bucket.groundSpeed.maximum, fineBucket.groundSpeed.maximum);
+                bucket.groundSpeed.average += fineBucket.groundSpeed.average * weight;
+                // Triangle inequality: the fine bucket lies entirely within the enlarged circle
+                bucket.radius = std::max(bucket.radius, ::distance(bucket.center, fineBucket.center) + fineBucket.radius);
+            }
+            const auto count = static_cast<double>(bucket.sampleCount);
+            bucket.latitude.average /= count;
+            bucket.longitude.average /= count;
+            bucket.altitude.average /= count;
+            bucket.groundSpeed.average /= count;
+            coarseBuckets.push_back(bucket);
+            first = last + 1;
+        }
+    }
+
+    d->overviewValid = true;
+    d->overviewGeneration = generation;
 }
 
-template class AbstractComponent<PositionData>;
+template class AbstractComponent<PositionData, PositionCodec>;
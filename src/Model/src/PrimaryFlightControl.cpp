@@ -27,6 +27,7 @@
 #include <Kernel/SkyMath.h>
 #include "TimeVariableData.h"
 #include "SkySearch.h"
+#include "SampleCursor.h"
 #include "AircraftInfo.h"
 #include "PrimaryFlightControlData.h"
 #include "PrimaryFlightControl.h"
@@ -38,14 +39,14 @@ PrimaryFlightControl::PrimaryFlightControl(const AircraftInfo &aircraftInfo) noe
     : AbstractComponent(aircraftInfo)
 {}
 
-const PrimaryFlightControlData &PrimaryFlightControl::interpolate(std::int64_t timestamp, TimeVariableData::Access access) const noexcept
+const PrimaryFlightControlData &PrimaryFlightControl::interpolate(std::int64_t timestamp, TimeVariableData::Access access, SampleCursor<PrimaryFlightControlData> &cursor) const noexcept
 {
     const PrimaryFlightControlData *p1 {nullptr}, *p2 {nullptr};
     const auto timeOffset = access != TimeVariableData::Access::NoTimeOffset ? getAircraftInfo().timeOffset : 0;
     const auto adjustedTimestamp = std::max(timestamp + timeOffset, std::int64_t(0));
 
-    if (getCurrentTimestamp() != adjustedTimestamp || getCurrentAccess() != access) {
-        int currentIndex = getCurrentIndex();
+    if (!bindCursor(cursor, adjustedTimestamp, access)) {
+        int currentIndex = cursor.index;
         double tn {0.0};
         switch (access) {
         case TimeVariableData::Access::Linear:
@@ -72,24 +73,24 @@ const PrimaryFlightControlData &PrimaryFlightControl::interpolate(std::int64_t t
         }
 
         if (p1 != nullptr) {
-            m_currentData.leftAileronDeflection = SkyMath::interpolateLinear(p1->leftAileronDeflection, p2->leftAileronDeflection, tn);
-            m_currentData.rightAileronDeflection = SkyMath::interpolateLinear(p1->rightAileronDeflection, p2->rightAileronDeflection, tn);
-            m_currentData.elevatorDeflection = SkyMath::interpolateLinear(p1->elevatorDeflection, p2->elevatorDeflection, tn);
-            m_currentData.rudderDeflection = SkyMath::interpolateLinear(p1->rudderDeflection, p2->rudderDeflection, tn);
-            m_currentData.rudderPosition = SkyMath::interpolateLinear(p1->rudderPosition, p2->rudderPosition, tn);
-            m_currentData.elevatorPosition = SkyMath::interpolateLinear(p1->elevatorPosition, p2->elevatorPosition, tn);
-            m_currentData.aileronPosition = SkyMath::interpolateLinear(p1->aileronPosition, p2->aileronPosition, tn);
-            m_currentData.timestamp = adjustedTimestamp;
+            cursor.data.leftAileronDeflection = SkyMath::interpolateLinear(p1->leftAileronDeflection, p2->leftAileronDeflection, tn);
+            cursor.data.rightAileronDeflection = SkyMath::interpolateLinear(p1->rightAileronDeflection, p2->rightAileronDeflection, tn);
+            cursor.data.elevatorDeflection = SkyMath::interpolateLinear(p1->elevatorDeflection, p2->elevatorDeflection, tn);
+            cursor.data.rudderDeflection = SkyMath::interpolateLinear(p1->rudderDeflection, p2->rudderDeflection, tn);
+            cursor.data.rudderPosition = SkyMath::interpolateLinear(p1->rudderPosition, p2->rudderPosition, tn);
+            cursor.data.elevatorPosition = SkyMath::interpolateLinear(p1->elevatorPosition, p2->elevatorPosition, tn);
+            cursor.data.aileronPosition = SkyMath::interpolateLinear(p1->aileronPosition, p2->aileronPosition, tn);
+            cursor.data.timestamp = adjustedTimestamp;
         } else {
             // No recorded data, or the timestamp exceeds the timestamp of the last recorded data
-            m_currentData.reset();
+            cursor.data.reset();
         }
 
-        setCurrentIndex(currentIndex);
-        setCurrentTimestamp(adjustedTimestamp);
-        setCurrentAccess(access);
+        cursor.index = currentIndex;
+        cursor.timestamp = adjustedTimestamp;
+        cursor.access = access;
     }
-    return m_currentData;
+    return cursor.data;
 }
 
 template class AbstractComponent<PrimaryFlightControlData>;
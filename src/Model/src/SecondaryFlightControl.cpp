@@ -28,6 +28,7 @@
 #include <Kernel/SkyMath.h>
 #include "TimeVariableData.h"
 #include "SkySearch.h"
+#include "SampleCursor.h"
 #include "AircraftInfo.h"
 #include "SecondaryFlightControlData.h"
 #include "SecondaryFlightControl.h"
@@ -38,14 +39,14 @@ SecondaryFlightControl::SecondaryFlightControl(const AircraftInfo &aircraftInfo)
     : AbstractComponent(aircraftInfo)
 {}
 
-const SecondaryFlightControlData &SecondaryFlightControl::interpolate(std::int64_t timestamp, TimeVariableData::Access access) const noexcept
+const SecondaryFlightControlData &SecondaryFlightControl::interpolate(std::int64_t timestamp, TimeVariableData::Access access, SampleCursor<SecondaryFlightControlData> &cursor) const noexcept
 {
     const SecondaryFlightControlData *p1 {nullptr}, *p2 {nullptr};
     const auto timeOffset = access != TimeVariableData::Access::NoTimeOffset ? getAircraftInfo().timeOffset : 0;
     const auto adjustedTimestamp = std::max(timestamp + timeOffset, std::int64_t(0));
 
-    if (getCurrentTimestamp() != adjustedTimestamp || getCurrentAccess() != access) {
-        int currentIndex = getCurrentIndex();
+    if (!bindCursor(cursor, adjustedTimestamp, access)) {
+        int currentIndex = cursor.index;
         double tn {0.0};
         switch (access) {
         case TimeVariableData::Access::Linear:
@@ -72,27 +73,27 @@ const SecondaryFlightControlData &SecondaryFlightControl::interpolate(std::int64
         }
 
         if (p1 != nullptr) {
-            m_currentData.leftLeadingEdgeFlapsPosition = SkyMath::interpolateLinear(p1->leftLeadingEdgeFlapsPosition, p2->leftLeadingEdgeFlapsPosition, tn);
-            m_currentData.rightLeadingEdgeFlapsPosition = SkyMath::interpolateLinear(p1->rightLeadingEdgeFlapsPosition, p2->rightLeadingEdgeFlapsPosition, tn);
-            m_currentData.leftTrailingEdgeFlapsPosition = SkyMath::interpolateLinear(p1->leftTrailingEdgeFlapsPosition, p2->leftTrailingEdgeFlapsPosition, tn);
-            m_currentData.rightTrailingEdgeFlapsPosition = SkyMath::interpolateLinear(p1->rightTrailingEdgeFlapsPosition, p2->rightTrailingEdgeFlapsPosition, tn);
-            m_currentData.leftSpoilersPosition = SkyMath::interpolateLinear(p1->leftSpoilersPosition, p2->leftSpoilersPosition, tn);
-            m_currentData.rightSpoilersPosition = SkyMath::interpolateLinear(p1->rightSpoilersPosition, p2->rightSpoilersPosition, tn);
-            m_currentData.spoilersHandlePercent = SkyMath::interpolateLinear(p1->spoilersHandlePercent, p2->spoilersHandlePercent, tn);
+            cursor.data.leftLeadingEdgeFlapsPosition = SkyMath::interpolateLinear(p1->leftLeadingEdgeFlapsPosition, p2->leftLeadingEdgeFlapsPosition, tn);
+            cursor.data.rightLeadingEdgeFlapsPosition = SkyMath::interpolateLinear(p1->rightLeadingEdgeFlapsPosition, p2->rightLeadingEdgeFlapsPosition, tn);
+            cursor.data.leftTrailingEdgeFlapsPosition = SkyMath::interpolateLinear(p1->leftTrailingEdgeFlapsPosition, p2->leftTrailingEdgeFlapsPosition, tn);
+            cursor.data.rightTrailingEdgeFlapsPosition = SkyMath::interpolateLinear(p1->rightTrailingEdgeFlapsPosition, p2->rightTrailingEdgeFlapsPosition, tn);
+            cursor.data.leftSpoilersPosition = SkyMath::interpolateLinear(p1->leftSpoilersPosition, p2->leftSpoilersPosition, tn);
+            cursor.data.rightSpoilersPosition = SkyMath::interpolateLinear(p1->rightSpoilersPosition, p2->rightSpoilersPosition, tn);
+            cursor.data.spoilersHandlePercent = SkyMath::interpolateLinear(p1->spoilersHandlePercent, p2->spoilersHandlePercent, tn);
             // No interpolation for boolean values
-            m_currentData.flapsHandleIndex = p1->flapsHandleIndex;
-            m_currentData.spoilersArmed = p1->spoilersArmed;
-            m_currentData.timestamp = adjustedTimestamp;
+            cursor.data.flapsHandleIndex = p1->flapsHandleIndex;
+            cursor.data.spoilersArmed = p1->spoilersArmed;
+            cursor.data.timestamp = adjustedTimestamp;
         } else {
             // No recorded data (and no repeat), or the timestamp exceeds the timestamp of the last recorded data
-            m_currentData.reset();
+            cursor.data.reset();
         }
 
-        setCurrentIndex(currentIndex);
-        setCurrentTimestamp(adjustedTimestamp);
-        setCurrentAccess(access);
+        cursor.index = currentIndex;
+        cursor.timestamp = adjustedTimestamp;
+        cursor.access = access;
     }
-    return m_currentData;
+    return cursor.data;
 }
 
 template class AbstractComponent<SecondaryFlightControlData>;
@@ -0,0 +1,45 @@
+/**
+ * Sky Dolly - The Black Sheep for Your Flight Recordings
+ *
+ * Copyright (c) 2020 - 2025 Oliver Knoll
+ *
+ * MIT License
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this
+ * software and associated documentation files (the "Software"), to deal in the Software
+ * without restriction, including without limitation the rights to use, copy, modify, merge,
+ * publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons
+ * to whom the Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or
+ * substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED *AS IS*, WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR
+ * PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE
+ * FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+ * OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ */
+#ifndef BACKUP_H
+#define BACKUP_H
+
+#include <cstdint>
+#include <functional>
+
+/*!
+ * Logbook backup related data structures.
+ */
+namespace Backup
+{
+    /*!
+     * Reports the backup progress: \c copied out of \c total units (an estimate of the
+     * number of rows) have been copied so far. The callback is called from the thread which
+     * is copying the logbook data, which is generally not the thread that started the backup.
+     *
+     * Returns \c true in order to continue the backup; \c false cancels the backup.
+     */
+    using ProgressCallback = std::function<bool(std::int64_t copied, std::int64_t total)>;
+}
+
+#endif // BACKUP_H
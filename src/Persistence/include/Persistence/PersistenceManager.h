@@ -25,6 +25,7 @@
 #define PERSISTENCEMANAGER_H
 
 #include <memory>
+#include <cstdint>
 
 #include <QObject>
 
@@ -34,6 +35,7 @@ class QWidget;
 class Metadata;
 class Version;
 
+#include "LookupStatistics.h"
 #include "PersistenceLib.h"
 
 class Metadata;
@@ -81,11 +83,20 @@ public:
     QString getLogbookPath() const noexcept;
 
     bool optimise() const noexcept;
+    std::int64_t incrementalVacuum(int maxPageCount, bool *ok = nullptr) const noexcept;
 
     Metadata getMetadata(bool *ok = nullptr) const noexcept;
     Version getDatabaseVersion(bool *ok = nullptr) const noexcept;
     QString getBackupDirectoryPath(bool *ok = nullptr) const noexcept;
 
+    /*!
+     * Returns the hit and miss counts of the cached aircraft type and enumeration
+     * lookups of the application logbook connection.
+     *
+     * \return the accumulated lookup statistics
+     */
+    LookupStatistics getLookupStatistics() const noexcept;
+
 signals:
     /*!
      * Emitted whenver the connection to the logbook (database) has changed.
@@ -106,6 +117,8 @@ private:
     PersistenceManager() noexcept;
     friend std::unique_ptr<PersistenceManager>::deleter_type;
     ~PersistenceManager() override;
+
+    void recoverUnfinishedRecordings(QWidget *parent) const noexcept;
 };
 
 #endif // PERSISTENCEMANAGER_H
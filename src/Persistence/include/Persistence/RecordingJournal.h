@@ -0,0 +1,108 @@
+/**
+ * Sky Dolly - The Black Sheep for Your Flight Recordings
+ *
+ * Copyright (c) 2020 - 2025 Oliver Knoll
+ *
+ * MIT License
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this
+ * software and associated documentation files (the "Software"), to deal in the Software
+ * without restriction, including without limitation the rights to use, copy, modify, merge,
+ * publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons
+ * to whom the Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or
+ * substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED *AS IS*, WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR
+ * PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE
+ * FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+ * OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ */
+#ifndef RECORDINGJOURNAL_H
+#define RECORDINGJOURNAL_H
+
+#include <memory>
+#include <chrono>
+
+#include <QObject>
+
+#include "PersistenceLib.h"
+
+class Flight;
+class Aircraft;
+struct RecordingJournalPrivate;
+
+/*!
+ * Periodically stores the samples of the ongoing recording into the logbook, in the background.
+ *
+ * The samples recorded since the last flush are copied on the calling (main) thread and
+ * then appended to the logbook on a dedicated thread and database connection, one transaction
+ * per batch. Once the recording has stopped #finish only stores the remaining samples and
+ * finalises the flight. Should the application terminate before that, the samples stored so
+ * far are recovered the next time the logbook is opened.
+ *
+ * \sa RecordingJournalService
+ */
+class PERSISTENCE_API RecordingJournal final : public QObject
+{
+    Q_OBJECT
+public:
+    explicit RecordingJournal(QObject *parent = nullptr) noexcept;
+    RecordingJournal(const RecordingJournal &rhs) = delete;
+    RecordingJournal(RecordingJournal &&rhs) = delete;
+    RecordingJournal &operator=(const RecordingJournal &rhs) = delete;
+    RecordingJournal &operator=(RecordingJournal &&rhs) = delete;
+    ~RecordingJournal() override;
+
+    /*!
+     * Starts journaling the recording of the \e current flight of the Logbook: every \p interval
+     * the newly recorded samples are stored into the logbook.
+     *
+     * The flight (or aircraft, when recording a formation) is only created in the logbook once the
+     * first samples are available.
+     *
+     * \param interval
+     *        the interval at which the recorded samples are stored
+     */
+    void start(std::chrono::milliseconds interval) noexcept;
+
+    /*!
+     * Returns whether the journal has been started and not finished yet.
+     *
+     * \return \c true if the journal is active; \c false else
+     */
+    bool isActive() const noexcept;
+
+    /*!
+     * Finishes the journal: stores the remaining samples of the recorded aircraft, finalises the
+     * flight and updates the IDs of the \p flight and the recorded aircraft. Blocks until all
+     * pending samples have been stored. Emits Flight#flightStored respectively Flight#aircraftStored
+     * upon success.
+     *
+     * If nothing has been journaled yet or storing any batch failed then the incrementally stored
+     * data is removed again and \c false is returned: the recording then still needs to be stored
+     * entirely, e.g. with FlightService#storeFlight.
+     *
+     * \param flight
+     *        the recorded flight; typically the \e current flight of the Logbook
+     * \return \c true if the recording has been completely stored by the journal; \c false if the
+     *         recording still needs to be stored
+     */
+    bool finish(Flight &flight) noexcept;
+
+private:
+    const std::unique_ptr<RecordingJournalPrivate> d;
+
+    void frenchConnection() noexcept;
+    bool begin(const Flight &flight) noexcept;
+    std::shared_ptr<Aircraft> takeSamples(const Aircraft &aircraft, bool all) noexcept;
+    void stopJournalThread() noexcept;
+
+private slots:
+    void flush() noexcept;
+};
+
+#endif // RECORDINGJOURNAL_H
@@ -56,6 +56,20 @@ public:
     bool changeTimeOffset(Aircraft &aircraft, std::int64_t newOffset) noexcept;
     bool changeTailNumber(Aircraft &aircraft, const QString &tailNumber) noexcept;
 
+    /*!
+     * Simplifies the position data of the given \p aircraft such that the replayed (interpolated)
+     * track deviates at most by \p maxDeviation metres from the original track. The simplified
+     * position data replaces the persisted position data, in case the \p aircraft is already stored.
+     *
+     * \param aircraft
+     *        the aircraft whose position data is to be simplified
+     * \param maxDeviation
+     *        the maximum allowed deviation [meters]; must be greater than 0
+     * \return \c true on success; \c false else (the position data remains unchanged)
+     * \sa TrackSimplification#simplify
+     */
+    bool compactPositionData(Aircraft &aircraft, double maxDeviation) noexcept;
+
 private:
     std::unique_ptr<AircraftServicePrivate> d;
 };
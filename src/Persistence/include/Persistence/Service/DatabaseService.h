@@ -40,6 +40,7 @@ class QDateTime;
 #include <Kernel/Version.h>
 #include "../Connection.h"
 #include "../Migration.h"
+#include "../Backup.h"
 #include "../Metadata.h"
 #include "../PersistenceLib.h"
 
@@ -84,19 +85,41 @@ public:
 
     bool migrate(Migration::Milestones milestones = Migration::Milestone::All) noexcept;
     bool optimise() const noexcept;
-    bool backup(const QString &logbookPath, BackupMode backupMode) noexcept;
+
+    /*!
+     * Frees at most \c maxPageCount unused pages of a logbook with incremental auto-vacuum.
+     *
+     * \return the number of unused pages remaining after the operation
+     */
+    std::int64_t incrementalVacuum(int maxPageCount, bool *ok = nullptr) const noexcept;
+
+    /*!
+     * Creates a backup of the logbook given by \c logbookPath. The logbook data is copied in
+     * small batches on a worker thread, while the calling thread keeps processing events.
+     *
+     * \sa Backup::ProgressCallback
+     */
+    bool backup(const QString &logbookPath, BackupMode backupMode, const Backup::ProgressCallback &progress = {}) noexcept;
     bool setBackupPeriod(std::int64_t backupPeriodId) noexcept;
     bool setNextBackupDate(const QDateTime &date) noexcept;
     bool updateBackupDate() noexcept;
     QString getBackupDirectoryPath(bool *ok = nullptr) const noexcept;
     bool setBackupDirectoryPath(const QString &backupFolderPath) noexcept;
 
+    /*!
+     * Restores the deduplicated backup \c backupFilePath into the new logbook \c logbookPath,
+     * on a worker thread while the calling thread keeps processing events.
+     *
+     * \sa Backup::ProgressCallback
+     */
+    static bool restoreBackup(const QString &backupFilePath, const QString &logbookPath, const Backup::ProgressCallback &progress = {}) noexcept;
+
     Metadata getMetadata(bool *ok = nullptr) const noexcept;
     Version getDatabaseVersion(bool *ok = nullptr) const noexcept;
 
     static QString getExistingLogbookPath(QWidget *parent) noexcept;
     static QString getNewLogbookPath(QWidget *parent) noexcept;
-    static QString getBackupFileName(const QString &logbookPath, const QString &backupDirectoryPath) noexcept;
+    static QString getBackupFileName(const QString &logbookPath, const QString &backupDirectoryPath, const char *extension = Const::DotLogbookExtension) noexcept;
     static QString createBackupPathIfNotExists(const QString &logbookPath, const QString &relativeOrAbsoluteBackupDirectoryPath) noexcept;
 
 private:
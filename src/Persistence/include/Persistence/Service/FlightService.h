@@ -25,6 +25,7 @@
 #define FLIGHTSERVICE_H
 
 #include <memory>
+#include <vector>
 #include <cstdint>
 
 #include <QSqlDatabase>
@@ -110,6 +111,16 @@ public:
      */
     bool importFlightData(std::int64_t id, FlightData &flightData) const noexcept;
     bool deleteById(std::int64_t id) const noexcept;
+
+    /*!
+     * Deletes the flights with the given \p ids, all within a single transaction. The freed
+     * database pages are not reclaimed immediately, but by the next (incremental) vacuum.
+     *
+     * \param ids
+     *        the IDs of the flights to be deleted
+     * \return \c true on success; \c false else (no flight is deleted)
+     */
+    bool deleteByIds(const std::vector<std::int64_t> &ids) const noexcept;
     bool updateTitle(Flight &flight, const QString &title) const noexcept;
     bool updateTitle(std::int64_t id, const QString &title) const noexcept;
     bool updateFlightNumber(Flight &flight, const QString &flightNumber) const noexcept;
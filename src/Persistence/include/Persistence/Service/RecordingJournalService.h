@@ -0,0 +1,142 @@
+/**
+ * Sky Dolly - The Black Sheep for Your Flight Recordings
+ *
+ * Copyright (c) 2020 - 2025 Oliver Knoll
+ *
+ * MIT License
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this
+ * software and associated documentation files (the "Software"), to deal in the Software
+ * without restriction, including without limitation the rights to use, copy, modify, merge,
+ * publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons
+ * to whom the Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or
+ * substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED *AS IS*, WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR
+ * PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE
+ * FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+ * OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ */
+#ifndef RECORDINGJOURNALSERVICE_H
+#define RECORDINGJOURNALSERVICE_H
+
+#include <memory>
+#include <cstdint>
+#include <cstddef>
+
+#include <QString>
+
+#include <Kernel/Const.h>
+#include "../PersistenceLib.h"
+
+struct FlightData;
+class Aircraft;
+struct RecordingJournalServicePrivate;
+
+/*!
+ * Stores a recording incrementally into the logbook, while it is still being recorded.
+ *
+ * The first batch of samples creates the flight (respectively the aircraft, when recording
+ * a formation) and marks it as \e unfinished; each further batch is appended in its own
+ * transaction. Finishing the recording stores the remaining samples, updates the flight and
+ * aircraft with their final values and removes the \e unfinished mark. Recordings which have
+ * never been finished (e.g. due to an application crash) are recovered with #recover.
+ *
+ * All methods must be called from the thread that has opened the given connection.
+ */
+class PERSISTENCE_API RecordingJournalService final
+{
+public:
+    RecordingJournalService(QString connectionName = Const::DefaultConnectionName) noexcept;
+    RecordingJournalService(const RecordingJournalService &rhs) = delete;
+    RecordingJournalService(RecordingJournalService &&rhs) noexcept;
+    RecordingJournalService &operator=(const RecordingJournalService &rhs) = delete;
+    RecordingJournalService &operator=(RecordingJournalService &&rhs) noexcept;
+    ~RecordingJournalService();
+
+    /*!
+     * Stores the new \p flightData - with the samples of its single aircraft recorded so far -
+     * and marks it as unfinished. The IDs of the \p flightData and its aircraft are updated.
+     *
+     * \param flightData
+     *        the flight being recorded, having exactly one aircraft
+     * \return \c true upon success; \c false else
+     */
+    bool beginFlight(FlightData &flightData) noexcept;
+
+    /*!
+     * Stores the new \p aircraft - with the samples recorded so far - into the existing flight
+     * identified by \p flightId and marks it as unfinished. The ID of the \p aircraft is updated.
+     *
+     * \param flightId
+     *        the ID of the flight the \p aircraft is added to
+     * \param sequenceNumber
+     *        the sequence number of the \p aircraft, starting at 1
+     * \param aircraft
+     *        the aircraft being recorded
+     * \return \c true upon success; \c false else
+     */
+    bool beginAircraft(std::int64_t flightId, std::size_t sequenceNumber, Aircraft &aircraft) noexcept;
+
+    /*!
+     * Appends the samples of the \p aircraft to the unfinished aircraft identified by \p aircraftId.
+     * The aircraft info and the flight plan recorded so far are updated as well.
+     *
+     * \param aircraftId
+     *        the ID of the aircraft being recorded
+     * \param aircraft
+     *        the batch of samples to be appended, with the current aircraft info and flight plan
+     * \return \c true upon success; \c false else
+     */
+    bool append(std::int64_t aircraftId, const Aircraft &aircraft) noexcept;
+
+    /*!
+     * Stores the remaining samples and the flight plan of the \p aircraft, updates the aircraft
+     * and the flight with their final values and removes the unfinished mark.
+     *
+     * \param flightData
+     *        the final flight values (the contained aircraft are ignored)
+     * \param aircraftId
+     *        the ID of the aircraft being recorded
+     * \param aircraft
+     *        the remaining samples, the flight plan and the final aircraft info
+     * \param newFlight
+     *        \c true if the entire flight has been recorded; \c false if the aircraft has been
+     *        added to an existing flight, in which case only the user aircraft of the flight is updated
+     * \return \c true upon success; \c false else
+     */
+    bool finish(const FlightData &flightData, std::int64_t aircraftId, const Aircraft &aircraft, bool newFlight) noexcept;
+
+    /*!
+     * Deletes the incrementally stored data of an unfinished recording, including its unfinished mark.
+     *
+     * \param flightId
+     *        the ID of the flight being recorded
+     * \param aircraftId
+     *        the ID of the aircraft being recorded
+     * \param newFlight
+     *        \c true if the entire flight is to be deleted; \c false if only the aircraft is to be deleted
+     * \return \c true upon success; \c false else
+     */
+    bool discard(std::int64_t flightId, std::int64_t aircraftId, bool newFlight) noexcept;
+
+    /*!
+     * Recovers all unfinished recordings: the samples, the aircraft info and the flight plan
+     * stored so far are kept as regular flights (respectively formation aircraft) in the logbook.
+     * The end time of a recovered flight is given by its last stored position sample.
+     *
+     * \param ok
+     *        if set, \c true upon success; \c false else
+     * \return the number of recovered recordings
+     */
+    std::int64_t recover(bool *ok = nullptr) noexcept;
+
+private:
+    std::unique_ptr<RecordingJournalServicePrivate> d;
+};
+
+#endif // RECORDINGJOURNALSERVICE_H
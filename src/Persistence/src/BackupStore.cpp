@@ -0,0 +1,394 @@
+/**
+ * Sky Dolly - The Black Sheep for Your Flight Recordings
+ *
+ * Copyright (c) 2020 - 2025 Oliver Knoll
+ *
+ * MIT License
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this
+ * software and associated documentation files (the "Software"), to deal in the Software
+ * without restriction, including without limitation the rights to use, copy, modify, merge,
+ * publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons
+ * to whom the Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or
+ * substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED *AS IS*, WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR
+ * PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE
+ * FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+ * OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ */
+#include <memory>
+#include <array>
+#include <vector>
+#include <algorithm>
+#include <cstdint>
+#include <utility>
+
+#include <QtGlobal>
+#if defined(Q_OS_WIN)
+#include <io.h>
+#else
+#include <unistd.h>
+#endif
+#include <QString>
+#include <QStringBuilder>
+#include <QByteArray>
+#include <QByteArrayView>
+#include <QHash>
+#include <QFile>
+#include <QSaveFile>
+#include <QFileInfo>
+#include <QDir>
+#include <QDataStream>
+#include <QCryptographicHash>
+#ifdef DEBUG
+#include <QDebug>
+#endif
+
+#include <Backup.h>
+#include "BackupStore.h"
+
+namespace
+{
+    constexpr const char *StoreDirectoryName {"Chunks"};
+    constexpr const char *PackFileName {"chunks.pack"};
+    constexpr const char *IndexFileName {"chunks.index"};
+
+    // "SDBK"
+    constexpr quint32 ManifestMagic {0x5344424b};
+    constexpr quint32 ManifestVersion {1};
+    constexpr QDataStream::Version StreamVersion {QDataStream::Qt_6_0};
+
+    constexpr QCryptographicHash::Algorithm HashAlgorithm {QCryptographicHash::Sha1};
+    constexpr qsizetype HashSize {20};
+    // Hash, offset, compressed size, size
+    constexpr qint64 IndexRecordSize {HashSize + 8 + 4 + 4};
+
+    // Content-defined chunking with a gear hash (as in FastCDC): a chunk ends where the topmost
+    // 15 bits of the rolling hash are zero, resulting in an average chunk size of about 32 KiB
+    constexpr qsizetype MinChunkSize {8 * 1024};
+    constexpr qsizetype MaxChunkSize {128 * 1024};
+    constexpr std::uint64_t BoundaryMask {~std::uint64_t {0} << 49};
+    // Each bit of the gear hash depends on at most the last 64 bytes
+    constexpr qsizetype GearWindowSize {64};
+
+    // The progress is reported at most this many times per operation
+    constexpr qint64 ProgressSteps {100};
+
+    constexpr std::uint64_t splitMix64(std::uint64_t &state) noexcept
+    {
+        std::uint64_t z = (state += 0x9e3779b97f4a7c15);
+        z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9;
+        z = (z ^ (z >> 27)) * 0x94d049bb133111eb;
+        return z ^ (z >> 31);
+    }
+
+    // Pseudo-random, but fixed: the chunk boundaries must not change between application versions
+    constexpr std::array<std::uint64_t, 256> GearTable = []() {
+        std::array<std::uint64_t, 256> table {};
+        // "SkyDolly"
+        std::uint64_t state {0x536b79446f6c6c79};
+        for (auto &value : table) {
+            value = splitMix64(state);
+        }
+        return table;
+    }();
+
+    qsizetype getChunkSize(const uchar *data, qsizetype size) noexcept
+    {
+        if (size <= MinChunkSize) {
+            return size;
+        }
+        const qsizetype maxChunkSize = std::min(size, MaxChunkSize);
+        std::uint64_t hash {0};
+        // Start hashing one window ahead of the minimum chunk size, so that the boundaries
+        // only depend on the content and not on the start of the chunk
+        for (qsizetype i = MinChunkSize - GearWindowSize; i < maxChunkSize; ++i) {
+            hash = (hash << 1) + GearTable[data[i]];
+            if (i >= MinChunkSize && (hash & BoundaryMask) == 0) {
+                return i + 1;
+            }
+        }
+        return maxChunkSize;
+    }
+
+    // Writes the buffered data of the file and flushes it to the storage device
+    bool syncToDisk(QFile &file) noexcept
+    {
+        bool ok = file.flush();
+        if (ok) {
+#if defined(Q_OS_WIN)
+            ok = ::_commit(file.handle()) == 0;
+#else
+            ok = ::fsync(file.handle()) == 0;
+#endif
+        }
+        return ok;
+    }
+
+    struct Entry
+    {
+        quint64 offset {0};
+        quint32 compressedSize {0};
+        quint32 size {0};
+    };
+}
+
+struct BackupStorePrivate
+{
+    BackupStorePrivate(const QString &backupDirectoryPath) noexcept
+        : storeDirectoryPath {backupDirectoryPath % "/" % ::StoreDirectoryName},
+          packFilePath {storeDirectoryPath % "/" % ::PackFileName},
+          indexFilePath {storeDirectoryPath % "/" % ::IndexFileName}
+    {}
+
+    QString storeDirectoryPath;
+    QString packFilePath;
+    QString indexFilePath;
+    // Key: chunk hash
+    QHash<QByteArray, ::Entry> index;
+    // The size of the valid index records
+    qint64 indexSize {0};
+};
+
+// PUBLIC
+
+BackupStore::BackupStore(const QString &backupDirectoryPath) noexcept
+    : d {std::make_unique<BackupStorePrivate>(backupDirectoryPath)}
+{}
+
+BackupStore::BackupStore(BackupStore &&rhs) noexcept = default;
+BackupStore &BackupStore::operator=(BackupStore &&rhs) noexcept = default;
+BackupStore::~BackupStore() = default;
+
+bool BackupStore::add(const QString &logbookPath, const QString &manifestPath, const Backup::ProgressCallback &progress) noexcept
+{
+    QFile logbookFile {logbookPath};
+    bool ok = QDir().mkpath(d->storeDirectoryPath) && logbookFile.open(QIODevice::ReadOnly);
+    const qint64 size = ok ? logbookFile.size() : 0;
+    uchar *data {nullptr};
+    if (ok && size > 0) {
+        data = logbookFile.map(0, size);
+        ok = data != nullptr;
+    }
+    if (ok) {
+        ok = loadIndex();
+    }
+    QFile packFile {d->packFilePath};
+    if (ok) {
+        ok = packFile.open(QIODevice::WriteOnly | QIODevice::Append);
+    }
+
+    QByteArray indexRecords;
+    QDataStream indexStream {&indexRecords, QIODevice::WriteOnly};
+    indexStream.setVersion(::StreamVersion);
+    std::vector<QByteArray> chunkHashes;
+    QCryptographicHash logbookHash {::HashAlgorithm};
+    quint64 packSize = ok ? packFile.size() : 0;
+    const qint64 progressStep = std::max(size / ::ProgressSteps, qint64 {1});
+    qint64 nextProgress {progressStep};
+    qint64 offset {0};
+    while (ok && offset < size) {
+        const qsizetype chunkSize = ::getChunkSize(data + offset, size - offset);
+        const QByteArrayView chunk {data + offset, chunkSize};
+        QByteArray chunkHash = QCryptographicHash::hash(chunk, ::HashAlgorithm);
+        logbookHash.addData(chunk);
+        if (!d->index.contains(chunkHash)) {
+            const QByteArray compressedChunk = qCompress(data + offset, chunkSize);
+            ok = packFile.write(compressedChunk) == compressedChunk.size();
+            if (ok) {
+                const ::Entry entry {packSize, static_cast<quint32>(compressedChunk.size()), static_cast<quint32>(chunkSize)};
+                indexStream.writeRawData(chunkHash.constData(), ::HashSize);
+                indexStream << entry.offset << entry.compressedSize << entry.size;
+                d->index.insert(chunkHash, entry);
+                packSize += compressedChunk.size();
+            }
+        }
+        chunkHashes.push_back(std::move(chunkHash));
+        offset += chunkSize;
+        if (ok && progress && (offset >= nextProgress || offset == size)) {
+            ok = progress(offset, size);
+            nextProgress = offset + progressStep;
+        }
+    }
+
+    // The chunks are on disk before the index refers to them...
+    if (ok) {
+        ok = ::syncToDisk(packFile);
+    }
+    if (ok && !indexRecords.isEmpty()) {
+        ok = writeIndex(indexRecords);
+    }
+    // ... and the index is on disk before the manifest refers to the chunks (the manifest
+    // is atomically replaced as well)
+    if (ok) {
+        QSaveFile manifestFile {manifestPath};
+        ok = manifestFile.open(QIODevice::WriteOnly);
+        if (ok) {
+            QDataStream manifestStream {&manifestFile};
+            manifestStream.setVersion(::StreamVersion);
+            manifestStream << ::ManifestMagic << ::ManifestVersion << static_cast<quint64>(size) << logbookHash.result() << static_cast<quint32>(chunkHashes.size());
+            for (const auto &chunkHash : chunkHashes) {
+                manifestStream.writeRawData(chunkHash.constData(), ::HashSize);
+            }
+            ok = manifestStream.status() == QDataStream::Ok && manifestFile.commit();
+        }
+    }
+#ifdef DEBUG
+    if (ok) {
+        qDebug() << "BackupStore::add:" << logbookPath << "size:" << size << "chunks:" << chunkHashes.size() << "new chunks:" << indexRecords.size() / ::IndexRecordSize;
+    }
+#endif
+
+    if (data != nullptr) {
+        logbookFile.unmap(data);
+    }
+    return ok;
+}
+
+bool BackupStore::restore(const QString &manifestPath, const QString &logbookPath, const Backup::ProgressCallback &progress) noexcept
+{
+    QFile manifestFile {manifestPath};
+    bool ok = !QFileInfo::exists(logbookPath) && manifestFile.open(QIODevice::ReadOnly);
+    QDataStream manifestStream {&manifestFile};
+    manifestStream.setVersion(::StreamVersion);
+    quint32 magic {0};
+    quint32 version {0};
+    quint64 size {0};
+    QByteArray logbookHash;
+    quint32 chunkCount {0};
+    if (ok) {
+        manifestStream >> magic >> version >> size >> logbookHash >> chunkCount;
+        ok = manifestStream.status() == QDataStream::Ok && magic == ::ManifestMagic && version == ::ManifestVersion;
+    }
+    if (ok) {
+        ok = loadIndex();
+    }
+    QFile packFile {d->packFilePath};
+    uchar *packData {nullptr};
+    if (ok && d->index.size() > 0) {
+        ok = packFile.open(QIODevice::ReadOnly);
+        if (ok) {
+            packData = packFile.map(0, packFile.size());
+            ok = packData != nullptr;
+        }
+    }
+    if (ok) {
+        ok = QDir().mkpath(QFileInfo(logbookPath).absolutePath());
+    }
+    QSaveFile logbookFile {logbookPath};
+    if (ok) {
+        ok = logbookFile.open(QIODevice::WriteOnly);
+    }
+
+    QCryptographicHash restoredHash {::HashAlgorithm};
+    quint64 restoredSize {0};
+    QByteArray chunkHash(::HashSize, Qt::Uninitialized);
+    const quint32 progressStep = std::max(chunkCount / static_cast<quint32>(::ProgressSteps), quint32 {1});
+    for (quint32 i = 0; ok && i < chunkCount; ++i) {
+        ok = manifestStream.readRawData(chunkHash.data(), ::HashSize) == ::HashSize;
+        if (ok) {
+            const auto it = d->index.constFind(chunkHash);
+            ok = it != d->index.cend();
+            if (ok) {
+                const QByteArray chunk = qUncompress(packData + it->offset, it->compressedSize);
+                ok = chunk.size() == static_cast<qsizetype>(it->size) && logbookFile.write(chunk) == chunk.size();
+                if (ok) {
+                    restoredHash.addData(chunk);
+                    restoredSize += chunk.size();
+                }
+            }
+        }
+        if (ok && progress && ((i + 1) % progressStep == 0 || i + 1 == chunkCount)) {
+            ok = progress(i + 1, chunkCount);
+        }
+    }
+
+    if (ok) {
+        ok = restoredSize == size && restoredHash.result() == logbookHash;
+    }
+    if (ok) {
+        ok = logbookFile.commit();
+    } else {
+        logbookFile.cancelWriting();
+#ifdef DEBUG
+        qDebug() << "BackupStore::restore: the backup" << manifestPath << "could not be restored";
+#endif
+    }
+
+    if (packData != nullptr) {
+        packFile.unmap(packData);
+    }
+    return ok;
+}
+
+// PRIVATE
+
+bool BackupStore::loadIndex() noexcept
+{
+    d->index.clear();
+    d->indexSize = 0;
+    QFile indexFile {d->indexFilePath};
+    if (!indexFile.exists()) {
+        return true;
+    }
+    const bool ok = indexFile.open(QIODevice::ReadOnly);
+    if (ok) {
+        const quint64 packSize = QFileInfo(d->packFilePath).size();
+        QDataStream indexStream {&indexFile};
+        indexStream.setVersion(::StreamVersion);
+        d->index.reserve(indexFile.size() / ::IndexRecordSize);
+        QByteArray chunkHash(::HashSize, Qt::Uninitialized);
+        ::Entry entry;
+        while (!indexStream.atEnd()) {
+            if (indexStream.readRawData(chunkHash.data(), ::HashSize) != ::HashSize) {
+                break;
+            }
+            indexStream >> entry.offset >> entry.compressedSize >> entry.size;
+            // Stop at incomplete records or chunks (e.g. of an interrupted backup)
+            if (indexStream.status() != QDataStream::Ok || entry.offset + entry.compressedSize > packSize) {
+                break;
+            }
+            d->index.insert(chunkHash, entry);
+            d->indexSize += ::IndexRecordSize;
+        }
+    }
+    return ok;
+}
+
+bool BackupStore::writeIndex(const QByteArray &indexRecords) noexcept
+{
+    // Only keep the valid records (e.g. discard the incomplete records of an interrupted backup)
+    QByteArray validRecords;
+    QFile indexFile {d->indexFilePath};
+    if (d->indexSize > 0) {
+        if (!indexFile.open(QIODevice::ReadOnly)) {
+            return false;
+        }
+        validRecords = indexFile.read(d->indexSize);
+        indexFile.close();
+        if (validRecords.size() != d->indexSize) {
+            return false;
+        }
+    }
+    // Atomically replaced, so an interruption never leaves an incomplete index behind
+    QSaveFile newIndexFile {d->indexFilePath};
+    bool ok = newIndexFile.open(QIODevice::WriteOnly);
+    if (ok) {
+        ok = newIndexFile.write(validRecords) == validRecords.size() &&
+             newIndexFile.write(indexRecords) == indexRecords.size();
+    }
+    if (ok) {
+        ok = newIndexFile.commit();
+        if (ok) {
+            d->indexSize = validRecords.size() + indexRecords.size();
+        }
+    } else {
+        newIndexFile.cancelWriting();
+    }
+    return ok;
+}
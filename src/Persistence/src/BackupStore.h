@@ -0,0 +1,102 @@
+/**
+ * Sky Dolly - The Black Sheep for Your Flight Recordings
+ *
+ * Copyright (c) 2020 - 2025 Oliver Knoll
+ *
+ * MIT License
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this
+ * software and associated documentation files (the "Software"), to deal in the Software
+ * without restriction, including without limitation the rights to use, copy, modify, merge,
+ * publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons
+ * to whom the Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or
+ * substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED *AS IS*, WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR
+ * PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE
+ * FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+ * OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ */
+#ifndef BACKUPSTORE_H
+#define BACKUPSTORE_H
+
+#include <memory>
+
+#include <QString>
+
+class QByteArray;
+
+#include <Backup.h>
+
+struct BackupStorePrivate;
+
+/*!
+ * A deduplicating, compressed store of logbook backups.
+ *
+ * Each backed up logbook is split into content-defined chunks (so that unchanged data yields
+ * identical chunks, even when shifted within the file); chunks which are not yet contained
+ * in the store are compressed and appended to the pack file in the \e Chunks sub-directory
+ * of the backup directory. Each backup itself is a small manifest file which lists the
+ * chunks of the backed up logbook.
+ *
+ * The new chunks are flushed to disk before the (atomically replaced) index refers to them,
+ * and the index before the (atomically replaced) manifest does, so an interrupted backup never
+ * affects the existing backups.
+ *
+ * Both adding and restoring a backup may take a while: they are typically called from a worker thread.
+ */
+class BackupStore final
+{
+public:
+    /*!
+     * Creates the store located in the given \c backupDirectoryPath.
+     *
+     * \param backupDirectoryPath
+     *        the directory containing the backup manifests
+     */
+    BackupStore(const QString &backupDirectoryPath) noexcept;
+    BackupStore(const BackupStore &rhs) = delete;
+    BackupStore(BackupStore &&rhs) noexcept;
+    BackupStore &operator=(const BackupStore &rhs) = delete;
+    BackupStore &operator=(BackupStore &&rhs) noexcept;
+    ~BackupStore();
+
+    /*!
+     * Adds the logbook given by \c logbookPath to the store and writes the manifest \c manifestPath.
+     *
+     * \param logbookPath
+     *        the path of the (consistent copy of the) logbook to be added
+     * \param manifestPath
+     *        the path of the manifest to be written
+     * \param progress
+     *        the optional callback which reports the progress and which may cancel the operation
+     * \return \c true if the backup has successfully been added; \c false upon error or cancellation
+     */
+    bool add(const QString &logbookPath, const QString &manifestPath, const Backup::ProgressCallback &progress = {}) noexcept;
+
+    /*!
+     * Restores the logbook of the manifest \c manifestPath into the new file \c logbookPath.
+     * The restored logbook is verified against the checksum stored in the manifest.
+     *
+     * \param manifestPath
+     *        the path of the backup manifest
+     * \param logbookPath
+     *        the path of the restored logbook; must not exist yet
+     * \param progress
+     *        the optional callback which reports the progress and which may cancel the operation
+     * \return \c true if the logbook has successfully been restored; \c false upon error or cancellation
+     */
+    bool restore(const QString &manifestPath, const QString &logbookPath, const Backup::ProgressCallback &progress = {}) noexcept;
+
+private:
+    std::unique_ptr<BackupStorePrivate> d;
+
+    bool loadIndex() noexcept;
+    bool writeIndex(const QByteArray &indexRecords) noexcept;
+};
+
+#endif // BACKUPSTORE_H
@@ -72,13 +72,47 @@ public:
      */
     virtual bool exportAircraft(std::int64_t flightId, std::size_t sequenceNumber, const Aircraft &aircraft) const noexcept = 0;
 
+    /*!
+     * Appends the sampled data (position, attitude, engine, ...) of the \p aircraft to the
+     * already persisted aircraft identified by \p aircraftId. The flight plan is not persisted.
+     *
+     * \param aircraftId
+     *        the ID of the persisted aircraft the samples are appended to
+     * \param aircraft
+     *        the aircraft containing the samples to be appended
+     * \return \c true on success; \c false else
+     */
+    virtual bool addSampledData(std::int64_t aircraftId, const Aircraft &aircraft) const noexcept = 0;
+
     virtual std::vector<Aircraft> getByFlightId(std::int64_t flightId, bool *ok = nullptr) const noexcept = 0;
     virtual bool adjustAircraftSequenceNumbersByFlightId(std::int64_t id, std::size_t sequenceNumber) const noexcept = 0;
     virtual bool deleteAllByFlightId(std::int64_t flightId) const noexcept = 0;
+
+    /*!
+     * Deletes all aircraft - including their sampled data - of the given flights,
+     * with one set-based delete statement per table.
+     *
+     * \param flightIds
+     *        the IDs of the flights whose aircraft are to be deleted
+     * \return \c true on success; \c false else
+     */
+    virtual bool deleteAllByFlightIds(const std::vector<std::int64_t> &flightIds) const noexcept = 0;
     virtual bool deleteById(std::int64_t id) const noexcept = 0;
     virtual std::vector<AircraftInfo> getAircraftInfosByFlightId(std::int64_t flightId, bool *ok = nullptr) const noexcept = 0;
     virtual bool updateTimeOffset(std::int64_t id, std::int64_t timeOffset) const noexcept = 0;
     virtual bool updateTailNumber(std::int64_t id, const QString &tailNumber) const noexcept = 0;
+
+    /*!
+     * Updates the aircraft type, time offset, tail number and initial flight state of the
+     * aircraft identified by \p id.
+     *
+     * \param id
+     *        the ID of the aircraft to be updated
+     * \param info
+     *        the AircraftInfo containing the values to be updated
+     * \return \c true on success; \c false else
+     */
+    virtual bool updateAircraftInfo(std::int64_t id, const AircraftInfo &info) const noexcept = 0;
 };
 
 #endif // AIRCRAFTDAOINTF_H
@@ -39,6 +39,7 @@
 #include "SQLite/SQLiteWaypointDao.h"
 #include "SQLite/SQLiteLocationDao.h"
 #include "SQLite/SQLiteEnumerationDao.h"
+#include "SQLite/SQLiteRecordingJournalDao.h"
 #include "FlightDaoIntf.h"
 #include "AircraftDaoIntf.h"
 #include "AircraftTypeDaoIntf.h"
@@ -52,6 +53,7 @@
 #include "WaypointDaoIntf.h"
 #include "LocationDaoIntf.h"
 #include "EnumerationDaoIntf.h"
+#include "RecordingJournalDaoIntf.h"
 #include "DaoFactory.h"
 
 struct DaoFactoryPrivate
@@ -240,3 +242,14 @@ std::unique_ptr<EnumerationDaoIntf> DaoFactory::createEnumerationDao() noexcept
     }
     return dao;
 }
+
+std::unique_ptr<RecordingJournalDaoIntf> DaoFactory::createRecordingJournalDao() noexcept
+{
+    std::unique_ptr<RecordingJournalDaoIntf> dao {nullptr};
+    switch (d->dbType) {
+    case DbType::SQLite:
+        dao = std::make_unique<SQLiteRecordingJournalDao>(d->connectionName);
+        break;
+    }
+    return dao;
+}
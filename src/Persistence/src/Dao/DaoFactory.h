@@ -46,6 +46,7 @@ class WaypointDaoIntf;
 class DatabaseDaoIntf;
 class LocationDaoIntf;
 class EnumerationDaoIntf;
+class RecordingJournalDaoIntf;
 
 struct DaoFactoryPrivate;
 
@@ -80,6 +81,7 @@ public:
     std::unique_ptr<WaypointDaoIntf> createFlightPlanDao() noexcept;
     std::unique_ptr<LocationDaoIntf> createLocationDao() noexcept;
     std::unique_ptr<EnumerationDaoIntf> createEnumerationDao() noexcept;
+    std::unique_ptr<RecordingJournalDaoIntf> createRecordingJournalDao() noexcept;
 
 private:
     std::unique_ptr<DaoFactoryPrivate> d;
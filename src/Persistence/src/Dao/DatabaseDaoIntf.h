@@ -34,6 +34,7 @@ class QDateTime;
 #include <Kernel/Const.h>
 #include <Connection.h>
 #include <Migration.h>
+#include <Backup.h>
 #include "Metadata.h"
 
 class DatabaseDaoIntf
@@ -51,7 +52,8 @@ public:
 
     virtual bool migrate(Migration::Milestones milestones = Migration::Milestone::All) const noexcept = 0;
     virtual bool optimise() const noexcept = 0;
-    virtual bool backup(const QString &backupFilePath) const noexcept= 0;
+    virtual std::int64_t incrementalVacuum(int maxPageCount, bool *ok = nullptr) const noexcept = 0;
+    virtual bool backup(const QString &backupFilePath, const Backup::ProgressCallback &progress = {}) const noexcept= 0;
     virtual bool updateBackupPeriod(std::int64_t backupPeriodId) const noexcept = 0;
     virtual bool updateNextBackupDate(const QDateTime &date) const noexcept = 0;
     virtual bool updateBackupDirectoryPath(const QString &backupDirectoryPath) const noexcept = 0;
@@ -24,6 +24,7 @@
 #ifndef FLIGHTDAOINTF_H
 #define FLIGHTDAOINTF_H
 
+#include <vector>
 #include <cstdint>
 
 class QString;
@@ -60,7 +61,19 @@ public:
      */
     virtual bool exportFlightData(const FlightData &flightData) const noexcept = 0;
     virtual bool get(std::int64_t id, FlightData &flightData) const noexcept = 0;
+
+    /*!
+     * Updates the flight row identified by the \p id of the given \p flightData with its
+     * current title, description, flight number, user aircraft and flight condition; the
+     * aircraft are not updated.
+     *
+     * \param flightData
+     *        the FlightData containing the values to be updated
+     * \return \c true on success; \c false else
+     */
+    virtual bool update(const FlightData &flightData) const noexcept = 0;
     virtual bool deleteById(std::int64_t id) const noexcept = 0;
+    virtual bool deleteByIds(const std::vector<std::int64_t> &ids) const noexcept = 0;
     virtual bool updateTitle(std::int64_t id, const QString &title) const noexcept = 0;
     virtual bool updateFlightNumber(std::int64_t id, const QString &flightNumber) const noexcept = 0;
     virtual bool updateDescription(std::int64_t id, const QString &description) const noexcept = 0;
@@ -0,0 +1,161 @@
+/**
+ * Sky Dolly - The Black Sheep for Your Flight Recordings
+ *
+ * Copyright (c) 2020 - 2025 Oliver Knoll
+ *
+ * MIT License
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this
+ * software and associated documentation files (the "Software"), to deal in the Software
+ * without restriction, including without limitation the rights to use, copy, modify, merge,
+ * publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons
+ * to whom the Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or
+ * substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED *AS IS*, WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR
+ * PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE
+ * FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+ * OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ */
+#include <memory>
+#include <optional>
+#include <unordered_map>
+#include <array>
+#include <vector>
+#include <cstdint>
+#include <cstddef>
+
+#include <QString>
+
+#include <Kernel/Enum.h>
+#include <Model/AircraftType.h>
+#include <Model/Enumeration.h>
+#include <LookupStatistics.h>
+#include "LookupCache.h"
+
+namespace
+{
+    // The lookup caches of the calling thread, by connection name
+    using Registry = std::unordered_map<QString, std::weak_ptr<LookupCache>>;
+    thread_local Registry registry;
+
+    constexpr std::size_t OrderCount {3};
+    using EnumerationItems = std::vector<Enumeration::Item>;
+}
+
+struct LookupCachePrivate
+{
+    std::unordered_map<QString, AircraftType> aircraftTypes;
+    // Per order: the items by enumeration name
+    std::array<std::unordered_map<QString, EnumerationItems>, ::OrderCount> enumerations;
+    LookupStatistics statistics;
+};
+
+// PUBLIC
+
+LookupCache::LookupCache() noexcept
+    : d {std::make_unique<LookupCachePrivate>()}
+{}
+
+LookupCache::LookupCache(LookupCache &&rhs) noexcept = default;
+LookupCache &LookupCache::operator=(LookupCache &&rhs) noexcept = default;
+LookupCache::~LookupCache() = default;
+
+std::shared_ptr<LookupCache> LookupCache::getInstance(const QString &connectionName) noexcept
+{
+    auto &weakCache = ::registry[connectionName];
+    std::shared_ptr<LookupCache> cache = weakCache.lock();
+    if (!cache) {
+        cache = std::make_shared<LookupCache>();
+        weakCache = cache;
+    }
+    return cache;
+}
+
+void LookupCache::invalidate(const QString &connectionName) noexcept
+{
+    const auto it = ::registry.find(connectionName);
+    if (it != ::registry.end()) {
+        const auto cache = it->second.lock();
+        if (cache) {
+            cache->clear();
+        } else {
+            ::registry.erase(it);
+        }
+    }
+}
+
+std::optional<AircraftType> LookupCache::getAircraftType(const QString &type) noexcept
+{
+    std::optional<AircraftType> aircraftType;
+    const auto it = d->aircraftTypes.find(type);
+    if (it != d->aircraftTypes.cend()) {
+        aircraftType = it->second;
+        ++d->statistics.aircraftTypeHitCount;
+    } else {
+        ++d->statistics.aircraftTypeMissCount;
+    }
+    return aircraftType;
+}
+
+bool LookupCache::containsAircraftType(const AircraftType &aircraftType) noexcept
+{
+    const auto it = d->aircraftTypes.find(aircraftType.type);
+    const bool contains = it != d->aircraftTypes.cend() && it->second == aircraftType;
+    if (contains) {
+        ++d->statistics.aircraftTypeHitCount;
+    } else {
+        ++d->statistics.aircraftTypeMissCount;
+    }
+    return contains;
+}
+
+void LookupCache::putAircraftType(const AircraftType &aircraftType) noexcept
+{
+    d->aircraftTypes.insert_or_assign(aircraftType.type, aircraftType);
+}
+
+bool LookupCache::containsEnumeration(const QString &name, Enumeration::Order order) const noexcept
+{
+    const auto &enumerations = d->enumerations.at(Enum::underly(order));
+    return enumerations.find(name) != enumerations.cend();
+}
+
+std::optional<Enumeration> LookupCache::getEnumeration(const QString &name, Enumeration::Order order) noexcept
+{
+    std::optional<Enumeration> enumeration;
+    const auto &enumerations = d->enumerations.at(Enum::underly(order));
+    const auto it = enumerations.find(name);
+    if (it != enumerations.cend()) {
+        enumeration.emplace(name);
+        for (const auto &item : it->second) {
+            enumeration->addItem(item);
+        }
+        ++d->statistics.enumerationHitCount;
+    } else {
+        ++d->statistics.enumerationMissCount;
+    }
+    return enumeration;
+}
+
+void LookupCache::putEnumeration(const Enumeration &enumeration, Enumeration::Order order) noexcept
+{
+    d->enumerations.at(Enum::underly(order)).insert_or_assign(enumeration.getName(), enumeration.items());
+}
+
+void LookupCache::clear() noexcept
+{
+    d->aircraftTypes.clear();
+    for (auto &enumerations : d->enumerations) {
+        enumerations.clear();
+    }
+}
+
+LookupStatistics LookupCache::getStatistics() const noexcept
+{
+    return d->statistics;
+}
@@ -0,0 +1,127 @@
+/**
+ * Sky Dolly - The Black Sheep for Your Flight Recordings
+ *
+ * Copyright (c) 2020 - 2025 Oliver Knoll
+ *
+ * MIT License
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this
+ * software and associated documentation files (the "Software"), to deal in the Software
+ * without restriction, including without limitation the rights to use, copy, modify, merge,
+ * publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons
+ * to whom the Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or
+ * substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED *AS IS*, WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR
+ * PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE
+ * FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+ * OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ */
+#ifndef LOOKUPCACHE_H
+#define LOOKUPCACHE_H
+
+#include <memory>
+#include <optional>
+
+#include <QString>
+
+#include <Model/AircraftType.h>
+#include <Model/Enumeration.h>
+#include <LookupStatistics.h>
+
+struct LookupCachePrivate;
+
+/*!
+ * A read-through cache of the aircraft types and the persisted enumerations of a given
+ * database connection, which are looked up over and over again when storing, restoring
+ * or importing flights and locations.
+ *
+ * Like the connection itself the cache is bound to a given thread: each thread has its
+ * own cache per connection, as returned by #getInstance, which is shared by all
+ * DAOs and services of the same connection.
+ *
+ * The cache must be invalidated whenever the connection is (re-)opened or closed, the
+ * logbook is migrated and whenever a transaction which may have stored aircraft types
+ * is rolled back.
+ */
+class LookupCache final
+{
+public:
+    LookupCache() noexcept;
+    LookupCache(const LookupCache &rhs) = delete;
+    LookupCache(LookupCache &&rhs) noexcept;
+    LookupCache &operator=(const LookupCache &rhs) = delete;
+    LookupCache &operator=(LookupCache &&rhs) noexcept;
+    ~LookupCache();
+
+    /*!
+     * Returns the lookup cache of the connection with the given \p connectionName,
+     * for the calling thread.
+     *
+     * \param connectionName
+     *        the name of the database connection
+     * \return the shared lookup cache of the connection
+     */
+    static std::shared_ptr<LookupCache> getInstance(const QString &connectionName) noexcept;
+
+    /*!
+     * Clears the lookup cache of the connection with the given \p connectionName,
+     * for the calling thread. The hit and miss counts are kept.
+     *
+     * \param connectionName
+     *        the name of the database connection
+     */
+    static void invalidate(const QString &connectionName) noexcept;
+
+    /*!
+     * Returns the cached aircraft type with the given \p type and counts a hit;
+     * counts a miss otherwise.
+     *
+     * \param type
+     *        the aircraft type (name) to look up
+     * \return the cached aircraft type; \c std::nullopt if not cached
+     */
+    std::optional<AircraftType> getAircraftType(const QString &type) noexcept;
+
+    /*!
+     * Returns whether exactly the given \p aircraftType - including all its attributes -
+     * is cached. Counts a hit or a miss respectively.
+     *
+     * \param aircraftType
+     *        the aircraft type to compare with
+     * \return \c true if an equal aircraft type is cached; \c false else
+     */
+    bool containsAircraftType(const AircraftType &aircraftType) noexcept;
+    void putAircraftType(const AircraftType &aircraftType) noexcept;
+
+    /*!
+     * Returns whether the enumeration \p name is cached in the given \p order,
+     * without counting a hit or miss.
+     */
+    bool containsEnumeration(const QString &name, Enumeration::Order order) const noexcept;
+
+    /*!
+     * Returns a copy of the cached enumeration \p name in the given \p order and
+     * counts a hit; counts a miss otherwise.
+     *
+     * \param name
+     *        the name of the enumeration
+     * \param order
+     *        the order of the enumeration items
+     * \return the cached enumeration; \c std::nullopt if not cached
+     */
+    std::optional<Enumeration> getEnumeration(const QString &name, Enumeration::Order order) noexcept;
+    void putEnumeration(const Enumeration &enumeration, Enumeration::Order order) noexcept;
+
+    void clear() noexcept;
+    LookupStatistics getStatistics() const noexcept;
+
+private:
+    std::unique_ptr<LookupCachePrivate> d;
+};
+
+#endif // LOOKUPCACHE_H
@@ -0,0 +1,99 @@
+/**
+ * Sky Dolly - The Black Sheep for Your Flight Recordings
+ *
+ * Copyright (c) 2020 - 2025 Oliver Knoll
+ *
+ * MIT License
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this
+ * software and associated documentation files (the "Software"), to deal in the Software
+ * without restriction, including without limitation the rights to use, copy, modify, merge,
+ * publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons
+ * to whom the Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or
+ * substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED *AS IS*, WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR
+ * PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE
+ * FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+ * OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ */
+#ifndef RECORDINGJOURNALDAOINTF_H
+#define RECORDINGJOURNALDAOINTF_H
+
+#include <vector>
+#include <cstdint>
+
+/*!
+ * An unfinished recording, as marked in the recording journal.
+ */
+struct RecordingJournalEntry
+{
+    std::int64_t flightId;
+    std::int64_t aircraftId;
+    bool newFlight;
+};
+
+class RecordingJournalDaoIntf
+{
+public:
+    RecordingJournalDaoIntf() = default;
+    RecordingJournalDaoIntf(const RecordingJournalDaoIntf &rhs) = delete;
+    RecordingJournalDaoIntf(RecordingJournalDaoIntf &&rhs) = default;
+    RecordingJournalDaoIntf &operator=(const RecordingJournalDaoIntf &rhs) = delete;
+    RecordingJournalDaoIntf &operator=(RecordingJournalDaoIntf &&rhs) = default;
+    virtual ~RecordingJournalDaoIntf() = default;
+
+    /*!
+     * Marks the aircraft identified by \p aircraftId as being recorded (unfinished).
+     *
+     * \param flightId
+     *        the flight the aircraft belongs to
+     * \param aircraftId
+     *        the aircraft that is being recorded
+     * \param newFlight
+     *        \c true if the flight itself is being recorded (and not yet finished);
+     *        \c false if the aircraft is being added to an existing flight (formation)
+     * \return \c true on success; \c false else
+     */
+    virtual bool add(std::int64_t flightId, std::int64_t aircraftId, bool newFlight) const noexcept = 0;
+
+    /*!
+     * Removes the unfinished mark of the aircraft identified by \p aircraftId.
+     *
+     * \param aircraftId
+     *        the aircraft whose recording has been finished
+     * \return \c true on success; \c false else
+     */
+    virtual bool deleteByAircraftId(std::int64_t aircraftId) const noexcept = 0;
+
+    /*!
+     * Removes all unfinished marks.
+     *
+     * \return \c true on success; \c false else
+     */
+    virtual bool deleteAll() const noexcept = 0;
+
+    /*!
+     * Returns the number of unfinished recordings.
+     *
+     * \param ok
+     *        if set, \c true on success; \c false else
+     * \return the number of aircraft with unfinished recordings
+     */
+    virtual std::int64_t getCount(bool *ok = nullptr) const noexcept = 0;
+
+    /*!
+     * Returns all unfinished recordings.
+     *
+     * \param ok
+     *        if set, \c true on success; \c false else
+     * \return the unfinished recordings, in the order they have been begun
+     */
+    virtual std::vector<RecordingJournalEntry> getAll(bool *ok = nullptr) const noexcept = 0;
+};
+
+#endif // RECORDINGJOURNALDAOINTF_H
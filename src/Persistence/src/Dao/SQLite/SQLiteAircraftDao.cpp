@@ -22,7 +22,11 @@
  * DEALINGS IN THE SOFTWARE.
  */
 #include <memory>
+#include <algorithm>
+#include <array>
+#include <atomic>
 #include <cstdint>
+#include <cstddef>
 #include <vector>
 #include <utility>
 
@@ -34,11 +38,16 @@
 #include <QSqlRecord>
 #include <QTimeZone>
 #include <QSqlDriver>
+#include <QStringBuilder>
+#include <QThread>
+#include <QFuture>
+#include <QtConcurrentRun>
 #ifdef DEBUG
 #include <QDebug>
 #endif
 
 #include <Kernel/Enum.h>
+#include <Kernel/Trace.h>
 #include <Model/Aircraft.h>
 #include <Model/AircraftInfo.h>
 #include <Model/Position.h>
@@ -67,12 +76,15 @@
 #include "../../Dao/LightDaoIntf.h"
 #include "../../Dao/WaypointDaoIntf.h"
 #include "../../Dao/DaoFactory.h"
+#include "../../FlightCache.h"
+#include "SqlStatementCache.h"
 #include "SQLiteAircraftDao.h"
 
 struct SQLiteAircraftDaoPrivate
 {
     SQLiteAircraftDaoPrivate(QString connectionName) noexcept
         : connectionName(connectionName),
+          statementCache(SqlStatementCache::getInstance(connectionName)),
           daoFactory(std::make_unique<DaoFactory>(DaoFactory::DbType::SQLite, std::move(connectionName))),
           aircraftTypeDao(daoFactory->createAircraftTypeDao()),
           positionDao(daoFactory->createPositionDao()),
@@ -86,6 +98,7 @@ struct SQLiteAircraftDaoPrivate
     {}
 
     QString connectionName;
+    std::shared_ptr<SqlStatementCache> statementCache;
     std::unique_ptr<DaoFactory> daoFactory;
     std::unique_ptr<AircraftTypeDaoIntf> aircraftTypeDao;
     std::unique_ptr<PositionDaoIntf> positionDao;
@@ -104,6 +117,99 @@ namespace
     // the result count for the given SELECT query)
     // Most flights have only one aircraft
     constexpr int DefaultCapacity = 1;
+
+    constexpr const char *DriverName {"QSQLITE"};
+    constexpr const char *InMemoryDatabaseName {":memory:"};
+    constexpr const char *ReadOnlyConnectOptions {"QSQLITE_OPEN_READONLY"};
+    constexpr const char *RestoreConnectionSuffix {"-Restore-"};
+    // The maximum number of concurrent read connections when restoring a flight
+    constexpr int MaxRestoreConnections {8};
+
+    // The tables with sampled data, referencing the aircraft table
+    constexpr std::array<const char *, 8> SampleTables {
+        "position",
+        "attitude",
+        "engine",
+        "primary_flight_control",
+        "secondary_flight_control",
+        "handle",
+        "light",
+        "waypoint"
+    };
+
+    // The sampled data restored per aircraft, in descending order of their typical size
+    enum struct RestoreStep: std::uint8_t
+    {
+        Position,
+        Attitude,
+        Engine,
+        PrimaryFlightControl,
+        SecondaryFlightControl,
+        Handle,
+        Light,
+        Waypoint,
+        Count
+    };
+    constexpr std::size_t RestoreStepCount {static_cast<std::size_t>(RestoreStep::Count)};
+
+    // The DAOs restoring the sampled data of an aircraft, all on the same connection
+    struct RestoreDaos
+    {
+        RestoreDaos(DaoFactory &daoFactory) noexcept
+            : positionDao(daoFactory.createPositionDao()),
+              attitudeDao(daoFactory.createAttitudeDao()),
+              engineDao(daoFactory.createEngineDao()),
+              primaryFlightControlDao(daoFactory.createPrimaryFlightControlDao()),
+              secondaryFlightControlDao(daoFactory.createSecondaryFlightControlDao()),
+              handleDao(daoFactory.createHandleDao()),
+              lightDao(daoFactory.createLightDao()),
+              waypointDao(daoFactory.createFlightPlanDao())
+        {}
+
+        bool restore(RestoreStep step, Aircraft &aircraft) const noexcept
+        {
+            bool ok {true};
+            const auto aircraftId = aircraft.getId();
+            switch (step) {
+            case RestoreStep::Position:
+                aircraft.getPosition().setData(positionDao->getByAircraftId(aircraftId, &ok));
+                break;
+            case RestoreStep::Attitude:
+                aircraft.getAttitude().setData(attitudeDao->getByAircraftId(aircraftId, &ok));
+                break;
+            case RestoreStep::Engine:
+                aircraft.getEngine().setData(engineDao->getByAircraftId(aircraftId, &ok));
+                break;
+            case RestoreStep::PrimaryFlightControl:
+                aircraft.getPrimaryFlightControl().setData(primaryFlightControlDao->getByAircraftId(aircraftId, &ok));
+                break;
+            case RestoreStep::SecondaryFlightControl:
+                aircraft.getSecondaryFlightControl().setData(secondaryFlightControlDao->getByAircraftId(aircraftId, &ok));
+                break;
+            case RestoreStep::Handle:
+                aircraft.getAircraftHandle().setData(handleDao->getByAircraftId(aircraftId, &ok));
+                break;
+            case RestoreStep::Light:
+                aircraft.getLight().setData(lightDao->getByAircraftId(aircraftId, &ok));
+                break;
+            case RestoreStep::Waypoint:
+                ok = waypointDao->getByAircraftId(aircraftId, aircraft.getFlightPlan());
+                break;
+            case RestoreStep::Count:
+                break;
+            }
+            return ok;
+        }
+
+        std::unique_ptr<PositionDaoIntf> positionDao;
+        std::unique_ptr<AttitudeDaoIntf> attitudeDao;
+        std::unique_ptr<EngineDaoIntf> engineDao;
+        std::unique_ptr<PrimaryFlightControlDaoIntf> primaryFlightControlDao;
+        std::unique_ptr<SecondaryFlightControlDaoIntf> secondaryFlightControlDao;
+        std::unique_ptr<HandleDaoIntf> handleDao;
+        std::unique_ptr<LightDaoIntf> lightDao;
+        std::unique_ptr<WaypointDaoIntf> waypointDao;
+    };
 }
 
 // PUBLIC
@@ -118,6 +224,7 @@ SQLiteAircraftDao::~SQLiteAircraftDao() = default;
 
 bool SQLiteAircraftDao::add(std::int64_t flightId, std::size_t sequenceNumber, Aircraft &aircraft) const noexcept
 {
+    Trace::Scope trace {Trace::Persistence, "Add aircraft"};
     bool ok {false};
     const std::int64_t aircraftId = insertAircraft(flightId, sequenceNumber, aircraft);
     if (aircraftId != Const::InvalidId) {
@@ -137,41 +244,91 @@ bool SQLiteAircraftDao::exportAircraft(std::int64_t flightId, std::size_t sequen
     return ok;
 }
 
-std::vector<Aircraft> SQLiteAircraftDao::getByFlightId(std::int64_t flightId, bool *ok) const noexcept
+bool SQLiteAircraftDao::addSampledData(std::int64_t aircraftId, const Aircraft &aircraft) const noexcept
 {
-    std::vector<Aircraft> aircraftList;
-    bool success {true};
-    std::vector<AircraftInfo> aircraftInfos = getAircraftInfosByFlightId(flightId, &success);
-    if (success) {
-        aircraftList.reserve(aircraftInfos.size());
-        for (const auto &info: aircraftInfos) {
-            Aircraft aircraft;
-            aircraft.setId(info.aircraftId);
-            aircraft.setAircraftInfo(info);
-            aircraft.getPosition().setData(d->positionDao->getByAircraftId(aircraft.getId(), &success));
-            if (success) {
-                aircraft.getAttitude().setData(d->attitudeDao->getByAircraftId(aircraft.getId(), &success));
+    bool ok {true};
+    for (const auto &data : aircraft.getPosition()) {
+        ok = d->positionDao->add(aircraftId, data);
+        if (!ok) {
+            break;
+        }
+    }
+    if (ok) {
+        for (const auto &data : aircraft.getAttitude()) {
+            ok = d->attitudeDao->add(aircraftId, data);
+            if (!ok) {
+                break;
             }
-            if (success) {
-                aircraft.getEngine().setData(d->engineDao->getByAircraftId(aircraft.getId(), &success));
+        }
+    }
+    if (ok) {
+        for (const auto &data : aircraft.getEngine()) {
+            ok = d->engineDao->add(aircraftId, data);
+            if (!ok) {
+                break;
             }
-            if (success) {
-                aircraft.getPrimaryFlightControl().setData(d->primaryFlightControlDao->getByAircraftId(aircraft.getId(), &success));
+        }
+    }
+    if (ok) {
+        for (const auto &data : aircraft.getPrimaryFlightControl()) {
+            ok = d->primaryFlightControlDao->add(aircraftId, data);
+            if (!ok) {
+                break;
             }
-            if (success) {
-                aircraft.getSecondaryFlightControl().setData(d->secondaryFlightControlDao->getByAircraftId(aircraft.getId(), &success));
+        }
+    }
+    if (ok) {
+        for (const auto &data : aircraft.getSecondaryFlightControl()) {
+            ok = d->secondaryFlightControlDao->add(aircraftId, data);
+            if (!ok) {
+                break;
             }
-            if (success) {
-                aircraft.getAircraftHandle().setData(d->handleDao->getByAircraftId(aircraft.getId(), &success));
+        }
+    }
+    if (ok) {
+        for (const auto &data : aircraft.getAircraftHandle()) {
+            ok = d->handleDao->add(aircraftId, data);
+            if (!ok) {
+                break;
             }
-            if (success) {
-                aircraft.getLight().setData(d->lightDao->getByAircraftId(aircraft.getId(), &success));
+        }
+    }
+    if (ok) {
+        for (const auto &data : aircraft.getLight()) {
+            ok = d->lightDao->add(aircraftId, data);
+            if (!ok) {
+                break;
             }
-            if (success) {
-                success = d->waypointDao->getByAircraftId(aircraft.getId(), aircraft.getFlightPlan());
+        }
+    }
+    return ok;
+}
+
+std::vector<Aircraft> SQLiteAircraftDao::getByFlightId(std::int64_t flightId, bool *ok) const noexcept
+{
+    Trace::Scope trace {Trace::Persistence, "Get aircraft"};
+    bool success {true};
+    std::vector<AircraftInfo> aircraftInfos = getAircraftInfosByFlightId(flightId, &success);
+    std::vector<Aircraft> aircraftList(aircraftInfos.size());
+    if (success) {
+        for (std::size_t i = 0; i < aircraftInfos.size(); ++i) {
+            aircraftList[i].setId(aircraftInfos[i].aircraftId);
+            aircraftList[i].setAircraftInfo(aircraftInfos[i]);
+        }
+        const auto &db = d->statementCache->getDatabase();
+        const auto logbookPath = db.databaseName();
+        FlightCache flightCache {db};
+        if (flightCache.read(flightId, aircraftList)) {
+            success = restoreFlightPlans(aircraftList);
+        } else {
+            const bool fileBased = !logbookPath.isEmpty() && logbookPath != ::InMemoryDatabaseName;
+            if (fileBased && QThread::idealThreadCount() > 1) {
+                success = restoreConcurrently(logbookPath, aircraftList);
+            } else {
+                success = restoreSequentially(aircraftList);
             }
             if (success) {
-                aircraftList.push_back(std::move(aircraft));
+                flightCache.write(flightId, aircraftList);
             }
         }
     }
@@ -184,9 +341,7 @@ std::vector<Aircraft> SQLiteAircraftDao::getByFlightId(std::int64_t flightId, bo
 
 bool SQLiteAircraftDao::adjustAircraftSequenceNumbersByFlightId(std::int64_t flightId, std::size_t sequenceNumber) const noexcept
 {
-    const auto db {QSqlDatabase::database(d->connectionName)};
-    QSqlQuery query {db};
-    query.prepare(
+    auto &query = d->statementCache->prepare(
         "update aircraft "
         "set    seq_nr = seq_nr - 1 "
         "where flight_id = :flight_id "
@@ -230,9 +385,7 @@ bool SQLiteAircraftDao::deleteAllByFlightId(std::int64_t flightId) const noexcep
         ok = d->waypointDao->deleteByFlightId(flightId);
     }
     if (ok) {
-        const auto db {QSqlDatabase::database(d->connectionName)};
-        QSqlQuery query {db};
-        query.prepare(
+        auto &query = d->statementCache->prepare(
             "delete "
             "from   aircraft "
             "where  flight_id = :flight_id;"
@@ -249,6 +402,54 @@ bool SQLiteAircraftDao::deleteAllByFlightId(std::int64_t flightId) const noexcep
     return ok;
 }
 
+bool SQLiteAircraftDao::deleteAllByFlightIds(const std::vector<std::int64_t> &flightIds) const noexcept
+{
+    const auto db {d->statementCache->getDatabase()};
+    QSqlQuery query {db};
+    // The IDs of the flights to be deleted are collected in a temporary table (private to this
+    // connection), so that each table is cleaned up with a single statement
+    bool ok = query.exec(
+        "create temp table if not exists deleted_flight ("
+        "    id integer primary key"
+        ");"
+    );
+    if (ok) {
+        ok = query.exec("delete from temp.deleted_flight;");
+    }
+    if (ok) {
+        query.prepare("insert or ignore into temp.deleted_flight (id) values(:id);");
+        for (auto it = flightIds.cbegin(); ok && it != flightIds.cend(); ++it) {
+            query.bindValue(":id", QVariant::fromValue(*it));
+            ok = query.exec();
+        }
+    }
+    // Delete "bottom-up" in order not to violate foreign key constraints
+    // Note: aircraft types (table aircraft_type) are not deleted
+    for (auto it = ::SampleTables.cbegin(); ok && it != ::SampleTables.cend(); ++it) {
+        ok = query.exec(QStringLiteral(
+            "delete "
+            "from   %1 "
+            "where  aircraft_id in (select a.id "
+            "                       from   aircraft a "
+            "                       where  a.flight_id in (select df.id from temp.deleted_flight df)"
+            "                      );"
+        ).arg(*it));
+    }
+    if (ok) {
+        ok = query.exec(
+            "delete "
+            "from   aircraft "
+            "where  flight_id in (select df.id from temp.deleted_flight df);"
+        );
+    }
+#ifdef DEBUG
+    if (!ok) {
+        qDebug() << "SQLiteAircraftDao::deleteAllByFlightIds: SQL error" << query.lastError().text() << "- error code:" << query.lastError().nativeErrorCode();
+    }
+#endif
+    return ok;
+}
+
 bool SQLiteAircraftDao::deleteById(std::int64_t id) const noexcept
 {
     // Delete "bottom-up" in order not to violate foreign key constraints
@@ -276,9 +477,7 @@ bool SQLiteAircraftDao::deleteById(std::int64_t id) const noexcept
         ok = d->waypointDao->deleteByAircraftId(id);
     }
     if (ok) {
-        const auto db {QSqlDatabase::database(d->connectionName)};
-        QSqlQuery query {db};
-        query.prepare(
+        auto &query = d->statementCache->prepare(
             "delete "
             "from   aircraft "
             "where  id = :id;"
@@ -298,20 +497,18 @@ bool SQLiteAircraftDao::deleteById(std::int64_t id) const noexcept
 std::vector<AircraftInfo> SQLiteAircraftDao::getAircraftInfosByFlightId(std::int64_t flightId,  bool *ok) const noexcept
 {
     std::vector<AircraftInfo> aircraftInfos;
-    const auto db {QSqlDatabase::database(d->connectionName)};
-    QSqlQuery query {db};
-    query.setForwardOnly(true);
-    query.prepare(
+    auto &query = d->statementCache->prepare(
         "select * "
         "from   aircraft a "
         "where  a.flight_id = :flight_id "
         "order by a.seq_nr;"
     );
+    const SqlQueryFinisher finisher {query};
 
     query.bindValue(":flight_id", QVariant::fromValue(flightId));
     bool success = query.exec();
     if (success) {
-        const bool querySizeFeature = db.driver()->hasFeature(QSqlDriver::QuerySize);
+        const bool querySizeFeature = d->statementCache->getDatabase().driver()->hasFeature(QSqlDriver::QuerySize);
         if (querySizeFeature) {
             aircraftInfos.reserve(query.size());
         } else {
@@ -356,9 +553,7 @@ std::vector<AircraftInfo> SQLiteAircraftDao::getAircraftInfosByFlightId(std::int
 
 bool SQLiteAircraftDao::updateTimeOffset(std::int64_t id, std::int64_t timeOffset) const noexcept
 {
-    const auto db {QSqlDatabase::database(d->connectionName)};
-    QSqlQuery query {db};
-    query.prepare(
+    auto &query = d->statementCache->prepare(
         "update aircraft "
         "set    time_offset = :time_offset "
         "where  id = :id;"
@@ -377,9 +572,7 @@ bool SQLiteAircraftDao::updateTimeOffset(std::int64_t id, std::int64_t timeOffse
 
 bool SQLiteAircraftDao::updateTailNumber(std::int64_t id, const QString &tailNumber) const noexcept
 {
-    const auto db {QSqlDatabase::database(d->connectionName)};
-    QSqlQuery query {db};
-    query.prepare(
+    auto &query = d->statementCache->prepare(
         "update aircraft "
         "set    tail_number = :tail_number "
         "where  id = :id;"
@@ -396,14 +589,46 @@ bool SQLiteAircraftDao::updateTailNumber(std::int64_t id, const QString &tailNum
     return ok;
 };
 
+bool SQLiteAircraftDao::updateAircraftInfo(std::int64_t id, const AircraftInfo &info) const noexcept
+{
+    auto &query = d->statementCache->prepare(
+        "update aircraft "
+        "set    type = :type,"
+        "       time_offset = :time_offset,"
+        "       tail_number = :tail_number,"
+        "       airline = :airline,"
+        "       initial_airspeed = :initial_airspeed,"
+        "       altitude_above_ground = :altitude_above_ground,"
+        "       start_on_ground = :start_on_ground "
+        "where  id = :id;"
+    );
+
+    bool ok = d->aircraftTypeDao->upsert(info.aircraftType);
+    if (ok) {
+        query.bindValue(":type", info.aircraftType.type);
+        query.bindValue(":time_offset", QVariant::fromValue(info.timeOffset));
+        query.bindValue(":tail_number", info.tailNumber);
+        query.bindValue(":airline", info.airline);
+        query.bindValue(":initial_airspeed", info.initialAirspeed);
+        query.bindValue(":altitude_above_ground", info.altitudeAboveGround);
+        query.bindValue(":start_on_ground", info.startOnGround);
+        query.bindValue(":id", QVariant::fromValue(id));
+        ok = query.exec();
+    }
+#ifdef DEBUG
+    if (!ok) {
+        qDebug() << "SQLiteAircraftDao::updateAircraftInfo: SQL error" << query.lastError().text() << "- error code:" << query.lastError().nativeErrorCode();
+    }
+#endif
+    return ok;
+}
+
 // PRIVATE
 
 inline std::int64_t SQLiteAircraftDao::insertAircraft(std::int64_t flightId, std::size_t sequenceNumber, const Aircraft &aircraft) const noexcept
 {
     std::int64_t aircraftId {Const::InvalidId};
-    const auto db {QSqlDatabase::database(d->connectionName)};
-    QSqlQuery query {db};
-    query.prepare(
+    auto &query = d->statementCache->prepare(
         "insert into aircraft ("
         "  flight_id,"
         "  seq_nr,"
@@ -457,63 +682,93 @@ inline std::int64_t SQLiteAircraftDao::insertAircraft(std::int64_t flightId, std
 
 inline bool SQLiteAircraftDao::insertAircraftData(std::int64_t aircraftId, const Aircraft &aircraft) const noexcept
 {
-    bool ok {true};
-    for (const auto &data : aircraft.getPosition()) {
-        ok = d->positionDao->add(aircraftId, data);
-        if (!ok) {
-            break;
-        }
-    }
+    bool ok = addSampledData(aircraftId, aircraft);
     if (ok) {
-        for (const auto &data : aircraft.getAttitude()) {
-            ok = d->attitudeDao->add(aircraftId, data);
-            if (!ok) {
-                break;
-            }
-        }
-    }
-    if (ok) {
-        for (const auto &data : aircraft.getEngine()) {
-            ok = d->engineDao->add(aircraftId, data);
-            if (!ok) {
-                break;
-            }
-        }
+        ok = d->waypointDao->add(aircraftId, aircraft.getFlightPlan());
     }
-    if (ok) {
-        for (const auto &data : aircraft.getPrimaryFlightControl()) {
-            ok = d->primaryFlightControlDao->add(aircraftId, data);
-            if (!ok) {
-                break;
-            }
+    return ok;
+}
+
+bool SQLiteAircraftDao::restoreSequentially(std::vector<Aircraft> &aircraftList) const noexcept
+{
+    const RestoreDaos daos {*d->daoFactory};
+    bool ok {true};
+    for (auto &aircraft : aircraftList) {
+        for (std::size_t step = 0; ok && step < ::RestoreStepCount; ++step) {
+            ok = daos.restore(static_cast<RestoreStep>(step), aircraft);
         }
-    }
-    if (ok) {
-        for (const auto &data : aircraft.getSecondaryFlightControl()) {
-            ok = d->secondaryFlightControlDao->add(aircraftId, data);
-            if (!ok) {
-                break;
-            }
+        if (!ok) {
+            break;
         }
     }
-    if (ok) {
-        for (const auto &data : aircraft.getAircraftHandle()) {
-            ok = d->handleDao->add(aircraftId, data);
-            if (!ok) {
-                break;
+    return ok;
+}
+
+bool SQLiteAircraftDao::restoreConcurrently(const QString &logbookPath, std::vector<Aircraft> &aircraftList) const noexcept
+{
+    // Jobs are ordered step-major: the (large) position data of all aircraft is fetched first,
+    // the (small) light and waypoint data last, which balances the load among the workers
+    const std::size_t aircraftCount = aircraftList.size();
+    const std::size_t jobCount = aircraftCount * ::RestoreStepCount;
+    if (jobCount == 0) {
+        return true;
+    }
+    const int workerCount = static_cast<int>(std::min({static_cast<std::size_t>(QThread::idealThreadCount()),
+                                                       static_cast<std::size_t>(::MaxRestoreConnections),
+                                                       jobCount}));
+    std::atomic<std::size_t> nextJob {0};
+    std::atomic_bool ok {true};
+
+    // Each worker opens its own read-only connection: a QSqlDatabase connection
+    // must only be used by the thread that opened it
+    const auto worker = [this, &logbookPath, &aircraftList, aircraftCount, jobCount, &nextJob, &ok](int workerIndex) {
+        const QString connectionName = d->connectionName % ::RestoreConnectionSuffix % QString::number(workerIndex);
+        {
+            QSqlDatabase db = QSqlDatabase::addDatabase(::DriverName, connectionName);
+            db.setDatabaseName(logbookPath);
+            db.setConnectOptions(::ReadOnlyConnectOptions);
+            if (db.open()) {
+                DaoFactory daoFactory {DaoFactory::DbType::SQLite, connectionName};
+                const RestoreDaos daos {daoFactory};
+                std::size_t job = nextJob.fetch_add(1);
+                while (job < jobCount && ok) {
+                    const auto step = static_cast<RestoreStep>(job / aircraftCount);
+                    // Each job writes into a distinct component of a pre-sized aircraft
+                    if (!daos.restore(step, aircraftList[job % aircraftCount])) {
+                        ok = false;
+                    }
+                    job = nextJob.fetch_add(1);
+                }
+                db.close();
+            } else {
+#ifdef DEBUG
+                qDebug() << "SQLiteAircraftDao::restoreConcurrently: could not open read connection:" << db.lastError().text();
+#endif
+                ok = false;
             }
         }
+        QSqlDatabase::removeDatabase(connectionName);
+    };
+
+    std::vector<QFuture<void>> futures;
+    futures.reserve(workerCount - 1);
+    for (int i = 1; i < workerCount; ++i) {
+        futures.push_back(QtConcurrent::run(worker, i));
     }
-    if (ok) {
-        for (const auto &data : aircraft.getLight()) {
-            ok = d->lightDao->add(aircraftId, data);
-            if (!ok) {
-                break;
-            }
-        }
+    // The calling thread participates as well
+    worker(0);
+    for (auto &future : futures) {
+        future.waitForFinished();
     }
-    if (ok) {
-        ok = d->waypointDao->add(aircraftId, aircraft.getFlightPlan());
+    return ok;
+}
+
+bool SQLiteAircraftDao::restoreFlightPlans(std::vector<Aircraft> &aircraftList) const noexcept
+{
+    const RestoreDaos daos {*d->daoFactory};
+    bool ok {true};
+    for (auto it = aircraftList.begin(); ok && it != aircraftList.end(); ++it) {
+        ok = daos.restore(RestoreStep::Waypoint, *it);
     }
     return ok;
 }
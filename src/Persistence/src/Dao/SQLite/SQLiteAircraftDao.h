@@ -49,13 +49,16 @@ public:
 
     bool add(std::int64_t flightId, std::size_t sequenceNumber, Aircraft &aircraft) const noexcept override;
     bool exportAircraft(std::int64_t flightId, std::size_t sequenceNumber, const Aircraft &aircraft) const noexcept override;
+    bool addSampledData(std::int64_t aircraftId, const Aircraft &aircraft) const noexcept override;
     std::vector<Aircraft> getByFlightId(std::int64_t flightId, bool *ok = nullptr) const noexcept override;
     bool adjustAircraftSequenceNumbersByFlightId(std::int64_t flightId, std::size_t sequenceNumber) const noexcept override;
     bool deleteAllByFlightId(std::int64_t flightId) const noexcept override;
+    bool deleteAllByFlightIds(const std::vector<std::int64_t> &flightIds) const noexcept override;
     bool deleteById(std::int64_t id) const noexcept override;
     std::vector<AircraftInfo> getAircraftInfosByFlightId(std::int64_t flightId, bool *ok = nullptr) const noexcept override;
     bool updateTimeOffset(std::int64_t id, std::int64_t timeOffset) const noexcept override;
     bool updateTailNumber(std::int64_t id, const QString &tailNumber) const noexcept override;
+    bool updateAircraftInfo(std::int64_t id, const AircraftInfo &info) const noexcept override;
 
 private:
     std::unique_ptr<SQLiteAircraftDaoPrivate> d;
@@ -63,6 +66,14 @@ private:
     // Inserts the aircraft and returns the generated aircraft ID if successful; Const::InvalidId upon failure
     inline std::int64_t insertAircraft(std::int64_t flightId, std::size_t sequenceNumber, const Aircraft &aircraft) const noexcept;
     inline bool insertAircraftData(std::int64_t aircraftId, const Aircraft &aircraft) const noexcept;
+
+    // Restores the sampled data of the pre-sized aircraft, one after another, on this connection
+    bool restoreSequentially(std::vector<Aircraft> &aircraftList) const noexcept;
+    // Restores the sampled data of the pre-sized aircraft with concurrent workers, each on
+    // its own read-only connection to the logbook given by \p logbookPath
+    bool restoreConcurrently(const QString &logbookPath, std::vector<Aircraft> &aircraftList) const noexcept;
+    // Restores the flight plans of the pre-sized aircraft, whose sampled data has been restored from the flight cache
+    bool restoreFlightPlans(std::vector<Aircraft> &aircraftList) const noexcept;
 };
 
 #endif // SQLITEAIRCRAFTDAO_H
@@ -22,9 +22,9 @@
  * DEALINGS IN THE SOFTWARE.
  */
 #include <memory>
+#include <optional>
 #include <utility>
 #include <vector>
-#include <utility>
 
 #include <QString>
 #include <QSqlDatabase>
@@ -39,6 +39,8 @@
 
 #include <Kernel/Enum.h>
 #include <Model/AircraftType.h>
+#include "../LookupCache.h"
+#include "SqlStatementCache.h"
 #include "SQLiteAircraftTypeDao.h"
 
 namespace
@@ -51,10 +53,14 @@ namespace
 struct SQLiteAircraftTypeDaoPrivate
 {
     SQLiteAircraftTypeDaoPrivate(QString connectionName) noexcept
-        : connectionName {std::move(connectionName)}
+        : connectionName {std::move(connectionName)},
+          statementCache {SqlStatementCache::getInstance(this->connectionName)},
+          lookupCache {LookupCache::getInstance(this->connectionName)}
     {}
 
     QString connectionName;
+    std::shared_ptr<SqlStatementCache> statementCache;
+    std::shared_ptr<LookupCache> lookupCache;
 };
 
 // PUBLIC
@@ -69,9 +75,11 @@ SQLiteAircraftTypeDao::~SQLiteAircraftTypeDao() = default;
 
 bool SQLiteAircraftTypeDao::upsert(const AircraftType &aircraftType) const noexcept
 {
-    const auto db {QSqlDatabase::database(d->connectionName)};
-    QSqlQuery query {db};
-    query.prepare(
+    // The same aircraft types are stored over and over again (once per stored aircraft)
+    if (d->lookupCache->containsAircraftType(aircraftType)) {
+        return true;
+    }
+    auto &query = d->statementCache->prepare(
         "insert into aircraft_type (type, category, wing_span, engine_type, nof_engines) "
         "values(:type, :category, :wing_span, :engine_type, :nof_engines) "
         "on conflict(type) "
@@ -89,6 +97,9 @@ bool SQLiteAircraftTypeDao::upsert(const AircraftType &aircraftType) const noexc
     query.bindValue(":nof_engines", aircraftType.numberOfEngines);
 
     const bool ok = query.exec();
+    if (ok) {
+        d->lookupCache->putAircraftType(aircraftType);
+    }
 #ifdef DEBUG
     if (!ok) {
         qDebug() << "SQLiteAircraftTypeDao::upsert: SQL error" << query.lastError().text() << "- error code:" << query.lastError().nativeErrorCode();
@@ -99,15 +110,21 @@ bool SQLiteAircraftTypeDao::upsert(const AircraftType &aircraftType) const noexc
 
 AircraftType SQLiteAircraftTypeDao::getByType(const QString &type, bool *ok) const noexcept
 {
+    std::optional<AircraftType> cachedAircraftType = d->lookupCache->getAircraftType(type);
+    if (cachedAircraftType) {
+        if (ok != nullptr) {
+            *ok = true;
+        }
+        return *cachedAircraftType;
+    }
+
     AircraftType aircraftType;
-    const auto db {QSqlDatabase::database(d->connectionName)};
-    QSqlQuery query {db};
-    query.setForwardOnly(true);
-    query.prepare(
+    auto &query = d->statementCache->prepare(
         "select at.category, at.wing_span, at.engine_type, at.nof_engines "
-         "from   aircraft_type at "
-         "where  at.type = :type;"
+        "from   aircraft_type at "
+        "where  at.type = :type;"
     );
+    const SqlQueryFinisher finisher {query};
 
     query.bindValue(":type", type);
     aircraftType.type = type;
@@ -125,6 +142,7 @@ AircraftType SQLiteAircraftTypeDao::getByType(const QString &type, bool *ok) con
             const auto enumValue = query.value(engineTypeIdx).toInt();
             aircraftType.engineType = Enum::contains<SimType::EngineType>(enumValue) ? static_cast<SimType::EngineType>(enumValue) : SimType::EngineType::First;
             aircraftType.numberOfEngines = query.value(nofEnginesIdx).toInt();
+            d->lookupCache->putAircraftType(aircraftType);
         }
     }
 #ifdef DEBUG
@@ -141,17 +159,15 @@ AircraftType SQLiteAircraftTypeDao::getByType(const QString &type, bool *ok) con
 std::vector<AircraftType> SQLiteAircraftTypeDao::getAll(bool *ok) const noexcept
 {
     std::vector<AircraftType> aircraftTypes;
-    const auto db {QSqlDatabase::database(d->connectionName)};
-    QSqlQuery query {db};
-    query.setForwardOnly(true);
-    query.prepare(
+    auto &query = d->statementCache->prepare(
         "select * "
         "from   aircraft_type at "
         "order by at.type asc;"
     );
+    const SqlQueryFinisher finisher {query};
     const bool success = query.exec();
     if (success) {
-        const bool querySizeFeature = db.driver()->hasFeature(QSqlDriver::QuerySize);
+        const bool querySizeFeature = d->statementCache->getDatabase().driver()->hasFeature(QSqlDriver::QuerySize);
         if (querySizeFeature) {
             aircraftTypes.reserve(query.size());
         } else {
@@ -172,6 +188,7 @@ std::vector<AircraftType> SQLiteAircraftTypeDao::getAll(bool *ok) const noexcept
             const SimType::EngineType engineType = Enum::contains<SimType::EngineType>(enumValue) ? static_cast<SimType::EngineType>(enumValue) : SimType::EngineType::First;
             const auto numberOfEngines = query.value(nofEnginesIdx).toInt();
             aircraftTypes.emplace_back(type, category, wingSpan, engineType, numberOfEngines);
+            d->lookupCache->putAircraftType(aircraftTypes.back());
         }
 #ifdef DEBUG
     } else {
@@ -187,16 +204,17 @@ std::vector<AircraftType> SQLiteAircraftTypeDao::getAll(bool *ok) const noexcept
 
 bool SQLiteAircraftTypeDao::exists(const QString &type) const noexcept
 {
+    if (d->lookupCache->getAircraftType(type)) {
+        return true;
+    }
     bool exists {false};
-    const auto db {QSqlDatabase::database(d->connectionName)};
-    QSqlQuery query {db};
-    query.setForwardOnly(true);
-    query.prepare(
+    auto &query = d->statementCache->prepare(
         "select count(*) "
         "from   aircraft_type at "
         "where  at.type = :type "
         "limit 1;"
     );
+    const SqlQueryFinisher finisher {query};
 
     query.bindValue(":type", type);
     const bool ok = query.exec();
@@ -40,6 +40,7 @@
 
 #include <Kernel/Enum.h>
 #include <Model/AttitudeData.h>
+#include "SqlStatementCache.h"
 #include "SQLiteAttitudeDao.h"
 
 namespace
@@ -53,10 +54,12 @@ namespace
 struct SQLiteAttitudeDaoPrivate
 {
     SQLiteAttitudeDaoPrivate(QString connectionName) noexcept
-        : connectionName {std::move(connectionName)}
+        : connectionName {std::move(connectionName)},
+          statementCache {SqlStatementCache::getInstance(this->connectionName)}
     {}
 
     QString connectionName;
+    std::shared_ptr<SqlStatementCache> statementCache;
 };
 
 // PUBLIC
@@ -71,9 +74,7 @@ SQLiteAttitudeDao::~SQLiteAttitudeDao() = default;
 
 bool SQLiteAttitudeDao::add(std::int64_t aircraftId, const AttitudeData &attitude) const noexcept
 {
-    const auto db {QSqlDatabase::database(d->connectionName)};
-    QSqlQuery query {db};
-    query.prepare(
+    auto &query = d->statementCache->prepare(
         "insert into attitude ("
         "  aircraft_id,"
         "  timestamp,"
@@ -119,21 +120,18 @@ bool SQLiteAttitudeDao::add(std::int64_t aircraftId, const AttitudeData &attitud
 std::vector<AttitudeData> SQLiteAttitudeDao::getByAircraftId(std::int64_t aircraftId, bool *ok) const noexcept
 {
     std::vector<AttitudeData> attitudeData;
-    const auto db {QSqlDatabase::database(d->connectionName)};
-    QSqlQuery query {db};
-    query.setForwardOnly(true);
-    query.prepare(
+    auto &query = d->statementCache->prepare(
         "select * "
         "from   attitude a "
         "where  a.aircraft_id = :aircraft_id "
         "order by a.timestamp asc;"
     );
+    const SqlQueryFinisher finisher {query};
 
     query.bindValue(":aircraft_id", QVariant::fromValue(aircraftId));
     const bool success = query.exec();
     if (success) {
-        const auto db {QSqlDatabase::database(d->connectionName)};
-        const bool querySizeFeature = db.driver()->hasFeature(QSqlDriver::QuerySize);
+        const bool querySizeFeature = d->statementCache->getDatabase().driver()->hasFeature(QSqlDriver::QuerySize);
         if (querySizeFeature) {
             attitudeData.reserve(query.size());
         } else {
@@ -175,9 +173,7 @@ std::vector<AttitudeData> SQLiteAttitudeDao::getByAircraftId(std::int64_t aircra
 
 bool SQLiteAttitudeDao::deleteByFlightId(std::int64_t flightId) const noexcept
 {
-    const auto db {QSqlDatabase::database(d->connectionName)};
-    QSqlQuery query {db};
-    query.prepare(
+    auto &query = d->statementCache->prepare(
         "delete "
         "from   attitude "
         "where  aircraft_id in (select a.id "
@@ -198,9 +194,7 @@ bool SQLiteAttitudeDao::deleteByFlightId(std::int64_t flightId) const noexcept
 
 bool SQLiteAttitudeDao::deleteByAircraftId(std::int64_t aircraftId) const noexcept
 {
-    const auto db {QSqlDatabase::database(d->connectionName)};
-    QSqlQuery query {db};
-    query.prepare(
+    auto &query = d->statementCache->prepare(
         "delete "
         "from   attitude "
         "where  aircraft_id = :aircraft_id;"
@@ -34,6 +34,10 @@
 #include <QDateTime>
 #include <QTimeZone>
 #include <QDateTime>
+#include <QFuture>
+#include <QFutureWatcher>
+#include <QEventLoop>
+#include <QtConcurrentRun>
 #ifdef DEBUG
 #include <QDebug>
 #endif
@@ -43,12 +47,18 @@
 #include <Metadata.h>
 #include <Connection.h>
 #include <Migration.h>
+#include <Backup.h>
+#include "../LookupCache.h"
 #include "SqlMigration.h"
+#include "SqlBackup.h"
 #include "SQLiteDatabaseDao.h"
 
 namespace
 {
     constexpr const char *DriverName {"QSQLITE"};
+
+    // https://www.sqlite.org/pragma.html#pragma_auto_vacuum
+    constexpr int AutoVacuumIncremental {2};
 }
 
 struct DatabaseDaoPrivate
@@ -76,12 +86,21 @@ SQLiteDatabaseDao::~SQLiteDatabaseDao()
 
 bool SQLiteDatabaseDao::connectDb(const QString &logbookPath) noexcept
 {
+    // Statements prepared on any previous connection with the same name are invalid
+    SqlStatementCache::invalidate(d->connectionName);
+    LookupCache::invalidate(d->connectionName);
     QSqlDatabase db = QSqlDatabase::addDatabase(::DriverName, d->connectionName);
     // For the QSQLITE driver, if the database name specified does not exist,
     // then it will create the file for you unless the QSQLITE_OPEN_READONLY
     // option is set
     db.setDatabaseName(logbookPath);
-    return db.open();
+    bool ok = db.open();
+    if (ok) {
+        // Only takes effect for new logbooks (existing logbooks are converted by the next optimisation)
+        QSqlQuery query {db};
+        ok = query.exec("pragma auto_vacuum = incremental;");
+    }
+    return ok;
 }
 
 void SQLiteDatabaseDao::disconnectDb(Connection::Default connection) noexcept
@@ -95,15 +114,23 @@ bool SQLiteDatabaseDao::migrate(Migration::Milestones milestones) const noexcept
     if (ok) {
         SqlMigration sqlMigration {d->connectionName};
         ok = sqlMigration.migrate(milestones);
+        // The migration may have added aircraft types and enumeration items
+        LookupCache::invalidate(d->connectionName);
     }
     return ok;
 }
 
 bool SQLiteDatabaseDao::optimise() const noexcept
 {
+    // No vacuum while statements are in progress
+    SqlStatementCache::getInstance(d->connectionName)->finish();
     const auto db {QSqlDatabase::database(d->connectionName)};
     QSqlQuery query {db};
-    bool ok = query.exec("vacuum;");
+    // Also converts logbooks which do not use incremental auto-vacuum yet
+    bool ok = query.exec("pragma auto_vacuum = incremental;");
+    if (ok) {
+        ok = query.exec("vacuum;");
+    }
     if (ok) {
         ok = query.exec("update metadata set last_optim_date = datetime('now') where rowid = 1;");
 #ifdef DEBUG
@@ -114,16 +141,62 @@ bool SQLiteDatabaseDao::optimise() const noexcept
     return ok;
 }
 
-bool SQLiteDatabaseDao::backup(const QString &backupPath) const noexcept
+std::int64_t SQLiteDatabaseDao::incrementalVacuum(int maxPageCount, bool *ok) const noexcept
 {
+    SqlStatementCache::getInstance(d->connectionName)->finish();
     const auto db {QSqlDatabase::database(d->connectionName)};
     QSqlQuery query {db};
-    bool ok = query.exec(QStringLiteral("vacuum into '%1';").arg(backupPath));
+    query.setForwardOnly(true);
+    std::int64_t freePageCount {0};
+    bool success = query.exec("pragma auto_vacuum;") && query.next();
+    if (success && query.value(0).toInt() == ::AutoVacuumIncremental) {
+        success = query.exec(QStringLiteral("pragma incremental_vacuum(%1);").arg(maxPageCount));
+        if (success) {
+            // Make sure that the pragma runs to completion
+            while (query.next()) {}
+            success = query.exec("pragma freelist_count;") && query.next();
+        }
+        if (success) {
+            freePageCount = query.value(0).toLongLong();
+        }
+    }
+#ifdef DEBUG
+    if (!success) {
+        qDebug() << "SQLiteDatabaseDao::incrementalVacuum: SQL error:" << query.lastError().text() << "- error code:" << query.lastError().nativeErrorCode();
+    }
+#endif
+    if (ok != nullptr) {
+        *ok = success;
+    }
+    return freePageCount;
+}
+
+bool SQLiteDatabaseDao::backup(const QString &backupPath, const Backup::ProgressCallback &progress) const noexcept
+{
+    const auto db {QSqlDatabase::database(d->connectionName)};
+    const QString logbookPath = db.databaseName();
+    // The logbook is copied on a worker thread, using its own connections, while this thread keeps
+    // processing events; user input is only processed when progress is reported (and the backup
+    // may hence be cancelled by the user)
+    QFuture<bool> future = QtConcurrent::run([&logbookPath, &backupPath, &progress]() {
+        SqlBackup sqlBackup {logbookPath, backupPath};
+        return sqlBackup.run(progress);
+    });
+    QFutureWatcher<bool> futureWatcher;
+    QEventLoop eventLoop;
+    QObject::connect(&futureWatcher, &QFutureWatcher<bool>::finished,
+                     &eventLoop, &QEventLoop::quit);
+    futureWatcher.setFuture(future);
+    if (!future.isFinished()) {
+        eventLoop.exec(progress ? QEventLoop::AllEvents : QEventLoop::ExcludeUserInputEvents);
+    }
+    bool ok = future.result();
+    QSqlQuery query {db};
     if (ok) {
         ok = query.exec("update metadata set last_backup_date = datetime('now') where rowid = 1;");
 #ifdef DEBUG
     } else {
-        qDebug() << "SQLiteDatabaseDao::backup(: SQL error:" << query.lastError().text() << "- error code:" << query.lastError().nativeErrorCode();
+        qDebug() << "SQLiteDatabaseDao::backup: the backup" << backupPath << "could not be created";
 #endif
     }
     return ok;
@@ -258,6 +331,8 @@ void SQLiteDatabaseDao::disconnectSQLite(Connection::Default connection) const n
     // removing the connection:
     // "Warning: There should be no open queries on the database connection
     // when this function is called, otherwise a resource leak will occur."
+    SqlStatementCache::invalidate(d->connectionName);
+    LookupCache::invalidate(d->connectionName);
     {
         QSqlDatabase db {QSqlDatabase::database(d->connectionName)};
         db.close();
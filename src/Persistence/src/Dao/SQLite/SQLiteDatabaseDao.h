@@ -34,6 +34,7 @@ class QDateTime;
 #include <Kernel/Const.h>
 #include <Connection.h>
 #include <Migration.h>
+#include <Backup.h>
 #include "../DatabaseDaoIntf.h"
 #include "Metadata.h"
 
@@ -54,7 +55,8 @@ public:
 
     bool migrate(Migration::Milestones milestones = Migration::Milestone::All) const noexcept override;
     bool optimise() const noexcept override;
-    bool backup(const QString &backupFilePath) const noexcept override;
+    std::int64_t incrementalVacuum(int maxPageCount, bool *ok = nullptr) const noexcept override;
+    bool backup(const QString &backupFilePath, const Backup::ProgressCallback &progress = {}) const noexcept override;
     bool updateBackupPeriod(std::int64_t backupPeriodId) const noexcept override;
     bool updateNextBackupDate(const QDateTime &date) const noexcept override;
     bool updateBackupDirectoryPath(const QString &backupDirectoryPath) const noexcept override;
@@ -38,6 +38,7 @@
 #endif
 
 #include <Model/EngineData.h>
+#include "SqlStatementCache.h"
 #include "SQLiteEngineDao.h"
 
 namespace
@@ -50,10 +51,12 @@ namespace
 struct SQLiteEngineDaoPrivate
 {
     SQLiteEngineDaoPrivate(QString connectionName) noexcept
-        : connectionName {std::move(connectionName)}
+        : connectionName {std::move(connectionName)},
+          statementCache {SqlStatementCache::getInstance(this->connectionName)}
     {}
 
     QString connectionName;
+    std::shared_ptr<SqlStatementCache> statementCache;
 };
 
 // PUBLIC
@@ -68,9 +71,7 @@ SQLiteEngineDao::~SQLiteEngineDao() = default;
 
 bool SQLiteEngineDao::add(std::int64_t aircraftId, const EngineData &data) const noexcept
 {
-    const auto db {QSqlDatabase::database(d->connectionName)};
-    QSqlQuery query {db};
-    query.prepare(
+    auto &query = d->statementCache->prepare(
         "insert into engine ("
         "  aircraft_id,"
         "  timestamp,"
@@ -179,21 +180,18 @@ bool SQLiteEngineDao::add(std::int64_t aircraftId, const EngineData &data) const
 std::vector<EngineData> SQLiteEngineDao::getByAircraftId(std::int64_t aircraftId, bool *ok) const noexcept
 {
     std::vector<EngineData> engineData;
-    const auto db {QSqlDatabase::database(d->connectionName)};
-    QSqlQuery query {db};
-    query.setForwardOnly(true);
-    query.prepare(
+    auto &query = d->statementCache->prepare(
         "select * "
         "from   engine e "
         "where  e.aircraft_id = :aircraft_id "
         "order by e.timestamp asc;"
     );
+    const SqlQueryFinisher finisher {query};
 
     query.bindValue(":aircraft_id", QVariant::fromValue(aircraftId));
     const bool success = query.exec();
     if (success) {
-        const auto db {QSqlDatabase::database(d->connectionName)};
-        const bool querySizeFeature = db.driver()->hasFeature(QSqlDriver::QuerySize);
+        const bool querySizeFeature = d->statementCache->getDatabase().driver()->hasFeature(QSqlDriver::QuerySize);
         if (querySizeFeature) {
             engineData.reserve(query.size());
         } else {
@@ -277,9 +275,7 @@ std::vector<EngineData> SQLiteEngineDao::getByAircraftId(std::int64_t aircraftId
 
 bool SQLiteEngineDao::deleteByFlightId(std::int64_t flightId) const noexcept
 {
-    const auto db {QSqlDatabase::database(d->connectionName)};
-    QSqlQuery query {db};
-    query.prepare(
+    auto &query = d->statementCache->prepare(
         "delete "
         "from   engine "
         "where  aircraft_id in (select a.id "
@@ -300,9 +296,7 @@ bool SQLiteEngineDao::deleteByFlightId(std::int64_t flightId) const noexcept
 
 bool SQLiteEngineDao::deleteByAircraftId(std::int64_t aircraftId) const noexcept
 {
-    const auto db {QSqlDatabase::database(d->connectionName)};
-    QSqlQuery query {db};
-    query.prepare(
+    auto &query = d->statementCache->prepare(
         "delete "
         "from   engine "
         "where  aircraft_id = :aircraft_id;"
@@ -22,6 +22,7 @@
  * DEALINGS IN THE SOFTWARE.
  */
 #include <memory>
+#include <optional>
 #include <utility>
 
 #include <QString>
@@ -39,15 +40,21 @@
 
 #include <Kernel/Name.h>
 #include <Model/Enumeration.h>
+#include "../LookupCache.h"
+#include "SqlStatementCache.h"
 #include "SQLiteEnumerationDao.h"
 
 struct SQLiteEnumerationDaoPrivate
 {
     SQLiteEnumerationDaoPrivate(QString connectionName) noexcept
-        : connectionName {std::move(connectionName)}
+        : connectionName {std::move(connectionName)},
+          statementCache {SqlStatementCache::getInstance(this->connectionName)},
+          lookupCache {LookupCache::getInstance(this->connectionName)}
     {}
 
     QString connectionName;
+    std::shared_ptr<SqlStatementCache> statementCache;
+    std::shared_ptr<LookupCache> lookupCache;
 };
 
 // PUBLIC
@@ -62,10 +69,18 @@ SQLiteEnumerationDao::~SQLiteEnumerationDao() = default;
 
 Enumeration SQLiteEnumerationDao::get(const QString &name, Enumeration::Order order, bool *ok) const noexcept
 {
+    std::optional<Enumeration> cachedEnumeration = d->lookupCache->getEnumeration(name, order);
+    if (cachedEnumeration) {
+        if (ok != nullptr) {
+            *ok = true;
+        }
+        return std::move(*cachedEnumeration);
+    }
+
     Enumeration enumeration {name};
     const QString enumerationTableName = QStringLiteral("enum_") % Name::fromCamelCase(enumeration.getName());
 
-    const auto db {QSqlDatabase::database(d->connectionName)};
+    const auto db {d->statementCache->getDatabase()};
     QSqlQuery query {db};
     query.setForwardOnly(true);
 
@@ -100,6 +115,7 @@ Enumeration SQLiteEnumerationDao::get(const QString &name, Enumeration::Order or
             const auto itemName = query.value(nameIdx).toString();
             enumeration.addItem({id, symId, itemName});
         }
+        d->lookupCache->putEnumeration(enumeration, order);
 #ifdef DEBUG
     } else {
         qDebug() << "SQLiteEnumerationDao::getByName: SQL error:" << query.lastError().text() << "- error code:" << query.lastError().nativeErrorCode();
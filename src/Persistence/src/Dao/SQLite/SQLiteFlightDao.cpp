@@ -40,11 +40,13 @@
 #endif
 
 #include <Kernel/Enum.h>
+#include <Kernel/Trace.h>
 #include <Model/FlightData.h>
 #include <Model/FlightSummary.h>
 #include <Model/FlightCondition.h>
 #include "../../Dao/AircraftDaoIntf.h"
 #include "../../Dao/DaoFactory.h"
+#include "SqlStatementCache.h"
 #include "SQLiteFlightDao.h"
 #include "SQLiteFlightDao.h"
 
@@ -52,11 +54,13 @@ struct SQLiteFlightDaoPrivate
 {
     SQLiteFlightDaoPrivate(QString connectionName) noexcept
         : connectionName(connectionName),
+          statementCache(SqlStatementCache::getInstance(connectionName)),
           daoFactory(std::make_unique<DaoFactory>(DaoFactory::DbType::SQLite, std::move(connectionName))),
           aircraftDao(daoFactory->createAircraftDao())
     {}
 
     QString connectionName;
+    std::shared_ptr<SqlStatementCache> statementCache;
     std::unique_ptr<DaoFactory> daoFactory;
     std::unique_ptr<AircraftDaoIntf> aircraftDao;
 };
@@ -73,6 +77,7 @@ SQLiteFlightDao::~SQLiteFlightDao() = default;
 
 bool SQLiteFlightDao::add(FlightData &flightData) const noexcept
 {
+    Trace::Scope trace {Trace::Persistence, "Add flight"};
     bool ok {false};
     const std::int64_t flightId = insertFlight(flightData);
     if (flightId != Const::InvalidId) {
@@ -94,14 +99,13 @@ bool SQLiteFlightDao::exportFlightData(const FlightData &flightData) const noexc
 
 bool SQLiteFlightDao::get(std::int64_t id, FlightData &flightData) const noexcept
 {
-    const auto db {QSqlDatabase::database(d->connectionName)};
-    QSqlQuery query {db};
-    query.setForwardOnly(true);
-    query.prepare(
+    Trace::Scope trace {Trace::Persistence, "Get flight"};
+    auto &query = d->statementCache->prepare(
         "select * "
         "from flight f "
         "where f.id = :id;"
     );
+    const SqlQueryFinisher finisher {query};
 
     query.bindValue(":id", QVariant::fromValue(id));
     bool ok = query.exec();
@@ -182,11 +186,51 @@ bool SQLiteFlightDao::get(std::int64_t id, FlightData &flightData) const noexcep
     return ok;
 }
 
+bool SQLiteFlightDao::update(const FlightData &flightData) const noexcept
+{
+    auto &query = d->statementCache->prepare(
+        "update flight "
+        "set    creation_time = :creation_time,"
+        "       user_aircraft_seq_nr = :user_aircraft_seq_nr,"
+        "       title = :title,"
+        "       description = :description,"
+        "       flight_number = :flight_number,"
+        "       surface_type = :surface_type,"
+        "       surface_condition = :surface_condition,"
+        "       on_any_runway = :on_any_runway,"
+        "       on_parking_spot = :on_parking_spot,"
+        "       ground_altitude = :ground_altitude,"
+        "       ambient_temperature = :ambient_temperature,"
+        "       total_air_temperature = :total_air_temperature,"
+        "       wind_speed = :wind_speed,"
+        "       wind_direction = :wind_direction,"
+        "       visibility = :visibility,"
+        "       sea_level_pressure = :sea_level_pressure,"
+        "       pitot_icing = :pitot_icing,"
+        "       structural_icing = :structural_icing,"
+        "       precipitation_state = :precipitation_state,"
+        "       in_clouds = :in_clouds,"
+        "       start_local_sim_time = :start_local_sim_time,"
+        "       start_zulu_sim_time = :start_zulu_sim_time,"
+        "       end_local_sim_time = :end_local_sim_time,"
+        "       end_zulu_sim_time = :end_zulu_sim_time "
+        "where  id = :id;"
+    );
+
+    bindFlightData(query, flightData);
+    query.bindValue(":id", QVariant::fromValue(flightData.id));
+    const bool ok = query.exec();
+#ifdef DEBUG
+    if (!ok) {
+        qDebug() << "SQLiteFlightDao::update: SQL error:" << query.lastError().text() << "- error code:" << query.lastError().nativeErrorCode();
+    }
+#endif
+    return ok;
+}
+
 bool SQLiteFlightDao::deleteById(std::int64_t id) const noexcept
 {
-    const auto db {QSqlDatabase::database(d->connectionName)};
-    QSqlQuery query {db};
-    query.prepare(
+    auto &query = d->statementCache->prepare(
         "delete "
         "from flight "
         "where id = :id;"
@@ -205,11 +249,31 @@ bool SQLiteFlightDao::deleteById(std::int64_t id) const noexcept
     return ok;
 }
 
+bool SQLiteFlightDao::deleteByIds(const std::vector<std::int64_t> &ids) const noexcept
+{
+    bool ok = d->aircraftDao->deleteAllByFlightIds(ids);
+    if (ok) {
+        auto &query = d->statementCache->prepare(
+            "delete "
+            "from flight "
+            "where id = :id;"
+        );
+        for (auto it = ids.cbegin(); ok && it != ids.cend(); ++it) {
+            query.bindValue(":id", QVariant::fromValue(*it));
+            ok = query.exec();
+        }
+#ifdef DEBUG
+        if (!ok) {
+            qDebug() << "SQLiteFlightDao::deleteByIds: SQL error" << query.lastError().text() << "- error code:" << query.lastError().nativeErrorCode();
+        }
+#endif
+    }
+    return ok;
+}
+
 bool SQLiteFlightDao::updateTitle(std::int64_t id, const QString &title) const noexcept
 {
-    const auto db {QSqlDatabase::database(d->connectionName)};
-    QSqlQuery query {db};
-    query.prepare(
+    auto &query = d->statementCache->prepare(
         "update flight "
         "set    title = :title "
         "where id = :id;"
@@ -228,9 +292,7 @@ bool SQLiteFlightDao::updateTitle(std::int64_t id, const QString &title) const n
 
 bool SQLiteFlightDao::updateFlightNumber(std::int64_t id, const QString &flightNumber) const noexcept
 {
-    const auto db {QSqlDatabase::database(d->connectionName)};
-    QSqlQuery query {db};
-    query.prepare(
+    auto &query = d->statementCache->prepare(
         "update flight "
         "set    flight_number = :flight_number "
         "where id = :id;"
@@ -249,9 +311,7 @@ bool SQLiteFlightDao::updateFlightNumber(std::int64_t id, const QString &flightN
 
 bool SQLiteFlightDao::updateDescription(std::int64_t id, const QString &description) const noexcept
 {
-    const auto db {QSqlDatabase::database(d->connectionName)};
-    QSqlQuery query {db};
-    query.prepare(
+    auto &query = d->statementCache->prepare(
         "update flight "
         "set    description = :description "
         "where id = :id;"
@@ -270,9 +330,7 @@ bool SQLiteFlightDao::updateDescription(std::int64_t id, const QString &descript
 
 bool SQLiteFlightDao::updateUserAircraftIndex(std::int64_t id, int index) const noexcept
 {
-    const auto db {QSqlDatabase::database(d->connectionName)};
-    QSqlQuery query {db};
-    query.prepare(
+    auto &query = d->statementCache->prepare(
         "update flight "
         "set    user_aircraft_seq_nr = :user_aircraft_seq_nr "
         "where id = :id;"
@@ -294,9 +352,7 @@ inline std::int64_t SQLiteFlightDao::insertFlight(const FlightData &flightData)
 {
     std::int64_t flightId {Const::InvalidId};
 
-    const auto db {QSqlDatabase::database(d->connectionName)};
-    QSqlQuery query {db};
-    query.prepare(
+    auto &query = d->statementCache->prepare(
         "insert into flight ("
         "  creation_time,"
         "  user_aircraft_seq_nr,"
@@ -350,6 +406,22 @@ inline std::int64_t SQLiteFlightDao::insertFlight(const FlightData &flightData)
         ");"
     );
 
+    bindFlightData(query, flightData);
+    bool ok = query.exec();
+    if (ok) {
+        flightId = query.lastInsertId().toLongLong(&ok);
+    } else {
+        flightId = Const::InvalidId;
+#ifdef DEBUG
+        qDebug() << "SQLiteFlightDao::insertFlight: SQL error:" << query.lastError().text() << "- error code:" << query.lastError().nativeErrorCode();
+#endif
+    }
+
+    return flightId;
+}
+
+inline void SQLiteFlightDao::bindFlightData(QSqlQuery &query, const FlightData &flightData) const noexcept
+{
     const auto &flightCondition = flightData.flightCondition;
     query.bindValue(":creation_time", flightData.creationTime.toUTC());
     // Sequence number starts at 1
@@ -380,17 +452,6 @@ inline std::int64_t SQLiteFlightDao::insertFlight(const FlightData &flightData)
     query.bindValue(":end_local_sim_time", flightCondition.getEndLocalDateTime());
     // Zulu time equals to UTC time
     query.bindValue(":end_zulu_sim_time", flightCondition.getEndZuluDateTime());
-    bool ok = query.exec();
-    if (ok) {
-        flightId = query.lastInsertId().toLongLong(&ok);
-    } else {
-        flightId = Const::InvalidId;
-#ifdef DEBUG
-        qDebug() << "SQLiteFlightDao::insertFlight: SQL error:" << query.lastError().text() << "- error code:" << query.lastError().nativeErrorCode();
-#endif
-    }
-
-    return flightId;
 }
 
 inline bool SQLiteFlightDao::addAircraft(std::int64_t flightId, FlightData &flightData) const noexcept
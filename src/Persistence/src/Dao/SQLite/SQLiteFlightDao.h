@@ -25,9 +25,11 @@
 #define SQLITEFLIGHTDAO_H
 
 #include <memory>
+#include <vector>
 #include <cstdint>
 
 class QString;
+class QSqlQuery;
 
 #include "../FlightDaoIntf.h"
 
@@ -47,7 +49,9 @@ public:
     bool add(FlightData &flight) const noexcept override;
     bool exportFlightData(const FlightData &flightData) const noexcept override;
     bool get(std::int64_t id, FlightData &flightData) const noexcept override;
+    bool update(const FlightData &flightData) const noexcept override;
     bool deleteById(std::int64_t id) const noexcept override;
+    bool deleteByIds(const std::vector<std::int64_t> &ids) const noexcept override;
     bool updateTitle(std::int64_t id, const QString &title) const noexcept override;
     bool updateFlightNumber(std::int64_t id, const QString &flightNumber) const noexcept override;
     bool updateDescription(std::int64_t id, const QString &description) const noexcept override;
@@ -58,6 +62,7 @@ private:
 
     // Inserts the flight and returns the generated aircraft ID if successful; Const::InvalidId upon failure
     inline std::int64_t insertFlight(const FlightData &flightData) const noexcept;
+    inline void bindFlightData(QSqlQuery &query, const FlightData &flightData) const noexcept;
     inline bool addAircraft(std::int64_t flightId, FlightData &flightData) const noexcept;
     inline bool exportAircraft(std::int64_t flightId, const FlightData &flightData) const noexcept;
 };
@@ -39,6 +39,7 @@
 #endif
 
 #include <Model/AircraftHandleData.h>
+#include "SqlStatementCache.h"
 #include "SQLiteHandleDao.h"
 
 namespace
@@ -51,10 +52,12 @@ namespace
 struct SQLiteHandleDaoPrivate
 {
     SQLiteHandleDaoPrivate(QString connectionName) noexcept
-        : connectionName {std::move(connectionName)}
+        : connectionName {std::move(connectionName)},
+          statementCache {SqlStatementCache::getInstance(this->connectionName)}
     {}
 
     QString connectionName;
+    std::shared_ptr<SqlStatementCache> statementCache;
 };
 
 // PUBLIC
@@ -69,9 +72,7 @@ SQLiteHandleDao::~SQLiteHandleDao() = default;
 
 bool SQLiteHandleDao::add(std::int64_t aircraftId, const AircraftHandleData &aircraftHandleData) const noexcept
 {
-    const auto db {QSqlDatabase::database(d->connectionName)};
-    QSqlQuery query {db};
-    query.prepare(
+    auto &query = d->statementCache->prepare(
         "insert into handle ("
         "  aircraft_id,"
         "  timestamp,"
@@ -129,21 +130,18 @@ bool SQLiteHandleDao::add(std::int64_t aircraftId, const AircraftHandleData &air
 std::vector<AircraftHandleData> SQLiteHandleDao::getByAircraftId(std::int64_t aircraftId, bool *ok) const noexcept
 {
     std::vector<AircraftHandleData> aircraftHandleData;
-    const auto db {QSqlDatabase::database(d->connectionName)};
-    QSqlQuery query {db};
-    query.setForwardOnly(true);
-    query.prepare(
+    auto &query = d->statementCache->prepare(
         "select * "
         "from   handle h "
         "where  h.aircraft_id = :aircraft_id "
         "order by h.timestamp asc;"
     );
+    const SqlQueryFinisher finisher {query};
 
     query.bindValue(":aircraft_id", QVariant::fromValue(aircraftId));
     const bool success = query.exec();
     if (success) {
-        const auto db {QSqlDatabase::database(d->connectionName)};
-        const bool querySizeFeature = db.driver()->hasFeature(QSqlDriver::QuerySize);
+        const bool querySizeFeature = d->statementCache->getDatabase().driver()->hasFeature(QSqlDriver::QuerySize);
         if (querySizeFeature) {
             aircraftHandleData.reserve(query.size());
         } else {
@@ -192,9 +190,7 @@ std::vector<AircraftHandleData> SQLiteHandleDao::getByAircraftId(std::int64_t ai
 
 bool SQLiteHandleDao::deleteByFlightId(std::int64_t flightId) const noexcept
 {
-    const auto db {QSqlDatabase::database(d->connectionName)};
-    QSqlQuery query {db};
-    query.prepare(
+    auto &query = d->statementCache->prepare(
         "delete "
         "from   handle "
         "where  aircraft_id in (select a.id "
@@ -215,9 +211,7 @@ bool SQLiteHandleDao::deleteByFlightId(std::int64_t flightId) const noexcept
 
 bool SQLiteHandleDao::deleteByAircraftId(std::int64_t aircraftId) const noexcept
 {
-    const auto db {QSqlDatabase::database(d->connectionName)};
-    QSqlQuery query {db};
-    query.prepare(
+    auto &query = d->statementCache->prepare(
         "delete "
         "from   handle "
         "where  aircraft_id = :aircraft_id;"
@@ -39,6 +39,7 @@
 #endif
 
 #include <Model/LightData.h>
+#include "SqlStatementCache.h"
 #include "SQLiteLightDao.h"
 
 namespace
@@ -51,10 +52,12 @@ namespace
 struct SQLiteLightDaoPrivate
 {
     SQLiteLightDaoPrivate(QString connectionName) noexcept
-        : connectionName {std::move(connectionName)}
+        : connectionName {std::move(connectionName)},
+          statementCache {SqlStatementCache::getInstance(this->connectionName)}
     {}
 
     QString connectionName;
+    std::shared_ptr<SqlStatementCache> statementCache;
 };
 
 // PUBLIC
@@ -69,9 +72,7 @@ SQLiteLightDao::~SQLiteLightDao() = default;
 
 bool SQLiteLightDao::add(std::int64_t aircraftId, const LightData &lightData) const noexcept
 {
-    const auto db {QSqlDatabase::database(d->connectionName)};
-    QSqlQuery query {db};
-    query.prepare(
+    auto &query = d->statementCache->prepare(
         "insert into light ("
         "  aircraft_id,"
         "  timestamp,"
@@ -98,7 +99,7 @@ bool SQLiteLightDao::add(std::int64_t aircraftId, const LightData &lightData) co
 std::vector<LightData> SQLiteLightDao::getByAircraftId(std::int64_t aircraftId, bool *ok) const noexcept
 {
     std::vector<LightData> lightData;
-    const auto db {QSqlDatabase::database(d->connectionName)};
+    const auto db {d->statementCache->getDatabase()};
     QSqlQuery query {db};
     query.setForwardOnly(true);
     query.prepare(
@@ -111,8 +112,7 @@ std::vector<LightData> SQLiteLightDao::getByAircraftId(std::int64_t aircraftId,
     query.bindValue(":aircraft_id", QVariant::fromValue(aircraftId));
     const bool success = query.exec();
     if (success) {
-        const auto db {QSqlDatabase::database(d->connectionName)};
-        const bool querySizeFeature = db.driver()->hasFeature(QSqlDriver::QuerySize);
+        const bool querySizeFeature = d->statementCache->getDatabase().driver()->hasFeature(QSqlDriver::QuerySize);
         if (querySizeFeature) {
             lightData.reserve(query.size());
         } else {
@@ -142,9 +142,7 @@ std::vector<LightData> SQLiteLightDao::getByAircraftId(std::int64_t aircraftId,
 
 bool SQLiteLightDao::deleteByFlightId(std::int64_t flightId) const noexcept
 {
-    const auto db {QSqlDatabase::database(d->connectionName)};
-    QSqlQuery query {db};
-    query.prepare(
+    auto &query = d->statementCache->prepare(
         "delete "
         "from   light "
         "where  aircraft_id in (select a.id "
@@ -164,9 +162,7 @@ bool SQLiteLightDao::deleteByFlightId(std::int64_t flightId) const noexcept
 
 bool SQLiteLightDao::deleteByAircraftId(std::int64_t aircraftId) const noexcept
 {
-    const auto db {QSqlDatabase::database(d->connectionName)};
-    QSqlQuery query {db};
-    query.prepare(
+    auto &query = d->statementCache->prepare(
         "delete "
         "from   light "
         "where  aircraft_id = :aircraft_id;"
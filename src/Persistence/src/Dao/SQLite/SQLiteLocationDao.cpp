@@ -40,6 +40,7 @@
 
 #include <Model/Location.h>
 #include <LocationSelector.h>
+#include "SqlStatementCache.h"
 #include "SQLiteLocationDao.h"
 
 namespace
@@ -52,10 +53,12 @@ namespace
 struct SQLiteLocationDaoPrivate
 {
     SQLiteLocationDaoPrivate(QString connectionName) noexcept
-        : connectionName {std::move(connectionName)}
+        : connectionName {std::move(connectionName)},
+          statementCache {SqlStatementCache::getInstance(this->connectionName)}
     {}
 
     QString connectionName;
+    std::shared_ptr<SqlStatementCache> statementCache;
 };
 
 // PUBLIC
@@ -87,9 +90,7 @@ bool SQLiteLocationDao::exportLocation(const Location &location) const noexcept
 
 bool SQLiteLocationDao::update(const Location &location) const noexcept
 {
-    const auto db {QSqlDatabase::database(d->connectionName)};
-    QSqlQuery query {db};
-    query.prepare(
+    auto &query = d->statementCache->prepare(
         "update location "
         "set    title = :title,"
         "       description = :description,"
@@ -142,17 +143,14 @@ bool SQLiteLocationDao::update(const Location &location) const noexcept
 std::vector<Location> SQLiteLocationDao::getByPosition(double latitude, double longitude, double distanceKm, bool *ok) const noexcept
 {
     std::vector<Location> locations;
-    const auto db {QSqlDatabase::database(d->connectionName)};
-    QSqlQuery query {db};
-    query.setForwardOnly(true);
-
     // https://jonisalonen.com/2014/computing-distance-between-coordinates-can-be-simple-and-fast/
-    query.prepare(
+    auto &query = d->statementCache->prepare(
         "select * "
         "from   location l "
         "where  power(latitude - :latitude, 2) + power((longitude - :longitude) * cos(radians(:latitude)), 2) <= power(:distance / 110.25, 2) "
         "order by l.id;"
     );
+    const SqlQueryFinisher finisher {query};
 
     query.bindValue(":latitude", latitude);
     query.bindValue(":longitude", longitude);
@@ -160,8 +158,7 @@ std::vector<Location> SQLiteLocationDao::getByPosition(double latitude, double l
 
     const bool success = query.exec();
     if (success) {
-        const auto db {QSqlDatabase::database(d->connectionName)};
-        const bool querySizeFeature = db.driver()->hasFeature(QSqlDriver::QuerySize);
+        const bool querySizeFeature = d->statementCache->getDatabase().driver()->hasFeature(QSqlDriver::QuerySize);
         if (querySizeFeature) {
             locations.reserve(query.size());
         } else {
@@ -225,9 +222,7 @@ std::vector<Location> SQLiteLocationDao::getByPosition(double latitude, double l
 
 bool SQLiteLocationDao::deleteById(std::int64_t id) const noexcept
 {
-    const auto db {QSqlDatabase::database(d->connectionName)};
-    QSqlQuery query {db};
-    query.prepare(
+    auto &query = d->statementCache->prepare(
         "delete "
         "from   location "
         "where  id = :id;"
@@ -245,21 +240,19 @@ bool SQLiteLocationDao::deleteById(std::int64_t id) const noexcept
 
 std::vector<Location> SQLiteLocationDao::getAll(bool *ok) const noexcept
 {
-    const auto db {QSqlDatabase::database(d->connectionName)};
-    QSqlQuery query {db};
-    query.setForwardOnly(true);
-    query.prepare(
+    auto &query = d->statementCache->prepare(
         "select * "
         "from   location l "
         "order by l.id;"
     );
+    const SqlQueryFinisher finisher {query};
 
     return executeGetLocationQuery(query, ok);
 }
 
 std::vector<Location> SQLiteLocationDao::getSelectedLocations(const LocationSelector &selector, bool *ok) const noexcept
 {
-    const auto db {QSqlDatabase::database(d->connectionName)};
+    const auto db {d->statementCache->getDatabase()};
     QSqlQuery query {db};
     query.setForwardOnly(true);
 
@@ -313,8 +306,7 @@ inline std::vector<Location> SQLiteLocationDao::executeGetLocationQuery(QSqlQuer
     std::vector<Location> locations;
     const bool success = query.exec();
     if (success) {
-        const auto db {QSqlDatabase::database(d->connectionName)};
-        const bool querySizeFeature = db.driver()->hasFeature(QSqlDriver::QuerySize);
+        const bool querySizeFeature = d->statementCache->getDatabase().driver()->hasFeature(QSqlDriver::QuerySize);
         if (querySizeFeature) {
             locations.reserve(query.size());
         } else {
@@ -378,9 +370,7 @@ inline std::vector<Location> SQLiteLocationDao::executeGetLocationQuery(QSqlQuer
 std::int64_t SQLiteLocationDao::insert(const Location &location) const noexcept
 {
     auto locationId {Const::InvalidId};
-    const auto db {QSqlDatabase::database(d->connectionName)};
-    QSqlQuery query {db};
-    query.prepare(
+    auto &query = d->statementCache->prepare(
         "insert into location ("
         "  title,"
         "  description,"
@@ -42,11 +42,13 @@
 #endif
 
 #include <Kernel/Enum.h>
+#include <Kernel/Trace.h>
 #include <Model/Logbook.h>
 #include <Model/FlightDate.h>
 #include <Model/FlightSummary.h>
 #include <Model/FlightCondition.h>
 #include <FlightSelector.h>
+#include "SqlStatementCache.h"
 #include "SQLiteLogbookDao.h"
 
 namespace
@@ -60,10 +62,12 @@ namespace
 struct SQLiteLogbookDaoPrivate
 {
     SQLiteLogbookDaoPrivate(QString connectionName) noexcept
-        : connectionName {std::move(connectionName)}
+        : connectionName {std::move(connectionName)},
+          statementCache {SqlStatementCache::getInstance(this->connectionName)}
     {}
 
     QString connectionName;
+    std::shared_ptr<SqlStatementCache> statementCache;
 };
 
 // PUBLIC
@@ -79,15 +83,13 @@ SQLiteLogbookDao::~SQLiteLogbookDao() = default;
 std::forward_list<FlightDate> SQLiteLogbookDao::getFlightDates(bool *ok) const noexcept
 {
     std::forward_list<FlightDate> flightDates;
-    const auto db {QSqlDatabase::database(d->connectionName)};
-    QSqlQuery query {db};
-    query.setForwardOnly(true);
-    query.prepare(
+    auto &query = d->statementCache->prepare(
         "select strftime('%Y', f.creation_time) as year, strftime('%m', f.creation_time) as month, "
         "strftime('%d', f.creation_time) as day, count(f.id) as nof_flights "
         "from  flight f "
         "group by year, month, day"
     );
+    const SqlQueryFinisher finisher {query};
 
     const bool success = query.exec();
     if (success) {
@@ -117,6 +119,7 @@ std::forward_list<FlightDate> SQLiteLogbookDao::getFlightDates(bool *ok) const n
 
 std::vector<FlightSummary> SQLiteLogbookDao::getFlightSummaries(const FlightSelector &flightSelector, bool *ok) const noexcept
 {
+    Trace::Scope trace {Trace::Persistence, "Get flight summaries"};
     std::vector<FlightSummary> summaries;
 
     QString searchKeyword;
@@ -126,10 +129,7 @@ std::vector<FlightSummary> SQLiteLogbookDao::getFlightSummaries(const FlightSele
         searchKeyword = LikeOperatorPlaceholder % flightSelector.searchKeyword % LikeOperatorPlaceholder;
     }
 
-    const auto db {QSqlDatabase::database(d->connectionName)};
-    QSqlQuery query {db};
-    query.setForwardOnly(true);
-    query.prepare(
+    auto &query = d->statementCache->prepare(
         "select f.id, f.creation_time, f.title, f.flight_number, a.type,"
         "       (select count(*) from aircraft where aircraft.flight_id = f.id) as aircraft_count,"
         "       f.start_local_sim_time, f.start_zulu_sim_time, fp1.ident as start_waypoint,"
@@ -152,11 +152,13 @@ std::vector<FlightSummary> SQLiteLogbookDao::getFlightSummaries(const FlightSele
         "       or end_waypoint like coalesce(:search_keyword, end_waypoint) "
         "      ) "
         "  and aircraft_count > :aircraft_count "
+        "  and f.id not in (select rj.flight_id from recording_journal rj where rj.new_flight = 1) "
         "  and at.engine_type = coalesce(:engine_type, at.engine_type)"
         "  and (   :duration = 0"
         "       or round((julianday(f.end_zulu_sim_time) - julianday(f.start_zulu_sim_time)) * 1440) >= :duration"
         "      );"
     );
+    const SqlQueryFinisher finisher {query};
 
     const auto aircraftCount = flightSelector.hasFormation ? 1 : 0;
     query.bindValue(":from_date", flightSelector.fromDate);
@@ -168,8 +170,7 @@ std::vector<FlightSummary> SQLiteLogbookDao::getFlightSummaries(const FlightSele
     query.bindValue(":duration", flightSelector.mininumDurationMinutes);
     const bool success = query.exec();
     if (success) {
-        const auto db {QSqlDatabase::database(d->connectionName)};
-        const bool querySizeFeature = db.driver()->hasFeature(QSqlDriver::QuerySize);
+        const bool querySizeFeature = d->statementCache->getDatabase().driver()->hasFeature(QSqlDriver::QuerySize);
         if (querySizeFeature) {
             summaries.reserve(query.size());
         } else {
@@ -235,10 +236,7 @@ std::vector<std::int64_t> SQLiteLogbookDao::getFlightIds(const FlightSelector &f
         searchKeyword = LikeOperatorPlaceholder  % flightSelector.searchKeyword % LikeOperatorPlaceholder;
     }
 
-    const auto db {QSqlDatabase::database(d->connectionName)};
-    QSqlQuery query {db};
-    query.setForwardOnly(true);
-    query.prepare(
+    auto &query = d->statementCache->prepare(
         "select f.id,"
         "       (select count(*) from aircraft where aircraft.flight_id = f.id) as aircraft_count,"
         "       f.start_local_sim_time, f.start_zulu_sim_time, fp1.ident as start_waypoint,"
@@ -260,11 +258,13 @@ std::vector<std::int64_t> SQLiteLogbookDao::getFlightIds(const FlightSelector &f
         "       or end_waypoint like coalesce(:search_keyword, end_waypoint) "
         "      ) "
         "  and aircraft_count > :aircraft_count "
+        "  and f.id not in (select rj.flight_id from recording_journal rj where rj.new_flight = 1) "
         "  and at.engine_type = coalesce(:engine_type, at.engine_type)"
         "  and (   :duration = 0"
         "       or round((julianday(f.end_zulu_sim_time) - julianday(f.start_zulu_sim_time)) * 1440) >= :duration"
         "      );"
     );
+    const SqlQueryFinisher finisher {query};
 
     const auto aircraftCount = flightSelector.hasFormation ? 1 : 0;
     query.bindValue(":from_date", flightSelector.fromDate);
@@ -276,8 +276,7 @@ std::vector<std::int64_t> SQLiteLogbookDao::getFlightIds(const FlightSelector &f
     query.bindValue(":duration", flightSelector.mininumDurationMinutes);
     const bool success = query.exec();
     if (success) {
-        const auto db {QSqlDatabase::database(d->connectionName)};
-        const bool querySizeFeature = db.driver()->hasFeature(QSqlDriver::QuerySize);
+        const bool querySizeFeature = d->statementCache->getDatabase().driver()->hasFeature(QSqlDriver::QuerySize);
         if (querySizeFeature) {
             flightIds.reserve(query.size());
         } else {
@@ -40,6 +40,7 @@
 
 #include <Kernel/Enum.h>
 #include <Model/PrimaryFlightControlData.h>
+#include "SqlStatementCache.h"
 #include "SQLitePrimaryFlightControlDao.h"
 
 namespace
@@ -53,10 +54,12 @@ namespace
 struct SQLitePrimaryFlightControlDaoPrivate
 {
     SQLitePrimaryFlightControlDaoPrivate(QString connectionName) noexcept
-        : connectionName {std::move(connectionName)}
+        : connectionName {std::move(connectionName)},
+          statementCache {SqlStatementCache::getInstance(this->connectionName)}
     {}
 
     QString connectionName;
+    std::shared_ptr<SqlStatementCache> statementCache;
 };
 
 // PUBLIC
@@ -71,9 +74,7 @@ SQLitePrimaryFlightControlDao::~SQLitePrimaryFlightControlDao() = default;
 
 bool SQLitePrimaryFlightControlDao::add(std::int64_t aircraftId, const PrimaryFlightControlData &primaryFlightControlData) const noexcept
 {
-    const auto db {QSqlDatabase::database(d->connectionName)};
-    QSqlQuery query {db};
-    query.prepare(
+    auto &query = d->statementCache->prepare(
         "insert into primary_flight_control ("
         "  aircraft_id,"
         "  timestamp,"
@@ -119,21 +120,18 @@ bool SQLitePrimaryFlightControlDao::add(std::int64_t aircraftId, const PrimaryFl
 std::vector<PrimaryFlightControlData> SQLitePrimaryFlightControlDao::getByAircraftId(std::int64_t aircraftId, bool *ok) const noexcept
 {
     std::vector<PrimaryFlightControlData> primaryFlightControlData;
-    const auto db {QSqlDatabase::database(d->connectionName)};
-    QSqlQuery query {db};
-    query.setForwardOnly(true);
-    query.prepare(
+    auto &query = d->statementCache->prepare(
         "select * "
         "from   primary_flight_control pfc "
         "where  pfc.aircraft_id = :aircraft_id "
         "order by pfc.timestamp asc;"
     );
+    const SqlQueryFinisher finisher {query};
 
     query.bindValue(":aircraft_id", QVariant::fromValue(aircraftId));
     const bool success = query.exec();
     if (success) {
-        const auto db {QSqlDatabase::database(d->connectionName)};
-        const bool querySizeFeature = db.driver()->hasFeature(QSqlDriver::QuerySize);
+        const bool querySizeFeature = d->statementCache->getDatabase().driver()->hasFeature(QSqlDriver::QuerySize);
         if (querySizeFeature) {
             primaryFlightControlData.reserve(query.size());
         } else {
@@ -175,9 +173,7 @@ std::vector<PrimaryFlightControlData> SQLitePrimaryFlightControlDao::getByAircra
 
 bool SQLitePrimaryFlightControlDao::deleteByFlightId(std::int64_t flightId) const noexcept
 {
-    const auto db {QSqlDatabase::database(d->connectionName)};
-    QSqlQuery query {db};
-    query.prepare(
+    auto &query = d->statementCache->prepare(
         "delete "
         "from   primary_flight_control "
         "where  aircraft_id in (select a.id "
@@ -198,9 +194,7 @@ bool SQLitePrimaryFlightControlDao::deleteByFlightId(std::int64_t flightId) cons
 
 bool SQLitePrimaryFlightControlDao::deleteByAircraftId(std::int64_t aircraftId) const noexcept
 {
-    const auto db {QSqlDatabase::database(d->connectionName)};
-    QSqlQuery query {db};
-    query.prepare(
+    auto &query = d->statementCache->prepare(
         "delete "
         "from   primary_flight_control "
         "where  aircraft_id = :aircraft_id;"
@@ -0,0 +1,164 @@
+/**
+ * Sky Dolly - The Black Sheep for Your Flight Recordings
+ *
+ * Copyright (c) 2020 - 2025 Oliver Knoll
+ *
+ * MIT License
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this
+ * software and associated documentation files (the "Software"), to deal in the Software
+ * without restriction, including without limitation the rights to use, copy, modify, merge,
+ * publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons
+ * to whom the Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or
+ * substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED *AS IS*, WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR
+ * PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE
+ * FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+ * OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ */
+#include <memory>
+#include <vector>
+#include <cstdint>
+#include <utility>
+
+#include <QString>
+#include <QSqlDatabase>
+#include <QSqlQuery>
+#include <QVariant>
+#include <QSqlError>
+#ifdef DEBUG
+#include <QDebug>
+#endif
+
+#include "SqlStatementCache.h"
+#include "SQLiteRecordingJournalDao.h"
+
+struct SQLiteRecordingJournalDaoPrivate
+{
+    SQLiteRecordingJournalDaoPrivate(QString connectionName) noexcept
+        : connectionName {std::move(connectionName)},
+          statementCache {SqlStatementCache::getInstance(this->connectionName)}
+    {}
+
+    QString connectionName;
+    std::shared_ptr<SqlStatementCache> statementCache;
+};
+
+// PUBLIC
+
+SQLiteRecordingJournalDao::SQLiteRecordingJournalDao(QString connectionName) noexcept
+    : d {std::make_unique<SQLiteRecordingJournalDaoPrivate>(std::move(connectionName))}
+{}
+
+SQLiteRecordingJournalDao::SQLiteRecordingJournalDao(SQLiteRecordingJournalDao &&rhs) noexcept = default;
+SQLiteRecordingJournalDao &SQLiteRecordingJournalDao::operator=(SQLiteRecordingJournalDao &&rhs) noexcept = default;
+SQLiteRecordingJournalDao::~SQLiteRecordingJournalDao() = default;
+
+bool SQLiteRecordingJournalDao::add(std::int64_t flightId, std::int64_t aircraftId, bool newFlight) const noexcept
+{
+    auto &query = d->statementCache->prepare(
+        "insert into recording_journal ("
+        "  aircraft_id,"
+        "  flight_id,"
+        "  new_flight"
+        ") values ("
+        " :aircraft_id,"
+        " :flight_id,"
+        " :new_flight"
+        ");"
+    );
+
+    query.bindValue(":aircraft_id", QVariant::fromValue(aircraftId));
+    query.bindValue(":flight_id", QVariant::fromValue(flightId));
+    query.bindValue(":new_flight", newFlight);
+    const bool ok = query.exec();
+#ifdef DEBUG
+    if (!ok) {
+        qDebug() << "SQLiteRecordingJournalDao::add: SQL error:" << query.lastError().text() << "- error code:" << query.lastError().nativeErrorCode();
+    }
+#endif
+    return ok;
+}
+
+bool SQLiteRecordingJournalDao::deleteByAircraftId(std::int64_t aircraftId) const noexcept
+{
+    auto &query = d->statementCache->prepare(
+        "delete "
+        "from   recording_journal "
+        "where  aircraft_id = :aircraft_id;"
+    );
+
+    query.bindValue(":aircraft_id", QVariant::fromValue(aircraftId));
+    const bool ok = query.exec();
+#ifdef DEBUG
+    if (!ok) {
+        qDebug() << "SQLiteRecordingJournalDao::deleteByAircraftId: SQL error:" << query.lastError().text() << "- error code:" << query.lastError().nativeErrorCode();
+    }
+#endif
+    return ok;
+}
+
+bool SQLiteRecordingJournalDao::deleteAll() const noexcept
+{
+    const auto db {d->statementCache->getDatabase()};
+    QSqlQuery query {db};
+    const bool ok = query.exec("delete from recording_journal;");
+#ifdef DEBUG
+    if (!ok) {
+        qDebug() << "SQLiteRecordingJournalDao::deleteAll: SQL error:" << query.lastError().text() << "- error code:" << query.lastError().nativeErrorCode();
+    }
+#endif
+    return ok;
+}
+
+std::int64_t SQLiteRecordingJournalDao::getCount(bool *ok) const noexcept
+{
+    std::int64_t count {0};
+    const auto db {d->statementCache->getDatabase()};
+    QSqlQuery query {db};
+    query.setForwardOnly(true);
+    bool success = query.exec("select count(*) from recording_journal;");
+    if (success && query.next()) {
+        count = query.value(0).toLongLong();
+    } else {
+        success = false;
+#ifdef DEBUG
+        qDebug() << "SQLiteRecordingJournalDao::getCount: SQL error:" << query.lastError().text() << "- error code:" << query.lastError().nativeErrorCode();
+#endif
+    }
+    if (ok != nullptr) {
+        *ok = success;
+    }
+    return count;
+}
+
+std::vector<RecordingJournalEntry> SQLiteRecordingJournalDao::getAll(bool *ok) const noexcept
+{
+    std::vector<RecordingJournalEntry> entries;
+    const auto db {d->statementCache->getDatabase()};
+    QSqlQuery query {db};
+    query.setForwardOnly(true);
+    const bool success = query.exec(
+        "select rj.flight_id, rj.aircraft_id, rj.new_flight "
+        "from   recording_journal rj "
+        "order by rj.aircraft_id;"
+    );
+    if (success) {
+        while (query.next()) {
+            entries.push_back({query.value(0).toLongLong(), query.value(1).toLongLong(), query.value(2).toBool()});
+        }
+#ifdef DEBUG
+    } else {
+        qDebug() << "SQLiteRecordingJournalDao::getAll: SQL error:" << query.lastError().text() << "- error code:" << query.lastError().nativeErrorCode();
+#endif
+    }
+    if (ok != nullptr) {
+        *ok = success;
+    }
+    return entries;
+}
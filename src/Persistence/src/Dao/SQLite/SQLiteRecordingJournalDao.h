@@ -0,0 +1,57 @@
+/**
+ * Sky Dolly - The Black Sheep for Your Flight Recordings
+ *
+ * Copyright (c) 2020 - 2025 Oliver Knoll
+ *
+ * MIT License
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this
+ * software and associated documentation files (the "Software"), to deal in the Software
+ * without restriction, including without limitation the rights to use, copy, modify, merge,
+ * publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons
+ * to whom the Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or
+ * substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED *AS IS*, WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR
+ * PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE
+ * FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+ * OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ */
+#ifndef SQLITERECORDINGJOURNALDAO_H
+#define SQLITERECORDINGJOURNALDAO_H
+
+#include <memory>
+#include <vector>
+#include <cstdint>
+
+class QString;
+
+#include "../RecordingJournalDaoIntf.h"
+
+struct SQLiteRecordingJournalDaoPrivate;
+
+class SQLiteRecordingJournalDao final : public RecordingJournalDaoIntf
+{
+public:
+    SQLiteRecordingJournalDao(QString connectionName) noexcept;
+    SQLiteRecordingJournalDao(const SQLiteRecordingJournalDao &rhs) = delete;
+    SQLiteRecordingJournalDao(SQLiteRecordingJournalDao &&rhs) noexcept;
+    SQLiteRecordingJournalDao &operator=(const SQLiteRecordingJournalDao &rhs) = delete;
+    SQLiteRecordingJournalDao &operator=(SQLiteRecordingJournalDao &&rhs) noexcept;
+    ~SQLiteRecordingJournalDao() override;
+
+    bool add(std::int64_t flightId, std::int64_t aircraftId, bool newFlight) const noexcept override;
+    bool deleteByAircraftId(std::int64_t aircraftId) const noexcept override;
+    bool deleteAll() const noexcept override;
+    std::int64_t getCount(bool *ok = nullptr) const noexcept override;
+    std::vector<RecordingJournalEntry> getAll(bool *ok = nullptr) const noexcept override;
+
+private:
+    std::unique_ptr<SQLiteRecordingJournalDaoPrivate> d;
+};
+
+#endif // SQLITERECORDINGJOURNALDAO_H
@@ -40,6 +40,7 @@
 
 #include <Kernel/Enum.h>
 #include <Model/SecondaryFlightControlData.h>
+#include "SqlStatementCache.h"
 #include "SQLiteSecondaryFlightControlDao.h"
 
 namespace
@@ -53,10 +54,12 @@ namespace
 struct SQLiteSecondaryFlightControlDaoPrivate
 {
     SQLiteSecondaryFlightControlDaoPrivate(QString connectionName) noexcept
-        : connectionName {std::move(connectionName)}
+        : connectionName {std::move(connectionName)},
+          statementCache {SqlStatementCache::getInstance(this->connectionName)}
     {}
 
     QString connectionName;
+    std::shared_ptr<SqlStatementCache> statementCache;
 };
 
 // PUBLIC
@@ -71,9 +74,7 @@ SQLiteSecondaryFlightControlDao::~SQLiteSecondaryFlightControlDao() = default;
 
 bool SQLiteSecondaryFlightControlDao::add(std::int64_t aircraftId, const SecondaryFlightControlData &secondaryFlightControlData) const noexcept
 {
-    const auto db {QSqlDatabase::database(d->connectionName)};
-    QSqlQuery query {db};
-    query.prepare(
+    auto &query = d->statementCache->prepare(
         "insert into secondary_flight_control ("
         "  aircraft_id,"
         "  timestamp,"
@@ -125,21 +126,18 @@ bool SQLiteSecondaryFlightControlDao::add(std::int64_t aircraftId, const Seconda
 std::vector<SecondaryFlightControlData> SQLiteSecondaryFlightControlDao::getByAircraftId(std::int64_t aircraftId, bool *ok) const noexcept
 {
     std::vector<SecondaryFlightControlData> secondaryFlightControlData;
-    const auto db {QSqlDatabase::database(d->connectionName)};
-    QSqlQuery query {db};
-    query.setForwardOnly(true);
-    query.prepare(
+    auto &query = d->statementCache->prepare(
         "select * "
         "from   secondary_flight_control sfc "
         "where  sfc.aircraft_id = :aircraft_id "
         "order by sfc.timestamp asc;"
     );
+    const SqlQueryFinisher finisher {query};
 
     query.bindValue(":aircraft_id", QVariant::fromValue(aircraftId));
     const bool success = query.exec();
     if (success) {
-        const auto db {QSqlDatabase::database(d->connectionName)};
-        const bool querySizeFeature = db.driver()->hasFeature(QSqlDriver::QuerySize);
+        const bool querySizeFeature = d->statementCache->getDatabase().driver()->hasFeature(QSqlDriver::QuerySize);
         if (querySizeFeature) {
             secondaryFlightControlData.reserve(query.size());
         } else {
@@ -185,9 +183,7 @@ std::vector<SecondaryFlightControlData> SQLiteSecondaryFlightControlDao::getByAi
 
 bool SQLiteSecondaryFlightControlDao::deleteByFlightId(std::int64_t flightId) const noexcept
 {
-    const auto db {QSqlDatabase::database(d->connectionName)};
-    QSqlQuery query {db};
-    query.prepare(
+    auto &query = d->statementCache->prepare(
         "delete "
         "from   secondary_flight_control "
         "where  aircraft_id in (select a.id "
@@ -208,9 +204,7 @@ bool SQLiteSecondaryFlightControlDao::deleteByFlightId(std::int64_t flightId) co
 
 bool SQLiteSecondaryFlightControlDao::deleteByAircraftId(std::int64_t aircraftId) const noexcept
 {
-    const auto db {QSqlDatabase::database(d->connectionName)};
-    QSqlQuery query {db};
-    query.prepare(
+    auto &query = d->statementCache->prepare(
         "delete "
         "from   secondary_flight_control "
         "where  aircraft_id = :aircraft_id;"
@@ -0,0 +1,391 @@
+/**
+ * Sky Dolly - The Black Sheep for Your Flight Recordings
+ *
+ * Copyright (c) 2020 - 2025 Oliver Knoll
+ *
+ * MIT License
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this
+ * software and associated documentation files (the "Software"), to deal in the Software
+ * without restriction, including without limitation the rights to use, copy, modify, merge,
+ * publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons
+ * to whom the Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or
+ * substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED *AS IS*, WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR
+ * PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE
+ * FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+ * OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ */
+#include <memory>
+#include <vector>
+#include <atomic>
+#include <limits>
+#include <algorithm>
+#include <cstdint>
+#include <utility>
+
+#include <QString>
+#include <QStringLiteral>
+#include <QStringBuilder>
+#include <QFile>
+#include <QThread>
+#include <QSqlDatabase>
+#include <QSqlQuery>
+#include <QVariant>
+#ifdef DEBUG
+#include <QDebug>
+#include <QSqlError>
+#endif
+
+#include <Backup.h>
+#include "SqlBackup.h"
+
+namespace
+{
+    constexpr const char *DriverName {"QSQLITE"};
+    constexpr const char *BackupConnectionPrefix {"Backup-"};
+
+    // The number of rows copied per transaction; in between batches no lock is held on the logbook
+    constexpr int BatchSize {4096};
+    // After the given number of restarts (due to concurrent modifications of the logbook) the
+    // backup is restarted one last time, copying all data within a single read transaction
+    constexpr int MaxRestarts {3};
+
+    std::atomic_int backupCount {0};
+
+    QString quoted(QString identifier) noexcept
+    {
+        return QStringLiteral("\"") % identifier.replace("\"", "\"\"") % QStringLiteral("\"");
+    }
+}
+
+struct SqlBackupPrivate
+{
+    SqlBackupPrivate(QString logbookPath, QString backupFilePath) noexcept
+        : logbookPath {std::move(logbookPath)},
+          backupFilePath {std::move(backupFilePath)}
+    {
+        const QString connectionName = ::BackupConnectionPrefix + QString::number(::backupCount.fetch_add(1));
+        sourceConnectionName = connectionName % "-Source";
+        targetConnectionName = connectionName % "-Target";
+    }
+
+    QString logbookPath;
+    QString backupFilePath;
+    QString sourceConnectionName;
+    QString targetConnectionName;
+
+    std::vector<QString> tables;
+    // Create table statements
+    std::vector<QString> tableStatements;
+    // Create index, trigger and view statements
+    std::vector<QString> indexStatements;
+};
+
+// PUBLIC
+
+SqlBackup::SqlBackup(QString logbookPath, QString backupFilePath) noexcept
+    : d {std::make_unique<SqlBackupPrivate>(std::move(logbookPath), std::move(backupFilePath))}
+{}
+
+SqlBackup::SqlBackup(SqlBackup &&rhs) noexcept = default;
+SqlBackup &SqlBackup::operator=(SqlBackup &&rhs) noexcept = default;
+SqlBackup::~SqlBackup() = default;
+
+bool SqlBackup::run(const Backup::ProgressCallback &progress) noexcept
+{
+    bool ok {true};
+    // Make sure the 'db' instances go out of scope before finally removing the connections
+    {
+        QSqlDatabase source = QSqlDatabase::addDatabase(::DriverName, d->sourceConnectionName);
+        source.setDatabaseName(d->logbookPath);
+        QSqlDatabase target = QSqlDatabase::addDatabase(::DriverName, d->targetConnectionName);
+        target.setDatabaseName(d->backupFilePath);
+        ok = source.open() && target.open();
+        if (ok) {
+            ok = readSchema();
+        }
+        if (ok) {
+            ok = createTables();
+        }
+        if (ok) {
+            ok = copyData(progress);
+        }
+        if (ok) {
+            // Creating the indices once all data has been copied is faster than updating them with each batch
+            ok = createIndices();
+        }
+        if (ok) {
+            // The backup is a logbook of its own: once restored at the path of the original logbook
+            // the flight cache of the original logbook must not apply to it
+            QSqlQuery query {target};
+            ok = query.exec("update metadata set logbook_id = lower(hex(randomblob(16)));");
+        }
+        source.close();
+        target.close();
+    }
+    QSqlDatabase::removeDatabase(d->sourceConnectionName);
+    QSqlDatabase::removeDatabase(d->targetConnectionName);
+    if (!ok) {
+        QFile::remove(d->backupFilePath);
+    }
+    return ok;
+}
+
+// PRIVATE
+
+bool SqlBackup::readSchema() noexcept
+{
+    const auto db {QSqlDatabase::database(d->sourceConnectionName)};
+    QSqlQuery query {db};
+    query.setForwardOnly(true);
+    const bool ok = query.exec(
+        "select m.type, m.name, m.sql "
+        "from   sqlite_master m "
+        "where  m.sql is not null "
+        "order by m.rowid;"
+    );
+    if (ok) {
+        while (query.next()) {
+            const QString type = query.value(0).toString();
+            const QString name = query.value(1).toString();
+            if (name == "sqlite_sequence") {
+                // Created implicitly by tables with autoincrement columns, but its content is copied as well
+                d->tables.push_back(name);
+            } else if (name.startsWith("sqlite_")) {
+                // Other internal tables (e.g. statistics) cannot be created
+                continue;
+            } else if (type == "table") {
+                d->tables.push_back(name);
+                d->tableStatements.push_back(query.value(2).toString());
+            } else {
+                d->indexStatements.push_back(query.value(2).toString());
+            }
+        }
+    }
+#ifdef DEBUG
+    else {
+        qDebug() << "SqlBackup::readSchema: SQL error:" << query.lastError().text() << "- error code:" << query.lastError().nativeErrorCode();
+    }
+#endif
+    return ok;
+}
+
+bool SqlBackup::createTables() const noexcept
+{
+    const auto db {QSqlDatabase::database(d->targetConnectionName)};
+    QSqlQuery query {db};
+    // Must be set before any table is created
+    bool ok = query.exec("pragma auto_vacuum = incremental;");
+    for (auto it = d->tableStatements.cbegin(); ok && it != d->tableStatements.cend(); ++it) {
+        ok = query.exec(*it);
+#ifdef DEBUG
+        if (!ok) {
+            qDebug() << "SqlBackup::createTables: SQL error:" << query.lastError().text() << "- error code:" << query.lastError().nativeErrorCode();
+        }
+#endif
+    }
+    return ok;
+}
+
+bool SqlBackup::createIndices() const noexcept
+{
+    const auto db {QSqlDatabase::database(d->targetConnectionName)};
+    QSqlQuery query {db};
+    bool ok {true};
+    for (auto it = d->indexStatements.cbegin(); ok && it != d->indexStatements.cend(); ++it) {
+        ok = query.exec(*it);
+#ifdef DEBUG
+        if (!ok) {
+            qDebug() << "SqlBackup::createIndices: SQL error:" << query.lastError().text() << "- error code:" << query.lastError().nativeErrorCode();
+        }
+#endif
+    }
+    return ok;
+}
+
+bool SqlBackup::copyData(const Backup::ProgressCallback &progress) const noexcept
+{
+    auto db {QSqlDatabase::database(d->sourceConnectionName)};
+    QSqlQuery query {db};
+    query.prepare("attach database :backup_file_path as backup;");
+    query.bindValue(":backup_file_path", d->backupFilePath);
+    bool ok = query.exec();
+    if (ok) {
+        const std::int64_t total = getTotalRowCount(&ok);
+        int restartCount {0};
+        bool restart {true};
+        while (ok && restart) {
+            const bool singleTransaction = restartCount >= ::MaxRestarts;
+            if (singleTransaction) {
+                // Writers are blocked until all data has been copied
+                ok = db.transaction();
+            }
+            if (ok) {
+                ok = copyTables(progress, total, singleTransaction, &restart);
+            }
+            if (singleTransaction) {
+                if (ok) {
+                    ok = db.commit();
+                } else {
+                    db.rollback();
+                }
+            }
+            if (ok && restart) {
+#ifdef DEBUG
+                qDebug() << "SqlBackup::copyData: the logbook has been modified, restarting the backup";
+#endif
+                ok = clearData();
+                ++restartCount;
+            }
+        }
+        if (ok && progress) {
+            ok = progress(total, total);
+        }
+        query.exec("detach database backup;");
+    }
+#ifdef DEBUG
+    else {
+        qDebug() << "SqlBackup::copyData: SQL error:" << query.lastError().text() << "- error code:" << query.lastError().nativeErrorCode();
+    }
+#endif
+    return ok;
+}
+
+bool SqlBackup::copyTables(const Backup::ProgressCallback &progress, std::int64_t total, bool singleTransaction, bool *restart) const noexcept
+{
+    auto db {QSqlDatabase::database(d->sourceConnectionName)};
+    *restart = false;
+    bool ok {true};
+    const std::int64_t dataVersion = getDataVersion(&ok);
+    std::int64_t copied {0};
+    for (auto it = d->tables.cbegin(); ok && !*restart && it != d->tables.cend(); ++it) {
+        std::int64_t lastRowId {std::numeric_limits<std::int64_t>::min()};
+        while (ok && !*restart && lastRowId < std::numeric_limits<std::int64_t>::max()) {
+            if (!singleTransaction) {
+                ok = db.transaction();
+            }
+            std::int64_t rowCount {0};
+            if (ok) {
+                ok = copyBatch(*it, lastRowId, rowCount);
+            }
+            if (!singleTransaction) {
+                if (ok) {
+                    // Like the SQLite online backup API the backup is restarted as soon as
+                    // the logbook has been modified by another connection
+                    *restart = getDataVersion(&ok) != dataVersion;
+                }
+                if (ok && !*restart) {
+                    ok = db.commit();
+                } else {
+                    db.rollback();
+                }
+                // No lock is held on the logbook anymore: give pending writers a chance
+                QThread::yieldCurrentThread();
+            }
+            copied += rowCount;
+            if (ok && !*restart && progress) {
+                ok = progress(std::min(copied, total), total);
+            }
+        }
+    }
+    return ok;
+}
+
+bool SqlBackup::copyBatch(const QString &table, std::int64_t &lastRowId, std::int64_t &rowCount) const noexcept
+{
+    const auto db {QSqlDatabase::database(d->sourceConnectionName)};
+    const QString quotedTable = ::quoted(table);
+    QSqlQuery query {db};
+    query.setForwardOnly(true);
+    // The last row ID of this batch
+    query.prepare(
+        "select t.rowid "
+        "from   main." % quotedTable % " t "
+        "where  t.rowid > :last_row_id "
+        "order by t.rowid "
+        "limit  1 offset :offset;"
+    );
+    query.bindValue(":last_row_id", QVariant::fromValue(lastRowId));
+    query.bindValue(":offset", ::BatchSize - 1);
+    bool ok = query.exec();
+    if (ok) {
+        const std::int64_t upperRowId = query.next() ? query.value(0).toLongLong() : std::numeric_limits<std::int64_t>::max();
+        query.finish();
+        query.prepare(
+            "insert into backup." % quotedTable % " "
+            "select * "
+            "from   main." % quotedTable % " t "
+            "where  t.rowid > :last_row_id "
+            "  and  t.rowid <= :upper_row_id;"
+        );
+        query.bindValue(":last_row_id", QVariant::fromValue(lastRowId));
+        query.bindValue(":upper_row_id", QVariant::fromValue(upperRowId));
+        ok = query.exec();
+        if (ok) {
+            rowCount = query.numRowsAffected();
+            lastRowId = upperRowId;
+        }
+    }
+#ifdef DEBUG
+    if (!ok) {
+        qDebug() << "SqlBackup::copyBatch: SQL error:" << query.lastError().text() << "- error code:" << query.lastError().nativeErrorCode();
+    }
+#endif
+    return ok;
+}
+
+bool SqlBackup::clearData() const noexcept
+{
+    auto db {QSqlDatabase::database(d->sourceConnectionName)};
+    bool ok = db.transaction();
+    if (ok) {
+        QSqlQuery query {db};
+        for (auto it = d->tables.cbegin(); ok && it != d->tables.cend(); ++it) {
+            ok = query.exec("delete from backup." % ::quoted(*it) % ";");
+        }
+        if (ok) {
+            ok = db.commit();
+        } else {
+            db.rollback();
+        }
+    }
+    return ok;
+}
+
+std::int64_t SqlBackup::getTotalRowCount(bool *ok) const noexcept
+{
+    const auto db {QSqlDatabase::database(d->sourceConnectionName)};
+    QSqlQuery query {db};
+    query.setForwardOnly(true);
+    std::int64_t total {0};
+    bool success {true};
+    // The largest row ID is an upper bound of the row count which is determined without a full table scan
+    for (auto it = d->tables.cbegin(); success && it != d->tables.cend(); ++it) {
+        success = query.exec("select max(t.rowid) from main." % ::quoted(*it) % " t;") && query.next();
+        if (success) {
+            total += std::max(query.value(0).toLongLong(), std::int64_t {0});
+        }
+    }
+    if (ok != nullptr) {
+        *ok = success;
+    }
+    return total;
+}
+
+std::int64_t SqlBackup::getDataVersion(bool *ok) const noexcept
+{
+    const auto db {QSqlDatabase::database(d->sourceConnectionName)};
+    QSqlQuery query {db};
+    query.setForwardOnly(true);
+    const bool success = query.exec("pragma main.data_version;") && query.next();
+    if (ok != nullptr) {
+        *ok = success;
+    }
+    return success ? query.value(0).toLongLong() : 0;
+}
@@ -0,0 +1,82 @@
+/**
+ * Sky Dolly - The Black Sheep for Your Flight Recordings
+ *
+ * Copyright (c) 2020 - 2025 Oliver Knoll
+ *
+ * MIT License
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this
+ * software and associated documentation files (the "Software"), to deal in the Software
+ * without restriction, including without limitation the rights to use, copy, modify, merge,
+ * publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons
+ * to whom the Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or
+ * substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED *AS IS*, WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR
+ * PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE
+ * FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+ * OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ */
+#ifndef SQLBACKUP_H
+#define SQLBACKUP_H
+
+#include <memory>
+#include <cstdint>
+
+#include <QString>
+
+#include <Backup.h>
+
+struct SqlBackupPrivate;
+
+/*!
+ * Copies a logbook into a new backup logbook, in small batches of rows.
+ *
+ * The copy is done on dedicated database connections which are created and removed
+ * by the thread calling #run, which is typically a worker thread. No lock is held
+ * on the logbook in between batches, so other connections may write to the logbook
+ * while the backup is in progress. Like the SQLite online backup API the backup
+ * is restarted when the logbook is modified by another connection; after repeated
+ * restarts the remaining data is copied within a single read transaction.
+ *
+ * The backup logbook uses incremental auto-vacuum.
+ */
+class SqlBackup final
+{
+public:
+    SqlBackup(QString logbookPath, QString backupFilePath) noexcept;
+    SqlBackup(const SqlBackup &rhs) = delete;
+    SqlBackup(SqlBackup &&rhs) noexcept;
+    SqlBackup &operator=(const SqlBackup &rhs) = delete;
+    SqlBackup &operator=(SqlBackup &&rhs) noexcept;
+    ~SqlBackup();
+
+    /*!
+     * Creates the backup logbook. A partially written backup logbook is removed
+     * in case of failure or cancellation.
+     *
+     * \param progress
+     *        the optional callback which reports the progress and which may cancel the backup
+     * \return \c true if the backup has successfully been created; \c false upon error or cancellation
+     */
+    bool run(const Backup::ProgressCallback &progress = {}) noexcept;
+
+private:
+    std::unique_ptr<SqlBackupPrivate> d;
+
+    bool readSchema() noexcept;
+    bool createTables() const noexcept;
+    bool createIndices() const noexcept;
+    bool copyData(const Backup::ProgressCallback &progress) const noexcept;
+    bool copyTables(const Backup::ProgressCallback &progress, std::int64_t total, bool singleTransaction, bool *restart) const noexcept;
+    bool copyBatch(const QString &table, std::int64_t &lastRowId, std::int64_t &rowCount) const noexcept;
+    bool clearData() const noexcept;
+    std::int64_t getTotalRowCount(bool *ok = nullptr) const noexcept;
+    std::int64_t getDataVersion(bool *ok = nullptr) const noexcept;
+};
+
+#endif // SQLBACKUP_H
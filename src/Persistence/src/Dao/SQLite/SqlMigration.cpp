@@ -23,6 +23,8 @@
  */
 #include <memory>
 #include <utility>
+#include <algorithm>
+#include <iterator>
 
 #include <QFile>
 #include <QTextStream>
@@ -34,6 +36,11 @@
 #include <QDir>
 #include <QCoreApplication>
 #include <QStringConverter>
+#include <QStringBuilder>
+#ifdef DEBUG
+#include <QDebug>
+#include <QSqlError>
+#endif
 
 #include <Kernel/Const.h>
 #include <Kernel/Enum.h>
@@ -45,6 +52,7 @@
 #include "SQLiteLocationDao.h"
 #include "SqlMigrationStep.h"
 #include "SqlMigration.h"
+#include "MigrationManifest.h"
 
 namespace
 {
@@ -105,10 +113,7 @@ bool SqlMigration::migrate(Migration::Milestones milestones) const noexcept
 {
     bool ok {true};
     if (milestones.testFlag(Migration::Milestone::Schema)) {
-        ok = migrateSql(":/dao/sqlite/migr/LogbookMigration.sql");
-        if (ok) {
-            ok = migrateSql(":/dao/sqlite/migr/LocationMigration.sql");
-        }
+        ok = migrateSchema();
     }
     if (ok && milestones.testFlag(Migration::Milestone::Location)) {
         QDir migrationDirectory {QDir(QCoreApplication::applicationDirPath())};
@@ -128,7 +133,28 @@ bool SqlMigration::migrate(Migration::Milestones milestones) const noexcept
 
 // PRIVATE
 
-bool SqlMigration::migrateSql(const QString &migrationFilePath) const noexcept
+bool SqlMigration::migrateSchema() const noexcept
+{
+    // Fast path: a single query, without reading or parsing any migration script
+    if (isSchemaUpToDate()) {
+        return true;
+    }
+
+    bool ok {true};
+    const AppliedSteps appliedSteps = getAppliedSteps(&ok);
+    if (ok && !isManifestApplied(appliedSteps)) {
+        ok = migrateSql(":/dao/sqlite/migr/LogbookMigration.sql", appliedSteps);
+        if (ok) {
+            ok = migrateSql(":/dao/sqlite/migr/LocationMigration.sql", appliedSteps);
+        }
+    }
+    if (ok) {
+        ok = updateSchemaFingerprint();
+    }
+    return ok;
+}
+
+bool SqlMigration::migrateSql(const QString &migrationFilePath, const AppliedSteps &appliedSteps) const noexcept
 {
     // https://regex101.com/
     // @migr(...)
@@ -158,7 +184,8 @@ bool SqlMigration::migrateSql(const QString &migrationFilePath) const noexcept
 #endif
                 SqlMigrationStep step {d->connectionName};
                 ok = step.parseTag(tagMatch);
-                if (ok && !step.checkApplied()) {
+                // Only pending steps are queried individually, which also detects any previously failed attempt
+                if (ok && !appliedSteps.contains(getAppliedStepKey(step.getMigrationId(), step.getStep())) && !step.checkApplied()) {
                     ok = step.execute(sqlStatements.at(i));
                 }
                 ++i;
@@ -210,6 +237,74 @@ bool SqlMigration::migrateCsv(const QString &migrationFilePath) const noexcept
     return query.exec() && ok;
 }
 
+bool SqlMigration::isSchemaUpToDate() const noexcept
+{
+    const auto db {QSqlDatabase::database(d->connectionName)};
+    QSqlQuery query {db};
+    query.setForwardOnly(true);
+    // Fails as long as the schema_fingerprint column does not exist yet (older logbooks)
+    const bool ok = query.exec("select m.schema_fingerprint from metadata m;");
+    return ok && query.next() && query.value(0).toString() == QLatin1String(MigrationManifest::SchemaFingerprint);
+}
+
+bool SqlMigration::updateSchemaFingerprint() const noexcept
+{
+    const auto db {QSqlDatabase::database(d->connectionName)};
+    QSqlQuery query {db};
+    query.prepare(
+        "update metadata "
+        "set    schema_fingerprint = :schema_fingerprint;"
+    );
+    query.bindValue(":schema_fingerprint", QString::fromLatin1(MigrationManifest::SchemaFingerprint));
+    const bool ok = query.exec();
+#ifdef DEBUG
+    if (!ok) {
+        qDebug() << "SqlMigration::updateSchemaFingerprint: SQL error:" << query.lastError().text() << "- error code:" << query.lastError().nativeErrorCode();
+    }
+#endif
+    return ok;
+}
+
+SqlMigration::AppliedSteps SqlMigration::getAppliedSteps(bool *ok) const noexcept
+{
+    AppliedSteps appliedSteps;
+    const auto db {QSqlDatabase::database(d->connectionName)};
+    QSqlQuery query {db};
+    query.setForwardOnly(true);
+    const bool success = query.exec(
+        "select m.id, m.step "
+        "from   migr m "
+        "where  m.success = 1;"
+    );
+    if (success) {
+        appliedSteps.reserve(std::size(MigrationManifest::Steps));
+        while (query.next()) {
+            appliedSteps.insert(getAppliedStepKey(query.value(0).toString(), query.value(1).toInt()));
+        }
+    }
+#ifdef DEBUG
+    else {
+        qDebug() << "SqlMigration::getAppliedSteps: SQL error:" << query.lastError().text() << "- error code:" << query.lastError().nativeErrorCode();
+    }
+#endif
+    if (ok != nullptr) {
+        *ok = success;
+    }
+    return appliedSteps;
+}
+
+bool SqlMigration::isManifestApplied(const AppliedSteps &appliedSteps) noexcept
+{
+    return std::all_of(std::cbegin(MigrationManifest::Steps), std::cend(MigrationManifest::Steps), [&appliedSteps](const MigrationManifest::Step &step) {
+        return appliedSteps.contains(getAppliedStepKey(QString::fromLatin1(step.migrationId), step.step));
+    });
+}
+
+QString SqlMigration::getAppliedStepKey(const QString &migrationId, int step) noexcept
+{
+    return migrationId % '/' % QString::number(step);
+}
+
 bool SqlMigration::migrateLocation(const CsvParser::Row &row) const noexcept
 {
     bool ok {true};
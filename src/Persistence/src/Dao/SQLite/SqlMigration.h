@@ -25,8 +25,9 @@
 #define SQLMIGRATION_H
 
 #include <memory>
+#include <unordered_set>
 
-class QString;
+#include <QString>
 
 #include <Kernel/CsvParser.h>
 #include <Migration.h>
@@ -48,8 +49,17 @@ public:
 private:
     std::unique_ptr<SqlMigrationPrivate> d;
 
-    bool migrateSql(const QString &migrationFilePath) const noexcept;
+    // Keys of the successfully applied migration steps, see #getAppliedStepKey
+    using AppliedSteps = std::unordered_set<QString>;
+
+    bool migrateSchema() const noexcept;
+    bool migrateSql(const QString &migrationFilePath, const AppliedSteps &appliedSteps) const noexcept;
     bool migrateCsv(const QString &migrationFilePath) const noexcept;
+    bool isSchemaUpToDate() const noexcept;
+    bool updateSchemaFingerprint() const noexcept;
+    AppliedSteps getAppliedSteps(bool *ok = nullptr) const noexcept;
+    static bool isManifestApplied(const AppliedSteps &appliedSteps) noexcept;
+    static QString getAppliedStepKey(const QString &migrationId, int step) noexcept;
     bool migrateLocation(const CsvParser::Row &row) const noexcept;
 };
 
@@ -0,0 +1,153 @@
+/**
+ * Sky Dolly - The Black Sheep for Your Flight Recordings
+ *
+ * Copyright (c) 2020 - 2025 Oliver Knoll
+ *
+ * MIT License
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this
+ * software and associated documentation files (the "Software"), to deal in the Software
+ * without restriction, including without limitation the rights to use, copy, modify, merge,
+ * publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons
+ * to whom the Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or
+ * substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED *AS IS*, WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR
+ * PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE
+ * FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+ * OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ */
+#include <memory>
+#include <unordered_map>
+#include <optional>
+#include <utility>
+#include <cstddef>
+
+#include <QString>
+#include <QSqlDatabase>
+#include <QSqlQuery>
+#include <QSqlError>
+#ifdef DEBUG
+#include <QDebug>
+#endif
+
+#include "SqlStatementCache.h"
+
+namespace
+{
+    // The statement caches of the calling thread, by connection name
+    using Registry = std::unordered_map<QString, std::weak_ptr<SqlStatementCache>>;
+    thread_local Registry registry;
+}
+
+struct SqlStatementCachePrivate
+{
+    SqlStatementCachePrivate(QString connectionName) noexcept
+        : connectionName {std::move(connectionName)}
+    {}
+
+    QString connectionName;
+    // Declared before the statements, which are hence destroyed first
+    QSqlDatabase database;
+    bool databaseValid {false};
+    // Keyed by the address of the SQL string literal
+    std::unordered_map<const char *, QSqlQuery> statements;
+    // A statement which could not be prepared is not cached
+    std::optional<QSqlQuery> failedStatement;
+};
+
+// PUBLIC
+
+SqlStatementCache::SqlStatementCache(QString connectionName) noexcept
+    : d {std::make_unique<SqlStatementCachePrivate>(std::move(connectionName))}
+{}
+
+SqlStatementCache::SqlStatementCache(SqlStatementCache &&rhs) noexcept = default;
+SqlStatementCache &SqlStatementCache::operator=(SqlStatementCache &&rhs) noexcept = default;
+SqlStatementCache::~SqlStatementCache() = default;
+
+std::shared_ptr<SqlStatementCache> SqlStatementCache::getInstance(const QString &connectionName) noexcept
+{
+    auto &weakCache = ::registry[connectionName];
+    std::shared_ptr<SqlStatementCache> cache = weakCache.lock();
+    if (!cache) {
+        cache = std::make_shared<SqlStatementCache>(connectionName);
+        weakCache = cache;
+    }
+    return cache;
+}
+
+void SqlStatementCache::invalidate(const QString &connectionName) noexcept
+{
+    const auto it = ::registry.find(connectionName);
+    if (it != ::registry.end()) {
+        const auto cache = it->second.lock();
+        if (cache) {
+            cache->clear();
+        } else {
+            ::registry.erase(it);
+        }
+    }
+}
+
+const QSqlDatabase &SqlStatementCache::getDatabase() noexcept
+{
+    if (!d->databaseValid) {
+        d->database = QSqlDatabase::database(d->connectionName);
+        d->databaseValid = true;
+    }
+    return d->database;
+}
+
+QSqlQuery &SqlStatementCache::prepare(const char *sql) noexcept
+{
+    auto it = d->statements.find(sql);
+    if (it == d->statements.end()) {
+        QSqlQuery query {getDatabase()};
+        query.setForwardOnly(true);
+        if (!query.prepare(sql)) {
+#ifdef DEBUG
+            qDebug() << "SqlStatementCache::prepare: SQL error:" << query.lastError().text() << "- error code:" << query.lastError().nativeErrorCode();
+#endif
+            // The execution of the returned statement fails as well; the next
+            // request tries again to prepare the statement
+            d->failedStatement = std::move(query);
+            return *d->failedStatement;
+        }
+        it = d->statements.emplace(sql, std::move(query)).first;
+    }
+    return it->second;
+}
+
+void SqlStatementCache::finish() noexcept
+{
+    for (auto &[sql, statement] : d->statements) {
+        statement.finish();
+    }
+}
+
+void SqlStatementCache::clear() noexcept
+{
+    d->statements.clear();
+    d->failedStatement.reset();
+    d->database = QSqlDatabase();
+    d->databaseValid = false;
+}
+
+std::size_t SqlStatementCache::getStatementCount() const noexcept
+{
+    return d->statements.size();
+}
+
+SqlQueryFinisher::SqlQueryFinisher(QSqlQuery &query) noexcept
+    : m_query {query}
+{}
+
+SqlQueryFinisher::~SqlQueryFinisher()
+{
+    m_query.finish();
+}
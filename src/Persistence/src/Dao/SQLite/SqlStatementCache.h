@@ -0,0 +1,145 @@
+/**
+ * Sky Dolly - The Black Sheep for Your Flight Recordings
+ *
+ * Copyright (c) 2020 - 2025 Oliver Knoll
+ *
+ * MIT License
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this
+ * software and associated documentation files (the "Software"), to deal in the Software
+ * without restriction, including without limitation the rights to use, copy, modify, merge,
+ * publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons
+ * to whom the Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or
+ * substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED *AS IS*, WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR
+ * PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE
+ * FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+ * OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ */
+#ifndef SQLSTATEMENTCACHE_H
+#define SQLSTATEMENTCACHE_H
+
+#include <memory>
+#include <cstddef>
+
+#include <QString>
+
+class QSqlDatabase;
+class QSqlQuery;
+struct SqlStatementCachePrivate;
+
+/*!
+ * Keeps the prepared statements of a given database connection alive, so that the
+ * DAOs do not have to prepare the same SQL text - and look up the connection by
+ * its name - over and over again.
+ *
+ * A QSqlDatabase connection must only be used by the thread that opened it: each
+ * thread therefore has its own cache per connection, as returned by #getInstance.
+ * All DAOs of the same connection share the same cache.
+ *
+ * The cached statements become invalid when their connection is closed: the cache
+ * must be invalidated before the connection is closed, (re-)opened or removed.
+ */
+class SqlStatementCache final
+{
+public:
+    SqlStatementCache(QString connectionName) noexcept;
+    SqlStatementCache(const SqlStatementCache &rhs) = delete;
+    SqlStatementCache(SqlStatementCache &&rhs) noexcept;
+    SqlStatementCache &operator=(const SqlStatementCache &rhs) = delete;
+    SqlStatementCache &operator=(SqlStatementCache &&rhs) noexcept;
+    ~SqlStatementCache();
+
+    /*!
+     * Returns the statement cache of the connection with the given \p connectionName,
+     * for the calling thread.
+     *
+     * \param connectionName
+     *        the name of the database connection
+     * \return the shared statement cache of the connection
+     */
+    static std::shared_ptr<SqlStatementCache> getInstance(const QString &connectionName) noexcept;
+
+    /*!
+     * Clears the statement cache of the connection with the given \p connectionName,
+     * for the calling thread. This must be called before the connection is closed,
+     * (re-)opened or removed.
+     *
+     * \param connectionName
+     *        the name of the database connection
+     */
+    static void invalidate(const QString &connectionName) noexcept;
+
+    /*!
+     * Returns the database connection, which is only looked up after the cache
+     * has been created or invalidated.
+     *
+     * \return the database connection of this cache
+     */
+    const QSqlDatabase &getDatabase() noexcept;
+
+    /*!
+     * Returns the statement prepared with the given \p sql text. The statement is prepared
+     * upon first use only; later on the same (forward-only) statement is returned, with
+     * its bound values from the previous execution, which are to be bound again.
+     *
+     * The statement is identified by the address of the \p sql text, which must hence be
+     * a string literal. Dynamically built SQL must not be cached.
+     *
+     * The returned statement remains valid until the cache is invalidated or the
+     * same \p sql is requested again.
+     *
+     * A cached SELECT statement which has not been stepped to its end keeps the read
+     * transaction - and with it the SHARED lock on the database - open, which blocks the
+     * writers of other connections. Readers hence finish the statement with a
+     * SqlQueryFinisher once they are done.
+     *
+     * \param sql
+     *        the SQL string literal
+     * \return the prepared statement
+     */
+    QSqlQuery &prepare(const char *sql) noexcept;
+
+    /*!
+     * Finishes all statements, releasing any pending read transaction, for instance
+     * before the database is vacuumed.
+     */
+    void finish() noexcept;
+
+    /*!
+     * Removes all cached statements and releases the database connection.
+     */
+    void clear() noexcept;
+
+    std::size_t getStatementCount() const noexcept;
+
+private:
+    std::unique_ptr<SqlStatementCachePrivate> d;
+};
+
+/*!
+ * Finishes the given cached \p query when going out of scope, keeping the query
+ * prepared for its next execution.
+ *
+ * \sa SqlStatementCache#prepare
+ */
+class SqlQueryFinisher final
+{
+public:
+    explicit SqlQueryFinisher(QSqlQuery &query) noexcept;
+    SqlQueryFinisher(const SqlQueryFinisher &rhs) = delete;
+    SqlQueryFinisher(SqlQueryFinisher &&rhs) = delete;
+    SqlQueryFinisher &operator=(const SqlQueryFinisher &rhs) = delete;
+    SqlQueryFinisher &operator=(SqlQueryFinisher &&rhs) = delete;
+    ~SqlQueryFinisher();
+
+private:
+    QSqlQuery &m_query;
+};
+
+#endif // SQLSTATEMENTCACHE_H
@@ -1234,4 +1234,22 @@ alter table attitude_new rename to attitude;
 update metadata
 set    app_version = '0.20.0';
 
+@migr(id = "b5baa316-bb12-4d10-b429-c4571511b3fb", descn = "Create recording journal table", step = 1)
+create table recording_journal (
+    aircraft_id integer primary key,
+    flight_id integer not null,
+    new_flight integer not null,
+    creation_time datetime default current_timestamp,
+    foreign key(aircraft_id) references aircraft(id),
+    foreign key(flight_id) references flight(id)
+);
 
+@migr(id = "ab4d1701-f7e9-4776-b979-63d87d8b6bd2", descn = "Add schema fingerprint to metadata", step = 1)
+alter table metadata add column schema_fingerprint text;
+
+@migr(id = "cbd1cec6-1e69-4413-9108-d83995b3d58c", descn = "Add logbook identity to metadata", step_cnt = 2)
+alter table metadata add column logbook_id text;
+
+@migr(id = "cbd1cec6-1e69-4413-9108-d83995b3d58c", descn = "Assign random logbook identity", step = 2)
+update metadata
+set    logbook_id = lower(hex(randomblob(16)));
@@ -0,0 +1,473 @@
+/**
+ * Sky Dolly - The Black Sheep for Your Flight Recordings
+ *
+ * Copyright (c) 2020 - 2025 Oliver Knoll
+ *
+ * MIT License
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this
+ * software and associated documentation files (the "Software"), to deal in the Software
+ * without restriction, including without limitation the rights to use, copy, modify, merge,
+ * publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons
+ * to whom the Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or
+ * substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED *AS IS*, WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR
+ * PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE
+ * FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+ * OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ */
+#include <memory>
+#include <array>
+#include <vector>
+#include <algorithm>
+#include <type_traits>
+#include <utility>
+#include <bit>
+#include <cstring>
+#include <cstdint>
+#include <cstddef>
+
+#include <QString>
+#include <QStringBuilder>
+#include <QByteArray>
+#include <QSqlDatabase>
+#include <QSqlQuery>
+#include <QVariant>
+#include <QFile>
+#include <QSaveFile>
+#include <QFileInfo>
+#include <QDir>
+#include <QDateTime>
+#include <QStandardPaths>
+#include <QCryptographicHash>
+#ifdef DEBUG
+#include <QDebug>
+#endif
+
+#include <Model/Aircraft.h>
+#include <Model/AbstractComponent.h>
+#include <Model/Position.h>
+#include <Model/PositionData.h>
+#include <Model/Attitude.h>
+#include <Model/AttitudeData.h>
+#include <Model/Engine.h>
+#include <Model/EngineData.h>
+#include <Model/PrimaryFlightControl.h>
+#include <Model/PrimaryFlightControlData.h>
+#include <Model/SecondaryFlightControl.h>
+#include <Model/SecondaryFlightControlData.h>
+#include <Model/AircraftHandle.h>
+#include <Model/AircraftHandleData.h>
+#include <Model/Light.h>
+#include <Model/LightData.h>
+#include "FlightCache.h"
+
+namespace
+{
+    constexpr const char *CacheDirectoryName {"Flights"};
+    constexpr const char *FileSuffix {".flight"};
+    constexpr const char *InMemoryDatabaseName {":memory:"};
+    // The maximum total size of all cache files of a logbook [bytes]
+    constexpr qint64 MaxCacheSize {4LL * 1024 * 1024 * 1024};
+    // The number of samples written at once
+    constexpr std::size_t ChunkSize {4096};
+
+    // "SDFC"
+    constexpr std::uint32_t Magic {0x53444643};
+    // Must be increased whenever the file layout changes
+    constexpr std::uint32_t Version {3};
+    // The maximum length of the logbook identity [characters]: 128 bit, hex-encoded
+    constexpr std::size_t LogbookIdSize {32};
+    using LogbookId = std::array<char, ::LogbookIdSize>;
+
+    // Position, attitude, engine, primary and secondary flight controls, handles, lights
+    constexpr std::size_t ComponentCount {7};
+
+    // The file starts with the header, followed by one entry per aircraft and then
+    // the samples of each aircraft, component by component
+    struct Header
+    {
+        std::uint32_t magic {::Magic};
+        std::uint32_t version {::Version};
+        // The identity of the logbook: a re-created logbook at the same path has another identity
+        ::LogbookId logbookId {};
+        std::int64_t flightId {0};
+        // The fingerprint of the sampled data of the flight in the logbook, which detects samples
+        // added or removed outside of the service layer
+        std::uint64_t fingerprint {0};
+        std::uint64_t aircraftCount {0};
+        // The size of all data following the header [bytes]
+        std::uint64_t payloadSize {0};
+        // The checksum of all data following the header
+        std::uint64_t checksum {0};
+        // The sample layout: a cache file written with different sample types is not valid
+        std::array<std::uint32_t, ::ComponentCount> sampleSizes {
+            sizeof(PositionData),
+            sizeof(AttitudeData),
+            sizeof(EngineData),
+            sizeof(PrimaryFlightControlData),
+            sizeof(SecondaryFlightControlData),
+            sizeof(AircraftHandleData),
+            sizeof(LightData)
+        };
+        std::uint32_t reserved {0};
+    };
+
+    struct AircraftEntry
+    {
+        std::int64_t aircraftId {0};
+        std::array<std::uint64_t, ::ComponentCount> sampleCounts {};
+    };
+
+    // All data is checksummed (and kept aligned) in units of 64 bit words
+    static_assert(std::is_trivially_copyable_v<Header> && sizeof(Header) % 8 == 0);
+    static_assert(std::is_trivially_copyable_v<AircraftEntry> && sizeof(AircraftEntry) % 8 == 0);
+
+    // A fast, non-cryptographic checksum over 64 bit words, which detects truncated or
+    // otherwise corrupt cache files
+    class Checksum
+    {
+    public:
+        void add(const void *data, std::size_t size) noexcept
+        {
+            const auto *bytes = static_cast<const unsigned char *>(data);
+            for (std::size_t i = 0; i < size; i += sizeof(std::uint64_t)) {
+                std::uint64_t word {0};
+                std::memcpy(&word, bytes + i, sizeof(word));
+                m_hash = std::rotl(m_hash ^ (word * Prime1), 31) * Prime2;
+            }
+        }
+
+        std::uint64_t result() const noexcept
+        {
+            return m_hash ^ (m_hash >> 29);
+        }
+
+    private:
+        static constexpr std::uint64_t Prime1 {0x9e3779b185ebca87};
+        static constexpr std::uint64_t Prime2 {0xc2b2ae3d27d4eb4f};
+        // "SkyDolly"
+        std::uint64_t m_hash {0x536b79446f6c6c79};
+    };
+
+    // Calls the given function for each component with sampled data, in file order
+    template <typename Function>
+    void forEachComponent(const Aircraft &aircraft, Function &&function) noexcept
+    {
+        function(aircraft.getPosition());
+        function(aircraft.getAttitude());
+        function(aircraft.getEngine());
+        function(aircraft.getPrimaryFlightControl());
+        function(aircraft.getSecondaryFlightControl());
+        function(aircraft.getAircraftHandle());
+        function(aircraft.getLight());
+    }
+
+    template <typename T, typename Codec>
+    bool writeSamples(QSaveFile &file, const AbstractComponent<T, Codec> &component, Checksum &checksum) noexcept
+    {
+        static_assert(sizeof(T) % 8 == 0 && alignof(T) <= 8, "Samples must be stored in units of 64 bit words");
+        bool ok {true};
+        const std::size_t count = component.count();
+        for (std::size_t index = 0; ok && index < count; index += ::ChunkSize) {
+            const std::vector<T> samples = component.copyData(index, std::min(::ChunkSize, count - index));
+            const qint64 size = static_cast<qint64>(samples.size() * sizeof(T));
+            checksum.add(samples.data(), samples.size() * sizeof(T));
+            ok = file.write(reinterpret_cast<const char *>(samples.data()), size) == size;
+        }
+        return ok;
+    }
+
+    ::LogbookId toLogbookId(const QString &logbookId) noexcept
+    {
+        ::LogbookId id {};
+        const QByteArray latin1 = logbookId.toLatin1().left(::LogbookIdSize);
+        std::memcpy(id.data(), latin1.constData(), static_cast<std::size_t>(latin1.size()));
+        return id;
+    }
+
+    QString selectLogbookId(const QSqlDatabase &database) noexcept
+    {
+        QSqlQuery query {database};
+        const bool ok = query.exec("select m.logbook_id from metadata m;") && query.next();
+        return ok ? query.value(0).toString() : QString();
+    }
+
+    // Selects the sample count and the last timestamp of each component, for each aircraft of the
+    // flight: these aggregates are answered from the (aircraft_id, timestamp) primary keys, without
+    // reading the sampled data itself
+    std::uint64_t selectFingerprint(const QSqlDatabase &database, std::int64_t flightId) noexcept
+    {
+        QSqlQuery query {database};
+        query.setForwardOnly(true);
+        bool ok = query.prepare(
+            "select a.id,"
+            "       (select count(*) from position p where p.aircraft_id = a.id),"
+            "       (select max(p.timestamp) from position p where p.aircraft_id = a.id),"
+            "       (select count(*) from attitude at where at.aircraft_id = a.id),"
+            "       (select max(at.timestamp) from attitude at where at.aircraft_id = a.id),"
+            "       (select count(*) from engine e where e.aircraft_id = a.id),"
+            "       (select max(e.timestamp) from engine e where e.aircraft_id = a.id),"
+            "       (select count(*) from primary_flight_control pfc where pfc.aircraft_id = a.id),"
+            "       (select max(pfc.timestamp) from primary_flight_control pfc where pfc.aircraft_id = a.id),"
+            "       (select count(*) from secondary_flight_control sfc where sfc.aircraft_id = a.id),"
+            "       (select max(sfc.timestamp) from secondary_flight_control sfc where sfc.aircraft_id = a.id),"
+            "       (select count(*) from handle h where h.aircraft_id = a.id),"
+            "       (select max(h.timestamp) from handle h where h.aircraft_id = a.id),"
+            "       (select count(*) from light l where l.aircraft_id = a.id),"
+            "       (select max(l.timestamp) from light l where l.aircraft_id = a.id) "
+            "from   aircraft a "
+            "where  a.flight_id = :flight_id "
+            "order by a.seq_nr;"
+        );
+        if (ok) {
+            query.bindValue(":flight_id", QVariant::fromValue(flightId));
+            ok = query.exec();
+        }
+        ::Checksum checksum;
+        while (ok && query.next()) {
+            // The aircraft ID and the count and last timestamp of the seven components
+            constexpr int ColumnCount {1 + 2 * static_cast<int>(::ComponentCount)};
+            std::array<std::int64_t, ColumnCount> values {};
+            for (int i = 0; i < ColumnCount; ++i) {
+                values[i] = query.value(i).toLongLong();
+            }
+            checksum.add(values.data(), sizeof(values));
+        }
+        // A logbook which cannot be queried never matches a cached flight
+        return ok ? checksum.result() : 0;
+    }
+
+    template <typename T, typename Codec>
+    void readSamples(const uchar *&data, std::uint64_t count, AbstractComponent<T, Codec> &component) noexcept
+    {
+        // The samples are trivially copyable and properly aligned in the mapped file
+        component.setData(reinterpret_cast<const T *>(data), count);
+        data += count * sizeof(T);
+    }
+}
+
+struct FlightCachePrivate
+{
+    FlightCachePrivate(QString cacheDirectoryPath, const QString &logbookId, QString connectionName = QString()) noexcept
+        : cacheDirectoryPath {logbookId.isEmpty() ? QString() : std::move(cacheDirectoryPath)},
+          logbookId {::toLogbookId(logbookId)},
+          connectionName {std::move(connectionName)}
+    {}
+
+    QString cacheDirectoryPath;
+    ::LogbookId logbookId;
+    // Empty if the cache is not bound to an open logbook connection
+    QString connectionName;
+
+    std::uint64_t getFingerprint(std::int64_t flightId) const noexcept
+    {
+        return !connectionName.isEmpty() ? ::selectFingerprint(QSqlDatabase::database(connectionName, false), flightId) : 0;
+    }
+};
+
+// PUBLIC
+
+FlightCache::FlightCache(QString cacheDirectoryPath, const QString &logbookId) noexcept
+    : d {std::make_unique<FlightCachePrivate>(std::move(cacheDirectoryPath), logbookId)}
+{}
+
+FlightCache::FlightCache(const QSqlDatabase &database) noexcept
+{
+    const QString cacheDirectoryPath = getDirectoryPath(database.databaseName());
+    // In-memory logbooks are not cached
+    const QString logbookId = !cacheDirectoryPath.isEmpty() ? ::selectLogbookId(database) : QString();
+    d = std::make_unique<FlightCachePrivate>(cacheDirectoryPath, logbookId, database.connectionName());
+}
+
+FlightCache::FlightCache(FlightCache &&rhs) noexcept = default;
+FlightCache &FlightCache::operator=(FlightCache &&rhs) noexcept = default;
+FlightCache::~FlightCache() = default;
+
+QString FlightCache::getDirectoryPath(const QString &logbookPath) noexcept
+{
+    QString directoryPath;
+    if (!logbookPath.isEmpty() && logbookPath != ::InMemoryDatabaseName) {
+        // Each logbook has its own cache directory, named after its path
+        const QByteArray logbookHash = QCryptographicHash::hash(QFileInfo(logbookPath).absoluteFilePath().toUtf8(), QCryptographicHash::Sha1).toHex().left(16);
+        directoryPath = QStandardPaths::writableLocation(QStandardPaths::CacheLocation) % "/" % ::CacheDirectoryName % "/" % QString::fromLatin1(logbookHash);
+    }
+    return directoryPath;
+}
+
+bool FlightCache::write(std::int64_t flightId, const std::vector<Aircraft> &aircraft) noexcept
+{
+    if (d->cacheDirectoryPath.isEmpty() || aircraft.empty()) {
+        return false;
+    }
+    const QString filePath = getFilePath(flightId);
+    QSaveFile file {filePath};
+    bool ok = QDir().mkpath(d->cacheDirectoryPath) && file.open(QIODevice::WriteOnly);
+
+    ::Header header;
+    header.logbookId = d->logbookId;
+    header.flightId = flightId;
+    header.fingerprint = d->getFingerprint(flightId);
+    header.aircraftCount = aircraft.size();
+    std::vector<::AircraftEntry> entries;
+    entries.reserve(aircraft.size());
+    for (const auto &a : aircraft) {
+        ::AircraftEntry entry;
+        entry.aircraftId = a.getId();
+        std::size_t component {0};
+        ::forEachComponent(a, [&entry, &component](const auto &c) {
+            entry.sampleCounts[component++] = c.count();
+        });
+        entries.push_back(entry);
+    }
+
+    // The header is written last, once the checksum is known
+    ::Checksum checksum;
+    if (ok) {
+        ok = file.seek(sizeof(::Header));
+    }
+    if (ok) {
+        const qint64 size = static_cast<qint64>(entries.size() * sizeof(::AircraftEntry));
+        checksum.add(entries.data(), entries.size() * sizeof(::AircraftEntry));
+        ok = file.write(reinterpret_cast<const char *>(entries.data()), size) == size;
+    }
+    for (auto it = aircraft.cbegin(); ok && it != aircraft.cend(); ++it) {
+        ::forEachComponent(*it, [&file, &checksum, &ok](const auto &c) {
+            ok = ok && ::writeSamples(file, c, checksum);
+        });
+    }
+    if (ok) {
+        header.payloadSize = static_cast<std::uint64_t>(file.pos()) - sizeof(::Header);
+        header.checksum = checksum.result();
+        ok = file.seek(0) && file.write(reinterpret_cast<const char *>(&header), sizeof(header)) == sizeof(header);
+    }
+    if (ok) {
+        ok = file.commit();
+    } else {
+        file.cancelWriting();
+    }
+#ifdef DEBUG
+    qDebug() << "FlightCache::write: flight ID:" << flightId << "cache file:" << filePath << "size:" << header.payloadSize + sizeof(::Header) << "success:" << ok;
+#endif
+    if (ok) {
+        evict(filePath);
+    }
+    return ok;
+}
+
+bool FlightCache::read(std::int64_t flightId, std::vector<Aircraft> &aircraft) noexcept
+{
+    if (d->cacheDirectoryPath.isEmpty() || aircraft.empty()) {
+        return false;
+    }
+    QFile file {getFilePath(flightId)};
+    bool ok = file.exists() && file.open(QIODevice::ReadOnly);
+    const qint64 fileSize = ok ? file.size() : 0;
+    ok = ok && fileSize >= static_cast<qint64>(sizeof(::Header));
+    const uchar *data {nullptr};
+    if (ok) {
+        data = file.map(0, fileSize);
+        ok = data != nullptr;
+    }
+
+    // Validate the entire file before any sampled data is replaced
+    ::Header header;
+    bool stale {false};
+    if (ok) {
+        std::memcpy(&header, data, sizeof(header));
+        const ::Header expected;
+        // Written for a previous logbook at the same path, or the flight has been modified in the logbook since
+        stale = header.magic == expected.magic && header.version == expected.version &&
+                (header.logbookId != d->logbookId || (header.flightId == flightId && header.fingerprint != d->getFingerprint(flightId)));
+        ok = !stale && header.magic == expected.magic && header.version == expected.version &&
+             header.sampleSizes == expected.sampleSizes && header.flightId == flightId &&
+             header.aircraftCount == aircraft.size() &&
+             header.payloadSize == static_cast<std::uint64_t>(fileSize) - sizeof(::Header) &&
+             header.payloadSize % sizeof(std::uint64_t) == 0 &&
+             header.payloadSize >= aircraft.size() * sizeof(::AircraftEntry);
+    }
+    std::vector<::AircraftEntry> entries(ok ? aircraft.size() : 0);
+    if (ok) {
+        std::memcpy(entries.data(), data + sizeof(::Header), entries.size() * sizeof(::AircraftEntry));
+        std::uint64_t payloadSize = entries.size() * sizeof(::AircraftEntry);
+        for (std::size_t i = 0; ok && i < entries.size(); ++i) {
+            ok = entries[i].aircraftId == aircraft[i].getId();
+            for (std::size_t component = 0; component < ::ComponentCount; ++component) {
+                payloadSize += entries[i].sampleCounts[component] * header.sampleSizes[component];
+            }
+        }
+        ok = ok && payloadSize == header.payloadSize;
+    }
+    if (ok) {
+        ::Checksum checksum;
+        checksum.add(data + sizeof(::Header), header.payloadSize);
+        ok = checksum.result() == header.checksum;
+    }
+
+    if (ok) {
+        const uchar *samples = data + sizeof(::Header) + entries.size() * sizeof(::AircraftEntry);
+        for (std::size_t i = 0; i < aircraft.size(); ++i) {
+            std::size_t component {0};
+            const auto &sampleCounts = entries[i].sampleCounts;
+            ::forEachComponent(aircraft[i], [&samples, &sampleCounts, &component](auto &c) {
+                ::readSamples(samples, sampleCounts[component++], c);
+            });
+        }
+        // Mark as recently used
+        file.setFileTime(QDateTime::currentDateTimeUtc(), QFileDevice::FileModificationTime);
+    }
+#ifdef DEBUG
+    qDebug() << "FlightCache::read: flight ID:" << flightId << "cache file:" << file.fileName() << "size:" << fileSize << "success:" << ok;
+#endif
+
+    if (data != nullptr) {
+        file.unmap(const_cast<uchar *>(data));
+    }
+    if (stale) {
+        file.remove();
+    }
+    return ok;
+}
+
+void FlightCache::invalidate(const std::vector<std::int64_t> &flightIds) noexcept
+{
+    for (const auto flightId : flightIds) {
+        invalidate(flightId);
+    }
+}
+
+void FlightCache::invalidate(std::int64_t flightId) noexcept
+{
+    if (!d->cacheDirectoryPath.isEmpty()) {
+        QFile::remove(getFilePath(flightId));
+    }
+}
+
+// PRIVATE
+
+QString FlightCache::getFilePath(std::int64_t flightId) const noexcept
+{
+    return d->cacheDirectoryPath % "/" % QString::number(flightId) % ::FileSuffix;
+}
+
+void FlightCache::evict(const QString &keptFilePath) noexcept
+{
+    const QDir directory {d->cacheDirectoryPath};
+    // Most recently used first
+    const auto fileInfos = directory.entryInfoList({QString("*") % ::FileSuffix}, QDir::Files, QDir::Time);
+    qint64 totalSize {0};
+    for (const auto &fileInfo : fileInfos) {
+        totalSize += fileInfo.size();
+        if (totalSize > ::MaxCacheSize && fileInfo.absoluteFilePath() != QFileInfo(keptFilePath).absoluteFilePath()) {
+            QFile::remove(fileInfo.absoluteFilePath());
+#ifdef DEBUG
+            qDebug() << "FlightCache::evict: removed cache file:" << fileInfo.absoluteFilePath();
+#endif
+        }
+    }
+}
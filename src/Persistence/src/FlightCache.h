@@ -0,0 +1,138 @@
+/**
+ * Sky Dolly - The Black Sheep for Your Flight Recordings
+ *
+ * Copyright (c) 2020 - 2025 Oliver Knoll
+ *
+ * MIT License
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this
+ * software and associated documentation files (the "Software"), to deal in the Software
+ * without restriction, including without limitation the rights to use, copy, modify, merge,
+ * publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons
+ * to whom the Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or
+ * substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED *AS IS*, WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR
+ * PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE
+ * FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+ * OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ */
+#ifndef FLIGHTCACHE_H
+#define FLIGHTCACHE_H
+
+#include <memory>
+#include <vector>
+#include <cstdint>
+
+#include <QString>
+
+class QSqlDatabase;
+
+class Aircraft;
+struct FlightCachePrivate;
+
+/*!
+ * A cache of the sampled data of recently stored or restored flights, one binary file per flight.
+ *
+ * The samples of each component are stored as contiguous arrays of the (trivially copyable)
+ * sample types, so restoring a cached flight merely memory-maps the cache file, verifies its
+ * checksum and copies the arrays in bulk into the components: no SQL queries and no value
+ * conversions are involved.
+ *
+ * A cache file is only valid for the exact same logbook identity, aircraft (IDs, in sequence order)
+ * and sample layout; the cache must explicitly be invalidated whenever the sampled data of a flight
+ * is modified or deleted in the logbook. Cache files of another logbook identity - e.g. written
+ * before the logbook has been re-created or restored from a backup at the same path - are removed
+ * upon read. When bound to a logbook connection the cache files also store a fingerprint of the
+ * sampled data in the logbook - the sample count and last timestamp of each component - so samples
+ * added or removed outside of the services equally invalidate the cached flight. The least recently
+ * used cache files are evicted once the cache exceeds its maximum size.
+ */
+class FlightCache final
+{
+public:
+    /*!
+     * Creates the flight cache located in the given \p cacheDirectoryPath, for the logbook
+     * with the given \p logbookId. An empty \p cacheDirectoryPath or \p logbookId yields a
+     * disabled cache: nothing is written nor found.
+     *
+     * \param cacheDirectoryPath
+     *        the directory containing the cache files
+     * \param logbookId
+     *        the identity of the logbook, as stored in its metadata
+     * \sa getDirectoryPath
+     */
+    FlightCache(QString cacheDirectoryPath, const QString &logbookId) noexcept;
+
+    /*!
+     * Creates the flight cache of the logbook opened by the given \p database connection. The
+     * cached flights are validated against the current sampled data in that logbook.
+     *
+     * \param database
+     *        the open logbook connection
+     */
+    explicit FlightCache(const QSqlDatabase &database) noexcept;
+    FlightCache(const FlightCache &rhs) = delete;
+    FlightCache(FlightCache &&rhs) noexcept;
+    FlightCache &operator=(const FlightCache &rhs) = delete;
+    FlightCache &operator=(FlightCache &&rhs) noexcept;
+    ~FlightCache();
+
+    /*!
+     * Returns the cache directory of the logbook given by \p logbookPath, in the cache
+     * location of the application.
+     *
+     * \param logbookPath
+     *        the path of the logbook
+     * \return the path of the cache directory; an empty path for in-memory logbooks
+     */
+    static QString getDirectoryPath(const QString &logbookPath) noexcept;
+
+    /*!
+     * Writes the sampled data of the \p aircraft of the flight with \p flightId into the cache,
+     * replacing any previously cached data of that flight.
+     *
+     * \param flightId
+     *        the ID of the flight
+     * \param aircraft
+     *        the aircraft of the flight, with valid IDs
+     * \return \c true if the sampled data has been written; \c false else
+     */
+    bool write(std::int64_t flightId, const std::vector<Aircraft> &aircraft) noexcept;
+
+    /*!
+     * Restores the sampled data of the \p aircraft of the flight with \p flightId from the cache.
+     * The position, attitude, engine, flight control, handle and light samples are replaced;
+     * the aircraft info and flight plan are left as is.
+     *
+     * \param flightId
+     *        the ID of the flight
+     * \param aircraft
+     *        the aircraft of the flight, with valid IDs in sequence order
+     * \return \c true if the sampled data has been restored; \c false if the flight is not cached,
+     *         the aircraft do not match or the cache file is corrupt, in which case the \p aircraft
+     *         are left unmodified
+     */
+    bool read(std::int64_t flightId, std::vector<Aircraft> &aircraft) noexcept;
+
+    /*!
+     * Removes the cached data of the flights with the given \p flightIds.
+     *
+     * \param flightIds
+     *        the IDs of the flights whose sampled data has been modified or deleted
+     */
+    void invalidate(const std::vector<std::int64_t> &flightIds) noexcept;
+    void invalidate(std::int64_t flightId) noexcept;
+
+private:
+    std::unique_ptr<FlightCachePrivate> d;
+
+    QString getFilePath(std::int64_t flightId) const noexcept;
+    void evict(const QString &keptFilePath) noexcept;
+};
+
+#endif // FLIGHTCACHE_H
@@ -24,6 +24,7 @@
 #include <memory>
 #include <utility>
 #include <mutex>
+#include <cstdint>
 
 #include <QString>
 #include <QStringBuilder>
@@ -40,10 +41,14 @@
 #include <Kernel/Const.h>
 #include <Kernel/Settings.h>
 #include <Kernel/Version.h>
+#include <Kernel/StartupProfile.h>
 #include <Model/Logbook.h>
 #include <Model/Flight.h>
 #include "Metadata.h"
+#include "LookupStatistics.h"
+#include "Dao/LookupCache.h"
 #include "Service/DatabaseService.h"
+#include "Service/RecordingJournalService.h"
 #include "PersistenceManager.h"
 
 struct PersistenceManagerPrivate
@@ -113,8 +118,12 @@ bool PersistenceManager::connectWithLogbook(const QString &logbookPath, QWidget
                         // We still migrate, even if the above version check indicates that the database is up to date
                         // (to make sure that we really do not miss any migration steps, in case the database version
                         // was "forgotten" to be updated during some prior migration)
+                        StartupProfile::Phase phase {"Migration"};
                         ok = d->databaseService->migrate();
                     }
+                    if (ok) {
+                        recoverUnfinishedRecordings(parent);
+                    }
                     retry = false;
                 } else {
                     disconnectFromLogbook();
@@ -163,6 +172,12 @@ bool PersistenceManager::connectWithLogbook(const QString &logbookPath, QWidget
 
 void PersistenceManager::disconnectFromLogbook() noexcept
 {
+#ifdef DEBUG
+    const LookupStatistics statistics = getLookupStatistics();
+    qDebug() << "PersistenceManager::disconnectFromLogbook: aircraft type lookups (hits/misses):"
+             << statistics.aircraftTypeHitCount << "/" << statistics.aircraftTypeMissCount
+             << "- enumeration lookups (hits/misses):" << statistics.enumerationHitCount << "/" << statistics.enumerationMissCount;
+#endif
     d->databaseService->disconnect(Connection::Default::Remove);
     d->logbookPath.clear();
     d->connected = false;
@@ -184,6 +199,11 @@ bool PersistenceManager::optimise() const noexcept
     return d->databaseService->optimise();
 }
 
+std::int64_t PersistenceManager::incrementalVacuum(int maxPageCount, bool *ok) const noexcept
+{
+    return d->databaseService->incrementalVacuum(maxPageCount, ok);
+}
+
 Metadata PersistenceManager::getMetadata(bool *ok) const noexcept
 {
     return d->databaseService->getMetadata(ok);
@@ -199,6 +219,11 @@ QString PersistenceManager::getBackupDirectoryPath(bool *ok) const noexcept
     return d->databaseService->getBackupDirectoryPath(ok);
 }
 
+LookupStatistics PersistenceManager::getLookupStatistics() const noexcept
+{
+    return LookupCache::getInstance(Const::DefaultConnectionName)->getStatistics();
+}
+
 // PRIVATE
 
 PersistenceManager::PersistenceManager() noexcept
@@ -213,3 +238,14 @@ PersistenceManager::~PersistenceManager()
 #endif
     disconnectFromLogbook();
 }
+
+void PersistenceManager::recoverUnfinishedRecordings(QWidget *parent) const noexcept
+{
+    RecordingJournalService recordingJournalService;
+    bool ok {true};
+    const std::int64_t count = recordingJournalService.recover(&ok);
+    if (ok && count > 0) {
+        QMessageBox::information(parent, tr("Recovered Recordings"),
+                                 tr("%n unfinished recording(s) from a previous session have been recovered into the logbook.", nullptr, static_cast<int>(count)));
+    }
+}
@@ -0,0 +1,358 @@
+/**
+ * Sky Dolly - The Black Sheep for Your Flight Recordings
+ *
+ * Copyright (c) 2020 - 2025 Oliver Knoll
+ *
+ * MIT License
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this
+ * software and associated documentation files (the "Software"), to deal in the Software
+ * without restriction, including without limitation the rights to use, copy, modify, merge,
+ * publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons
+ * to whom the Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or
+ * substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED *AS IS*, WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR
+ * PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE
+ * FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+ * OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ */
+#include <memory>
+#include <vector>
+#include <chrono>
+#include <cstdint>
+#include <cstddef>
+
+#include <QObject>
+#include <QString>
+#include <QTimer>
+#include <QThread>
+#include <QMetaObject>
+#ifdef DEBUG
+#include <QDebug>
+#endif
+
+#include <Kernel/Const.h>
+#include <Model/Logbook.h>
+#include <Model/Flight.h>
+#include <Model/FlightData.h>
+#include <Model/Aircraft.h>
+#include <Model/AbstractComponent.h>
+#include <Model/Position.h>
+#include <Model/Attitude.h>
+#include <Model/Engine.h>
+#include <Model/PrimaryFlightControl.h>
+#include <Model/SecondaryFlightControl.h>
+#include <Model/AircraftHandle.h>
+#include <Model/Light.h>
+#include <Model/FlightPlan.h>
+#include <Model/Waypoint.h>
+#include "Service/DatabaseService.h"
+#include "Service/RecordingJournalService.h"
+#include "Connection.h"
+#include "PersistenceManager.h"
+#include "RecordingJournal.h"
+
+namespace
+{
+    enum struct Mode: std::uint8_t
+    {
+        // Not journaling
+        Inactive,
+        // Journaling has been started, but no samples have been stored yet
+        Pending,
+        // The entire flight is being journaled
+        NewFlight,
+        // An aircraft added to an existing flight (formation) is being journaled
+        AddedAircraft
+    };
+
+    // Copies the samples of the given component which have not been journaled yet
+    template <typename T, typename Codec>
+    std::vector<T> takeComponentSamples(const AbstractComponent<T, Codec> &component, std::size_t &journaledCount, bool all) noexcept
+    {
+        std::vector<T> samples;
+        const std::size_t count = component.count();
+        // The last sample may still be replaced by a sample having the same timestamp (refer to
+        // AbstractComponent#upsertLast), so it is only journaled once the recording has stopped
+        const std::size_t end = all ? count : (count > 0 ? count - 1 : 0);
+        if (end > journaledCount) {
+            samples = component.copyData(journaledCount, end - journaledCount);
+            journaledCount = end;
+        }
+        return samples;
+    }
+
+    // Copies the flight values, but not the aircraft
+    FlightData copyFlightValues(const Flight &flight) noexcept
+    {
+        FlightData flightData;
+        flightData.id = flight.getId();
+        flightData.creationTime = flight.getCreationTime();
+        flightData.title = flight.getTitle();
+        flightData.description = flight.getDescription();
+        flightData.flightNumber = flight.getFlightNumber();
+        flightData.flightCondition = flight.getFlightCondition();
+        flightData.userAircraftIndex = flight.getUserAircraftIndex();
+        return flightData;
+    }
+}
+
+struct JournaledCounts
+{
+    std::size_t position {0};
+    std::size_t attitude {0};
+    std::size_t engine {0};
+    std::size_t primaryFlightControl {0};
+    std::size_t secondaryFlightControl {0};
+    std::size_t aircraftHandle {0};
+    std::size_t light {0};
+};
+
+struct RecordingJournalPrivate
+{
+    RecordingJournalPrivate() noexcept
+    {
+        context.moveToThread(&thread);
+    }
+
+    // Main thread
+    QTimer flushTimer;
+    Mode mode {Mode::Inactive};
+    std::size_t aircraftIndex {0};
+    JournaledCounts journaledCounts;
+
+    // Journal thread: the context object lives in the journal thread, and all database
+    // operations are executed in its context
+    QThread thread;
+    QObject context;
+    std::unique_ptr<DatabaseService> databaseService;
+    std::unique_ptr<RecordingJournalService> recordingJournalService;
+    std::int64_t flightId {Const::InvalidId};
+    std::int64_t aircraftId {Const::InvalidId};
+    // Set to false as soon as any batch could not be stored
+    bool ok {true};
+};
+
+// PUBLIC
+
+RecordingJournal::RecordingJournal(QObject *parent) noexcept
+    : QObject {parent},
+      d {std::make_unique<RecordingJournalPrivate>()}
+{
+    d->thread.setObjectName("RecordingJournal");
+    frenchConnection();
+}
+
+RecordingJournal::~RecordingJournal()
+{
+    // An unfinished journal is kept in the logbook and recovered the next time
+    // the logbook is opened
+    d->flushTimer.stop();
+    stopJournalThread();
+}
+
+void RecordingJournal::start(std::chrono::milliseconds interval) noexcept
+{
+    if (d->mode != Mode::Inactive) {
+        return;
+    }
+    d->mode = Mode::Pending;
+    d->journaledCounts = {};
+    if (!d->thread.isRunning()) {
+        d->thread.start(QThread::LowPriority);
+    }
+
+    const QString logbookPath = PersistenceManager::getInstance().getLogbookPath();
+    QMetaObject::invokeMethod(&d->context, [this, logbookPath]() {
+        d->flightId = Const::InvalidId;
+        d->aircraftId = Const::InvalidId;
+        d->databaseService = std::make_unique<DatabaseService>(Const::RecordingJournalConnectionName);
+        d->ok = d->databaseService->connect(logbookPath);
+        d->recordingJournalService = std::make_unique<RecordingJournalService>(Const::RecordingJournalConnectionName);
+    }, Qt::QueuedConnection);
+
+    d->flushTimer.start(interval);
+}
+
+bool RecordingJournal::isActive() const noexcept
+{
+    return d->mode != Mode::Inactive;
+}
+
+bool RecordingJournal::finish(Flight &flight) noexcept
+{
+    d->flushTimer.stop();
+    if (d->mode == Mode::Inactive) {
+        return false;
+    }
+
+    bool ok {false};
+    const bool hasBegun = d->mode == Mode::NewFlight || d->mode == Mode::AddedAircraft;
+    if (hasBegun && d->aircraftIndex < flight.count()) {
+        Aircraft &aircraft = flight[d->aircraftIndex];
+        const bool newFlight = d->mode == Mode::NewFlight;
+        std::shared_ptr<Aircraft> remaining = takeSamples(aircraft, true);
+        auto flightData = std::make_shared<FlightData>(::copyFlightValues(flight));
+        // Wait for all pending batches and store the remaining samples
+        QMetaObject::invokeMethod(&d->context, [this, &ok, remaining, flightData, newFlight]() {
+            if (d->ok) {
+                flightData->id = d->flightId;
+                ok = d->recordingJournalService->finish(*flightData, d->aircraftId, *remaining, newFlight);
+            }
+            if (!ok && d->aircraftId != Const::InvalidId) {
+                // Remove the incomplete data, the recording is to be stored entirely instead
+                d->recordingJournalService->discard(d->flightId, d->aircraftId, newFlight);
+            }
+        }, Qt::BlockingQueuedConnection);
+
+        if (ok) {
+            // The journal thread is idle now: the IDs may safely be read
+            aircraft.setId(d->aircraftId);
+            if (newFlight) {
+                flight.setId(d->flightId);
+                emit flight.flightStored(true);
+            } else {
+                emit flight.aircraftStored(true);
+            }
+        }
+    }
+
+    QMetaObject::invokeMethod(&d->context, [this]() {
+        d->recordingJournalService.reset();
+        if (d->databaseService != nullptr) {
+            d->databaseService->disconnect(Connection::Default::Remove);
+            d->databaseService.reset();
+        }
+    }, Qt::BlockingQueuedConnection);
+    d->mode = Mode::Inactive;
+
+#ifdef DEBUG
+    qDebug() << "RecordingJournal::finish: recording stored by journal:" << ok;
+#endif
+    return ok;
+}
+
+// PRIVATE
+
+void RecordingJournal::frenchConnection() noexcept
+{
+    connect(&d->flushTimer, &QTimer::timeout,
+            this, &RecordingJournal::flush);
+}
+
+bool RecordingJournal::begin(const Flight &flight) noexcept
+{
+    const Aircraft &aircraft = flight.getUserAircraft();
+    // Only start storing once the first samples have actually been recorded
+    if (!aircraft.hasRecording()) {
+        return false;
+    }
+
+    const std::int64_t flightId = flight.getId();
+    if (flightId == Const::RecordingId && flight.count() == 1) {
+        d->mode = Mode::NewFlight;
+    } else if (Flight::isValidId(flightId) && flight.getUserAircraftIndex() == static_cast<int>(flight.count()) - 1) {
+        // The recorded aircraft has been added to an already stored flight
+        d->mode = Mode::AddedAircraft;
+    } else {
+        // Unsupported: the recording will be stored entirely once stopped
+        return false;
+    }
+    d->aircraftIndex = static_cast<std::size_t>(flight.getUserAircraftIndex());
+
+    std::shared_ptr<Aircraft> batch = takeSamples(aircraft, false);
+    if (d->mode == Mode::NewFlight) {
+        auto flightData = std::make_shared<FlightData>(::copyFlightValues(flight));
+        flightData->userAircraftIndex = 0;
+        flightData->aircraft.push_back(std::move(*batch));
+        QMetaObject::invokeMethod(&d->context, [this, flightData]() {
+            if (d->ok) {
+                d->ok = d->recordingJournalService->beginFlight(*flightData);
+                if (d->ok) {
+                    d->flightId = flightData->id;
+                    d->aircraftId = (*flightData)[0].getId();
+                }
+            }
+        }, Qt::QueuedConnection);
+    } else {
+        // Sequence numbers start at 1
+        const std::size_t sequenceNumber = d->aircraftIndex + 1;
+        QMetaObject::invokeMethod(&d->context, [this, flightId, sequenceNumber, batch]() {
+            if (d->ok) {
+                d->ok = d->recordingJournalService->beginAircraft(flightId, sequenceNumber, *batch);
+                if (d->ok) {
+                    d->flightId = flightId;
+                    d->aircraftId = batch->getId();
+                }
+            }
+        }, Qt::QueuedConnection);
+    }
+    return true;
+}
+
+std::shared_ptr<Aircraft> RecordingJournal::takeSamples(const Aircraft &aircraft, bool all) noexcept
+{
+    auto batch = std::make_shared<Aircraft>();
+    batch->setAircraftInfo(aircraft.getAircraftInfo());
+    auto &counts = d->journaledCounts;
+    batch->getPosition().setData(::takeComponentSamples(aircraft.getPosition(), counts.position, all));
+    batch->getAttitude().setData(::takeComponentSamples(aircraft.getAttitude(), counts.attitude, all));
+    batch->getEngine().setData(::takeComponentSamples(aircraft.getEngine(), counts.engine, all));
+    batch->getPrimaryFlightControl().setData(::takeComponentSamples(aircraft.getPrimaryFlightControl(), counts.primaryFlightControl, all));
+    batch->getSecondaryFlightControl().setData(::takeComponentSamples(aircraft.getSecondaryFlightControl(), counts.secondaryFlightControl, all));
+    batch->getAircraftHandle().setData(::takeComponentSamples(aircraft.getAircraftHandle(), counts.aircraftHandle, all));
+    batch->getLight().setData(::takeComponentSamples(aircraft.getLight(), counts.light, all));
+    // The flight plan recorded so far replaces the stored one with each batch
+    for (const auto &waypoint : aircraft.getFlightPlan()) {
+        batch->getFlightPlan().add(waypoint);
+    }
+    return batch;
+}
+
+void RecordingJournal::stopJournalThread() noexcept
+{
+    if (d->thread.isRunning()) {
+        QMetaObject::invokeMethod(&d->context, [this]() {
+            d->recordingJournalService.reset();
+            if (d->databaseService != nullptr) {
+                d->databaseService->disconnect(Connection::Default::Remove);
+                d->databaseService.reset();
+            }
+        }, Qt::BlockingQueuedConnection);
+        d->thread.quit();
+        d->thread.wait();
+    }
+}
+
+// PRIVATE SLOTS
+
+void RecordingJournal::flush() noexcept
+{
+    const auto &flight = Logbook::getInstance().getCurrentFlight();
+    switch (d->mode) {
+    case Mode::Pending:
+        if (!begin(flight)) {
+            // Try again with the next flush
+            return;
+        }
+        break;
+    case Mode::NewFlight:
+    case Mode::AddedAircraft:
+        if (d->aircraftIndex < flight.count()) {
+            std::shared_ptr<Aircraft> batch = takeSamples(flight[d->aircraftIndex], false);
+            QMetaObject::invokeMethod(&d->context, [this, batch]() {
+                if (d->ok) {
+                    d->ok = d->recordingJournalService->append(d->aircraftId, *batch);
+                }
+            }, Qt::QueuedConnection);
+        }
+        break;
+    case Mode::Inactive:
+        break;
+    }
+}
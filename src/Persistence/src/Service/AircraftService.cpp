@@ -31,9 +31,15 @@
 #include <Kernel/Const.h>
 #include <Model/Aircraft.h>
 #include <Model/Logbook.h>
+#include <Model/Position.h>
+#include <Model/PositionData.h>
+#include <Model/TrackSimplification.h>
 #include "../Dao/FlightDaoIntf.h"
 #include "../Dao/DaoFactory.h"
+#include "../Dao/LookupCache.h"
 #include "../Dao/AircraftDaoIntf.h"
+#include "../Dao/PositionDaoIntf.h"
+#include "../FlightCache.h"
 #include <Service/AircraftService.h>
 
 struct AircraftServicePrivate
@@ -42,13 +48,15 @@ struct AircraftServicePrivate
         : connectionName(connectionName),
           daoFactory(std::make_unique<DaoFactory>(DaoFactory::DbType::SQLite, std::move(connectionName))),
           aircraftDao(daoFactory->createAircraftDao()),
-          flightDao(daoFactory->createFlightDao())
+          flightDao(daoFactory->createFlightDao()),
+          positionDao(daoFactory->createPositionDao())
     {}
 
     QString connectionName;
     std::unique_ptr<DaoFactory> daoFactory;
     std::unique_ptr<AircraftDaoIntf> aircraftDao;
     std::unique_ptr<FlightDaoIntf> flightDao;
+    std::unique_ptr<PositionDaoIntf> positionDao;
 };
 
 // PUBLIC
@@ -67,15 +75,21 @@ bool AircraftService::store(std::int64_t flightId, std::size_t sequenceNumber, A
     bool ok = db.transaction();
     if (ok) {
         auto &flight = Logbook::getInstance().getCurrentFlight();
+        FlightCache flightCache {db};
+        flightCache.invalidate(flightId);
         ok = d->aircraftDao->add(flightId, sequenceNumber, aircraft);
         if (ok) {
             ok = d->flightDao->updateUserAircraftIndex(flight.getId(), flight.getUserAircraftIndex());
         }
         if (ok) {
-            ok = db.commit();            
+            ok = db.commit();
         } else {
             db.rollback();
         }
+        if (!ok) {
+            // Aircraft types cached by the failed transaction may not have been stored
+            LookupCache::invalidate(d->connectionName);
+        }
         emit flight.aircraftStored(ok);
     }
     return ok;
@@ -96,6 +110,10 @@ bool AircraftService::exportAircraft(std::int64_t flightId, std::size_t sequence
         } else {
             db.rollback();
         }
+        if (!ok) {
+            // Aircraft types cached by the failed transaction may not have been stored
+            LookupCache::invalidate(d->connectionName);
+        }
         emit flight.aircraftStored(ok);
     }
     return ok;
@@ -110,6 +128,8 @@ bool AircraftService::deleteByIndex(int index) noexcept
         QSqlDatabase db {QSqlDatabase::database(d->connectionName)};
         ok = db.transaction();
         if (ok) {
+            FlightCache flightCache {db};
+            flightCache.invalidate(flight.getId());
             ok = d->aircraftDao->deleteById(aircraftId);
             if (ok) {
                 ok = d->flightDao->updateUserAircraftIndex(flight.getId(), flight.getUserAircraftIndex());
@@ -196,3 +216,42 @@ bool AircraftService::changeTailNumber(Aircraft &aircraft, const QString &tailNu
     }
     return ok;
 }
+
+bool AircraftService::compactPositionData(Aircraft &aircraft, double maxDeviation) noexcept
+{
+    bool ok {false};
+    const std::int64_t aircraftId = aircraft.getId();
+    if (aircraftId != Const::InvalidId && maxDeviation > 0.0) {
+        Position &position = aircraft.getPosition();
+        const std::vector<PositionData> positionData(position.cbegin(), position.cend());
+        std::vector<PositionData> simplifiedData = TrackSimplification::simplify(positionData, maxDeviation);
+        if (simplifiedData.size() == positionData.size()) {
+            // Nothing to compact
+            return true;
+        }
+        if (aircraftId != Const::RecordingId) {
+            QSqlDatabase db {QSqlDatabase::database(d->connectionName)};
+            ok = db.transaction();
+            if (ok) {
+                // The simplified aircraft belongs to the current flight
+                FlightCache flightCache {db};
+                flightCache.invalidate(Logbook::getInstance().getCurrentFlight().getId());
+                ok = d->positionDao->deleteByAircraftId(aircraftId);
+                for (auto it = simplifiedData.cbegin(); ok && it != simplifiedData.cend(); ++it) {
+                    ok = d->positionDao->add(aircraftId, *it);
+                }
+                if (ok) {
+                    ok = db.commit();
+                } else {
+                    db.rollback();
+                }
+            }
+        } else {
+            ok = true;
+        }
+        if (ok) {
+            position.setData(std::move(simplifiedData));
+        }
+    }
+    return ok;
+}
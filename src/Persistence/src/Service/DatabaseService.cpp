@@ -23,6 +23,7 @@
  */
 #include <memory>
 #include <cstdint>
+#include <functional>
 
 #include <QCoreApplication>
 #include <QString>
@@ -37,13 +38,21 @@
 #include <QCoreApplication>
 #include <QSqlDatabase>
 #include <QDateTime>
+#include <QFile>
+#include <QFuture>
+#include <QFutureWatcher>
+#include <QEventLoop>
+#include <QtConcurrentRun>
 
 #include <Kernel/Settings.h>
 #include <Kernel/Const.h>
+#include <Kernel/Trace.h>
 #include <Model/Logbook.h>
 #include <Service/EnumerationService.h>
 #include <Service/DatabaseService.h>
 #include <Migration.h>
+#include <Backup.h>
+#include "../BackupStore.h"
 #include "../Dao/DaoFactory.h"
 #include "../Dao/DatabaseDaoIntf.h"
 #include "PersistedEnumerationItem.h"
@@ -58,6 +67,36 @@ namespace
     constexpr int BackupPeriodOneDay = 1;
 
     constexpr const char *DefaultBackupDirectory {"./Backups"};
+
+    // Deduplicated backups are created in two phases of equal progress weight:
+    // copying the logbook and adding the copy to the backup store
+    constexpr std::int64_t PhaseProgress {1000};
+
+    Backup::ProgressCallback getPhaseProgress(const Backup::ProgressCallback &progress, int phase) noexcept
+    {
+        if (!progress) {
+            return {};
+        }
+        return [&progress, phase](std::int64_t done, std::int64_t total) {
+            const std::int64_t phaseDone = total > 0 ? done * ::PhaseProgress / total : ::PhaseProgress;
+            return progress(phase * ::PhaseProgress + phaseDone, 2 * ::PhaseProgress);
+        };
+    }
+
+    // Runs the function on a worker thread while the calling thread keeps processing events
+    bool runConcurrently(const std::function<bool()> &function, bool processUserInput) noexcept
+    {
+        QFuture<bool> future = QtConcurrent::run(function);
+        QFutureWatcher<bool> futureWatcher;
+        QEventLoop eventLoop;
+        QObject::connect(&futureWatcher, &QFutureWatcher<bool>::finished,
+                         &eventLoop, &QEventLoop::quit);
+        futureWatcher.setFuture(future);
+        if (!future.isFinished()) {
+            eventLoop.exec(processUserInput ? QEventLoop::AllEvents : QEventLoop::ExcludeUserInputEvents);
+        }
+        return future.result();
+    }
 }
 
 struct DatabaseServicePrivate
@@ -147,6 +186,7 @@ std::pair<bool, Version> DatabaseService::checkDatabaseVersion() const noexcept
 
 bool DatabaseService::migrate(Migration::Milestones milestones) noexcept
 {
+    Trace::Scope trace {Trace::Migration, "Migrate"};
     return d->databaseDao->migrate(milestones);
 }
 
@@ -155,7 +195,12 @@ bool DatabaseService::optimise() const noexcept
     return d->databaseDao->optimise();
 }
 
-bool DatabaseService::backup(const QString &logbookPath, BackupMode backupMode) noexcept
+std::int64_t DatabaseService::incrementalVacuum(int maxPageCount, bool *ok) const noexcept
+{
+    return d->databaseDao->incrementalVacuum(maxPageCount, ok);
+}
+
+bool DatabaseService::backup(const QString &logbookPath, BackupMode backupMode, const Backup::ProgressCallback &progress) noexcept
 {
     bool ok {true};
     QString absoluteOrRelativeBackupPath = getBackupDirectoryPath(&ok);
@@ -171,11 +216,28 @@ bool DatabaseService::backup(const QString &logbookPath, BackupMode backupMode)
     }
     ok = !backupDirectoryPath.isNull();
     if (ok) {
-        const QString backupFileName = getBackupFileName(logbookPath, backupDirectoryPath);
+        // Backups before migration remain full logbook copies, which can be opened right away
+        const bool deduplicate = backupMode == BackupMode::Normal && Settings::getInstance().isBackupDeduplicationEnabled();
+        const QString backupFileName = getBackupFileName(logbookPath, backupDirectoryPath, deduplicate ? Const::DotBackupExtension : Const::DotLogbookExtension);
         if (!backupFileName.isNull()) {
             const QString backupFilePath = backupDirectoryPath + "/" + backupFileName;
             // No transaction must be active during backup
-            ok = d->databaseDao->backup(backupFilePath);
+            if (deduplicate) {
+                // The consistent copy of the logbook is only temporary: it is split into chunks which
+                // are added to the backup store, while the backup file itself is the manifest
+                const QString logbookCopyPath = backupFilePath % Const::DotLogbookExtension;
+                ok = d->databaseDao->backup(logbookCopyPath, ::getPhaseProgress(progress, 0));
+                if (ok) {
+                    const Backup::ProgressCallback storeProgress = ::getPhaseProgress(progress, 1);
+                    ok = ::runConcurrently([&backupDirectoryPath, &logbookCopyPath, &backupFilePath, &storeProgress]() {
+                        BackupStore backupStore {backupDirectoryPath};
+                        return backupStore.add(logbookCopyPath, backupFilePath, storeProgress);
+                    }, static_cast<bool>(progress));
+                }
+                QFile::remove(logbookCopyPath);
+            } else {
+                ok = d->databaseDao->backup(backupFilePath, progress);
+            }
             if (ok) {
                 ok = setBackupDirectoryPath(backupDirectoryPath);
             }
@@ -350,17 +412,26 @@ QString DatabaseService::getNewLogbookPath(QWidget *parent) noexcept
     return newLogbookPath;
 }
 
-QString DatabaseService::getBackupFileName(const QString &logbookPath, const QString &backupDirectoryPath) noexcept
+bool DatabaseService::restoreBackup(const QString &backupFilePath, const QString &logbookPath, const Backup::ProgressCallback &progress) noexcept
+{
+    const QString backupDirectoryPath = QFileInfo(backupFilePath).absolutePath();
+    return ::runConcurrently([&backupDirectoryPath, &backupFilePath, &logbookPath, &progress]() {
+        BackupStore backupStore {backupDirectoryPath};
+        return backupStore.restore(backupFilePath, logbookPath, progress);
+    }, static_cast<bool>(progress));
+}
+
+QString DatabaseService::getBackupFileName(const QString &logbookPath, const QString &backupDirectoryPath, const char *extension) noexcept
 {
     const QDir backupDir {backupDirectoryPath};
 
     const QFileInfo logbookInfo = QFileInfo(logbookPath);
     const QString baseName = logbookInfo.completeBaseName();
     const QString baseBackupLogbookName = baseName + "-" + QDateTime::currentDateTime().toString("yyyy-MM-dd hhmm");
-    QString backupLogbookName = baseBackupLogbookName % Const::DotLogbookExtension;
+    QString backupLogbookName = baseBackupLogbookName % extension;
     int index = 1;
     while (backupDir.exists(backupLogbookName) && index <= ::MaxBackupIndex) {
-        backupLogbookName = baseBackupLogbookName % QStringLiteral("-%1").arg(index) % Const::DotLogbookExtension;
+        backupLogbookName = baseBackupLogbookName % QStringLiteral("-%1").arg(index) % extension;
         ++index;
     }
     return (index <= ::MaxBackupIndex) ? backupLogbookName : QString();
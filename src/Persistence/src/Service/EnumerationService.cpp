@@ -27,6 +27,7 @@
 
 #include <Model/Enumeration.h>
 #include "../Dao/DaoFactory.h"
+#include "../Dao/LookupCache.h"
 #include "../Dao/EnumerationDaoIntf.h"
 #include <Service/EnumerationService.h>
 
@@ -35,12 +36,14 @@ struct EnumerationServicePrivate
     EnumerationServicePrivate(QString connectionName) noexcept
         : connectionName(connectionName),
           daoFactory(std::make_unique<DaoFactory>(DaoFactory::DbType::SQLite, std::move(connectionName))),
-          enumerationDao(daoFactory->createEnumerationDao())
+          enumerationDao(daoFactory->createEnumerationDao()),
+          lookupCache(LookupCache::getInstance(this->connectionName))
     {}
 
     QString connectionName;
     std::unique_ptr<DaoFactory> daoFactory;
     std::unique_ptr<EnumerationDaoIntf> enumerationDao;
+    std::shared_ptr<LookupCache> lookupCache;
 };
 
 // PUBLIC
@@ -56,12 +59,18 @@ EnumerationService::~EnumerationService() = default;
 Enumeration EnumerationService::getEnumerationByName(const QString &name, Enumeration::Order order, bool *ok)
 {
     Enumeration enumeration;
-    QSqlDatabase db {QSqlDatabase::database(d->connectionName)};
-    bool success = db.transaction();
-    if (success) {
+    bool success {false};
+    if (d->lookupCache->containsEnumeration(name, order)) {
+        // No transaction required for a cached enumeration
         enumeration = d->enumerationDao->get(name, order, &success);
+    } else {
+        QSqlDatabase db {QSqlDatabase::database(d->connectionName)};
+        success = db.transaction();
+        if (success) {
+            enumeration = d->enumerationDao->get(name, order, &success);
+        }
+        db.rollback();
     }
-    db.rollback();
     if (ok != nullptr) {
         *ok = success;
     }
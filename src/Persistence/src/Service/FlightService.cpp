@@ -23,19 +23,49 @@
  */
 #include <memory>
 #include <utility>
+#include <vector>
+#include <algorithm>
+#include <cstddef>
 #include <cstdint>
 
 #include <QSqlDatabase>
 #include <QSqlError>
 
+#include <Kernel/Settings.h>
 #include <Model/Logbook.h>
 #include <Model/Flight.h>
 #include <Model/FlightData.h>
 #include <Model/Aircraft.h>
 #include "../Dao/DaoFactory.h"
+#include "../Dao/LookupCache.h"
 #include "../Dao/FlightDaoIntf.h"
+#include "../FlightCache.h"
 #include <Service/FlightService.h>
 
+namespace
+{
+    // Compactly encodes the sampled data of all aircraft of the given flight
+    void compact(FlightData &flightData) noexcept
+    {
+#ifdef DEBUG
+        std::size_t memoryUsage {0};
+        for (const auto &aircraft : flightData) {
+            memoryUsage += aircraft.getMemoryUsage();
+        }
+#endif
+        for (auto &aircraft : flightData) {
+            aircraft.compact();
+        }
+#ifdef DEBUG
+        std::size_t compactMemoryUsage {0};
+        for (const auto &aircraft : flightData) {
+            compactMemoryUsage += aircraft.getMemoryUsage();
+        }
+        qDebug() << "FlightService::restoreFlight: sample memory:" << memoryUsage << "bytes, compactly encoded:" << compactMemoryUsage << "bytes";
+#endif
+    }
+}
+
 struct FlightServicePrivate
 {
     FlightServicePrivate(QString connectionName) noexcept
@@ -63,6 +93,11 @@ bool FlightService::storeFlight(Flight &flight) noexcept
 {
     FlightData &flightData = flight.getFlightData();
     const bool ok = storeFlightData(flightData);
+    if (ok) {
+        // The recorded flight is likely to be replayed again
+        FlightCache flightCache {QSqlDatabase::database(d->connectionName)};
+        flightCache.write(flightData.id, flightData.aircraft);
+    }
     emit flight.flightStored(ok);
     return ok;
 }
@@ -78,6 +113,10 @@ bool FlightService::storeFlightData(FlightData &flightData) noexcept
         } else {
             db.rollback();
         }
+        if (!ok) {
+            // Aircraft types cached by the failed transaction may not have been stored
+            LookupCache::invalidate(d->connectionName);
+        }
 #ifdef DEBUG
     } else {
         qDebug() << "FlightService::storeFlightData: SQL error:" << db.lastError().text() << "- error code:" << db.lastError().nativeErrorCode();
@@ -97,6 +136,10 @@ bool FlightService::exportFlightData(const FlightData &flightData) noexcept
         } else {
             db.rollback();
         }
+        if (!ok) {
+            // Aircraft types cached by the failed transaction may not have been stored
+            LookupCache::invalidate(d->connectionName);
+        }
 #ifdef DEBUG
     } else {
         qDebug() << "FlightService::exportFlightData: SQL error:" << db.lastError().text() << "- error code:" << db.lastError().nativeErrorCode();
@@ -112,6 +155,9 @@ bool FlightService::restoreFlight(std::int64_t id, Flight &flight) noexcept
     if (ok) {
         FlightData &flightData = flight.getFlightData();
         ok = d->flightDao->get(id, flightData);
+        if (ok && Settings::getInstance().isCompactSampleMemoryEnabled()) {
+            ::compact(flightData);
+        }
         emit flight.flightRestored(flight.getId());
         db.rollback();
 #ifdef DEBUG
@@ -146,6 +192,8 @@ bool FlightService::deleteById(std::int64_t id) const noexcept
         if (flight.getId() == id) {
             flight.clear(true, FlightData::CreationTimeMode::Reset);
         }
+        FlightCache flightCache {db};
+        flightCache.invalidate(id);
         ok = d->flightDao->deleteById(id);
         if (ok) {
             ok = db.commit();
@@ -160,6 +208,31 @@ bool FlightService::deleteById(std::int64_t id) const noexcept
     return ok;
 }
 
+bool FlightService::deleteByIds(const std::vector<std::int64_t> &ids) const noexcept
+{
+    QSqlDatabase db {QSqlDatabase::database(d->connectionName)};
+    bool ok = db.transaction();
+    if (ok) {
+        auto &flight = Logbook::getInstance().getCurrentFlight();
+        if (std::find(ids.cbegin(), ids.cend(), flight.getId()) != ids.cend()) {
+            flight.clear(true, FlightData::CreationTimeMode::Reset);
+        }
+        FlightCache flightCache {db};
+        flightCache.invalidate(ids);
+        ok = d->flightDao->deleteByIds(ids);
+        if (ok) {
+            ok = db.commit();
+        } else {
+            db.rollback();
+        }
+#ifdef DEBUG
+    } else {
+        qDebug() << "FlightService::deleteByIds: SQL error:" << db.lastError().text() << "- error code:" << db.lastError().nativeErrorCode();
+#endif
+    }
+    return ok;
+}
+
 bool FlightService::updateTitle(Flight &flight, const QString &title) const noexcept
 {
     bool ok {false};
@@ -0,0 +1,294 @@
+/**
+ * Sky Dolly - The Black Sheep for Your Flight Recordings
+ *
+ * Copyright (c) 2020 - 2025 Oliver Knoll
+ *
+ * MIT License
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this
+ * software and associated documentation files (the "Software"), to deal in the Software
+ * without restriction, including without limitation the rights to use, copy, modify, merge,
+ * publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons
+ * to whom the Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or
+ * substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED *AS IS*, WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR
+ * PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE
+ * FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+ * OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ */
+#include <memory>
+#include <vector>
+#include <utility>
+#include <cstdint>
+#include <cstddef>
+
+#include <QSqlDatabase>
+#include <QSqlError>
+#ifdef DEBUG
+#include <QDebug>
+#endif
+
+#include <Kernel/Const.h>
+#include <Model/FlightData.h>
+#include <Model/Aircraft.h>
+#include <Model/AircraftInfo.h>
+#include <Model/FlightPlan.h>
+#include <Model/FlightCondition.h>
+#include <Model/Position.h>
+#include <Model/PositionData.h>
+#include "../Dao/DaoFactory.h"
+#include "../Dao/LookupCache.h"
+#include "../Dao/FlightDaoIntf.h"
+#include "../Dao/AircraftDaoIntf.h"
+#include "../Dao/WaypointDaoIntf.h"
+#include "../Dao/RecordingJournalDaoIntf.h"
+#include "../FlightCache.h"
+#include <Service/RecordingJournalService.h>
+
+struct RecordingJournalServicePrivate
+{
+    RecordingJournalServicePrivate(QString connectionName) noexcept
+        : connectionName(connectionName),
+          daoFactory(std::make_unique<DaoFactory>(DaoFactory::DbType::SQLite, std::move(connectionName))),
+          flightDao(daoFactory->createFlightDao()),
+          aircraftDao(daoFactory->createAircraftDao()),
+          waypointDao(daoFactory->createFlightPlanDao()),
+          recordingJournalDao(daoFactory->createRecordingJournalDao())
+    {}
+
+    QString connectionName;
+    std::unique_ptr<DaoFactory> daoFactory;
+    std::unique_ptr<FlightDaoIntf> flightDao;
+    std::unique_ptr<AircraftDaoIntf> aircraftDao;
+    std::unique_ptr<WaypointDaoIntf> waypointDao;
+    std::unique_ptr<RecordingJournalDaoIntf> recordingJournalDao;
+
+    bool replaceFlightPlan(std::int64_t aircraftId, const FlightPlan &flightPlan) const noexcept
+    {
+        bool ok = waypointDao->deleteByAircraftId(aircraftId);
+        if (ok) {
+            ok = waypointDao->add(aircraftId, flightPlan);
+        }
+        return ok;
+    }
+
+    bool finishRecovered(const RecordingJournalEntry &entry) const noexcept
+    {
+        FlightCache flightCache {QSqlDatabase::database(connectionName)};
+        flightCache.invalidate(entry.flightId);
+        if (!entry.newFlight) {
+            // The flight values of the existing flight remain valid
+            return true;
+        }
+        FlightData flightData;
+        bool ok = flightDao->get(entry.flightId, flightData);
+        if (ok && flightData.count() > 0) {
+            // The end of the flight is given by the last stored sample, just like for imported flights
+            const Position &position = flightData[0].getPosition();
+            if (position.count() > 0) {
+                const std::int64_t timestamp = position.getLast().timestamp;
+                FlightCondition &flightCondition = flightData.flightCondition;
+                flightCondition.setEndLocalDateTime(flightCondition.getStartLocalDateTime().addMSecs(timestamp));
+                flightCondition.setEndZuluDateTime(flightCondition.getStartZuluDateTime().addMSecs(timestamp));
+                ok = flightDao->update(flightData);
+            }
+        }
+        return ok;
+    }
+};
+
+// PUBLIC
+
+RecordingJournalService::RecordingJournalService(QString connectionName) noexcept
+    : d {std::make_unique<RecordingJournalServicePrivate>(std::move(connectionName))}
+{}
+
+RecordingJournalService::RecordingJournalService(RecordingJournalService &&rhs) noexcept = default;
+RecordingJournalService &RecordingJournalService::operator=(RecordingJournalService &&rhs) noexcept = default;
+RecordingJournalService::~RecordingJournalService() = default;
+
+bool RecordingJournalService::beginFlight(FlightData &flightData) noexcept
+{
+    QSqlDatabase db {QSqlDatabase::database(d->connectionName)};
+    bool ok = db.transaction();
+    if (ok) {
+        ok = flightData.count() == 1 && d->flightDao->add(flightData);
+        if (ok) {
+            ok = d->recordingJournalDao->add(flightData.id, flightData[0].getId(), true);
+        }
+        if (ok) {
+            ok = db.commit();
+        } else {
+            db.rollback();
+        }
+        if (!ok) {
+            // Aircraft types cached by the failed transaction may not have been stored
+            LookupCache::invalidate(d->connectionName);
+        }
+#ifdef DEBUG
+    } else {
+        qDebug() << "RecordingJournalService::beginFlight: SQL error:" << db.lastError().text() << "- error code:" << db.lastError().nativeErrorCode();
+#endif
+    }
+    return ok;
+}
+
+bool RecordingJournalService::beginAircraft(std::int64_t flightId, std::size_t sequenceNumber, Aircraft &aircraft) noexcept
+{
+    QSqlDatabase db {QSqlDatabase::database(d->connectionName)};
+    bool ok = db.transaction();
+    if (ok) {
+        // An aircraft is added to the (possibly cached) flight
+        FlightCache flightCache {db};
+        flightCache.invalidate(flightId);
+        ok = d->aircraftDao->add(flightId, sequenceNumber, aircraft);
+        if (ok) {
+            ok = d->recordingJournalDao->add(flightId, aircraft.getId(), false);
+        }
+        if (ok) {
+            ok = db.commit();
+        } else {
+            db.rollback();
+        }
+        if (!ok) {
+            // Aircraft types cached by the failed transaction may not have been stored
+            LookupCache::invalidate(d->connectionName);
+        }
+#ifdef DEBUG
+    } else {
+        qDebug() << "RecordingJournalService::beginAircraft: SQL error:" << db.lastError().text() << "- error code:" << db.lastError().nativeErrorCode();
+#endif
+    }
+    return ok;
+}
+
+bool RecordingJournalService::append(std::int64_t aircraftId, const Aircraft &aircraft) noexcept
+{
+    QSqlDatabase db {QSqlDatabase::database(d->connectionName)};
+    bool ok = db.transaction();
+    if (ok) {
+        ok = d->aircraftDao->addSampledData(aircraftId, aircraft);
+        if (ok) {
+            // Keep the aircraft info and the flight plan recorded so far, should the recording never be finished
+            ok = d->aircraftDao->updateAircraftInfo(aircraftId, aircraft.getAircraftInfo());
+        }
+        if (ok) {
+            ok = d->replaceFlightPlan(aircraftId, aircraft.getFlightPlan());
+        }
+        if (ok) {
+            ok = db.commit();
+        } else {
+            db.rollback();
+        }
+        if (!ok) {
+            // Aircraft types cached by the failed transaction may not have been stored
+            LookupCache::invalidate(d->connectionName);
+        }
+#ifdef DEBUG
+    } else {
+        qDebug() << "RecordingJournalService::append: SQL error:" << db.lastError().text() << "- error code:" << db.lastError().nativeErrorCode();
+#endif
+    }
+    return ok;
+}
+
+bool RecordingJournalService::finish(const FlightData &flightData, std::int64_t aircraftId, const Aircraft &aircraft, bool newFlight) noexcept
+{
+    QSqlDatabase db {QSqlDatabase::database(d->connectionName)};
+    bool ok = db.transaction();
+    if (ok) {
+        // The aircraft samples and the flight values change
+        FlightCache flightCache {db};
+        flightCache.invalidate(flightData.id);
+        ok = d->aircraftDao->addSampledData(aircraftId, aircraft);
+        if (ok) {
+            ok = d->aircraftDao->updateAircraftInfo(aircraftId, aircraft.getAircraftInfo());
+        }
+        if (ok) {
+            ok = d->replaceFlightPlan(aircraftId, aircraft.getFlightPlan());
+        }
+        if (ok) {
+            ok = newFlight ? d->flightDao->update(flightData)
+                           : d->flightDao->updateUserAircraftIndex(flightData.id, flightData.userAircraftIndex);
+        }
+        if (ok) {
+            ok = d->recordingJournalDao->deleteByAircraftId(aircraftId);
+        }
+        if (ok) {
+            ok = db.commit();
+        } else {
+            db.rollback();
+        }
+        if (!ok) {
+            // Aircraft types cached by the failed transaction may not have been stored
+            LookupCache::invalidate(d->connectionName);
+        }
+#ifdef DEBUG
+    } else {
+        qDebug() << "RecordingJournalService::finish: SQL error:" << db.lastError().text() << "- error code:" << db.lastError().nativeErrorCode();
+#endif
+    }
+    return ok;
+}
+
+bool RecordingJournalService::discard(std::int64_t flightId, std::int64_t aircraftId, bool newFlight) noexcept
+{
+    QSqlDatabase db {QSqlDatabase::database(d->connectionName)};
+    bool ok = db.transaction();
+    if (ok) {
+        FlightCache flightCache {db};
+        flightCache.invalidate(flightId);
+        ok = d->recordingJournalDao->deleteByAircraftId(aircraftId);
+        if (ok) {
+            ok = newFlight ? d->flightDao->deleteById(flightId) : d->aircraftDao->deleteById(aircraftId);
+        }
+        if (ok) {
+            ok = db.commit();
+        } else {
+            db.rollback();
+        }
+#ifdef DEBUG
+    } else {
+        qDebug() << "RecordingJournalService::discard: SQL error:" << db.lastError().text() << "- error code:" << db.lastError().nativeErrorCode();
+#endif
+    }
+    return ok;
+}
+
+std::int64_t RecordingJournalService::recover(bool *ok) noexcept
+{
+    std::int64_t count {0};
+    QSqlDatabase db {QSqlDatabase::database(d->connectionName)};
+    bool success = db.transaction();
+    if (success) {
+        // The samples, the aircraft info and the flight plan of each batch have been committed
+        // atomically, so the data stored so far is consistent: keep it as a regular recording
+        const std::vector<RecordingJournalEntry> entries = d->recordingJournalDao->getAll(&success);
+        for (auto it = entries.cbegin(); success && it != entries.cend(); ++it) {
+            success = d->finishRecovered(*it);
+        }
+        if (success && !entries.empty()) {
+            success = d->recordingJournalDao->deleteAll();
+        }
+        count = static_cast<std::int64_t>(entries.size());
+        if (success) {
+            success = db.commit();
+        } else {
+            db.rollback();
+            count = 0;
+        }
+#ifdef DEBUG
+    } else {
+        qDebug() << "RecordingJournalService::recover: SQL error:" << db.lastError().text() << "- error code:" << db.lastError().nativeErrorCode();
+#endif
+    }
+    if (ok != nullptr) {
+        *ok = success;
+    }
+    return count;
+}
@@ -37,6 +37,9 @@ class QWidget;
 #include <Kernel/Settings.h>
 #include <Model/InitialPosition.h>
 #include "SkyConnectIntf.h"
+#include "ReplayStatistics.h"
+#include "CaptureStatistics.h"
+#include "FrameSnapshot.h"
 #include "ConnectPluginBaseSettings.h"
 #include "Connect.h"
 #include "../PluginBase.h"
@@ -47,6 +50,8 @@ class Flight;
 class Aircraft;
 struct FlightSimulatorShortcuts;
 class ConnectPluginBaseSettings;
+class ReplayScheduler;
+class CaptureQueue;
 struct AbstractSkyConnectPrivate;
 
 class PLUGINMANAGER_API AbstractSkyConnect : public SkyConnectIntf, public PluginBase
@@ -109,6 +114,8 @@ public:
 
     float getReplaySpeedFactor() const noexcept override;
     void setReplaySpeedFactor(float factor) noexcept override;
+    ReplayStatistics getReplayStatistics() const noexcept override;
+    CaptureStatistics getCaptureStatistics() const noexcept override;
 
     bool requestLocation() noexcept override;
     bool requestSimulationRate() noexcept override;
@@ -147,6 +154,55 @@ protected:
 
     void createAiObjects() noexcept;
 
+    /*!
+     * Returns the scheduler which paces the replay frames on a dedicated thread. Connect
+     * plugins which are not driven by frame events of the flight simulator itself start
+     * the scheduler when the replay starts and send the aircraft data upon each
+     * ReplayScheduler#frameDue signal.
+     *
+     * \return the ReplayScheduler of this connection
+     */
+    ReplayScheduler &getReplayScheduler() const noexcept;
+
+    /*!
+     * Returns the queue into which the connect plugins push the sample data captured during
+     * recording, instead of appending it to the user aircraft directly. The queued samples are
+     * appended to the user aircraft by #drainCaptureQueue, which the plugins call synchronously
+     * after having processed the received simulator data, and when the recording is paused or
+     * stopped.
+     *
+     * \return the CaptureQueue of this connection
+     */
+    CaptureQueue &getCaptureQueue() const noexcept;
+
+    /*!
+     * Appends the samples which have been pushed into the CaptureQueue to the user aircraft.
+     *
+     * \sa getCaptureQueue
+     */
+    void drainCaptureQueue() noexcept;
+
+    /*!
+     * Interpolates the sampled data of the aircraft given by \p aircraftSelection for the
+     * given \p timestamp. Large formations are interpolated in parallel, with one task per
+     * aircraft: each task only accesses the components of its own aircraft.
+     *
+     * The returned snapshot remains valid until the next call of this method.
+     *
+     * \param timestamp
+     *        the timestamp of the frame [milliseconds]
+     * \param access
+     *        the way the sampled data is accessed
+     * \param aircraftSelection
+     *        the aircraft to be interpolated: all aircraft or the user aircraft only
+     * \param skipUserAircraft
+     *        set to \c true in order not to interpolate the user aircraft (which is then not part of the
+     *        snapshot), e.g. while it is being recorded or manually flown
+     * \return the interpolated FrameSnapshot, in the order of the aircraft in the flight
+     */
+    const FrameSnapshot &updateFrameSnapshot(std::int64_t timestamp, TimeVariableData::Access access, AircraftSelection aircraftSelection,
+                                             bool skipUserAircraft = false) noexcept;
+
     // Re-implement
     virtual ConnectPluginBaseSettings &getPluginSettings() const noexcept = 0;
     virtual std::optional<std::unique_ptr<OptionWidgetIntf>> createExtendedOptionWidget() const noexcept = 0;
@@ -255,8 +311,16 @@ private:
     // and the maximum simulation rate, as defined in the application settings
     float getApplicableSimulationRate() const noexcept;
 
+    // Interpolates the pending continuous seek request in the background
+    void startSeekInterpolation() noexcept;
+    // Drops any pending continuous seek request and waits for the background interpolation to finish
+    void cancelSeekInterpolation() noexcept;
+    void sendSeekData(std::int64_t timestamp, TimeVariableData::Access access) noexcept;
+
 private slots:
     void onReconnectTimer() noexcept;
+    // Sends the interpolated aircraft data of the newest continuous seek request
+    void onSeekInterpolated() noexcept;
     void retryConnectAndSetup(Connect::Mode mode) noexcept;
 
     // Updates the simulation date and time, based on the start and end flight date and time of the current flight.
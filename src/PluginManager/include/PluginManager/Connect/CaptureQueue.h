@@ -0,0 +1,122 @@
+/**
+ * Sky Dolly - The Black Sheep for Your Flight Recordings
+ *
+ * Copyright (c) 2020 - 2025 Oliver Knoll
+ *
+ * MIT License
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this
+ * software and associated documentation files (the "Software"), to deal in the Software
+ * without restriction, including without limitation the rights to use, copy, modify, merge,
+ * publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons
+ * to whom the Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or
+ * substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED *AS IS*, WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR
+ * PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE
+ * FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+ * OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ */
+#ifndef CAPTUREQUEUE_H
+#define CAPTUREQUEUE_H
+
+#include <memory>
+#include <cstddef>
+
+#include "CaptureStatistics.h"
+#include "DeadbandTolerance.h"
+#include "../PluginManagerLib.h"
+
+class Aircraft;
+struct PositionData;
+struct AttitudeData;
+struct EngineData;
+struct PrimaryFlightControlData;
+struct SecondaryFlightControlData;
+struct AircraftHandleData;
+struct LightData;
+struct CaptureQueuePrivate;
+
+/*!
+ * Collects the sample data captured from the simulator and appends it to the recorded aircraft.
+ *
+ * The connect plugins push the captured (timestamped) samples, one buffer per sample type, while
+ * processing the received simulator data. The buffered samples are then appended to the aircraft
+ * in one batch, synchronously after each dispatch. Buffers grow as needed, so no samples are ever
+ * dropped.
+ *
+ * The queue is not thread-safe: pushing and draining must happen on the thread which owns the flight.
+ *
+ * Optionally the samples are reduced by adaptive (deadband) sampling when being appended: samples
+ * which do not leave the tolerance band of the previously appended sample are skipped.
+ *
+ * \sa DeadbandTolerance
+ */
+class PLUGINMANAGER_API CaptureQueue final
+{
+public:
+    CaptureQueue() noexcept;
+    CaptureQueue(const CaptureQueue &rhs) = delete;
+    CaptureQueue(CaptureQueue &&rhs) = delete;
+    CaptureQueue &operator=(const CaptureQueue &rhs) = delete;
+    CaptureQueue &operator=(CaptureQueue &&rhs) = delete;
+    ~CaptureQueue();
+
+    void push(const PositionData &positionData) noexcept;
+    void push(const AttitudeData &attitudeData) noexcept;
+    void push(const EngineData &engineData) noexcept;
+    void push(const PrimaryFlightControlData &primaryFlightControlData) noexcept;
+    void push(const SecondaryFlightControlData &secondaryFlightControlData) noexcept;
+    void push(const AircraftHandleData &aircraftHandleData) noexcept;
+    void push(const LightData &lightData) noexcept;
+
+    /*!
+     * Appends all buffered samples to the corresponding components of the given \p aircraft,
+     * in the order in which they have been captured.
+     *
+     * \param aircraft
+     *        the aircraft being recorded
+     * \return the number of appended samples
+     */
+    std::size_t drain(Aircraft &aircraft) noexcept;
+
+    /*!
+     * Appends the samples which have been held back by the adaptive sampling to the given
+     * \p aircraft. To be called at the end of the recording, after the last #drain.
+     *
+     * \param aircraft
+     *        the aircraft being recorded
+     * \return the number of appended samples
+     * \sa setAdaptiveSamplingEnabled
+     */
+    std::size_t flush(Aircraft &aircraft) noexcept;
+
+    /*!
+     * Discards all buffered and held back samples.
+     */
+    void discard() noexcept;
+
+    /*!
+     * Enables the adaptive (deadband) sampling with the given \p tolerance. To be called
+     * before the recording starts.
+     *
+     * \param enable
+     *        set to \c true in order to only append samples which leave the tolerance band;
+     *        \c false in order to append all captured samples
+     * \param tolerance
+     *        the tolerances of the adaptive sampling
+     */
+    void setAdaptiveSamplingEnabled(bool enable, const DeadbandTolerance &tolerance = {}) noexcept;
+
+    CaptureStatistics getStatistics() const noexcept;
+    void resetStatistics() noexcept;
+
+private:
+    const std::unique_ptr<CaptureQueuePrivate> d;
+};
+
+#endif // CAPTUREQUEUE_H
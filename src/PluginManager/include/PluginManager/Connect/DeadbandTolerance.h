@@ -0,0 +1,81 @@
+/**
+ * Sky Dolly - The Black Sheep for Your Flight Recordings
+ *
+ * Copyright (c) 2020 - 2025 Oliver Knoll
+ *
+ * MIT License
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this
+ * software and associated documentation files (the "Software"), to deal in the Software
+ * without restriction, including without limitation the rights to use, copy, modify, merge,
+ * publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons
+ * to whom the Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or
+ * substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED *AS IS*, WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR
+ * PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE
+ * FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+ * OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ */
+#ifndef DEADBANDTOLERANCE_H
+#define DEADBANDTOLERANCE_H
+
+#include <cstdint>
+
+/*!
+ * The tolerances of the adaptive (deadband) sampling during recording.
+ *
+ * A captured sample is only kept when at least one of its values leaves the tolerance band
+ * around the previously kept sample, or when the maximum sample interval has expired. Discrete
+ * values (light states, battery and starter switches, gear handle etc.) are kept whenever
+ * they change.
+ *
+ * The default tolerances are below the precision which is noticeable on replay, so sample
+ * data which remains (nearly) constant, such as lights, handles and the position of a parked
+ * aircraft, is reduced to one sample per maximum sample interval.
+ */
+struct DeadbandTolerance
+{
+    /*!
+     * The latitude and longitude tolerance [degrees]; roughly one centimetre.
+     */
+    double positionDegrees {1e-7};
+
+    /*!
+     * The altitude tolerance [feet]; roughly one centimetre.
+     */
+    double altitudeFeet {0.03};
+
+    /*!
+     * The pitch, bank and heading tolerance [degrees].
+     */
+    double attitudeDegrees {0.01};
+
+    /*!
+     * The body velocity tolerance [feet per second].
+     */
+    double velocityFeetPerSecond {0.01};
+
+    /*!
+     * The flight control surface deflection tolerance [radians].
+     */
+    float deflectionRadians {1e-4f};
+
+    /*!
+     * The tolerance of the lever, control and flaps positions [position units];
+     * 0 means that any change is recorded.
+     */
+    std::int16_t position {0};
+
+    /*!
+     * The maximum time between two kept samples [milliseconds]. In order for the sample data to be
+     * interpolated on replay this interval must not exceed SkySearch::DefaultInterpolationWindow.
+     */
+    std::int64_t maxIntervalMSec {1000};
+};
+
+#endif // DEADBANDTOLERANCE_H
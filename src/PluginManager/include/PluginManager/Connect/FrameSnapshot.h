@@ -0,0 +1,63 @@
+/**
+ * Sky Dolly - The Black Sheep for Your Flight Recordings
+ *
+ * Copyright (c) 2020 - 2025 Oliver Knoll
+ *
+ * MIT License
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this
+ * software and associated documentation files (the "Software"), to deal in the Software
+ * without restriction, including without limitation the rights to use, copy, modify, merge,
+ * publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons
+ * to whom the Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or
+ * substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED *AS IS*, WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR
+ * PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE
+ * FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+ * OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ */
+#ifndef FRAMESNAPSHOT_H
+#define FRAMESNAPSHOT_H
+
+#include <vector>
+#include <cstdint>
+#include <cstddef>
+
+#include <Kernel/Const.h>
+#include <Model/PositionData.h>
+#include <Model/AttitudeData.h>
+#include <Model/EngineData.h>
+#include <Model/PrimaryFlightControlData.h>
+#include <Model/SecondaryFlightControlData.h>
+#include <Model/AircraftHandleData.h>
+#include <Model/LightData.h>
+
+/*!
+ * The interpolated sample data of a single aircraft, for a given replay frame.
+ */
+struct AircraftSnapshot
+{
+    // The index of the aircraft in the flight
+    std::size_t aircraftIndex {0};
+    std::int64_t aircraftId {Const::InvalidId};
+    PositionData position;
+    AttitudeData attitude;
+    EngineData engine;
+    PrimaryFlightControlData primaryFlightControl;
+    SecondaryFlightControlData secondaryFlightControl;
+    AircraftHandleData aircraftHandle;
+    LightData light;
+};
+
+/*!
+ * The interpolated sample data of all selected aircraft for a given replay frame,
+ * stored contiguously in the order of the aircraft in the flight.
+ */
+using FrameSnapshot = std::vector<AircraftSnapshot>;
+
+#endif // FRAMESNAPSHOT_H
@@ -0,0 +1,97 @@
+/**
+ * Sky Dolly - The Black Sheep for Your Flight Recordings
+ *
+ * Copyright (c) 2020 - 2025 Oliver Knoll
+ *
+ * MIT License
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this
+ * software and associated documentation files (the "Software"), to deal in the Software
+ * without restriction, including without limitation the rights to use, copy, modify, merge,
+ * publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons
+ * to whom the Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or
+ * substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED *AS IS*, WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR
+ * PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE
+ * FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+ * OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ */
+#ifndef REPLAYSCHEDULER_H
+#define REPLAYSCHEDULER_H
+
+#include <memory>
+#include <cstdint>
+
+#include <QObject>
+
+#include "../PluginManagerLib.h"
+
+struct ReplaySchedulerPrivate;
+
+/*!
+ * Paces replay frames on a dedicated thread with a high-resolution clock.
+ *
+ * Frame deadlines are absolute multiples of the frame period since the start,
+ * so delays in delivering one frame do not accumulate ("drift compensation").
+ * At most one frame is pending delivery at any time: if the previous frame has
+ * not yet been processed by the time the next one is due (e.g. because the event
+ * loop is busy with UI work) the frame is skipped instead of being queued up.
+ */
+class PLUGINMANAGER_API ReplayScheduler final : public QObject
+{
+    Q_OBJECT
+public:
+    explicit ReplayScheduler(QObject *parent = nullptr) noexcept;
+    ReplayScheduler(const ReplayScheduler &rhs) = delete;
+    ReplayScheduler(ReplayScheduler &&rhs) = delete;
+    ReplayScheduler &operator=(const ReplayScheduler &rhs) = delete;
+    ReplayScheduler &operator=(ReplayScheduler &&rhs) = delete;
+    ~ReplayScheduler() override;
+
+    /*!
+     * Starts pacing frames with the given \p frequency. Any already running pacing
+     * is stopped first.
+     *
+     * \param frequency
+     *        the frame frequency [Hz]; must be > 0
+     * \sa frameDue
+     */
+    void start(int frequency) noexcept;
+
+    /*!
+     * Stops pacing frames. A pending frame is discarded.
+     */
+    void stop() noexcept;
+
+    bool isActive() const noexcept;
+
+    /*!
+     * Returns the number of frames skipped since the last call of #resetSkippedFrameCount.
+     *
+     * \return the number of skipped frames
+     */
+    std::uint64_t getSkippedFrameCount() const noexcept;
+    void resetSkippedFrameCount() noexcept;
+
+signals:
+    /*!
+     * Emitted in the thread of this scheduler object (typically the main thread)
+     * when the next frame is due.
+     */
+    void frameDue();
+
+private:
+    const std::unique_ptr<ReplaySchedulerPrivate> d;
+
+    void run() noexcept;
+
+private slots:
+    void onFrameReady() noexcept;
+};
+
+#endif // REPLAYSCHEDULER_H
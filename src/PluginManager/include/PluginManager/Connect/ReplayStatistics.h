@@ -0,0 +1,77 @@
+/**
+ * Sky Dolly - The Black Sheep for Your Flight Recordings
+ *
+ * Copyright (c) 2020 - 2025 Oliver Knoll
+ *
+ * MIT License
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this
+ * software and associated documentation files (the "Software"), to deal in the Software
+ * without restriction, including without limitation the rights to use, copy, modify, merge,
+ * publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons
+ * to whom the Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or
+ * substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED *AS IS*, WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR
+ * PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE
+ * FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+ * OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ */
+#ifndef REPLAYSTATISTICS_H
+#define REPLAYSTATISTICS_H
+
+#include <cstdint>
+
+#include <Kernel/Histogram.h>
+
+/*!
+ * Frame timing telemetry, collected during replay.
+ */
+struct ReplayStatistics
+{
+    /*!
+     * The intervals between two consecutively replayed frames [milliseconds],
+     * in 0.5 ms buckets up to 100 ms.
+     */
+    Histogram frameIntervals {0.5, 200};
+
+    /*!
+     * The jitter, that is the absolute difference between two consecutive
+     * frame intervals [milliseconds], in 0.25 ms buckets up to 50 ms.
+     */
+    Histogram jitter {0.25, 200};
+
+    /*!
+     * The number of frames the replay scheduler had to skip, because the
+     * previous frame had not yet been processed in time.
+     */
+    std::uint64_t skippedFrames {0};
+
+    /*!
+     * The latency between a continuous seek request (e.g. dragging the position slider)
+     * and the moment its interpolated aircraft data has been sent [milliseconds], in 1 ms
+     * buckets up to 200 ms.
+     */
+    Histogram seekLatencies {1.0, 200};
+
+    /*!
+     * The number of continuous seek requests which have been dropped, because a newer
+     * seek request arrived before they could be applied.
+     */
+    std::uint64_t supersededSeeks {0};
+
+    inline void clear() noexcept
+    {
+        frameIntervals.clear();
+        jitter.clear();
+        skippedFrames = 0;
+        seekLatencies.clear();
+        supersededSeeks = 0;
+    }
+};
+
+#endif // REPLAYSTATISTICS_H
@@ -37,6 +37,8 @@
 #include <Model/TimeZoneInfo.h>
 #include "Connect.h"
 #include "FlightSimulatorShortcuts.h"
+#include "ReplayStatistics.h"
+#include "CaptureStatistics.h"
 #include "../PluginIntf.h"
 #include "../PluginWithOptionWidgetIntf.h"
 #include "../PluginManagerLib.h"
@@ -306,6 +308,22 @@ public:
 
     virtual float getReplaySpeedFactor() const noexcept = 0;
 
+    /*!
+     * Returns the frame timing statistics of the current (or last) replay. The statistics
+     * are reset whenever a replay is started.
+     *
+     * \return the ReplayStatistics of the current replay
+     */
+    virtual ReplayStatistics getReplayStatistics() const noexcept = 0;
+
+    /*!
+     * Returns the statistics of the sample capture of the current (or last) recording. The
+     * statistics are reset whenever a recording is started.
+     *
+     * \return the CaptureStatistics of the current recording
+     */
+    virtual CaptureStatistics getCaptureStatistics() const noexcept = 0;
+
     /*!
      * Sets the replay speed factor. It is at the discretion of the connect plugin
      * implementation to also set the simulation rate accordingly (if supported by
@@ -102,7 +102,22 @@ public:
         return QString::number(number, 'f', NumberPrecision);
     }
 
-    static std::vector<PositionData> resamplePositionDataForExport(const Aircraft &aircraft, const SampleRate::ResamplingPeriod resamplingPeriod) noexcept;
+    /*!
+     * Resamples the position data of the given \p aircraft with the \p resamplingPeriod and optionally
+     * simplifies the resulting track, such that it deviates at most \p maxDeviation meters from the
+     * resampled position data (when connected by straight lines, as typically done by the applications
+     * displaying the exported tracks).
+     *
+     * \param aircraft
+     *        the aircraft whose position data is to be exported
+     * \param resamplingPeriod
+     *        the resampling period
+     * \param maxDeviation
+     *        the maximum deviation of the simplified track [meters]; 0.0: no simplification
+     * \return the resampled (and simplified) position data
+     * \sa TrackSimplification
+     */
+    static std::vector<PositionData> resamplePositionDataForExport(const Aircraft &aircraft, const SampleRate::ResamplingPeriod resamplingPeriod, double maxDeviation = 0.0) noexcept;
     static std::vector<EngineData> resampleEngineDataForExport(const Aircraft &aircraft, const SampleRate::ResamplingPeriod resamplingPeriod) noexcept;
     static std::vector<PrimaryFlightControlData> resamplePrimaryFlightControlDataForExport(const Aircraft &aircraft, const SampleRate::ResamplingPeriod resamplingPeriod) noexcept;
     static std::vector<SecondaryFlightControlData> resampleSecondaryFlightControlDataForExport(const Aircraft &aircraft, const SampleRate::ResamplingPeriod resamplingPeriod) noexcept;
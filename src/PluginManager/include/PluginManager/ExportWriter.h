@@ -0,0 +1,261 @@
+/**
+ * Sky Dolly - The Black Sheep for Your Flight Recordings
+ *
+ * Copyright (c) 2020 - 2025 Oliver Knoll
+ *
+ * MIT License
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this
+ * software and associated documentation files (the "Software"), to deal in the Software
+ * without restriction, including without limitation the rights to use, copy, modify, merge,
+ * publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons
+ * to whom the Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or
+ * substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED *AS IS*, WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR
+ * PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE
+ * FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+ * OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ */
+#ifndef EXPORTWRITER_H
+#define EXPORTWRITER_H
+
+#include <memory>
+#include <algorithm>
+#include <string_view>
+#include <charconv>
+#include <cstdint>
+#include <cstddef>
+#include <cstdio>
+
+#include <QByteArray>
+
+class QIODevice;
+class QString;
+class QDateTime;
+
+#include <Kernel/Unit.h>
+#include "Export.h"
+#include "PluginManagerLib.h"
+
+/*!
+ * A buffered UTF-8 text writer for the flight exporters: the text is formatted directly into a
+ * large block buffer, which is written to the underlying QIODevice once it is full, instead of
+ * creating (and converting) a QString for each exported sample.
+ *
+ * Numbers are formatted with std::to_chars, with the same fixed precisions as the Export
+ * formatting functions. Timestamps are formatted relative to a base date and time (as given
+ * by #setBaseDateTime), typically the start time of the exported aircraft.
+ *
+ * Any write error is remembered; the last block is written by #flush (or when the writer is
+ * destroyed), which returns whether all text has been written successfully.
+ */
+class PLUGINMANAGER_API ExportWriter final
+{
+public:
+    /*! The default size of the write blocks [bytes] */
+    static constexpr std::size_t DefaultBlockSize {1024 * 1024};
+
+    /*!
+     * Creates the writer which writes into the \p io device, in blocks of \p blockSize bytes.
+     * The blocks are enlarged as needed, should a single formatted value not fit into an
+     * empty block.
+     *
+     * \param io
+     *        the IO device to write to; already opened for writing
+     * \param blockSize
+     *        the size of the write blocks [bytes]
+     */
+    explicit ExportWriter(QIODevice &io, std::size_t blockSize = DefaultBlockSize) noexcept;
+    ExportWriter(const ExportWriter &rhs) = delete;
+    ExportWriter(ExportWriter &&rhs) = delete;
+    ExportWriter &operator=(const ExportWriter &rhs) = delete;
+    ExportWriter &operator=(ExportWriter &&rhs) = delete;
+    ~ExportWriter();
+
+    inline ExportWriter &append(char c) noexcept
+    {
+        if (m_size == m_capacity) {
+            writeBlock();
+        }
+        m_buffer[m_size] = c;
+        ++m_size;
+        return *this;
+    }
+
+    inline ExportWriter &append(std::string_view text) noexcept
+    {
+        if (m_size + text.size() > m_capacity) {
+            writeBlock();
+            if (text.size() > m_capacity) {
+                writeDirectly(text);
+                return *this;
+            }
+        }
+        std::copy(text.cbegin(), text.cend(), m_buffer.get() + m_size);
+        m_size += text.size();
+        return *this;
+    }
+
+    inline ExportWriter &append(const char *text) noexcept
+    {
+        return append(std::string_view(text));
+    }
+
+    inline ExportWriter &append(const QByteArray &text) noexcept
+    {
+        return append(std::string_view(text.constData(), static_cast<std::size_t>(text.size())));
+    }
+
+    /*!
+     * Appends the \p text, encoded as UTF-8.
+     */
+    ExportWriter &append(const QString &text) noexcept;
+
+    /*!
+     * Appends the integer \p value in decimal notation, zero-padded to at least \p width
+     * characters (including the sign of negative values).
+     */
+    inline ExportWriter &appendInteger(std::int64_t value, int width = 0) noexcept
+    {
+        reserve(MaxIntegerLength + std::max(width, 0));
+        char *first = m_buffer.get() + m_size;
+        char *last = first;
+        if (value < 0) {
+            *last++ = '-';
+            --width;
+        }
+        char digits[MaxIntegerLength];
+        // Negate as unsigned, which is also well-defined for the minimum value
+        const std::uint64_t magnitude = value < 0 ? 0 - static_cast<std::uint64_t>(value) : static_cast<std::uint64_t>(value);
+        const auto result = std::to_chars(digits, digits + MaxIntegerLength, magnitude);
+        const int digitCount = static_cast<int>(result.ptr - digits);
+        for (int i = digitCount; i < width; ++i) {
+            *last++ = '0';
+        }
+        last = std::copy(digits, result.ptr, last);
+        m_size += static_cast<std::size_t>(last - first);
+        return *this;
+    }
+
+    /*!
+     * Appends the \p value in fixed notation with \p precision decimals, exactly like
+     * QString::number(value, 'f', precision).
+     */
+    inline ExportWriter &appendFixed(double value, int precision) noexcept
+    {
+        // Including the terminating null character written by std::snprintf
+        reserve(MaxFixedLength + precision + 1);
+        char *first = m_buffer.get() + m_size;
+#if defined(__cpp_lib_to_chars) && __cpp_lib_to_chars >= 201611L
+        const auto result = std::to_chars(first, first + MaxFixedLength + precision, value, std::chars_format::fixed, precision);
+        m_size += static_cast<std::size_t>(result.ptr - first);
+#else
+        // Floating point std::to_chars is not available on all platforms yet
+        const int length = std::snprintf(first, MaxFixedLength + precision + 1, "%.*f", precision, value);
+        m_size += length > 0 ? static_cast<std::size_t>(length) : 0;
+#endif
+        return *this;
+    }
+
+    /*!
+     * Appends the GNSS \p coordinate (latitude or longitude), like Export#formatCoordinate.
+     */
+    inline ExportWriter &appendCoordinate(double coordinate) noexcept
+    {
+        return appendFixed(coordinate, Unit::CoordinatePrecision);
+    }
+
+    /*!
+     * Appends the general \p number (e.g. altitude or heading), like Export#formatNumber.
+     */
+    inline ExportWriter &appendNumber(double number) noexcept
+    {
+        return appendFixed(number, Export::NumberPrecision);
+    }
+
+    /*!
+     * Sets the base date and time, relative to which the timestamps are formatted by
+     * #appendIsoDateTime and #appendTime. The timestamps are always formatted in UTC.
+     *
+     * \param dateTime
+     *        the base date and time; typically the start time of the exported aircraft
+     */
+    void setBaseDateTime(const QDateTime &dateTime) noexcept;
+
+    /*!
+     * Appends the base date and time plus \p timestamp milliseconds in the ISO 8601 format,
+     * exactly like QDateTime::toString(Qt::ISODate) or QDateTime::toString(Qt::ISODateWithMs)
+     * for UTC date and times, e.g. 2024-10-11T20:20:00Z. Nothing is appended if the base date
+     * and time is not valid.
+     *
+     * \param timestamp
+     *        the timestamp relative to the base date and time [milliseconds]
+     * \param withMilliseconds
+     *        set to \c true in order to append the milliseconds as well
+     * \sa setBaseDateTime
+     */
+    ExportWriter &appendIsoDateTime(std::int64_t timestamp, bool withMilliseconds = false) noexcept;
+
+    /*!
+     * Appends the time of day of the base date and time plus \p timestamp milliseconds in the
+     * compact format hhmmss, e.g. 202000. Nothing is appended if the base date and time is not
+     * valid.
+     *
+     * \param timestamp
+     *        the timestamp relative to the base date and time [milliseconds]
+     * \sa setBaseDateTime
+     */
+    ExportWriter &appendTime(std::int64_t timestamp) noexcept;
+
+    /*!
+     * Writes the buffered text to the IO device.
+     *
+     * \return \c true if all text has been written successfully so far; \c false else
+     */
+    bool flush() noexcept;
+
+private:
+    // Large enough for any 64 bit integer, including the sign
+    static constexpr int MaxIntegerLength {21};
+    // Large enough for the integral part of any double in fixed notation, including the sign and decimal point
+    static constexpr int MaxFixedLength {312};
+    // The number of characters cached for the date part: YYYY-MM-DDT
+    static constexpr int DateLength {11};
+
+    QIODevice &m_io;
+    std::unique_ptr<char[]> m_buffer;
+    std::size_t m_capacity;
+    std::size_t m_size {0};
+    bool m_ok {true};
+
+    // The base date and time [milliseconds since the epoch, UTC]
+    std::int64_t m_baseMSecsSinceEpoch {0};
+    bool m_hasBaseDateTime {false};
+    // The day (since the epoch) of the cached date part, which is only re-formatted when the day changes
+    std::int64_t m_cachedDay {0};
+    bool m_hasCachedDay {false};
+    char m_cachedDate[DateLength] {};
+
+    inline void reserve(int length) noexcept
+    {
+        const auto size = static_cast<std::size_t>(length);
+        if (m_size + size > m_capacity) {
+            writeBlock();
+            if (size > m_capacity) {
+                grow(size);
+            }
+        }
+    }
+
+    void grow(std::size_t capacity) noexcept;
+    void writeBlock() noexcept;
+    void writeDirectly(std::string_view text) noexcept;
+    void updateCachedDate(std::int64_t day) noexcept;
+};
+
+#endif // EXPORTWRITER_H
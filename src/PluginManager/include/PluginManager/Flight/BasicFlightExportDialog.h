@@ -88,6 +88,7 @@ private slots:
     void onFilePathChanged();
     void onFormationExportChanged() noexcept;
     void onResamplingOptionChanged() noexcept;
+    void onSimplificationChanged(double maxDeviation) noexcept;
     void onDoOpenExportedFilesChanged(bool enable) noexcept;
     void onRestoreDefaults() noexcept;
 };
@@ -26,15 +26,50 @@
 
 #include <QtPlugin>
 
+class QIODevice;
+
 #include "../PluginIntf.h"
 #include "../DialogPluginIntf.h"
 
 class Flight;
+struct FlightData;
+class Aircraft;
 
 class FlightExportIntf : public DialogPluginIntf, public PluginIntf
 {
 public:
     virtual bool exportFlight(const Flight &flight) const noexcept = 0;
+
+    /*!
+     * Exports all aircraft of the \p flightData into the given \p io data sink, without
+     * any user interaction.
+     *
+     * The data sink \p io must have been properly opened for writing already.
+     *
+     * \param flightData
+     *        the flight data to be exported
+     * \param io
+     *        the IO device to write to; already opened for writing
+     * \return \c true upon success; \c false else (write error)
+     */
+    virtual bool exportFlightData(const FlightData &flightData, QIODevice &io) const noexcept = 0;
+
+    /*!
+     * Exports the given \p aircraft of the \p flightData into the given \p io data sink,
+     * without any user interaction. Formats which only support single aircraft (e.g. IGC)
+     * export each aircraft this way.
+     *
+     * The data sink \p io must have been properly opened for writing already.
+     *
+     * \param flightData
+     *        the flight data of the \p aircraft
+     * \param aircraft
+     *        the aircraft to be exported
+     * \param io
+     *        the IO device to write to; already opened for writing
+     * \return \c true upon success; \c false else (write error)
+     */
+    virtual bool exportAircraft(const FlightData &flightData, const Aircraft &aircraft, QIODevice &io) const noexcept = 0;
 };
 
 #define FLIGHT_EXPORT_INTERFACE_IID "com.github.till213.SkyDolly.FlightExportInterface/1.0"
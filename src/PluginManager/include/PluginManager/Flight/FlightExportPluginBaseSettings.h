@@ -73,6 +73,23 @@ public:
     SampleRate::ResamplingPeriod getResamplingPeriod() const noexcept;
     void setResamplingPeriod(SampleRate::ResamplingPeriod resamplingPeriod) noexcept;
 
+    /*!
+     * Returns whether the plugin supports the error-bounded simplification of the exported
+     * position data (track).
+     *
+     * \return \c true if the plugin supports track simplification; \c false else
+     * \sa TrackSimplification
+     */
+    virtual bool isSimplificationSupported() const noexcept = 0;
+
+    /*!
+     * Returns the maximum deviation of the simplified track from the (resampled) position data.
+     *
+     * \return the maximum deviation [meters]; 0.0 if the track is not to be simplified
+     */
+    double getSimplificationMaxDeviation() const noexcept;
+    void setSimplificationMaxDeviation(double maxDeviation) noexcept;
+
     /*!
      * Returns whether the plugin supports the given \p formationExport option.
      *
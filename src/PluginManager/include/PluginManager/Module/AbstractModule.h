@@ -37,6 +37,8 @@ class QUuid;
 
 class ModuleBaseSettings;
 class FlightService;
+class RecordingJournal;
+class Aircraft;
 struct AbstractModulePrivate;
 
 class PLUGINMANAGER_API AbstractModule : public QObject, public ModuleIntf
@@ -64,6 +66,28 @@ protected:
 
     FlightService &getFlightService() const noexcept;
 
+    /*!
+     * Returns the journal which incrementally stores the ongoing recording into the logbook,
+     * in case the incremental persistence is enabled in the settings.
+     *
+     * Modules storing the recording themselves must first try to RecordingJournal#finish
+     * the journal and only store the recording in case the journal did not store it.
+     *
+     * \return the recording journal of this module
+     * \sa Settings#isIncrementalPersistenceEnabled
+     */
+    RecordingJournal &getRecordingJournal() const noexcept;
+
+    /*!
+     * Simplifies the position data of the recorded \p aircraft, in case the compact on store
+     * option is enabled in the settings. To be called after the \p aircraft has been stored.
+     *
+     * \param aircraft
+     *        the stored aircraft whose position data is to be compacted
+     * \sa Settings#getCompactOnStoreMaxDeviation
+     */
+    void compactOnStore(Aircraft &aircraft) const noexcept;
+
     void storeSettings(const QUuid &pluginUuid) const noexcept;
     void restoreSettings(const QUuid &pluginUuid) noexcept;
     virtual ModuleBaseSettings &getModuleSettings() const noexcept = 0;
@@ -99,6 +123,9 @@ private:
     const std::unique_ptr<AbstractModulePrivate> d;
 
     void frenchConnection() noexcept;
+
+private slots:
+    void onRecordingStarted() noexcept;
 };
 
 #endif // ABSTRACTMODULE_H
@@ -41,6 +41,7 @@ class QString;
 
 class SkyConnectIntf;
 class Flight;
+class Aircraft;
 struct FlightData;
 struct PluginManagerPrivate;
 
@@ -86,6 +87,41 @@ public:
     std::vector<FlightData> importFlightData(const QUuid &pluginUuid, QIODevice &io, bool &ok) const noexcept;
 
     bool exportFlight(const Flight &flight, const QUuid &pluginUuid) const noexcept;
+
+    /*!
+     * Exports the \p flightData with plugin \p pluginUuid into the output device \p io.
+     *
+     * Implementation note: this method (while not necessarily called from the application
+     * code itself) is useful for unit tests and benchmarks. So do not remove.
+     *
+     * \param pluginUuid
+     *        the UUID of the plugin with which to export the flight data
+     * \param flightData
+     *        the flight data to be exported
+     * \param io
+     *        the output device; must already be open for writing
+     * \return \c true when successful; \c false else
+     */
+    bool exportFlightData(const QUuid &pluginUuid, const FlightData &flightData, QIODevice &io) const noexcept;
+
+    /*!
+     * Exports the \p aircraft of the \p flightData with plugin \p pluginUuid into the output device \p io.
+     *
+     * Implementation note: this method (while not necessarily called from the application
+     * code itself) is useful for unit tests and benchmarks, notably for formats which only
+     * support single aircraft. So do not remove.
+     *
+     * \param pluginUuid
+     *        the UUID of the plugin with which to export the aircraft
+     * \param flightData
+     *        the flight data of the \p aircraft
+     * \param aircraft
+     *        the aircraft to be exported
+     * \param io
+     *        the output device; must already be open for writing
+     * \return \c true when successful; \c false else
+     */
+    bool exportAircraftData(const QUuid &pluginUuid, const FlightData &flightData, const Aircraft &aircraft, QIODevice &io) const noexcept;
     bool importLocations(const QUuid &pluginUuid) const noexcept;
     bool exportLocations(const QUuid &pluginUuid) const noexcept;
 
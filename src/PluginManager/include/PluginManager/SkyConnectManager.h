@@ -46,6 +46,8 @@ class QUuid;
 #include <Model/TimeZoneInfo.h>
 #include "Connect/Connect.h"
 #include "Connect/SkyConnectIntf.h"
+#include "Connect/ReplayStatistics.h"
+#include "Connect/CaptureStatistics.h"
 #include "OptionWidgetIntf.h"
 #include "PluginManagerLib.h"
 
@@ -176,6 +178,24 @@ public:
     std::int64_t getCurrentTimestamp() const noexcept;
     bool isAtEnd() const noexcept;
 
+    /*!
+     * Returns the frame timing statistics of the current (or last) replay.
+     *
+     * \return the ReplayStatistics of the current connection; empty statistics
+     *         if no connect plugin is loaded
+     * \sa SkyConnectIntf#getReplayStatistics
+     */
+    ReplayStatistics getReplayStatistics() const noexcept;
+
+    /*!
+     * Returns the sample capture statistics of the current (or last) recording.
+     *
+     * \return the CaptureStatistics of the current connection; empty statistics
+     *         if no connect plugin is loaded
+     * \sa SkyConnectIntf#getCaptureStatistics
+     */
+    CaptureStatistics getCaptureStatistics() const noexcept;
+
     bool requestLocation() const noexcept;
     bool requestSimulationRate() const noexcept;
     bool requestTimeZoneInfo() const noexcept;
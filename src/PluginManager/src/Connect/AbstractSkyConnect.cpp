@@ -27,11 +27,15 @@
 #include <array>
 #include <memory>
 #include <optional>
+#include <vector>
 
 #include <QTimer>
 #include <QElapsedTimer>
 #include <QDateTime>
 #include <QWidget>
+#include <QFutureWatcher>
+#include <QtConcurrent/QtConcurrentMap>
+#include <QtConcurrent/QtConcurrentRun>
 #ifdef DEBUG
 #include <QDebug>
 #endif
@@ -40,6 +44,7 @@
 #include <Kernel/Const.h>
 #include <Kernel/SampleRate.h>
 #include <Kernel/Settings.h>
+#include <Kernel/Trace.h>
 #include <Model/Logbook.h>
 #include <Model/Flight.h>
 #include <Model/FlightData.h>
@@ -48,11 +53,29 @@
 #include <Model/PositionData.h>
 #include <Model/Attitude.h>
 #include <Model/AttitudeData.h>
+#include <Model/Engine.h>
+#include <Model/EngineData.h>
+#include <Model/PrimaryFlightControl.h>
+#include <Model/PrimaryFlightControlData.h>
+#include <Model/SecondaryFlightControl.h>
+#include <Model/SecondaryFlightControlData.h>
+#include <Model/AircraftHandle.h>
+#include <Model/AircraftHandleData.h>
+#include <Model/Light.h>
+#include <Model/LightData.h>
 #include <Model/InitialPosition.h>
+#include <Model/SampleCursor.h>
+#include <Model/SkySearch.h>
 #include <Connect/Connect.h>
 #include <Connect/SkyConnectIntf.h>
 #include <Connect/AbstractSkyConnect.h>
 #include <Connect/ConnectPluginBaseSettings.h>
+#include <Connect/ReplayScheduler.h>
+#include <Connect/ReplayStatistics.h>
+#include <Connect/CaptureQueue.h>
+#include <Connect/CaptureStatistics.h>
+#include <Connect/DeadbandTolerance.h>
+#include <Connect/FrameSnapshot.h>
 #include "BasicConnectOptionWidget.h"
 
 namespace
@@ -72,8 +95,70 @@ namespace
     constexpr int SimulationTimeUpdateBaseIntervalMSec = 60 * 1000;
     // Minimum simulation time update interval
     constexpr int MinimumSimulationTimeUpdateIntervalMSec = 16;
+
+    // The minimum number of aircraft for which the frame snapshot is interpolated in parallel;
+    // for smaller formations the overhead of dispatching the tasks outweighs the gain
+    constexpr std::size_t ParallelInterpolationThreshold = 4;
 }
 
+// The interpolation cursors of a single aircraft, used for the frame snapshot
+struct AircraftCursors
+{
+    std::int64_t aircraftId {Const::InvalidId};
+    SampleCursor<PositionData> position;
+    SampleCursor<AttitudeData> attitude;
+    SampleCursor<EngineData> engine;
+    SampleCursor<PrimaryFlightControlData> primaryFlightControl;
+    SampleCursor<SecondaryFlightControlData> secondaryFlightControl;
+    SampleCursor<AircraftHandleData> aircraftHandle;
+    SampleCursor<LightData> light;
+};
+
+namespace
+{
+    // Interpolates the aircraft of the given frameSnapshot, whose aircraft indices have already been set
+    void interpolateFrame(const Flight &flight, std::int64_t timestamp, TimeVariableData::Access access,
+                          FrameSnapshot &frameSnapshot, std::vector<AircraftCursors> &aircraftCursors) noexcept
+    {
+        // Each aircraft has its own cursors, which are reset whenever another aircraft takes its place
+        aircraftCursors.resize(flight.count());
+        const auto interpolate = [&flight, &aircraftCursors, timestamp, access](AircraftSnapshot &snapshot) {
+            const auto &aircraft = flight[snapshot.aircraftIndex];
+            auto &cursors = aircraftCursors[snapshot.aircraftIndex];
+            if (cursors.aircraftId != aircraft.getId()) {
+                cursors = AircraftCursors();
+                cursors.aircraftId = aircraft.getId();
+            }
+            snapshot.aircraftId = aircraft.getId();
+            snapshot.position = aircraft.getPosition().interpolate(timestamp, access, cursors.position);
+            snapshot.attitude = aircraft.getAttitude().interpolate(timestamp, access, cursors.attitude);
+            snapshot.engine = aircraft.getEngine().interpolate(timestamp, access, cursors.engine);
+            snapshot.primaryFlightControl = aircraft.getPrimaryFlightControl().interpolate(timestamp, access, cursors.primaryFlightControl);
+            snapshot.secondaryFlightControl = aircraft.getSecondaryFlightControl().interpolate(timestamp, access, cursors.secondaryFlightControl);
+            snapshot.aircraftHandle = aircraft.getAircraftHandle().interpolate(timestamp, access, cursors.aircraftHandle);
+            snapshot.light = aircraft.getLight().interpolate(timestamp, access, cursors.light);
+        };
+        if (frameSnapshot.size() >= ::ParallelInterpolationThreshold) {
+            // The calling thread blocks (and participates) until all aircraft have been interpolated;
+            // the cursors are distinct per aircraft
+            QtConcurrent::blockingMap(frameSnapshot, interpolate);
+        } else {
+            std::for_each(frameSnapshot.begin(), frameSnapshot.end(), interpolate);
+        }
+    }
+}
+
+// A continuous seek request, to be interpolated off the UI thread
+struct SeekRequest
+{
+    std::int64_t timestamp {0};
+    TimeVariableData::Access access {TimeVariableData::Access::ContinuousSeek};
+    // Measures the latency from the request until the aircraft data has been sent
+    QElapsedTimer requestTimer;
+    // Requests of a previous generation have been cancelled
+    std::uint64_t generation {0};
+};
+
 struct AbstractSkyConnectPrivate
 {
     AbstractSkyConnectPrivate() noexcept
@@ -100,6 +185,32 @@ struct AbstractSkyConnectPrivate
     float replaySpeedFactor {1.0f};
     std::int64_t elapsedTime {0};
 
+    ReplayScheduler replayScheduler;
+    ReplayStatistics replayStatistics;
+    // Measures the interval since the last replayed frame
+    QElapsedTimer frameTimer;
+    // The previous frame interval [milliseconds]; negative if not yet available
+    double lastFrameInterval {-1.0};
+    FrameSnapshot frameSnapshot;
+    // The interpolation cursors, by aircraft index
+    std::vector<AircraftCursors> aircraftCursors;
+
+    // Coalescing (latest-wins) continuous seek: at most one seek request is interpolated
+    // in the background at any time, and only the newest pending request is kept
+    QFutureWatcher<void> seekWatcher;
+    std::optional<SeekRequest> pendingSeek;
+    SeekRequest activeSeek;
+    std::uint64_t seekGeneration {0};
+    // Set from the start of the background interpolation until its result has been handled
+    bool seekInterpolating {false};
+    // Only accessed by the background interpolation while it is running
+    FrameSnapshot seekSnapshot;
+    std::vector<AircraftCursors> seekCursors;
+    // Set when the frameSnapshot has been interpolated in the background for the active seek request
+    bool seekSnapshotPrepared {false};
+
+    CaptureQueue captureQueue;
+
     inline void updateSimulationTimeUpdateInterval() noexcept
     {
         // Not less than MinimumSimulationTimeUpdateIntervalMSec msec
@@ -108,6 +219,27 @@ struct AbstractSkyConnectPrivate
                                       SimulationTimeUpdateBaseIntervalMSec;
         simulationTimeUpdateTimer.setInterval(intervalMSec);
     }
+
+    inline void recordFrame() noexcept
+    {
+        if (frameTimer.isValid()) {
+            const auto frameInterval = static_cast<double>(frameTimer.nsecsElapsed()) / 1000000.0;
+            replayStatistics.frameIntervals.add(frameInterval);
+            if (lastFrameInterval >= 0.0) {
+                replayStatistics.jitter.add(std::abs(frameInterval - lastFrameInterval));
+            }
+            lastFrameInterval = frameInterval;
+        }
+        frameTimer.start();
+    }
+
+    // Frame intervals are only measured between consecutive frames, that is not
+    // across pauses, seek operations or a replay restart
+    inline void resetFrameTimer() noexcept
+    {
+        frameTimer.invalidate();
+        lastFrameInterval = -1.0;
+    }
 };
 
 // PUBLIC
@@ -119,7 +251,10 @@ AbstractSkyConnect::AbstractSkyConnect(QObject *parent) noexcept
     frenchConnection();
 }
 
-AbstractSkyConnect::~AbstractSkyConnect() = default;
+AbstractSkyConnect::~AbstractSkyConnect()
+{
+    cancelSeekInterpolation();
+}
 
 void AbstractSkyConnect::tryConnectAndSetup() noexcept
 {
@@ -211,6 +346,8 @@ void AbstractSkyConnect::startRecording(RecordingMode recordingMode, const Initi
 
     bool ok = isConnectedWithSim();
     if (ok) {
+        // The flight is about to be modified
+        cancelSeekInterpolation();
         switch (recordingMode) {
         case RecordingMode::SingleAircraft:
             // Start a new flight
@@ -238,6 +375,14 @@ void AbstractSkyConnect::startRecording(RecordingMode recordingMode, const Initi
         d->currentTimestamp = 0;
         d->lastNotificationTimestamp = d->currentTimestamp;
         d->elapsedTimer.invalidate();
+        d->captureQueue.discard();
+        d->captureQueue.resetStatistics();
+        {
+            const auto &settings = Settings::getInstance();
+            DeadbandTolerance tolerance;
+            tolerance.maxIntervalMSec = std::min(static_cast<std::int64_t>(settings.getAdaptiveSamplingMaxIntervalMSec()), SkySearch::DefaultInterpolationWindow);
+            d->captureQueue.setAdaptiveSamplingEnabled(settings.isAdaptiveSamplingEnabled(), tolerance);
+        }
         ok = retryWithReconnect([this, initialPosition]() -> bool { return setupInitialRecordingPosition(initialPosition); });
         if (ok) {
             switch (recordingMode) {
@@ -259,7 +404,11 @@ void AbstractSkyConnect::startRecording(RecordingMode recordingMode, const Initi
 void AbstractSkyConnect::stopRecording() noexcept
 {
     onStopRecording();
+    drainCaptureQueue();
     auto &aircraft = d->currentFlight.getUserAircraft();
+    // Append the samples held back by the adaptive sampling, so that the recording ends
+    // with the last captured values
+    d->captureQueue.flush(aircraft);
     aircraft.invalidateDuration();
     // Only go into "recording stopped" state once the aircraft duration has been invalidated, in
     // order to properly update the total flight duration
@@ -294,6 +443,9 @@ void AbstractSkyConnect::startReplay(bool skipToStart, const InitialPosition &in
             d->currentTimestamp = 0;   
         }
         d->lastNotificationTimestamp = d->currentTimestamp;
+        d->replayStatistics.clear();
+        d->replayScheduler.resetSkippedFrameCount();
+        d->resetFrameTimer();
 
         d->elapsedTimer.invalidate();
         bool ok = retryWithReconnect([this]() -> bool { return onStartReplay(d->currentTimestamp); });
@@ -325,6 +477,7 @@ void AbstractSkyConnect::stopReplay() noexcept
     // current timestamp
     d->elapsedTime = d->currentTimestamp;
     d->elapsedTimer.invalidate();
+    d->resetFrameTimer();
     d->simulationTimeUpdateTimer.stop();
     onStopReplay();
     updateUserAircraftFreeze();
@@ -371,6 +524,7 @@ void AbstractSkyConnect::setPaused(Initiator initiator, bool enable) noexcept
                 // ... and stop the elapsed timer
                 d->elapsedTimer.invalidate();
             }
+            d->resetFrameTimer();
             updateUserAircraftFreeze();
             onReplayPaused(initiator, true);
             break;
@@ -382,6 +536,7 @@ void AbstractSkyConnect::setPaused(Initiator initiator, bool enable) noexcept
         switch (d->state) {
         case Connect::State::RecordingPaused:
             setState(Connect::State::Recording);
+            drainCaptureQueue();
             if (hasRecordingStarted()) {
                 // Resume recording (but only if it has already recorded samples before)
                 startElapsedTimer();
@@ -446,19 +601,29 @@ void AbstractSkyConnect::seek(std::int64_t timestamp, SeekMode seekMode) noexcep
             d->currentTimestamp = timestamp;
             d->lastNotificationTimestamp = d->currentTimestamp;
             d->elapsedTime = timestamp;
+            d->resetFrameTimer();
             const TimeVariableData::Access access = seekMode == SeekMode::Continuous ? TimeVariableData::Access::ContinuousSeek : TimeVariableData::Access::DiscreteSeek;
             updateSimulationTime();
             emit timestampChanged(d->currentTimestamp, access);
             onSeek(d->currentTimestamp, seekMode);
-            bool ok = retryWithReconnect([this, access]() -> bool { return sendAircraftData(d->currentTimestamp, access, AircraftSelection::All); });
-            if (ok) {
-                if (d->elapsedTimer.isValid()) {
-                    // Restart the elapsed timer, counting onwards from the newly
-                    // set timestamp
-                    startElapsedTimer();
-                }                
+            if (seekMode == SeekMode::Continuous) {
+                // Interpolate in the background; superseded requests are dropped
+                if (d->pendingSeek) {
+                    ++d->replayStatistics.supersededSeeks;
+                }
+                SeekRequest seekRequest;
+                seekRequest.timestamp = d->currentTimestamp;
+                seekRequest.access = access;
+                seekRequest.requestTimer.start();
+                seekRequest.generation = d->seekGeneration;
+                d->pendingSeek = std::move(seekRequest);
+                if (!d->seekInterpolating) {
+                    startSeekInterpolation();
+                }
             } else {
-                setState(Connect::State::Disconnected);
+                // Any pending continuous seek is superseded by this seek
+                cancelSeekInterpolation();
+                sendSeekData(d->currentTimestamp, access);
             }
         }
     } else {
@@ -533,6 +698,18 @@ void AbstractSkyConnect::setReplaySpeedFactor(float factor) noexcept
     }
 }
 
+ReplayStatistics AbstractSkyConnect::getReplayStatistics() const noexcept
+{
+    ReplayStatistics replayStatistics {d->replayStatistics};
+    replayStatistics.skippedFrames = d->replayScheduler.getSkippedFrameCount();
+    return replayStatistics;
+}
+
+CaptureStatistics AbstractSkyConnect::getCaptureStatistics() const noexcept
+{
+    return d->captureQueue.getStatistics();
+}
+
 bool AbstractSkyConnect::requestLocation() noexcept
 {
     if (!isConnectedWithSim()) {
@@ -725,6 +902,64 @@ void AbstractSkyConnect::resetElapsedTime(bool restart) noexcept
     }
 }
 
+ReplayScheduler &AbstractSkyConnect::getReplayScheduler() const noexcept
+{
+    return d->replayScheduler;
+}
+
+CaptureQueue &AbstractSkyConnect::getCaptureQueue() const noexcept
+{
+    return d->captureQueue;
+}
+
+void AbstractSkyConnect::drainCaptureQueue() noexcept
+{
+    Trace::Scope trace {Trace::Recording, "Drain capture queue"};
+    const auto appended = d->captureQueue.drain(d->currentFlight.getUserAircraft());
+    Trace::counter(Trace::Recording, "Appended samples", static_cast<std::int64_t>(appended));
+}
+
+const FrameSnapshot &AbstractSkyConnect::updateFrameSnapshot(std::int64_t timestamp, TimeVariableData::Access access, AircraftSelection aircraftSelection,
+                                                             bool skipUserAircraft) noexcept
+{
+    Trace::Scope trace {Trace::Replay, "Interpolate frame"};
+    const auto &flight = d->currentFlight;
+    auto &frameSnapshot = d->frameSnapshot;
+    const auto userAircraftIndex = static_cast<std::size_t>(flight.getUserAircraftIndex());
+    if (d->seekSnapshotPrepared) {
+        // Consume the snapshot which has been interpolated in the background for the active seek request
+        d->seekSnapshotPrepared = false;
+        if (timestamp == d->activeSeek.timestamp && access == d->activeSeek.access && aircraftSelection == AircraftSelection::All &&
+            frameSnapshot.size() == flight.count()) {
+            if (skipUserAircraft) {
+                std::erase_if(frameSnapshot, [userAircraftIndex](const AircraftSnapshot &snapshot) { return snapshot.aircraftIndex == userAircraftIndex; });
+            }
+            return frameSnapshot;
+        }
+    }
+    // Skipped aircraft are not interpolated at all
+    frameSnapshot.clear();
+    switch (aircraftSelection) {
+    case AircraftSelection::All:
+        for (std::size_t i = 0; i < flight.count(); ++i) {
+            if (i != userAircraftIndex || !skipUserAircraft) {
+                frameSnapshot.emplace_back().aircraftIndex = i;
+            }
+        }
+        break;
+    case AircraftSelection::UserAircraft:
+        if (!skipUserAircraft) {
+            frameSnapshot.emplace_back().aircraftIndex = userAircraftIndex;
+        }
+        break;
+    }
+
+    // The calling thread blocks until all aircraft have been interpolated, so the flight
+    // cannot be modified concurrently
+    ::interpolateFrame(flight, timestamp, access, frameSnapshot, d->aircraftCursors);
+    return frameSnapshot;
+}
+
 void AbstractSkyConnect::createAiObjects() noexcept
 {
     if (isConnectedWithSim()) {
@@ -748,6 +983,7 @@ std::int64_t AbstractSkyConnect::updateCurrentTimestamp() noexcept
         // Ignore spontaneous SimConnect events: do not update
         // the current timestamp unless we are replaying or recording
         if (d->state == Connect::State::Replay) {
+            d->recordFrame();
             d->currentTimestamp = d->elapsedTime + static_cast<std::int64_t>(std::round(static_cast<double>(d->elapsedTimer.elapsed()) * d->replaySpeedFactor));
             if (d->currentTimestamp == 0 || d->currentTimestamp - d->lastNotificationTimestamp > ::NotificationInterval) {
                 d->lastNotificationTimestamp = d->currentTimestamp;
@@ -792,6 +1028,8 @@ void AbstractSkyConnect::frenchConnection() noexcept
             this, &AbstractSkyConnect::onReconnectTimer);
     connect(&(d->simulationTimeUpdateTimer), &QTimer::timeout,
             this, &AbstractSkyConnect::updateSimulationTime);
+    connect(&(d->seekWatcher), &QFutureWatcher<void>::finished,
+            this, &AbstractSkyConnect::onSeekInterpolated);
 }
 
 bool AbstractSkyConnect::hasRecordingStarted() const noexcept
@@ -832,6 +1070,50 @@ bool AbstractSkyConnect::retryWithReconnect(const std::function<bool()> &func)
     return ok;
 }
 
+void AbstractSkyConnect::startSeekInterpolation() noexcept
+{
+    d->activeSeek = std::move(*d->pendingSeek);
+    d->pendingSeek.reset();
+    d->seekInterpolating = true;
+
+    const auto &flight = d->currentFlight;
+    auto &seekSnapshot = d->seekSnapshot;
+    seekSnapshot.resize(flight.count());
+    for (std::size_t i = 0; i < seekSnapshot.size(); ++i) {
+        seekSnapshot[i].aircraftIndex = i;
+    }
+    // The flight is not modified while the position slider is being dragged: the seek operation
+    // ends with a discrete seek, which waits for the background interpolation to finish
+    const auto timestamp = d->activeSeek.timestamp;
+    const auto access = d->activeSeek.access;
+    d->seekWatcher.setFuture(QtConcurrent::run([&flight, &seekSnapshot, &seekCursors = d->seekCursors, timestamp, access]() {
+        ::interpolateFrame(flight, timestamp, access, seekSnapshot, seekCursors);
+    }));
+}
+
+void AbstractSkyConnect::cancelSeekInterpolation() noexcept
+{
+    d->pendingSeek.reset();
+    ++d->seekGeneration;
+    d->seekWatcher.waitForFinished();
+    d->seekInterpolating = false;
+    d->seekSnapshotPrepared = false;
+}
+
+void AbstractSkyConnect::sendSeekData(std::int64_t timestamp, TimeVariableData::Access access) noexcept
+{
+    bool ok = retryWithReconnect([this, timestamp, access]() -> bool { return sendAircraftData(timestamp, access, AircraftSelection::All); });
+    if (ok) {
+        if (d->elapsedTimer.isValid()) {
+            // Restart the elapsed timer, counting onwards from the newly
+            // set timestamp
+            startElapsedTimer();
+        }
+    } else {
+        setState(Connect::State::Disconnected);
+    }
+}
+
 bool AbstractSkyConnect::setupInitialRecordingPosition(InitialPosition initialPosition) noexcept
 {
     bool ok {true};
@@ -901,6 +1183,26 @@ void AbstractSkyConnect::onReconnectTimer() noexcept
     retryConnectAndSetup(Connect::Mode::SetupOnly);
 }
 
+void AbstractSkyConnect::onSeekInterpolated() noexcept
+{
+    if (!d->seekInterpolating || d->activeSeek.generation != d->seekGeneration) {
+        // Cancelled
+        return;
+    }
+    d->seekInterpolating = false;
+    if (d->pendingSeek) {
+        // Superseded by a newer seek request: interpolate the newest one instead
+        ++d->replayStatistics.supersededSeeks;
+        startSeekInterpolation();
+    } else if (d->state != Connect::State::Recording && isConnectedWithSim()) {
+        std::swap(d->frameSnapshot, d->seekSnapshot);
+        d->seekSnapshotPrepared = true;
+        sendSeekData(d->activeSeek.timestamp, d->activeSeek.access);
+        d->seekSnapshotPrepared = false;
+        d->replayStatistics.seekLatencies.add(static_cast<double>(d->activeSeek.requestTimer.nsecsElapsed()) / 1000000.0);
+    }
+}
+
 void AbstractSkyConnect::retryConnectAndSetup(Connect::Mode mode) noexcept
 {
     d->reconnectTimer.stop();
@@ -0,0 +1,223 @@
+/**
+ * Sky Dolly - The Black Sheep for Your Flight Recordings
+ *
+ * Copyright (c) 2020 - 2025 Oliver Knoll
+ *
+ * MIT License
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this
+ * software and associated documentation files (the "Software"), to deal in the Software
+ * without restriction, including without limitation the rights to use, copy, modify, merge,
+ * publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons
+ * to whom the Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or
+ * substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED *AS IS*, WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR
+ * PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE
+ * FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+ * OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ */
+#include <memory>
+#include <vector>
+#include <cstddef>
+#include <cstdint>
+
+#include <Model/Aircraft.h>
+#include <Model/Position.h>
+#include <Model/PositionData.h>
+#include <Model/Attitude.h>
+#include <Model/AttitudeData.h>
+#include <Model/Engine.h>
+#include <Model/EngineData.h>
+#include <Model/PrimaryFlightControl.h>
+#include <Model/PrimaryFlightControlData.h>
+#include <Model/SecondaryFlightControl.h>
+#include <Model/SecondaryFlightControlData.h>
+#include <Model/AircraftHandle.h>
+#include <Model/AircraftHandleData.h>
+#include <Model/Light.h>
+#include <Model/LightData.h>
+#include <Connect/CaptureStatistics.h>
+#include <Connect/DeadbandTolerance.h>
+#include <Connect/CaptureQueue.h>
+#include "DeadbandFilter.h"
+
+struct CaptureQueuePrivate
+{
+    std::vector<PositionData> positionQueue;
+    std::vector<AttitudeData> attitudeQueue;
+    std::vector<EngineData> engineQueue;
+    std::vector<PrimaryFlightControlData> primaryFlightControlQueue;
+    std::vector<SecondaryFlightControlData> secondaryFlightControlQueue;
+    std::vector<AircraftHandleData> aircraftHandleQueue;
+    std::vector<LightData> lightQueue;
+
+    bool adaptiveSampling {false};
+    DeadbandTolerance tolerance;
+    DeadbandFilter<PositionData> positionFilter;
+    DeadbandFilter<AttitudeData> attitudeFilter;
+    DeadbandFilter<EngineData> engineFilter;
+    DeadbandFilter<PrimaryFlightControlData> primaryFlightControlFilter;
+    DeadbandFilter<SecondaryFlightControlData> secondaryFlightControlFilter;
+    DeadbandFilter<AircraftHandleData> aircraftHandleFilter;
+    DeadbandFilter<LightData> lightFilter;
+
+    std::uint64_t capturedSamples {0};
+    std::uint64_t appendedSamples {0};
+
+    template <typename T, typename Component>
+    inline std::size_t append(DeadbandFilter<T> &filter, const T &data, Component &component) noexcept
+    {
+        std::size_t count {0};
+        if (adaptiveSampling) {
+            count = filter.process(data, tolerance, [&component](const T &sample) { component.upsertLast(sample); });
+        } else {
+            component.upsertLast(data);
+            count = 1;
+        }
+        return count;
+    }
+
+    template <typename T, typename Component>
+    inline std::size_t drain(std::vector<T> &queue, DeadbandFilter<T> &filter, Component &component) noexcept
+    {
+        std::size_t appended {0};
+        for (const auto &data : queue) {
+            appended += append(filter, data, component);
+        }
+        capturedSamples += queue.size();
+        // Keep the capacity for the next batch
+        queue.clear();
+        return appended;
+    }
+
+    template <typename T, typename Component>
+    static inline std::size_t flush(DeadbandFilter<T> &filter, Component &component) noexcept
+    {
+        return filter.flush([&component](const T &sample) { component.upsertLast(sample); });
+    }
+
+    inline void clearQueues() noexcept
+    {
+        positionQueue.clear();
+        attitudeQueue.clear();
+        engineQueue.clear();
+        primaryFlightControlQueue.clear();
+        secondaryFlightControlQueue.clear();
+        aircraftHandleQueue.clear();
+        lightQueue.clear();
+    }
+
+    inline void resetFilters() noexcept
+    {
+        positionFilter.reset();
+        attitudeFilter.reset();
+        engineFilter.reset();
+        primaryFlightControlFilter.reset();
+        secondaryFlightControlFilter.reset();
+        aircraftHandleFilter.reset();
+        lightFilter.reset();
+    }
+};
+
+// PUBLIC
+
+CaptureQueue::CaptureQueue() noexcept
+    : d {std::make_unique<CaptureQueuePrivate>()}
+{}
+
+CaptureQueue::~CaptureQueue() = default;
+
+void CaptureQueue::push(const PositionData &positionData) noexcept
+{
+    d->positionQueue.push_back(positionData);
+}
+
+void CaptureQueue::push(const AttitudeData &attitudeData) noexcept
+{
+    d->attitudeQueue.push_back(attitudeData);
+}
+
+void CaptureQueue::push(const EngineData &engineData) noexcept
+{
+    d->engineQueue.push_back(engineData);
+}
+
+void CaptureQueue::push(const PrimaryFlightControlData &primaryFlightControlData) noexcept
+{
+    d->primaryFlightControlQueue.push_back(primaryFlightControlData);
+}
+
+void CaptureQueue::push(const SecondaryFlightControlData &secondaryFlightControlData) noexcept
+{
+    d->secondaryFlightControlQueue.push_back(secondaryFlightControlData);
+}
+
+void CaptureQueue::push(const AircraftHandleData &aircraftHandleData) noexcept
+{
+    d->aircraftHandleQueue.push_back(aircraftHandleData);
+}
+
+void CaptureQueue::push(const LightData &lightData) noexcept
+{
+    d->lightQueue.push_back(lightData);
+}
+
+std::size_t CaptureQueue::drain(Aircraft &aircraft) noexcept
+{
+    std::size_t count {0};
+    count += d->drain(d->positionQueue, d->positionFilter, aircraft.getPosition());
+    count += d->drain(d->attitudeQueue, d->attitudeFilter, aircraft.getAttitude());
+    count += d->drain(d->engineQueue, d->engineFilter, aircraft.getEngine());
+    count += d->drain(d->primaryFlightControlQueue, d->primaryFlightControlFilter, aircraft.getPrimaryFlightControl());
+    count += d->drain(d->secondaryFlightControlQueue, d->secondaryFlightControlFilter, aircraft.getSecondaryFlightControl());
+    count += d->drain(d->aircraftHandleQueue, d->aircraftHandleFilter, aircraft.getAircraftHandle());
+    count += d->drain(d->lightQueue, d->lightFilter, aircraft.getLight());
+    d->appendedSamples += count;
+    return count;
+}
+
+std::size_t CaptureQueue::flush(Aircraft &aircraft) noexcept
+{
+    std::size_t count {0};
+    count += CaptureQueuePrivate::flush(d->positionFilter, aircraft.getPosition());
+    count += CaptureQueuePrivate::flush(d->attitudeFilter, aircraft.getAttitude());
+    count += CaptureQueuePrivate::flush(d->engineFilter, aircraft.getEngine());
+    count += CaptureQueuePrivate::flush(d->primaryFlightControlFilter, aircraft.getPrimaryFlightControl());
+    count += CaptureQueuePrivate::flush(d->secondaryFlightControlFilter, aircraft.getSecondaryFlightControl());
+    count += CaptureQueuePrivate::flush(d->aircraftHandleFilter, aircraft.getAircraftHandle());
+    count += CaptureQueuePrivate::flush(d->lightFilter, aircraft.getLight());
+    d->appendedSamples += count;
+    return count;
+}
+
+void CaptureQueue::discard() noexcept
+{
+    d->clearQueues();
+    d->resetFilters();
+}
+
+void CaptureQueue::setAdaptiveSamplingEnabled(bool enable, const DeadbandTolerance &tolerance) noexcept
+{
+    d->adaptiveSampling = enable;
+    d->tolerance = tolerance;
+    d->resetFilters();
+}
+
+CaptureStatistics CaptureQueue::getStatistics() const noexcept
+{
+    CaptureStatistics statistics;
+    statistics.capturedSamples = d->capturedSamples;
+    statistics.appendedSamples = d->appendedSamples;
+    return statistics;
+}
+
+void CaptureQueue::resetStatistics() noexcept
+{
+    d->capturedSamples = 0;
+    d->appendedSamples = 0;
+}
@@ -0,0 +1,257 @@
+/**
+ * Sky Dolly - The Black Sheep for Your Flight Recordings
+ *
+ * Copyright (c) 2020 - 2025 Oliver Knoll
+ *
+ * MIT License
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this
+ * software and associated documentation files (the "Software"), to deal in the Software
+ * without restriction, including without limitation the rights to use, copy, modify, merge,
+ * publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons
+ * to whom the Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or
+ * substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED *AS IS*, WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR
+ * PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE
+ * FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+ * OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ */
+#ifndef DEADBANDFILTER_H
+#define DEADBANDFILTER_H
+
+#include <cmath>
+#include <cstdint>
+#include <cstddef>
+#include <cstdlib>
+
+#include <Model/TimeVariableData.h>
+#include <Model/PositionData.h>
+#include <Model/AttitudeData.h>
+#include <Model/EngineData.h>
+#include <Model/PrimaryFlightControlData.h>
+#include <Model/SecondaryFlightControlData.h>
+#include <Model/AircraftHandleData.h>
+#include <Model/LightData.h>
+#include <Connect/DeadbandTolerance.h>
+
+namespace Deadband
+{
+    inline bool isWithin(double reference, double value, double tolerance) noexcept
+    {
+        return std::abs(value - reference) <= tolerance;
+    }
+
+    inline bool isWithinCircular(double reference, double value, double tolerance) noexcept
+    {
+        return std::abs(std::remainder(value - reference, 360.0)) <= tolerance;
+    }
+
+    inline bool isWithin(std::int16_t reference, std::int16_t value, std::int16_t tolerance) noexcept
+    {
+        return std::abs(value - reference) <= tolerance;
+    }
+
+    inline bool isWithinTolerance(const PositionData &reference, const PositionData &sample, const DeadbandTolerance &tolerance) noexcept
+    {
+        return isWithin(reference.latitude, sample.latitude, tolerance.positionDegrees) &&
+               isWithinCircular(reference.longitude, sample.longitude, tolerance.positionDegrees) &&
+               isWithin(reference.altitude, sample.altitude, tolerance.altitudeFeet) &&
+               isWithin(reference.indicatedAltitude, sample.indicatedAltitude, tolerance.altitudeFeet) &&
+               isWithin(reference.calibratedIndicatedAltitude, sample.calibratedIndicatedAltitude, tolerance.altitudeFeet) &&
+               isWithin(reference.pressureAltitude, sample.pressureAltitude, tolerance.altitudeFeet);
+    }
+
+    inline bool isWithinTolerance(const AttitudeData &reference, const AttitudeData &sample, const DeadbandTolerance &tolerance) noexcept
+    {
+        return reference.onGround == sample.onGround &&
+               isWithinCircular(reference.pitch, sample.pitch, tolerance.attitudeDegrees) &&
+               isWithinCircular(reference.bank, sample.bank, tolerance.attitudeDegrees) &&
+               isWithinCircular(reference.trueHeading, sample.trueHeading, tolerance.attitudeDegrees) &&
+               isWithin(reference.velocityBodyX, sample.velocityBodyX, tolerance.velocityFeetPerSecond) &&
+               isWithin(reference.velocityBodyY, sample.velocityBodyY, tolerance.velocityFeetPerSecond) &&
+               isWithin(reference.velocityBodyZ, sample.velocityBodyZ, tolerance.velocityFeetPerSecond);
+    }
+
+    inline bool isWithinTolerance(const EngineData &reference, const EngineData &sample, const DeadbandTolerance &tolerance) noexcept
+    {
+        // Discrete values: any change is recorded
+        return reference.electricalMasterBattery1 == sample.electricalMasterBattery1 &&
+               reference.electricalMasterBattery2 == sample.electricalMasterBattery2 &&
+               reference.electricalMasterBattery3 == sample.electricalMasterBattery3 &&
+               reference.electricalMasterBattery4 == sample.electricalMasterBattery4 &&
+               reference.generalEngineStarter1 == sample.generalEngineStarter1 &&
+               reference.generalEngineStarter2 == sample.generalEngineStarter2 &&
+               reference.generalEngineStarter3 == sample.generalEngineStarter3 &&
+               reference.generalEngineStarter4 == sample.generalEngineStarter4 &&
+               reference.generalEngineCombustion1 == sample.generalEngineCombustion1 &&
+               reference.generalEngineCombustion2 == sample.generalEngineCombustion2 &&
+               reference.generalEngineCombustion3 == sample.generalEngineCombustion3 &&
+               reference.generalEngineCombustion4 == sample.generalEngineCombustion4 &&
+               reference.mixtureLeverPosition1 == sample.mixtureLeverPosition1 &&
+               reference.mixtureLeverPosition2 == sample.mixtureLeverPosition2 &&
+               reference.mixtureLeverPosition3 == sample.mixtureLeverPosition3 &&
+               reference.mixtureLeverPosition4 == sample.mixtureLeverPosition4 &&
+               reference.cowlFlapPosition1 == sample.cowlFlapPosition1 &&
+               reference.cowlFlapPosition2 == sample.cowlFlapPosition2 &&
+               reference.cowlFlapPosition3 == sample.cowlFlapPosition3 &&
+               reference.cowlFlapPosition4 == sample.cowlFlapPosition4 &&
+               // Analog values
+               isWithin(reference.throttleLeverPosition1, sample.throttleLeverPosition1, tolerance.position) &&
+               isWithin(reference.throttleLeverPosition2, sample.throttleLeverPosition2, tolerance.position) &&
+               isWithin(reference.throttleLeverPosition3, sample.throttleLeverPosition3, tolerance.position) &&
+               isWithin(reference.throttleLeverPosition4, sample.throttleLeverPosition4, tolerance.position) &&
+               isWithin(reference.propellerLeverPosition1, sample.propellerLeverPosition1, tolerance.position) &&
+               isWithin(reference.propellerLeverPosition2, sample.propellerLeverPosition2, tolerance.position) &&
+               isWithin(reference.propellerLeverPosition3, sample.propellerLeverPosition3, tolerance.position) &&
+               isWithin(reference.propellerLeverPosition4, sample.propellerLeverPosition4, tolerance.position);
+    }
+
+    inline bool isWithinTolerance(const PrimaryFlightControlData &reference, const PrimaryFlightControlData &sample, const DeadbandTolerance &tolerance) noexcept
+    {
+        return isWithin(reference.rudderDeflection, sample.rudderDeflection, tolerance.deflectionRadians) &&
+               isWithin(reference.elevatorDeflection, sample.elevatorDeflection, tolerance.deflectionRadians) &&
+               isWithin(reference.leftAileronDeflection, sample.leftAileronDeflection, tolerance.deflectionRadians) &&
+               isWithin(reference.rightAileronDeflection, sample.rightAileronDeflection, tolerance.deflectionRadians) &&
+               isWithin(reference.rudderPosition, sample.rudderPosition, tolerance.position) &&
+               isWithin(reference.elevatorPosition, sample.elevatorPosition, tolerance.position) &&
+               isWithin(reference.aileronPosition, sample.aileronPosition, tolerance.position);
+    }
+
+    inline bool isWithinTolerance(const SecondaryFlightControlData &reference, const SecondaryFlightControlData &sample, const DeadbandTolerance &tolerance) noexcept
+    {
+        // Discrete values: any change is recorded
+        return reference.spoilersHandlePercent == sample.spoilersHandlePercent &&
+               reference.flapsHandleIndex == sample.flapsHandleIndex &&
+               reference.spoilersArmed == sample.spoilersArmed &&
+               // Analog values
+               isWithin(reference.leftLeadingEdgeFlapsPosition, sample.leftLeadingEdgeFlapsPosition, tolerance.position) &&
+               isWithin(reference.rightLeadingEdgeFlapsPosition, sample.rightLeadingEdgeFlapsPosition, tolerance.position) &&
+               isWithin(reference.leftTrailingEdgeFlapsPosition, sample.leftTrailingEdgeFlapsPosition, tolerance.position) &&
+               isWithin(reference.rightTrailingEdgeFlapsPosition, sample.rightTrailingEdgeFlapsPosition, tolerance.position) &&
+               isWithin(reference.leftSpoilersPosition, sample.leftSpoilersPosition, tolerance.position) &&
+               isWithin(reference.rightSpoilersPosition, sample.rightSpoilersPosition, tolerance.position);
+    }
+
+    inline bool isWithinTolerance(const AircraftHandleData &reference, const AircraftHandleData &sample, const DeadbandTolerance &tolerance) noexcept
+    {
+        // Discrete values: any change is recorded
+        return reference.tailhookPosition == sample.tailhookPosition &&
+               reference.canopyOpen == sample.canopyOpen &&
+               reference.leftWingFolding == sample.leftWingFolding &&
+               reference.rightWingFolding == sample.rightWingFolding &&
+               reference.gearHandlePosition == sample.gearHandlePosition &&
+               reference.tailhookHandlePosition == sample.tailhookHandlePosition &&
+               reference.foldingWingHandlePosition == sample.foldingWingHandlePosition &&
+               reference.smokeEnabled == sample.smokeEnabled &&
+               // Analog values
+               isWithin(reference.brakeLeftPosition, sample.brakeLeftPosition, tolerance.position) &&
+               isWithin(reference.brakeRightPosition, sample.brakeRightPosition, tolerance.position) &&
+               isWithin(reference.gearSteerPosition, sample.gearSteerPosition, tolerance.position) &&
+               isWithin(reference.waterRudderHandlePosition, sample.waterRudderHandlePosition, tolerance.position);
+    }
+
+    inline bool isWithinTolerance(const LightData &reference, const LightData &sample, [[maybe_unused]] const DeadbandTolerance &tolerance) noexcept
+    {
+        // Discrete values: any change is recorded
+        return reference.lightStates == sample.lightStates;
+    }
+}
+
+/*!
+ * Adaptive (deadband) sampling of a stream of captured samples of type \p T.
+ *
+ * Samples which stay within the tolerance band around the last kept sample (the \e reference)
+ * are held back. As soon as a sample leaves the tolerance band the last held back sample is
+ * kept as well, followed by the new sample: this way the end of each (nearly) constant plateau
+ * is recorded, and the linear and Hermite interpolation between the kept samples reconstructs
+ * the captured data within the given tolerance. After the maximum sample interval a sample is
+ * kept regardless, so that the kept samples never lie further apart than the interpolation window.
+ *
+ * The kept samples are passed on to the \e sink, e.g. a function which appends them to the
+ * corresponding aircraft component.
+ *
+ * \sa DeadbandTolerance
+ */
+template <typename T>
+class DeadbandFilter final
+{
+public:
+    /*!
+     * Processes the captured \p sample.
+     *
+     * \param sample
+     *        the captured sample
+     * \param tolerance
+     *        the tolerances
+     * \param sink
+     *        called with each kept sample, in timestamp order
+     * \return the number of kept samples: 0, 1 or 2
+     */
+    template <typename Sink>
+    inline std::size_t process(const T &sample, const DeadbandTolerance &tolerance, Sink &&sink) noexcept
+    {
+        std::size_t count {0};
+        if (m_reference.isNull()) {
+            count = keep(sample, sink);
+        } else if (!Deadband::isWithinTolerance(m_reference, sample, tolerance)) {
+            count = flush(sink);
+            count += keep(sample, sink);
+        } else if (sample.timestamp - m_reference.timestamp >= tolerance.maxIntervalMSec) {
+            // The held back sample lies within the tolerance band between the reference
+            // and the new sample
+            m_held.reset();
+            count = keep(sample, sink);
+        } else {
+            m_held = sample;
+        }
+        return count;
+    }
+
+    /*!
+     * Passes on the held back sample, if any, typically at the end of the recording.
+     *
+     * \param sink
+     *        called with the held back sample
+     * \return the number of kept samples: 0 or 1
+     */
+    template <typename Sink>
+    inline std::size_t flush(Sink &&sink) noexcept
+    {
+        std::size_t count {0};
+        if (!m_held.isNull()) {
+            sink(m_held);
+            m_reference = m_held;
+            m_held.reset();
+            count = 1;
+        }
+        return count;
+    }
+
+    /*!
+     * Resets the filter, typically at the start of a recording.
+     */
+    inline void reset() noexcept
+    {
+        m_reference.reset();
+        m_held.reset();
+    }
+
+private:
+    T m_reference;
+    T m_held;
+
+    template <typename Sink>
+    inline std::size_t keep(const T &sample, Sink &sink) noexcept
+    {
+        sink(sample);
+        m_reference = sample;
+        return 1;
+    }
+};
+
+#endif // DEADBANDFILTER_H
@@ -0,0 +1,147 @@
+/**
+ * Sky Dolly - The Black Sheep for Your Flight Recordings
+ *
+ * Copyright (c) 2020 - 2025 Oliver Knoll
+ *
+ * MIT License
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this
+ * software and associated documentation files (the "Software"), to deal in the Software
+ * without restriction, including without limitation the rights to use, copy, modify, merge,
+ * publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons
+ * to whom the Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or
+ * substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED *AS IS*, WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR
+ * PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE
+ * FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+ * OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ */
+#include <memory>
+#include <algorithm>
+#include <chrono>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <atomic>
+#include <cstdint>
+
+#include <QObject>
+#include <QMetaObject>
+
+#include <Connect/ReplayScheduler.h>
+
+struct ReplaySchedulerPrivate
+{
+    std::thread thread;
+    std::mutex mutex;
+    std::condition_variable condition;
+    std::atomic_bool running {false};
+    std::atomic_bool framePending {false};
+    std::atomic_uint64_t skippedFrames {0};
+    std::chrono::steady_clock::duration period {0};
+};
+
+// PUBLIC
+
+ReplayScheduler::ReplayScheduler(QObject *parent) noexcept
+    : QObject {parent},
+      d {std::make_unique<ReplaySchedulerPrivate>()}
+{}
+
+ReplayScheduler::~ReplayScheduler()
+{
+    stop();
+}
+
+void ReplayScheduler::start(int frequency) noexcept
+{
+    stop();
+    d->period = std::chrono::duration_cast<std::chrono::steady_clock::duration>(std::chrono::duration<double>(1.0 / std::max(frequency, 1)));
+    {
+        std::lock_guard lock {d->mutex};
+        d->running = true;
+    }
+    d->thread = std::thread(&ReplayScheduler::run, this);
+}
+
+void ReplayScheduler::stop() noexcept
+{
+    {
+        std::lock_guard lock {d->mutex};
+        d->running = false;
+    }
+    d->condition.notify_all();
+    if (d->thread.joinable()) {
+        d->thread.join();
+    }
+    d->framePending = false;
+}
+
+bool ReplayScheduler::isActive() const noexcept
+{
+    return d->running;
+}
+
+std::uint64_t ReplayScheduler::getSkippedFrameCount() const noexcept
+{
+    return d->skippedFrames;
+}
+
+void ReplayScheduler::resetSkippedFrameCount() noexcept
+{
+    d->skippedFrames = 0;
+}
+
+// PRIVATE
+
+void ReplayScheduler::run() noexcept
+{
+    using Clock = std::chrono::steady_clock;
+    const auto period = d->period;
+    const auto startTime = Clock::now();
+    std::int64_t frame {1};
+    while (d->running) {
+        // Sleep until the absolute deadline: any oversleeping (due to the timer resolution
+        // of the operating system) shortens the wait for the next frame, but does not add up
+        const auto deadline = startTime + frame * period;
+        {
+            std::unique_lock lock {d->mutex};
+            d->condition.wait_until(lock, deadline, [this]() { return !d->running; });
+        }
+        if (!d->running) {
+            break;
+        }
+
+        if (!d->framePending.exchange(true)) {
+            QMetaObject::invokeMethod(this, &ReplayScheduler::onFrameReady, Qt::QueuedConnection);
+        } else {
+            // The previous frame has not been processed yet
+            ++d->skippedFrames;
+        }
+
+        // Drift compensation: deadlines are always multiples of the period since the start; in case
+        // we fell behind by more than an entire period the missed deadlines are skipped
+        const auto elapsedFrames = static_cast<std::int64_t>((Clock::now() - startTime) / period);
+        if (elapsedFrames > frame) {
+            d->skippedFrames += static_cast<std::uint64_t>(elapsedFrames - frame);
+            frame = elapsedFrames;
+        }
+        ++frame;
+    }
+}
+
+// PRIVATE SLOTS
+
+void ReplayScheduler::onFrameReady() noexcept
+{
+    // A stopped scheduler resets the pending flag, so frames which were still queued
+    // in the event loop at that time are discarded
+    if (d->framePending.exchange(false) && d->running) {
+        emit frameDue();
+    }
+}
@@ -46,6 +46,8 @@
 #include <Model/AircraftHandleData.h>
 #include <Model/Light.h>
 #include <Model/LightData.h>
+#include <Model/SampleCursor.h>
+#include <Model/TrackSimplification.h>
 #include "Export.h"
 
 // PUBLIC
@@ -81,7 +83,7 @@ QString Export::suggestLocationFilePath(QStringView extension) noexcept
     return settings.getExportPath() + "/" + File::ensureExtension(suggestedFileName, extension);
 }
 
-std::vector<PositionData> Export::resamplePositionDataForExport(const Aircraft &aircraft, const SampleRate::ResamplingPeriod resamplingPeriod) noexcept
+std::vector<PositionData> Export::resamplePositionDataForExport(const Aircraft &aircraft, const SampleRate::ResamplingPeriod resamplingPeriod, double maxDeviation) noexcept
 {
     std::vector<PositionData> interpolatedData;
     // Position data
@@ -91,8 +93,9 @@ std::vector<PositionData> Export::resamplePositionDataForExport(const Aircraft &
             const auto duration = position.getLast().timestamp;
             const auto deltaTime = Enum::underly(resamplingPeriod);
             std::int64_t timestamp {0};
+            SampleCursor<PositionData> cursor;
             while (timestamp <= duration) {
-                const auto data = position.interpolate(timestamp, TimeVariableData::Access::NoTimeOffset);
+                const auto &data = position.interpolate(timestamp, TimeVariableData::Access::NoTimeOffset, cursor);
                 if (!data.isNull()) {
                     interpolatedData.push_back(data);
                 }
@@ -100,8 +103,11 @@ std::vector<PositionData> Export::resamplePositionDataForExport(const Aircraft &
             }
         } else {
             // Original data requested
-            interpolatedData.reserve(position.count());
-            std::copy(position.begin(), position.end(), std::back_inserter(interpolatedData));
+            interpolatedData = position.copyData();
+        }
+        if (maxDeviation > 0.0) {
+            // The exported tracks are typically displayed as straight line segments
+            interpolatedData = TrackSimplification::simplify(interpolatedData, maxDeviation, TrackSimplification::Interpolation::Linear);
         }
     }
     return interpolatedData;
@@ -117,8 +123,9 @@ std::vector<EngineData> Export::resampleEngineDataForExport(const Aircraft &airc
             const auto duration = engine.getLast().timestamp;
             const auto deltaTime = Enum::underly(resamplingPeriod);
             std::int64_t timestamp {0};
+            SampleCursor<EngineData> cursor;
             while (timestamp <= duration) {
-                const auto data = engine.interpolate(timestamp, TimeVariableData::Access::NoTimeOffset);
+                const auto &data = engine.interpolate(timestamp, TimeVariableData::Access::NoTimeOffset, cursor);
                 if (!data.isNull()) {
                     interpolatedData.push_back(data);
                 }
@@ -126,8 +133,7 @@ std::vector<EngineData> Export::resampleEngineDataForExport(const Aircraft &airc
             }
         } else {
             // Original data requested
-            interpolatedData.reserve(engine.count());
-            std::copy(engine.begin(), engine.end(), std::back_inserter(interpolatedData));
+            interpolatedData = engine.copyData();
         }
     }
     return interpolatedData;
@@ -143,8 +149,9 @@ std::vector<PrimaryFlightControlData> Export::resamplePrimaryFlightControlDataFo
             const auto duration = primaryFlightControl.getLast().timestamp;
             const auto deltaTime = Enum::underly(resamplingPeriod);
             std::int64_t timestamp {0};
+            SampleCursor<PrimaryFlightControlData> cursor;
             while (timestamp <= duration) {
-                const auto data = primaryFlightControl.interpolate(timestamp, TimeVariableData::Access::NoTimeOffset);
+                const auto &data = primaryFlightControl.interpolate(timestamp, TimeVariableData::Access::NoTimeOffset, cursor);
                 if (!data.isNull()) {
                     interpolatedData.push_back(data);
                 }
@@ -152,8 +159,7 @@ std::vector<PrimaryFlightControlData> Export::resamplePrimaryFlightControlDataFo
             }
         } else {
             // Original data requested
-            interpolatedData.reserve(primaryFlightControl.count());
-            std::copy(primaryFlightControl.begin(), primaryFlightControl.end(), std::back_inserter(interpolatedData));
+            interpolatedData = primaryFlightControl.copyData();
         }
     }
     return interpolatedData;
@@ -169,8 +175,9 @@ std::vector<SecondaryFlightControlData> Export::resampleSecondaryFlightControlDa
             const auto duration = secondaryFlightControl.getLast().timestamp;
             const auto deltaTime = Enum::underly(resamplingPeriod);
             std::int64_t timestamp {0};
+            SampleCursor<SecondaryFlightControlData> cursor;
             while (timestamp <= duration) {
-                const auto data = secondaryFlightControl.interpolate(timestamp, TimeVariableData::Access::NoTimeOffset);
+                const auto &data = secondaryFlightControl.interpolate(timestamp, TimeVariableData::Access::NoTimeOffset, cursor);
                 if (!data.isNull()) {
                     interpolatedData.push_back(data);
                 }
@@ -178,8 +185,7 @@ std::vector<SecondaryFlightControlData> Export::resampleSecondaryFlightControlDa
             }
         } else {
             // Original data requested
-            interpolatedData.reserve(secondaryFlightControl.count());
-            std::copy(secondaryFlightControl.begin(), secondaryFlightControl.end(), std::back_inserter(interpolatedData));
+            interpolatedData = secondaryFlightControl.copyData();
         }
     }
     return interpolatedData;
@@ -195,8 +201,9 @@ std::vector<AircraftHandleData> Export::resampleAircraftHandleDataForExport(cons
             const auto duration = aircraftHandle.getLast().timestamp;
             const auto deltaTime = Enum::underly(resamplingPeriod);
             std::int64_t timestamp {0};
+            SampleCursor<AircraftHandleData> cursor;
             while (timestamp <= duration) {
-                const auto data = aircraftHandle.interpolate(timestamp, TimeVariableData::Access::NoTimeOffset);
+                const auto &data = aircraftHandle.interpolate(timestamp, TimeVariableData::Access::NoTimeOffset, cursor);
                 if (!data.isNull()) {
                     interpolatedData.push_back(data);
                 }
@@ -204,8 +211,7 @@ std::vector<AircraftHandleData> Export::resampleAircraftHandleDataForExport(cons
             }
         } else {
             // Original data requested
-            interpolatedData.reserve(aircraftHandle.count());
-            std::copy(aircraftHandle.begin(), aircraftHandle.end(), std::back_inserter(interpolatedData));
+            interpolatedData = aircraftHandle.copyData();
         }
     }
     return interpolatedData;
@@ -221,8 +227,9 @@ std::vector<LightData> Export::resampleLightDataForExport(const Aircraft &aircra
             const auto duration = light.getLast().timestamp;
             const auto deltaTime = Enum::underly(resamplingPeriod);
             std::int64_t timestamp {0};
+            SampleCursor<LightData> cursor;
             while (timestamp <= duration) {
-                const auto data = light.interpolate(timestamp, TimeVariableData::Access::NoTimeOffset);
+                const auto &data = light.interpolate(timestamp, TimeVariableData::Access::NoTimeOffset, cursor);
                 if (!data.isNull()) {
                     interpolatedData.push_back(data);
                 }
@@ -230,8 +237,7 @@ std::vector<LightData> Export::resampleLightDataForExport(const Aircraft &aircra
             }
         } else {
             // Original data requested
-            interpolatedData.reserve(light.count());
-            std::copy(light.begin(), light.end(), std::back_inserter(interpolatedData));
+            interpolatedData = light.copyData();
         }
     }
     return interpolatedData;
@@ -0,0 +1,188 @@
+/**
+ * Sky Dolly - The Black Sheep for Your Flight Recordings
+ *
+ * Copyright (c) 2020 - 2025 Oliver Knoll
+ *
+ * MIT License
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this
+ * software and associated documentation files (the "Software"), to deal in the Software
+ * without restriction, including without limitation the rights to use, copy, modify, merge,
+ * publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons
+ * to whom the Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or
+ * substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED *AS IS*, WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR
+ * PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE
+ * FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+ * OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ */
+#include <memory>
+#include <string_view>
+#include <cstdint>
+#include <cstddef>
+
+#include <QByteArray>
+#include <QString>
+#include <QDateTime>
+#include <QIODevice>
+
+#include "ExportWriter.h"
+
+namespace
+{
+    constexpr std::int64_t MillisecondsPerDay {24 * 60 * 60 * 1000};
+
+    inline char *writeTwoDigits(char *destination, int value) noexcept
+    {
+        destination[0] = static_cast<char>('0' + value / 10);
+        destination[1] = static_cast<char>('0' + value % 10);
+        return destination + 2;
+    }
+
+    // Floor division, also for timestamps before the epoch
+    inline std::int64_t daysSinceEpoch(std::int64_t msecsSinceEpoch) noexcept
+    {
+        std::int64_t days = msecsSinceEpoch / ::MillisecondsPerDay;
+        if (msecsSinceEpoch % ::MillisecondsPerDay < 0) {
+            --days;
+        }
+        return days;
+    }
+}
+
+// PUBLIC
+
+ExportWriter::ExportWriter(QIODevice &io, std::size_t blockSize) noexcept
+    : m_io(io),
+      m_buffer(std::make_unique<char[]>(blockSize)),
+      m_capacity(blockSize)
+{}
+
+ExportWriter::~ExportWriter()
+{
+    flush();
+}
+
+ExportWriter &ExportWriter::append(const QString &text) noexcept
+{
+    return append(text.toUtf8());
+}
+
+void ExportWriter::setBaseDateTime(const QDateTime &dateTime) noexcept
+{
+    m_hasBaseDateTime = dateTime.isValid();
+    m_baseMSecsSinceEpoch = m_hasBaseDateTime ? dateTime.toMSecsSinceEpoch() : 0;
+    m_hasCachedDay = false;
+}
+
+ExportWriter &ExportWriter::appendIsoDateTime(std::int64_t timestamp, bool withMilliseconds) noexcept
+{
+    if (m_hasBaseDateTime) {
+        const std::int64_t msecsSinceEpoch = m_baseMSecsSinceEpoch + timestamp;
+        const std::int64_t day = ::daysSinceEpoch(msecsSinceEpoch);
+        if (!m_hasCachedDay || day != m_cachedDay) {
+            updateCachedDate(day);
+        }
+        const auto msecsOfDay = static_cast<int>(msecsSinceEpoch - day * ::MillisecondsPerDay);
+        const int seconds = msecsOfDay / 1000;
+
+        // YYYY-MM-DDThh:mm:ss.zzzZ
+        reserve(DateLength + 13);
+        char *destination = std::copy(m_cachedDate, m_cachedDate + DateLength, m_buffer.get() + m_size);
+        destination = ::writeTwoDigits(destination, seconds / 3600);
+        *destination++ = ':';
+        destination = ::writeTwoDigits(destination, (seconds / 60) % 60);
+        *destination++ = ':';
+        destination = ::writeTwoDigits(destination, seconds % 60);
+        if (withMilliseconds) {
+            const int milliseconds = msecsOfDay % 1000;
+            *destination++ = '.';
+            *destination++ = static_cast<char>('0' + milliseconds / 100);
+            destination = ::writeTwoDigits(destination, milliseconds % 100);
+        }
+        *destination++ = 'Z';
+        m_size = static_cast<std::size_t>(destination - m_buffer.get());
+    }
+    return *this;
+}
+
+ExportWriter &ExportWriter::appendTime(std::int64_t timestamp) noexcept
+{
+    if (m_hasBaseDateTime) {
+        const std::int64_t msecsSinceEpoch = m_baseMSecsSinceEpoch + timestamp;
+        const std::int64_t day = ::daysSinceEpoch(msecsSinceEpoch);
+        const int seconds = static_cast<int>(msecsSinceEpoch - day * ::MillisecondsPerDay) / 1000;
+
+        // hhmmss
+        reserve(6);
+        char *destination = m_buffer.get() + m_size;
+        destination = ::writeTwoDigits(destination, seconds / 3600);
+        destination = ::writeTwoDigits(destination, (seconds / 60) % 60);
+        destination = ::writeTwoDigits(destination, seconds % 60);
+        m_size = static_cast<std::size_t>(destination - m_buffer.get());
+    }
+    return *this;
+}
+
+bool ExportWriter::flush() noexcept
+{
+    writeBlock();
+    return m_ok;
+}
+
+// PRIVATE
+
+void ExportWriter::grow(std::size_t capacity) noexcept
+{
+    // Only called with an empty block
+    m_buffer = std::make_unique<char[]>(capacity);
+    m_capacity = capacity;
+}
+
+void ExportWriter::writeBlock() noexcept
+{
+    if (m_size > 0) {
+        writeDirectly(std::string_view(m_buffer.get(), m_size));
+        m_size = 0;
+    }
+}
+
+void ExportWriter::writeDirectly(std::string_view text) noexcept
+{
+    if (m_ok) {
+        const auto size = static_cast<qint64>(text.size());
+        m_ok = m_io.write(text.data(), size) == size;
+    }
+}
+
+void ExportWriter::updateCachedDate(std::int64_t day) noexcept
+{
+    // Civil date from days since the epoch (proleptic Gregorian calendar), see
+    // https://howardhinnant.github.io/date_algorithms.html#civil_from_days
+    const std::int64_t z = day + 719468;
+    const std::int64_t era = (z >= 0 ? z : z - 146096) / 146097;
+    const std::int64_t dayOfEra = z - era * 146097;
+    const std::int64_t yearOfEra = (dayOfEra - dayOfEra / 1460 + dayOfEra / 36524 - dayOfEra / 146096) / 365;
+    const std::int64_t dayOfYear = dayOfEra - (365 * yearOfEra + yearOfEra / 4 - yearOfEra / 100);
+    const std::int64_t mp = (5 * dayOfYear + 2) / 153;
+    const auto dayOfMonth = static_cast<int>(dayOfYear - (153 * mp + 2) / 5 + 1);
+    const auto month = static_cast<int>(mp < 10 ? mp + 3 : mp - 9);
+    const auto year = static_cast<int>(yearOfEra + era * 400 + (month <= 2 ? 1 : 0));
+
+    // YYYY-MM-DDT
+    char *destination = ::writeTwoDigits(m_cachedDate, (year / 100) % 100);
+    destination = ::writeTwoDigits(destination, year % 100);
+    *destination++ = '-';
+    destination = ::writeTwoDigits(destination, month);
+    *destination++ = '-';
+    destination = ::writeTwoDigits(destination, dayOfMonth);
+    *destination = 'T';
+
+    m_cachedDay = day;
+    m_hasCachedDay = true;
+}
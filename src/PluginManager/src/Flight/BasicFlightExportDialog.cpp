@@ -34,6 +34,7 @@
 #include <QFileDialog>
 #include <QComboBox>
 #include <QCheckBox>
+#include <QDoubleSpinBox>
 
 #include <Kernel/Settings.h>
 #include <Kernel/SampleRate.h>
@@ -48,6 +49,12 @@
 #include "Export.h"
 #include "ui_BasicFlightExportDialog.h"
 
+namespace
+{
+    constexpr double MaxSimplificationDeviation {1000.0};
+    constexpr double SimplificationDeviationStep {0.5};
+}
+
 struct BasicFlightExportDialogPrivate
 {
     BasicFlightExportDialogPrivate(const Flight &theFlight, QString fileExtension, QString fileFilter, FlightExportPluginBaseSettings &thePluginSettings) noexcept
@@ -141,6 +148,14 @@ void BasicFlightExportDialog::initBasicUi() noexcept
     ui->resamplingComboBox->addItem(tr("Original data (no resampling)"), Enum::underly(SampleRate::ResamplingPeriod::Original));
     ui->resamplingComboBox->setToolTip(tr("Defines the rate at which the data will be resampled for the export. The file size is either reduced or increased."));
 
+    // Simplification
+    const bool simplificationSupported = d->pluginSettings.isSimplificationSupported();
+    ui->simplificationLabel->setVisible(simplificationSupported);
+    ui->simplificationSpinBox->setVisible(simplificationSupported);
+    ui->simplificationSpinBox->setRange(0.0, ::MaxSimplificationDeviation);
+    ui->simplificationSpinBox->setSingleStep(::SimplificationDeviationStep);
+    ui->simplificationSpinBox->setToolTip(tr("Simplifies the exported track such that it deviates at most the given distance from the (resampled) position data. The file size is typically reduced considerably."));
+
     ui->openExportCheckBox->setToolTip(tr("Open the exported file with the default application registered with this file type."));
 }
 
@@ -176,6 +191,11 @@ void BasicFlightExportDialog::updateDataGroupBox() noexcept
     } else {
         infoText.append(" " % tr("The original recorded data will be exported, resulting in total %Ln exported positions.", nullptr, static_cast<int>(samplePoints)));
     }
+    const double maxDeviation = d->pluginSettings.getSimplificationMaxDeviation();
+    if (d->pluginSettings.isSimplificationSupported() && maxDeviation > 0.0) {
+        infoText.append(" " % tr("The track will be simplified with a maximum deviation of %1 meters, further reducing the number of exported positions.")
+                                 .arg(d->unit.formatNumber(maxDeviation, 1)));
+    }
     ui->infoLabel->setText(infoText);
 }
 
@@ -189,6 +209,8 @@ void BasicFlightExportDialog::frenchConnection() noexcept
             this, &BasicFlightExportDialog::onFormationExportChanged);
     connect(ui->resamplingComboBox, &QComboBox::currentIndexChanged,
             this, &BasicFlightExportDialog::onResamplingOptionChanged);
+    connect(ui->simplificationSpinBox, &QDoubleSpinBox::valueChanged,
+            this, &BasicFlightExportDialog::onSimplificationChanged);
     connect(ui->openExportCheckBox, &QCheckBox::toggled,
             this, &BasicFlightExportDialog::onDoOpenExportedFilesChanged);
     connect(&d->pluginSettings, &FlightExportPluginBaseSettings::changed,
@@ -281,6 +303,7 @@ void BasicFlightExportDialog::updateUi() noexcept
         break;
     }
 
+    ui->simplificationSpinBox->setValue(d->pluginSettings.getSimplificationMaxDeviation());
     ui->openExportCheckBox->setChecked(d->pluginSettings.isOpenExportedFilesEnabled());
 
     updateDataGroupBox();
@@ -312,6 +335,11 @@ void BasicFlightExportDialog::onResamplingOptionChanged() noexcept
     d->pluginSettings.setResamplingPeriod(static_cast<SampleRate::ResamplingPeriod>(ui->resamplingComboBox->currentData().toInt()));
 }
 
+void BasicFlightExportDialog::onSimplificationChanged(double maxDeviation) noexcept
+{
+    d->pluginSettings.setSimplificationMaxDeviation(maxDeviation);
+}
+
 void BasicFlightExportDialog::onDoOpenExportedFilesChanged(bool enable) noexcept
 {
     d->pluginSettings.setOpenExportedFilesEnabled(enable);
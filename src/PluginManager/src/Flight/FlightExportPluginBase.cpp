@@ -42,6 +42,7 @@
 
 #include <Kernel/Settings.h>
 #include <Kernel/File.h>
+#include <Kernel/Trace.h>
 #include <Model/Flight.h>
 #include <Model/Aircraft.h>
 #include <Flight/BasicFlightExportDialog.h>
@@ -127,6 +128,7 @@ void FlightExportPluginBase::restoreSettings(const Settings::ValuesByKey &values
 
 bool FlightExportPluginBase::exportFlight(const Flight &flight, const QString &filePath) const noexcept
 {
+    Trace::Scope trace {Trace::Export, "Export flight"};
     d->exportedFilePaths.clear();
     QFile file(filePath);
     bool ok {true};
@@ -32,11 +32,14 @@ namespace
 {
     // Keys
     constexpr const char *ResamplingPeriodKey {"ResamplingPeriod"};
+    constexpr const char *SimplificationMaxDeviationKey {"SimplificationMaxDeviation"};
     constexpr const char *FormationExportKey {"FormationExport"};
     constexpr const char *OpenExportedFilesEnabledKey {"OpenExportedFilesEnabled"};
 
     // Defaults
     constexpr SampleRate::ResamplingPeriod DefaultResamplingPeriod {SampleRate::ResamplingPeriod::OneHz};
+    // No simplification
+    constexpr double DefaultSimplificationMaxDeviation {0.0};
     constexpr FlightExportPluginBaseSettings::FormationExport DefaultFormationExport {FlightExportPluginBaseSettings::FormationExport::AllAircraftOneFile};
     constexpr bool DefaultOpenExportedFilesEnabled {false};
 }
@@ -45,11 +48,13 @@ struct FlightExportPluginBaseSettingsPrivate
 {
     FlightExportPluginBaseSettingsPrivate()
         : resamplingPeriod(::DefaultResamplingPeriod),
+          simplificationMaxDeviation(::DefaultSimplificationMaxDeviation),
           formationExport(::DefaultFormationExport),
           openExportedFilesEnabled(::DefaultOpenExportedFilesEnabled)
     {}
 
     SampleRate::ResamplingPeriod resamplingPeriod;
+    double simplificationMaxDeviation;
     FlightExportPluginBaseSettings::FormationExport formationExport;
     bool openExportedFilesEnabled;
 };
@@ -75,6 +80,19 @@ void FlightExportPluginBaseSettings::setResamplingPeriod(SampleRate::ResamplingP
     }
 }
 
+double FlightExportPluginBaseSettings::getSimplificationMaxDeviation() const noexcept
+{
+    return d->simplificationMaxDeviation;
+}
+
+void FlightExportPluginBaseSettings::setSimplificationMaxDeviation(double maxDeviation) noexcept
+{
+    if (d->simplificationMaxDeviation != maxDeviation) {
+        d->simplificationMaxDeviation = maxDeviation;
+        emit changed();
+    }
+}
+
 FlightExportPluginBaseSettings::FormationExport FlightExportPluginBaseSettings::getFormationExport() const noexcept
 {
     return d->formationExport;
@@ -109,6 +127,10 @@ void FlightExportPluginBaseSettings::addSettings(Settings::KeyValues &keyValues)
     keyValue.second = Enum::underly(d->resamplingPeriod);
     keyValues.push_back(keyValue);
 
+    keyValue.first = ::SimplificationMaxDeviationKey;
+    keyValue.second = d->simplificationMaxDeviation;
+    keyValues.push_back(keyValue);
+
     keyValue.first = ::FormationExportKey;
     keyValue.second = Enum::underly(d->formationExport);
     keyValues.push_back(keyValue);
@@ -128,6 +150,10 @@ void FlightExportPluginBaseSettings::addKeysWithDefaults(Settings::KeysWithDefau
     keyValue.second = Enum::underly(::DefaultResamplingPeriod);
     keysWithDefaults.push_back(keyValue);
 
+    keyValue.first = ::SimplificationMaxDeviationKey;
+    keyValue.second = ::DefaultSimplificationMaxDeviation;
+    keysWithDefaults.push_back(keyValue);
+
     keyValue.first = ::FormationExportKey;
     keyValue.second = Enum::underly(::DefaultFormationExport);
     keysWithDefaults.push_back(keyValue);
@@ -145,6 +171,9 @@ void FlightExportPluginBaseSettings::restoreSettings(const Settings::ValuesByKey
     auto enumValue = valuesByKey.at(::ResamplingPeriodKey).toInt(&ok);
     d->resamplingPeriod = ok && Enum::contains<SampleRate::ResamplingPeriod>(enumValue) ? static_cast<SampleRate::ResamplingPeriod>(enumValue) : ::DefaultResamplingPeriod;
 
+    const double maxDeviation = valuesByKey.at(::SimplificationMaxDeviationKey).toDouble(&ok);
+    d->simplificationMaxDeviation = ok && maxDeviation >= 0.0 ? maxDeviation : ::DefaultSimplificationMaxDeviation;
+
     enumValue = valuesByKey.at(::FormationExportKey).toInt(&ok);
     d->formationExport = ok && Enum::contains<FormationExport>(enumValue) ? static_cast<FormationExport>(enumValue) : ::DefaultFormationExport;
 
@@ -158,6 +187,7 @@ void FlightExportPluginBaseSettings::restoreSettings(const Settings::ValuesByKey
 void FlightExportPluginBaseSettings::restoreDefaults() noexcept
 {
     d->resamplingPeriod = ::DefaultResamplingPeriod;
+    d->simplificationMaxDeviation = ::DefaultSimplificationMaxDeviation;
     d->formationExport = ::DefaultFormationExport;
     d->openExportedFilesEnabled = ::DefaultOpenExportedFilesEnabled;
 
@@ -42,6 +42,7 @@
 #include <Kernel/Settings.h>
 #include <Kernel/SkyMath.h>
 #include <Kernel/Convert.h>
+#include <Kernel/Trace.h>
 #include <Model/Flight.h>
 #include <Model/FlightData.h>
 #include <Model/FlightCondition.h>
@@ -171,6 +172,7 @@ void FlightImportPluginBase::restoreSettings(const Settings::ValuesByKey &values
 
 bool FlightImportPluginBase::importFlights(const QStringList &filePaths, Flight &currentFlight) noexcept
 {
+    Trace::Scope trace {Trace::Import, "Import flights"};
     const FlightImportPluginBaseSettings &pluginSettings = getPluginSettings();
     const bool importDirectory = pluginSettings.isImportDirectoryEnabled();
     const FlightImportPluginBaseSettings::AircraftImportMode aircraftImportMode = pluginSettings.getAircraftImportMode();
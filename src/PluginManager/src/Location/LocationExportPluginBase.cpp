@@ -40,6 +40,7 @@
 #include <QDesktopServices>
 
 #include <Kernel/File.h>
+#include <Kernel/Trace.h>
 #include <Persistence/Service/LocationService.h>
 #include <Persistence/Service/EnumerationService.h>
 #include <Persistence/PersistenceManager.h>
@@ -133,6 +134,7 @@ void LocationExportPluginBase::restoreSettings(const Settings::ValuesByKey &valu
 
 bool LocationExportPluginBase::exportLocations(const std::vector<Location> &locations, const QString &filePath) const noexcept
 {
+    Trace::Scope trace {Trace::Export, "Export locations"};
     QFile file(filePath);
     bool ok {true};
 #ifdef DEBUG
@@ -36,6 +36,7 @@
 #include <QGuiApplication>
 
 #include <Kernel/File.h>
+#include <Kernel/Trace.h>
 #include <Persistence/Service/LocationService.h>
 #include <Persistence/PersistenceManager.h>
 #include <Location/BasicLocationImportDialog.h>
@@ -119,6 +120,7 @@ void LocationImportPluginBase::restoreSettings(const Settings::ValuesByKey &valu
 
 bool LocationImportPluginBase::importLocations(const QStringList &filePaths) noexcept
 {
+    Trace::Scope trace {Trace::Import, "Import locations"};
     const LocationImportPluginBaseSettings &pluginSettings = getPluginSettings();
     const bool importDirectory = pluginSettings.isImportDirectoryEnabled();
 
@@ -21,6 +21,8 @@
  * OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
  * DEALINGS IN THE SOFTWARE.
  */
+#include <chrono>
+
 #include <QWidget>
 #include <QAction>
 #include <QUuid>
@@ -29,8 +31,12 @@
 
 #include <Kernel/Settings.h>
 #include <Model/Logbook.h>
+#include <Model/Flight.h>
+#include <Model/Aircraft.h>
 #include <Persistence/Service/FlightService.h>
+#include <Persistence/Service/AircraftService.h>
 #include <Persistence/PersistenceManager.h>
+#include <Persistence/RecordingJournal.h>
 #include <Module/ModuleBaseSettings.h>
 #include <Module/AbstractModule.h>
 #include <Connect/SkyConnectIntf.h>
@@ -39,6 +45,8 @@
 struct AbstractModulePrivate
 {
     std::unique_ptr<FlightService> flightService {std::make_unique<FlightService>()};
+    std::unique_ptr<AircraftService> aircraftService {std::make_unique<AircraftService>()};
+    RecordingJournal recordingJournal;
 };
 
 // PUBLIC
@@ -148,12 +156,33 @@ void AbstractModule::onStartReplay() noexcept
     skyConnectManager.startReplay(skyConnectManager.isAtEnd());
 }
 
+RecordingJournal &AbstractModule::getRecordingJournal() const noexcept
+{
+    return d->recordingJournal;
+}
+
+void AbstractModule::compactOnStore(Aircraft &aircraft) const noexcept
+{
+    const double maxDeviation = Settings::getInstance().getCompactOnStoreMaxDeviation();
+    if (maxDeviation > 0.0) {
+        // On failure the recorded position data simply remains as stored
+        d->aircraftService->compactPositionData(aircraft, maxDeviation);
+    }
+}
+
 // PROTECTED SLOTS
 
 void AbstractModule::onRecordingStopped() noexcept
 {
-    const bool ok = d->flightService->storeFlight(Logbook::getInstance().getCurrentFlight());
+    auto &flight = Logbook::getInstance().getCurrentFlight();
+    // The recording journal may already have stored the recording incrementally
+    bool ok = d->recordingJournal.finish(flight);
     if (!ok) {
+        ok = d->flightService->storeFlight(flight);
+    }
+    if (ok) {
+        compactOnStore(flight.getUserAircraft());
+    } else {
         const auto &persistenceManager = PersistenceManager::getInstance();
         const QString logbookPath = QDir::toNativeSeparators(persistenceManager.getLogbookPath());
         QMessageBox::critical(getWidget(), tr("Write Error"), tr("The flight could not be stored into the logbook %1.").arg(logbookPath));
@@ -180,6 +209,18 @@ void AbstractModule::restoreSettings(const Settings::ValuesByKey &valuesByKey) n
 void AbstractModule::frenchConnection() noexcept
 {
     auto &skyConnectManager = SkyConnectManager::getInstance();
+    connect(&skyConnectManager, &SkyConnectManager::recordingStarted,
+            this, &AbstractModule::onRecordingStarted);
     connect(&skyConnectManager, &SkyConnectManager::recordingStopped,
             this, &AbstractModule::onRecordingStopped);
 }
+
+// PRIVATE SLOTS
+
+void AbstractModule::onRecordingStarted() noexcept
+{
+    const auto &settings = Settings::getInstance();
+    if (settings.isIncrementalPersistenceEnabled()) {
+        d->recordingJournal.start(std::chrono::seconds(settings.getIncrementalPersistenceIntervalSeconds()));
+    }
+}
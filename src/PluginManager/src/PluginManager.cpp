@@ -206,6 +206,44 @@ bool PluginManager::exportFlight(const Flight &flight, const QUuid &pluginUuid)
     return ok;
 }
 
+bool PluginManager::exportFlightData(const QUuid &pluginUuid, const FlightData &flightData, QIODevice &io) const noexcept
+{
+    bool ok {false};
+    if (d->flightExportPluginRegistry.contains(pluginUuid)) {
+        const QString pluginPath {d->flightExportPluginRegistry[pluginUuid]};
+        d->pluginLoader->setFileName(pluginPath);
+        QObject *plugin = d->pluginLoader->instance();
+        auto *exportPlugin = qobject_cast<FlightExportIntf *>(plugin);
+        if (exportPlugin != nullptr) {
+            exportPlugin->setParentWidget(d->parentWidget);
+            exportPlugin->restoreSettings(pluginUuid);
+            ok = exportPlugin->exportFlightData(flightData, io);
+            exportPlugin->storeSettings(pluginUuid);
+        }
+        d->pluginLoader->unload();
+    }
+    return ok;
+}
+
+bool PluginManager::exportAircraftData(const QUuid &pluginUuid, const FlightData &flightData, const Aircraft &aircraft, QIODevice &io) const noexcept
+{
+    bool ok {false};
+    if (d->flightExportPluginRegistry.contains(pluginUuid)) {
+        const QString pluginPath {d->flightExportPluginRegistry[pluginUuid]};
+        d->pluginLoader->setFileName(pluginPath);
+        QObject *plugin = d->pluginLoader->instance();
+        auto *exportPlugin = qobject_cast<FlightExportIntf *>(plugin);
+        if (exportPlugin != nullptr) {
+            exportPlugin->setParentWidget(d->parentWidget);
+            exportPlugin->restoreSettings(pluginUuid);
+            ok = exportPlugin->exportAircraft(flightData, aircraft, io);
+            exportPlugin->storeSettings(pluginUuid);
+        }
+        d->pluginLoader->unload();
+    }
+    return ok;
+}
+
 bool PluginManager::importLocations(const QUuid &pluginUuid) const noexcept
 {
     bool ok {false};
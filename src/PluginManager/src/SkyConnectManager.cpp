@@ -392,6 +392,18 @@ bool SkyConnectManager::isAtEnd() const noexcept
     return skyConnect ? skyConnect->get().isEndReached() : false;
 }
 
+ReplayStatistics SkyConnectManager::getReplayStatistics() const noexcept
+{
+    std::optional<std::reference_wrapper<SkyConnectIntf>> skyConnect = getCurrentSkyConnect();
+    return skyConnect ? skyConnect->get().getReplayStatistics() : ReplayStatistics();
+}
+
+CaptureStatistics SkyConnectManager::getCaptureStatistics() const noexcept
+{
+    std::optional<std::reference_wrapper<SkyConnectIntf>> skyConnect = getCurrentSkyConnect();
+    return skyConnect ? skyConnect->get().getCaptureStatistics() : CaptureStatistics();
+}
+
 bool SkyConnectManager::requestLocation() const noexcept
 {
     std::optional<std::reference_wrapper<SkyConnectIntf>> skyConnect = getCurrentSkyConnect();
@@ -45,6 +45,7 @@
 #include <Kernel/Enum.h>
 #include <Kernel/File.h>
 #include <Kernel/Settings.h>
+#include <Kernel/Trace.h>
 #include <Model/Flight.h>
 #include <Model/Aircraft.h>
 #include <Model/AircraftInfo.h>
@@ -66,6 +67,8 @@
 #include <Model/Waypoint.h>
 #include <Model/InitialPosition.h>
 #include <PluginManager/Connect/Connect.h>
+#include <PluginManager/Connect/FrameSnapshot.h>
+#include <PluginManager/Connect/CaptureQueue.h>
 #include <PluginManager/Connect/FlightSimulatorShortcuts.h>
 #include "SimVar/SimulationVariables.h"
 #include "SimVar/SimConnectType.h"
@@ -396,9 +399,16 @@ bool MSFSSimConnectPlugin::sendAircraftData(std::int64_t currentTimestamp, TimeV
     // by setting the userAircraftId to an invalid ID, so no aircraft in the Flight is considered the "user aircraft"
     // (which is really being controlled by the user as an "additional aircraft", next to the formation)
     const std::int64_t userAircraftId = getReplayMode() != ReplayMode::FlyWithFormation ?  flight.getUserAircraft().getId() : Const::InvalidId;
+    // The user aircraft is not interpolated at all when it is not going to be sent: while it is being
+    // recorded or manually flown, or when only the user aircraft is selected in "fly with formation" mode
+    // (in which no aircraft of the formation is considered the user aircraft)
+    const bool skipUserAircraft = getState() == Connect::State::Recording ||
+                                  getReplayMode() == ReplayMode::UserAircraftManualControl ||
+                                  (aircraftSelection == AircraftSelection::UserAircraft && getReplayMode() == ReplayMode::FlyWithFormation);
     bool ok {true};
-    for (const auto &aircraft : flight) {
+    for (const auto &aircraftSnapshot : updateFrameSnapshot(currentTimestamp, access, aircraftSelection, skipUserAircraft)) {
 
+        const auto &aircraft = flight[aircraftSnapshot.aircraftIndex];
         // Replay AI aircraft - if any - during recording (if all aircraft are selected for replay)
         const bool isUserAircraft = aircraft.getId() == userAircraftId;
         if (isUserAircraft && getReplayMode() == ReplayMode::UserAircraftManualControl) {
@@ -418,8 +428,8 @@ bool MSFSSimConnectPlugin::sendAircraftData(std::int64_t currentTimestamp, TimeV
             if (objectId != SimConnectAi::InvalidObjectId) {
 
                 ok = true;
-                const auto positionData = aircraft.getPosition().interpolate(currentTimestamp, access);
-                const auto attitudeData = aircraft.getAttitude().interpolate(currentTimestamp, access);
+                const auto &positionData = aircraftSnapshot.position;
+                const auto &attitudeData = aircraftSnapshot.attitude;
                 if (!positionData.isNull()) {
                     SimConnectPositionAndAttitudeAll simConnnectPositionAndAttitudeAll {positionData, attitudeData};
                     if (isUserAircraft) {
@@ -449,7 +459,7 @@ bool MSFSSimConnectPlugin::sendAircraftData(std::int64_t currentTimestamp, TimeV
 
                 // Engine
                 if (ok) {
-                    const auto engineData = aircraft.getEngine().interpolate(currentTimestamp, access);
+                    const auto &engineData = aircraftSnapshot.engine;
                     if (!engineData.isNull()) {
                         SimConnectEngineAll simConnectEngineAll {engineData};
                         if (isUserAircraft) {
@@ -473,7 +483,7 @@ bool MSFSSimConnectPlugin::sendAircraftData(std::int64_t currentTimestamp, TimeV
 
                 // Primary flight controls
                 if (ok) {
-                    const auto primaryFlightControlData = aircraft.getPrimaryFlightControl().interpolate(currentTimestamp, access);
+                    const auto &primaryFlightControlData = aircraftSnapshot.primaryFlightControl;
                     if (!primaryFlightControlData.isNull()) {
                         SimConnectPrimaryFlightControlAll simConnectPrimaryFlightControlAll {primaryFlightControlData};
                         if (isUserAircraft) {
@@ -490,7 +500,7 @@ bool MSFSSimConnectPlugin::sendAircraftData(std::int64_t currentTimestamp, TimeV
 
                 // Secondary flight controls
                 if (ok) {
-                    const auto secondaryFlightControlData = aircraft.getSecondaryFlightControl().interpolate(currentTimestamp, access);
+                    const auto &secondaryFlightControlData = aircraftSnapshot.secondaryFlightControl;
                     if (!secondaryFlightControlData.isNull()) {
                         SimConnectSecondaryFlightControlAll simConnectSecondaryFlightControlAll {secondaryFlightControlData};
                         if (isUserAircraft) {
@@ -507,7 +517,7 @@ bool MSFSSimConnectPlugin::sendAircraftData(std::int64_t currentTimestamp, TimeV
 
                 // Aircraft handles & brakes
                 if (ok) {
-                    const auto aircraftHandleData = aircraft.getAircraftHandle().interpolate(currentTimestamp, access);
+                    const auto &aircraftHandleData = aircraftSnapshot.aircraftHandle;
                     if (!aircraftHandleData.isNull()) {
                         SimConnectAircraftHandleAll simConnectAircraftHandleAll {aircraftHandleData};
                         if (isUserAircraft) {
@@ -531,7 +541,7 @@ bool MSFSSimConnectPlugin::sendAircraftData(std::int64_t currentTimestamp, TimeV
 
                 // Lights
                 if (ok) {
-                    const auto lightData = aircraft.getLight().interpolate(currentTimestamp, access);
+                    const auto &lightData = aircraftSnapshot.light;
                     if (!lightData.isNull()) {
                         SimConnectLightAll simConnectLightAll {lightData};
                         if (isUserAircraft) {
@@ -710,6 +720,7 @@ void MSFSSimConnectPlugin::setupRequestData() noexcept
 
 void MSFSSimConnectPlugin::replay() noexcept
 {
+    Trace::Scope trace {Trace::Replay, "Replay frame"};
     const std::int64_t currentTimestamp = getCurrentTimestamp();
     if (currentTimestamp <= getCurrentFlight().getTotalDurationMSec()) {
         if (!sendAircraftData(currentTimestamp, TimeVariableData::Access::Linear, AircraftSelection::All)) {
@@ -1010,6 +1021,7 @@ void CALLBACK MSFSSimConnectPlugin::dispatch(::SIMCONNECT_RECV *receivedData, [[
 
     case ::SIMCONNECT_RECV_ID_SIMOBJECT_DATA:
     {
+        Trace::Scope trace {Trace::Recording, "Receive sample data"};
         objectData = static_cast<::SIMCONNECT_RECV_SIMOBJECT_DATA *>(receivedData);
 
         switch (static_cast<SimConnectType::DataRequest>(objectData->dwRequestID)) {
@@ -1019,7 +1031,7 @@ void CALLBACK MSFSSimConnectPlugin::dispatch(::SIMCONNECT_RECV *receivedData, [[
                 auto simConnectPositionAll = reinterpret_cast<const SimConnectPositionAll *>(&objectData->dwData);
                 PositionData positionData = simConnectPositionAll->toPositionData();
                 positionData.timestamp = skyConnect->getCurrentTimestamp();
-                userAircraft.getPosition().upsertLast(positionData);
+                skyConnect->getCaptureQueue().push(positionData);
                 dataStored = true;
             }
             break;
@@ -1030,7 +1042,7 @@ void CALLBACK MSFSSimConnectPlugin::dispatch(::SIMCONNECT_RECV *receivedData, [[
                 auto simConnectAttitudeAll = reinterpret_cast<const SimConnectAttitudeAll *>(&objectData->dwData);
                 AttitudeData attitudeData = simConnectAttitudeAll->toAttitudeData();
                 attitudeData.timestamp = skyConnect->getCurrentTimestamp();
-                userAircraft.getAttitude().upsertLast(attitudeData);
+                skyConnect->getCaptureQueue().push(attitudeData);
                 dataStored = true;
             }
             break;
@@ -1041,7 +1053,7 @@ void CALLBACK MSFSSimConnectPlugin::dispatch(::SIMCONNECT_RECV *receivedData, [[
                 auto simConnectEngineAll = reinterpret_cast<const SimConnectEngineAll *>(&objectData->dwData);
                 EngineData engineData = simConnectEngineAll->toEngineData();
                 engineData.timestamp = skyConnect->getCurrentTimestamp();
-                userAircraft.getEngine().upsertLast(engineData);
+                skyConnect->getCaptureQueue().push(engineData);
                 dataStored = true;
             }
             break;
@@ -1052,7 +1064,7 @@ void CALLBACK MSFSSimConnectPlugin::dispatch(::SIMCONNECT_RECV *receivedData, [[
                 auto simConnectPrimaryFlightControlAll = reinterpret_cast<const SimConnectPrimaryFlightControlAll *>(&objectData->dwData);
                 PrimaryFlightControlData primaryFlightControlData = simConnectPrimaryFlightControlAll->toPrimaryFlightControlData();
                 primaryFlightControlData.timestamp = skyConnect->getCurrentTimestamp();
-                userAircraft.getPrimaryFlightControl().upsertLast(primaryFlightControlData);
+                skyConnect->getCaptureQueue().push(primaryFlightControlData);
                 dataStored = true;
             }
             break;
@@ -1063,7 +1075,7 @@ void CALLBACK MSFSSimConnectPlugin::dispatch(::SIMCONNECT_RECV *receivedData, [[
                 auto simConnectSecondaryFlightControlAll = reinterpret_cast<const SimConnectSecondaryFlightControlAll *>(&objectData->dwData);
                 SecondaryFlightControlData secondaryFlightControlData = simConnectSecondaryFlightControlAll->toSecondaryFlightControlData();
                 secondaryFlightControlData.timestamp = skyConnect->getCurrentTimestamp();
-                userAircraft.getSecondaryFlightControl().upsertLast(secondaryFlightControlData);
+                skyConnect->getCaptureQueue().push(secondaryFlightControlData);
                 dataStored = true;
             }
             break;
@@ -1074,7 +1086,7 @@ void CALLBACK MSFSSimConnectPlugin::dispatch(::SIMCONNECT_RECV *receivedData, [[
                 auto simConnectAircraftHandleAll = reinterpret_cast<const SimConnectAircraftHandleAll *>(&objectData->dwData);
                 AircraftHandleData aircraftHandleData = simConnectAircraftHandleAll->toAircraftHandleData();
                 aircraftHandleData.timestamp = skyConnect->getCurrentTimestamp();
-                userAircraft.getAircraftHandle().upsertLast(aircraftHandleData);
+                skyConnect->getCaptureQueue().push(aircraftHandleData);
                 dataStored = true;
             }
             break;
@@ -1085,7 +1097,7 @@ void CALLBACK MSFSSimConnectPlugin::dispatch(::SIMCONNECT_RECV *receivedData, [[
                 auto simConnectLightAll = reinterpret_cast<const SimConnectLightAll *>(&objectData->dwData);
                 LightData lightData = simConnectLightAll->toLightData();
                 lightData.timestamp = skyConnect->getCurrentTimestamp();
-                userAircraft.getLight().upsertLast(lightData);
+                skyConnect->getCaptureQueue().push(lightData);
                 dataStored = true;
             }
             break;
@@ -1354,6 +1366,10 @@ void MSFSSimConnectPlugin::processSimConnectEvent() noexcept
     updateCurrentTimestamp();
     // Process system events
     ::SimConnect_CallDispatch(d->simConnectHandle, MSFSSimConnectPlugin::dispatch, this);
+    if (getState() == Connect::State::Recording) {
+        // Append the samples captured by this dispatch
+        drainCaptureQueue();
+    }
 }
 
 void MSFSSimConnectPlugin::emitActiveAction() noexcept
@@ -38,6 +38,7 @@
 #include <Model/PositionData.h>
 #include <Model/Attitude.h>
 #include <Model/AttitudeData.h>
+#include <Model/SampleCursor.h>
 #include "SimVar/SimConnectType.h"
 #include "SimVar/SimulationVariables.h"
 #include "SimVar/PositionAndAttitude/SimConnectPositionAndAttitudeAll.h"
@@ -77,8 +78,10 @@ void SimConnectAi::addObject(const Aircraft &aircraft, std::int64_t timestamp) n
         const auto &aircraftInfo = aircraft.getAircraftInfo();
         const auto &position = aircraft.getPosition();
         const auto &attitude = aircraft.getAttitude();
-        const auto positionData = position.interpolate(timestamp, TimeVariableData::Access::DiscreteSeek);
-        const auto attitudeData = attitude.interpolate(timestamp, TimeVariableData::Access::DiscreteSeek);
+        SampleCursor<PositionData> positionCursor;
+        SampleCursor<AttitudeData> attitudeCursor;
+        const auto &positionData = position.interpolate(timestamp, TimeVariableData::Access::DiscreteSeek, positionCursor);
+        const auto &attitudeData = attitude.interpolate(timestamp, TimeVariableData::Access::DiscreteSeek, attitudeCursor);
         const ::SIMCONNECT_DATA_INITPOSITION initialPosition = SimConnectPositionAndAttitudeAll::toInitialPosition(positionData, attitudeData, aircraftInfo.initialAirspeed);
 
         const ::SIMCONNECT_DATA_REQUEST_ID requestId = Enum::underly(SimConnectType::DataRequest::AiObjectBase) + d->lastAiCreateRequestId;
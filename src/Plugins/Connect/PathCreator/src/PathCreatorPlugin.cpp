@@ -39,6 +39,7 @@
 #include <Kernel/SkyMath.h>
 #include <Kernel/Enum.h>
 #include <Kernel/Unit.h>
+#include <Kernel/Trace.h>
 #include <Model/TimeVariableData.h>
 #include <Model/Flight.h>
 #include <Model/Aircraft.h>
@@ -66,6 +67,9 @@
 #include <Model/FlightCondition.h>
 #include <Model/SimType.h>
 #include <PluginManager/Connect/AbstractSkyConnect.h>
+#include <PluginManager/Connect/ReplayScheduler.h>
+#include <PluginManager/Connect/FrameSnapshot.h>
+#include <PluginManager/Connect/CaptureQueue.h>
 #include <PluginManager/Connect/FlightSimulatorShortcuts.h>
 #include "PathCreatorSettings.h"
 #include "PathCreatorOptionWidget.h"
@@ -77,7 +81,6 @@ namespace {
     constexpr int ReplayRate = 60;
     // Implementation note: std:round will become constexpr with C++23
     const int RecordingPeriod = static_cast<int>(std::round(1000.0 / RecordingRate));
-    const int ReplayPeriod = static_cast<int>(std::round(1000.0 / ReplayRate));
 }
 
 struct PathCreatorPluginPrivate
@@ -86,13 +89,11 @@ struct PathCreatorPluginPrivate
         : randomGenerator {QRandomGenerator::global()}
     {
         recordingTimer.setTimerType(Qt::TimerType::PreciseTimer);
-        replayTimer.setTimerType(Qt::TimerType::PreciseTimer);
     }
 
     PathCreatorSettings pluginSettings;
 
     QTimer recordingTimer;
-    QTimer replayTimer;
     QRandomGenerator *randomGenerator;
     bool connected {false};
 
@@ -222,16 +223,16 @@ void PathCreatorPlugin::onStopRecording() noexcept
 }
 
 bool PathCreatorPlugin::onStartReplay([[maybe_unused]] std::int64_t currentTimestamp) noexcept {
-    d->replayTimer.start(::ReplayPeriod);
+    getReplayScheduler().start(::ReplayRate);
     return true;
 }
 
 void PathCreatorPlugin::onReplayPaused([[maybe_unused]] Initiator initiator, bool enable) noexcept
 {
     if (enable) {
-         d->replayTimer.stop();
+        getReplayScheduler().stop();
     } else {
-        d->replayTimer.start(::ReplayPeriod);
+        getReplayScheduler().start(::ReplayRate);
     }
 #ifdef DEBUG
     qDebug() << "PathCreatorPlugin::onReplayPaused: enable:" << enable;
@@ -240,21 +241,22 @@ void PathCreatorPlugin::onReplayPaused([[maybe_unused]] Initiator initiator, boo
 
 void PathCreatorPlugin::onStopReplay() noexcept
 {
-    d->replayTimer.stop();
+    getReplayScheduler().stop();
 }
 
 void PathCreatorPlugin::onSeek([[maybe_unused]] std::int64_t currentTimestamp, [[maybe_unused]] SeekMode seekMode) noexcept
 {}
 
-bool PathCreatorPlugin::sendAircraftData(std::int64_t currentTimestamp, TimeVariableData::Access access, [[maybe_unused]] AircraftSelection aircraftSelection) noexcept
+bool PathCreatorPlugin::sendAircraftData(std::int64_t currentTimestamp, TimeVariableData::Access access, AircraftSelection aircraftSelection) noexcept
 {
     bool dataAvailable {false};
-    if (currentTimestamp <= getCurrentFlight().getTotalDurationMSec()) {
+    const auto &flight = getCurrentFlight();
+    if (currentTimestamp <= flight.getTotalDurationMSec()) {
         dataAvailable = true;
-        const PositionData currentPositionData = getCurrentFlight().getUserAircraft().getPosition().interpolate(getCurrentTimestamp(), access);
-        if (!currentPositionData.isNull()) {
+        const auto userAircraftIndex = static_cast<std::size_t>(flight.getUserAircraftIndex());
+        for (const auto &aircraftSnapshot : updateFrameSnapshot(currentTimestamp, access, aircraftSelection)) {
             // Start the elapsed timer after sending the first sample data
-            if (!isElapsedTimerRunning()) {
+            if (aircraftSnapshot.aircraftIndex == userAircraftIndex && !aircraftSnapshot.position.isNull() && !isElapsedTimerRunning()) {
                 startElapsedTimer();
             }
         }
@@ -356,7 +358,7 @@ void PathCreatorPlugin::frenchConnection() noexcept
     connect(&d->pluginSettings, &ConnectPluginBaseSettings::changed,
             this, &PathCreatorPlugin::onPluginSettingsChanged);
 
-    connect(&d->replayTimer, &QTimer::timeout,
+    connect(&getReplayScheduler(), &ReplayScheduler::frameDue,
             this, &PathCreatorPlugin::replay);
     connect(&d->recordingTimer, &QTimer::timeout,
             this, &PathCreatorPlugin::recordData);
@@ -364,8 +366,6 @@ void PathCreatorPlugin::frenchConnection() noexcept
 
 void PathCreatorPlugin::recordPositionData(std::int64_t timestamp) noexcept
 {
-    auto &aircraft = getCurrentFlight().getUserAircraft();
-
     PositionData positionData;
     positionData.latitude = -90.0 + d->randomGenerator->bounded(180);
     positionData.longitude = -180.0 + d->randomGenerator->bounded(360.0);
@@ -374,7 +374,7 @@ void PathCreatorPlugin::recordPositionData(std::int64_t timestamp) noexcept
     positionData.calibratedIndicatedAltitude = std::max(positionData.altitude - 1000.0, 0.0) + d->randomGenerator->bounded(1000.0);
     positionData.pressureAltitude = std::max(positionData.altitude - 1000.0, 0.0) + d->randomGenerator->bounded(1000.0);
     positionData.timestamp = timestamp;
-    aircraft.getPosition().upsertLast(positionData);
+    getCaptureQueue().push(positionData);
 
     AttitudeData attitudeData;
     attitudeData.pitch = -90.0 + d->randomGenerator->bounded(180.0);
@@ -386,7 +386,7 @@ void PathCreatorPlugin::recordPositionData(std::int64_t timestamp) noexcept
     attitudeData.velocityBodyZ = d->randomGenerator->bounded(1.0);
     attitudeData.onGround = false;
     attitudeData.timestamp = timestamp;
-    aircraft.getAttitude().upsertLast(attitudeData);
+    getCaptureQueue().push(attitudeData);
 }
 
 void PathCreatorPlugin::recordEngineData(std::int64_t timestamp) noexcept
@@ -422,8 +422,7 @@ void PathCreatorPlugin::recordEngineData(std::int64_t timestamp) noexcept
     engineData.generalEngineCombustion4 = d->randomGenerator->bounded(2) < 1 ? false : true;
 
     engineData.timestamp = timestamp;
-    auto &aircraft = getCurrentFlight().getUserAircraft();
-    aircraft.getEngine().upsertLast(engineData);
+    getCaptureQueue().push(engineData);
 }
 
 void PathCreatorPlugin::recordPrimaryControls(std::int64_t timestamp) noexcept
@@ -438,8 +437,7 @@ void PathCreatorPlugin::recordPrimaryControls(std::int64_t timestamp) noexcept
     primaryFlightControlData.aileronPosition = SkyMath::fromNormalisedPosition(-1.0 + d->randomGenerator->bounded(2.0));
 
     primaryFlightControlData.timestamp = timestamp;
-    auto &aircraft = getCurrentFlight().getUserAircraft();
-    aircraft.getPrimaryFlightControl().upsertLast(primaryFlightControlData);
+    getCaptureQueue().push(primaryFlightControlData);
 }
 
 void PathCreatorPlugin::recordSecondaryControls(std::int64_t timestamp) noexcept
@@ -455,8 +453,7 @@ void PathCreatorPlugin::recordSecondaryControls(std::int64_t timestamp) noexcept
     secondaryFlightControlData.flapsHandleIndex = static_cast<std::int8_t>(d->randomGenerator->bounded(5));
 
     secondaryFlightControlData.timestamp = timestamp;
-    auto &aircraft = getCurrentFlight().getUserAircraft();
-    aircraft.getSecondaryFlightControl().upsertLast(secondaryFlightControlData);
+    getCaptureQueue().push(secondaryFlightControlData);
 }
 
 void PathCreatorPlugin::recordAircraftHandle(std::int64_t timestamp) noexcept
@@ -475,8 +472,7 @@ void PathCreatorPlugin::recordAircraftHandle(std::int64_t timestamp) noexcept
     aircraftHandleData.foldingWingHandlePosition = d->randomGenerator->bounded(2) < 1 ? false : true;
 
     aircraftHandleData.timestamp = timestamp;
-    auto &aircraft = getCurrentFlight().getUserAircraft();
-    aircraft.getAircraftHandle().upsertLast(aircraftHandleData);
+    getCaptureQueue().push(aircraftHandleData);
 }
 
 void PathCreatorPlugin::recordLights(std::int64_t timestamp) noexcept
@@ -487,8 +483,7 @@ void PathCreatorPlugin::recordLights(std::int64_t timestamp) noexcept
     lights = ++lights % 0b1111111111;
 
     lightData.timestamp = timestamp;
-    auto &aircraft = getCurrentFlight().getUserAircraft();
-    aircraft.getLight().upsertLast(lightData);
+    getCaptureQueue().push(lightData);
 }
 
 void PathCreatorPlugin::recordWaypoint(std::int64_t timestamp) noexcept
@@ -605,6 +600,7 @@ void PathCreatorPlugin::closeConnection() noexcept
 
 void PathCreatorPlugin::replay() noexcept
 {
+    Trace::Scope trace {Trace::Replay, "Replay frame"};
     const auto timestamp = updateCurrentTimestamp();
     if (!sendAircraftData(timestamp, TimeVariableData::Access::Linear, AircraftSelection::All)) {
         onEndReached();
@@ -613,6 +609,7 @@ void PathCreatorPlugin::replay() noexcept
 
 void PathCreatorPlugin::recordData() noexcept
 {
+    Trace::Scope trace {Trace::Recording, "Record data"};
     if (!isElapsedTimerRunning()) {
         // Start the elapsed timer with the arrival of the first sample data
         setCurrentTimestamp(0);
@@ -627,4 +624,5 @@ void PathCreatorPlugin::recordData() noexcept
     recordAircraftHandle(timestamp);
     recordLights(timestamp);
     recordWaypoint(timestamp);
+    drainCaptureQueue();
 }
@@ -72,6 +72,11 @@ bool CsvExportSettings::isResamplingSupported() const noexcept
     return true;
 }
 
+bool CsvExportSettings::isSimplificationSupported() const noexcept
+{
+    return false;
+}
+
 bool CsvExportSettings::isFormationExportSupported(FormationExport formationExport) const noexcept
 {
     bool supported {false};
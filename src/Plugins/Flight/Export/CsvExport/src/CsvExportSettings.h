@@ -62,6 +62,7 @@ public:
     void setFormat(Format format) noexcept;
 
     bool isResamplingSupported() const noexcept override;
+    bool isSimplificationSupported() const noexcept override;
     bool isFormationExportSupported(FormationExport formationExport) const noexcept override;
 
 protected:
@@ -24,11 +24,14 @@
 #include <memory>
 #include <vector>
 #include <cmath>
+#include <cstdint>
 
 #include <QIODevice>
 #include <QChar>
 #include <QString>
 #include <QStringBuilder>
+#include <QByteArray>
+#include <QDateTime>
 
 #include <Kernel/Enum.h>
 #include <Kernel/Unit.h>
@@ -39,9 +42,11 @@
 #include <Model/PositionData.h>
 #include <Model/Attitude.h>
 #include <Model/AttitudeData.h>
+#include <Model/SampleCursor.h>
 #include <Model/TimeVariableData.h>
 #include <PluginManager/Csv.h>
 #include <PluginManager/Export.h>
+#include <PluginManager/ExportWriter.h>
 #include "CsvExportSettings.h"
 #include "FlightRadar24CsvWriter.h"
 
@@ -86,24 +91,25 @@ bool FlightRadar24CsvWriter::write(const FlightData &flightData, const Aircraft
     bool ok = io.write(csv.toUtf8());
     if (ok) {
         const QDateTime startDateTimeUtc = flightData.getAircraftStartZuluTime(aircraft);
-        const QString callSign = flightData.flightNumber;
+        const std::int64_t startMSecsSinceEpoch = startDateTimeUtc.toMSecsSinceEpoch();
+        const QByteArray callSign = flightData.flightNumber.toUtf8();
         const auto interpolatedPositionData = Export::resamplePositionDataForExport(aircraft, d->pluginSettings.getResamplingPeriod());
+        SampleCursor<AttitudeData> attitudeCursor;
+        ExportWriter writer {io};
+        writer.setBaseDateTime(startDateTimeUtc);
         for (const auto &positionData : interpolatedPositionData) {
-            const auto attitudeData = aircraft.getAttitude().interpolate(positionData.timestamp, TimeVariableData::Access::NoTimeOffset);
-            const auto dateTimeUtc = startDateTimeUtc.addMSecs(positionData.timestamp);
-            const auto secsSinceEpoch = dateTimeUtc.toSecsSinceEpoch();
-            const QString csv = QString::number(secsSinceEpoch) % Csv::CommaSep %
-                                dateTimeUtc.toString(Qt::ISODate) % Csv::CommaSep %
-                                callSign % Csv::CommaSep %
-                                formatPosition(positionData) % Csv::CommaSep %
-                                QString::number(static_cast<int>(std::round(positionData.altitude))) % Csv::CommaSep %
-                                QString::number(static_cast<int>(std::round(attitudeData.velocityBodyZ))) % Csv::CommaSep %
-                                QString::number(static_cast<int>(std::round(attitudeData.trueHeading))) % Csv::Ln;
-            ok = io.write(csv.toUtf8());
-            if (!ok) {
-                break;
-            }
+            const auto &attitudeData = aircraft.getAttitude().interpolate(positionData.timestamp, TimeVariableData::Access::NoTimeOffset, attitudeCursor);
+            const std::int64_t secsSinceEpoch = (startMSecsSinceEpoch + positionData.timestamp) / 1000;
+            writer.appendInteger(secsSinceEpoch).append(Csv::CommaSep)
+                  .appendIsoDateTime(positionData.timestamp).append(Csv::CommaSep)
+                  .append(callSign).append(Csv::CommaSep);
+            appendPosition(positionData, writer);
+            writer.append(Csv::CommaSep)
+                  .appendInteger(static_cast<int>(std::round(positionData.altitude))).append(Csv::CommaSep)
+                  .appendInteger(static_cast<int>(std::round(attitudeData.velocityBodyZ))).append(Csv::CommaSep)
+                  .appendInteger(static_cast<int>(std::round(attitudeData.trueHeading))).append(Csv::Ln);
         }
+        ok = writer.flush();
     }
 
     return ok;
@@ -111,7 +117,7 @@ bool FlightRadar24CsvWriter::write(const FlightData &flightData, const Aircraft
 
 // PRIVATE
 
-inline QString FlightRadar24CsvWriter::formatPosition(const PositionData &positionData) noexcept
+inline void FlightRadar24CsvWriter::appendPosition(const PositionData &positionData, ExportWriter &writer) noexcept
 {
-    return Csv::DoubleQuote % Export::formatCoordinate(positionData.latitude) % "," % Export::formatCoordinate(positionData.longitude) % Csv::DoubleQuote;
+    writer.append(Csv::DoubleQuote).appendCoordinate(positionData.latitude).append(',').appendCoordinate(positionData.longitude).append(Csv::DoubleQuote);
 }
@@ -36,6 +36,7 @@ struct FlightData;
 class Aircraft;
 class CsvExportSettings;
 class PositionData;
+class ExportWriter;
 struct FlightRadar24CsvWriterPrivate;
 
 class FlightRadar24CsvWriter : public CsvWriterIntf
@@ -53,7 +54,7 @@ public:
 private:
     const std::unique_ptr<FlightRadar24CsvWriterPrivate> d;
 
-    static inline QString formatPosition(const PositionData &positionData) noexcept;
+    static inline void appendPosition(const PositionData &positionData, ExportWriter &writer) noexcept;
 };
 
 #endif // FLIGHTRADAR24CSVWRITER_H
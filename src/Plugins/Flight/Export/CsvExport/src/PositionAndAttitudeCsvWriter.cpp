@@ -41,8 +41,10 @@
 #include <Model/PositionData.h>
 #include <Model/Attitude.h>
 #include <Model/AttitudeData.h>
+#include <Model/SampleCursor.h>
 #include <PluginManager/Csv.h>
 #include <PluginManager/Export.h>
+#include <PluginManager/ExportWriter.h>
 #include "CsvExportSettings.h"
 #include "PositionAndAttitudeCsvWriter.h"
 
@@ -90,25 +92,23 @@ bool PositionAndAttitudeCsvWriter::write(const FlightData &flightData, const Air
 
     bool ok = io.write(csv.toUtf8());
     if (ok) {
-        const auto startDateTimeUtc = flightData.getAircraftStartZuluTime(aircraft);
+        ExportWriter writer {io};
+        writer.setBaseDateTime(flightData.getAircraftStartZuluTime(aircraft));
         const auto interpolatedPositionData = Export::resamplePositionDataForExport(aircraft, d->pluginSettings.getResamplingPeriod());
+        SampleCursor<AttitudeData> attitudeCursor;
         for (const auto &positionData : interpolatedPositionData) {
-            const auto attitudeData = aircraft.getAttitude().interpolate(positionData.timestamp, TimeVariableData::Access::NoTimeOffset);
-            const auto dateTimeUtc = startDateTimeUtc.addMSecs(positionData.timestamp);
-            const QString csv = QString::number(positionData.timestamp) % Csv::CommaSep %
-                                dateTimeUtc.toString(Qt::ISODate) % Csv::CommaSep %
-                                Export::formatCoordinate(positionData.latitude) % Csv::CommaSep %
-                                Export::formatCoordinate(positionData.longitude) % Csv::CommaSep %
-                                QString::number(static_cast<int>(std::round(positionData.altitude))) % Csv::CommaSep %
-                                QString::number(static_cast<int>(std::round(attitudeData.velocityBodyZ))) % Csv::CommaSep %
-                                QString::number(static_cast<int>(std::round(attitudeData.pitch))) % Csv::CommaSep %
-                                QString::number(static_cast<int>(std::round(attitudeData.bank))) % Csv::CommaSep %
-                                QString::number(static_cast<int>(std::round(attitudeData.trueHeading))) % Csv::Ln;
-            ok = io.write(csv.toUtf8());
-            if (!ok) {
-                break;
-            }
+            const auto &attitudeData = aircraft.getAttitude().interpolate(positionData.timestamp, TimeVariableData::Access::NoTimeOffset, attitudeCursor);
+            writer.appendInteger(positionData.timestamp).append(Csv::CommaSep)
+                  .appendIsoDateTime(positionData.timestamp).append(Csv::CommaSep)
+                  .appendCoordinate(positionData.latitude).append(Csv::CommaSep)
+                  .appendCoordinate(positionData.longitude).append(Csv::CommaSep)
+                  .appendInteger(static_cast<int>(std::round(positionData.altitude))).append(Csv::CommaSep)
+                  .appendInteger(static_cast<int>(std::round(attitudeData.velocityBodyZ))).append(Csv::CommaSep)
+                  .appendInteger(static_cast<int>(std::round(attitudeData.pitch))).append(Csv::CommaSep)
+                  .appendInteger(static_cast<int>(std::round(attitudeData.bank))).append(Csv::CommaSep)
+                  .appendInteger(static_cast<int>(std::round(attitudeData.trueHeading))).append(Csv::Ln);
         }
+        ok = writer.flush();
     }
 
     return ok;
@@ -45,6 +45,7 @@
 #include <Model/PositionData.h>
 #include <Model/SimType.h>
 #include <PluginManager/Export.h>
+#include <PluginManager/ExportWriter.h>
 #include "GpxExportOptionWidget.h"
 #include "GpxExportSettings.h"
 #include "GpxExportPlugin.h"
@@ -180,7 +181,7 @@ bool GpxExportPlugin::exportAllAircraft(const FlightData &flightData, QIODevice
 bool GpxExportPlugin::exportSingleAircraft(const FlightData &flightData, const Aircraft &aircraft, QIODevice &io) const noexcept
 {
     updateStartDateTimeUtc(flightData, aircraft);
-    const auto interpolatedPositionData = Export::resamplePositionDataForExport(aircraft, d->pluginSettings.getResamplingPeriod());
+    const auto interpolatedPositionData = Export::resamplePositionDataForExport(aircraft, d->pluginSettings.getResamplingPeriod(), d->pluginSettings.getSimplificationMaxDeviation());
     bool ok {true};
     if (interpolatedPositionData.size() > 0) {
 
@@ -194,12 +195,12 @@ bool GpxExportPlugin::exportSingleAircraft(const FlightData &flightData, const A
 
         ok = io.write(trackBegin.toUtf8());
         if (ok) {
+            ExportWriter writer {io};
+            writer.setBaseDateTime(d->startDateTimeUtc);
             for (const auto &positionData : interpolatedPositionData) {
-                ok = exportTrackPoint(positionData, io);
-                if (!ok) {
-                    break;
-                }
+                exportTrackPoint(positionData, writer);
             }
+            ok = writer.flush();
         }
         if (ok) {
             const QString placemarkEnd = "    </trkseg>\n"
@@ -275,25 +276,19 @@ QString GpxExportPlugin::getAircraftDescription(const Aircraft &aircraft) const
            QObject::tr("Tail number") % ": " % info.tailNumber % "\n";
 }
 
-inline bool GpxExportPlugin::exportTrackPoint(const PositionData &positionData, QIODevice &io) const noexcept
+inline void GpxExportPlugin::exportTrackPoint(const PositionData &positionData, ExportWriter &writer) const noexcept
 {
     // Elevation above mean sea level (MSL)
     const auto elevation = Convert::feetToMeters(positionData.altitude);
-    const auto dateTimeUtc = d->startDateTimeUtc.addMSecs(positionData.timestamp);
-    QString trackPoint =
-"      <trkpt lat=\"" % Export::formatCoordinate(positionData.latitude) % "\" lon=\"" % Export::formatCoordinate(positionData.longitude) % "\">\n"
-"        <ele>" % Export::formatNumber(elevation).toUtf8() % "</ele>\n"
-"        <time>" % dateTimeUtc.toString(Qt::ISODateWithMs) % "</time>\n";
+    writer.append("      <trkpt lat=\"").appendCoordinate(positionData.latitude).append("\" lon=\"").appendCoordinate(positionData.longitude).append("\">\n"
+                  "        <ele>").appendNumber(elevation).append("</ele>\n"
+                  "        <time>").appendIsoDateTime(positionData.timestamp, true).append("</time>\n");
     if (d->pluginSettings.isGeoidHeightExportEnabled()) {
         // Calculate the geoid height
         const auto geoidHeight = d->convert.geoidToEllipsoidHeight(0, positionData.latitude, positionData.longitude);
-        trackPoint = trackPoint %
-"        <geoidheight>" % Export::formatNumber(geoidHeight).toUtf8() % "</geoidheight>\n";
+        writer.append("        <geoidheight>").appendNumber(geoidHeight).append("</geoidheight>\n");
     }
-    trackPoint = trackPoint %
-"      </trkpt>\n";
-
-    return io.write(trackPoint.toUtf8());
+    writer.append("      </trkpt>\n");
 }
 
 inline bool GpxExportPlugin::exportWaypoint(const Waypoint &waypoint, const QString &description, QIODevice &io) const noexcept
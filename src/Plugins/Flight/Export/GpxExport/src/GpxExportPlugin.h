@@ -33,6 +33,7 @@
 class QIODevice;
 class QString;
 class QDateTime;
+class ExportWriter;
 
 #include <Kernel/Settings.h>
 #include <PluginManager/Flight/FlightExportIntf.h>
@@ -81,7 +82,7 @@ private:
     QString getFlightDescription(const FlightData &flightData) const noexcept;
     QString getAircraftDescription(const Aircraft &aircraft) const noexcept;
 
-    inline bool exportTrackPoint(const PositionData &positionData, QIODevice &io) const noexcept;
+    inline void exportTrackPoint(const PositionData &positionData, ExportWriter &writer) const noexcept;
     inline bool exportWaypoint(const Waypoint &waypoint, const QString &description, QIODevice &io) const noexcept;
 };
 
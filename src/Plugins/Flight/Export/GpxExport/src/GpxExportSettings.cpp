@@ -88,6 +88,11 @@ bool GpxExportSettings::isResamplingSupported() const noexcept
     return true;
 }
 
+bool GpxExportSettings::isSimplificationSupported() const noexcept
+{
+    return true;
+}
+
 bool GpxExportSettings::isFormationExportSupported(FormationExport formationExport) const noexcept
 {
     bool supported {false};
@@ -66,6 +66,7 @@ public:
     void setGeoidHeightExportEnabled(bool enable) noexcept;
 
     bool isResamplingSupported() const noexcept override;
+    bool isSimplificationSupported() const noexcept override;
     bool isFormationExportSupported(FormationExport formationExport) const noexcept override;
 
 protected:
@@ -24,6 +24,7 @@
 #include <algorithm>
 #include <cmath>
 #include <cstdlib>
+#include <cstdint>
 
 #include <QtGlobal>
 #include <QIODevice>
@@ -50,12 +51,14 @@
 #include <Model/PositionData.h>
 #include <Model/Attitude.h>
 #include <Model/AttitudeData.h>
+#include <Model/SampleCursor.h>
 #include <Model/Engine.h>
 #include <Model/EngineData.h>
 #include <Model/FlightPlan.h>
 #include <Model/Waypoint.h>
 #include <Model/TimeVariableData.h>
 #include <PluginManager/Export.h>
+#include <PluginManager/ExportWriter.h>
 #include "IgcExportOptionWidget.h"
 #include "IgcExportSettings.h"
 #include "IgcExportPlugin.h"
@@ -106,6 +109,21 @@ namespace
 
     // Interval of 20 seconds for K records
     constexpr int KRecordIntervalSec {20};
+
+    // Appends the DDMMmmm (latitude) or DDDMMmmm (longitude) part of a position,
+    // followed by the hemisphere
+    inline void appendDegreesAndMinutes(double value, int degreesWidth, char hemisphere, ExportWriter &writer) noexcept
+    {
+        double degrees {0.0};
+        double minutes {0.0};
+
+        GeographicLib::DMS::Encode(value, degrees, minutes);
+        const int decimals = static_cast<int>((minutes - static_cast<int>(minutes)) * 1000);
+        writer.appendInteger(static_cast<int>(std::abs(degrees)), degreesWidth)
+              .appendInteger(static_cast<int>(std::abs(minutes)), 2)
+              .appendInteger(std::abs(decimals), 3)
+              .append(hemisphere);
+    }
 }
 
 struct IgcExportPluginPrivate
@@ -272,56 +290,50 @@ inline bool IgcExportPlugin::exportCRecord(const FlightData &flightData, const A
 
 inline bool IgcExportPlugin::exportFixes(const FlightData &flightData, const Aircraft &aircraft, QIODevice &io) const noexcept
 {
-    QDateTime startTime = flightData.getAircraftStartZuluTime(aircraft);
-    QDateTime lastKFixTime;
+    ExportWriter writer {io};
+    writer.setBaseDateTime(flightData.getAircraftStartZuluTime(aircraft));
+    bool hasKFix {false};
+    std::int64_t lastKFixTimestamp {0};
 
     Convert convert;
     auto &engine = aircraft.getEngine();
-    const auto interpolatedPositionData = Export::resamplePositionDataForExport(aircraft, d->pluginSettings.getResamplingPeriod());
-    bool ok {true};
+    const auto interpolatedPositionData = Export::resamplePositionDataForExport(aircraft, d->pluginSettings.getResamplingPeriod(), d->pluginSettings.getSimplificationMaxDeviation());
+    SampleCursor<EngineData> engineCursor;
+    SampleCursor<AttitudeData> attitudeCursor;
     for (const auto &positionData : interpolatedPositionData) {
         // Convert height above EGM geoid to height above WGS84 ellipsoid (HAE) [meters]
         const double heightAboveEllipsoid = convert.geoidToEllipsoidHeight(Convert::feetToMeters(positionData.altitude), positionData.latitude, positionData.longitude);
 
         const auto gnssAltitude = static_cast<int>(std::round(heightAboveEllipsoid));
-        const auto gnssAltitudeByteArray = formatNumber(gnssAltitude, 5);
         const auto pressureAltitude = static_cast<int>(std::round(Convert::feetToMeters(positionData.pressureAltitude)));
-        const auto pressureAltitudeByteArray = formatNumber(pressureAltitude, 5);
-        const auto engineData = engine.interpolate(positionData.timestamp, TimeVariableData::Access::Linear);
+        const auto &engineData = engine.interpolate(positionData.timestamp, TimeVariableData::Access::Linear, engineCursor);
         const auto noise = estimateEnvironmentalNoise(engineData);
-        const auto currentTime = startTime.addMSecs(positionData.timestamp);
-        const QByteArray bRecord = IgcExportPluginPrivate::BRecord %
-                                   formatTime(currentTime) %
-                                   formatPosition(positionData.latitude, positionData.longitude) %
-                                   ::FixValid %
-                                   // Pressure altitude
-                                   pressureAltitudeByteArray %
-                                   // GNSS altitude
-                                   gnssAltitudeByteArray %
-                                   formatNumber(noise, 3) %
-                                   ::LineEnd;
-        ok = io.write(bRecord);
-
-        if (ok && (lastKFixTime.isNull() || lastKFixTime.secsTo(currentTime) >= ::KRecordIntervalSec)) {
+        writer.append(IgcExportPluginPrivate::BRecord).appendTime(positionData.timestamp);
+        appendPosition(positionData.latitude, positionData.longitude, writer);
+        writer.append(::FixValid)
+              // Pressure altitude
+              .appendInteger(pressureAltitude, 5)
+              // GNSS altitude
+              .appendInteger(gnssAltitude, 5)
+              .appendInteger(noise, 3)
+              .append(::LineEnd);
+
+        if (!hasKFix || (positionData.timestamp - lastKFixTimestamp) / 1000 >= ::KRecordIntervalSec) {
             const auto &attitude = aircraft.getAttitude();
-            const auto attitudeData = attitude.interpolate(positionData.timestamp, TimeVariableData::Access::NoTimeOffset);
+            const auto &attitudeData = attitude.interpolate(positionData.timestamp, TimeVariableData::Access::NoTimeOffset, attitudeCursor);
             const auto trueAirspeed = Convert::feetPerSecondToKilometersPerHour(attitudeData.velocityBodyZ);
             const auto indicatedAirspeed = Convert::trueToIndicatedAirspeed(trueAirspeed, positionData.altitude);
-            const QByteArray kRecord = IgcExportPluginPrivate::KRecord %
-                                       formatTime(currentTime) %
-                                       formatNumber(static_cast<int>(std::round(attitudeData.trueHeading)), 3) %
-                                       // IAS: km/h
-                                       formatNumber(static_cast<int>(std::round(indicatedAirspeed)), 3) %
-                                       ::LineEnd;
-            ok = io.write(kRecord);
-            lastKFixTime = currentTime;
-        }
-        if (!ok) {
-            break;
+            writer.append(IgcExportPluginPrivate::KRecord).appendTime(positionData.timestamp)
+                  .appendInteger(static_cast<int>(std::round(attitudeData.trueHeading)), 3)
+                  // IAS: km/h
+                  .appendInteger(static_cast<int>(std::round(indicatedAirspeed)), 3)
+                  .append(::LineEnd);
+            hasKFix = true;
+            lastKFixTimestamp = positionData.timestamp;
         }
     }
 
-    return ok;
+    return writer.flush();
 }
 
 inline bool IgcExportPlugin::exportGRecord(QIODevice &io) const noexcept
@@ -388,6 +400,12 @@ inline QByteArray IgcExportPlugin::formatPosition(double latitude, double longit
     return formatLatitude(latitude) % formatLongitude(longitude);
 }
 
+inline void IgcExportPlugin::appendPosition(double latitude, double longitude, ExportWriter &writer) const noexcept
+{
+    ::appendDegreesAndMinutes(latitude, 2, latitude >= 0.0 ? 'N' : 'S', writer);
+    ::appendDegreesAndMinutes(longitude, 3, longitude >= 0.0 ? 'E' : 'W', writer);
+}
+
 inline int IgcExportPlugin::estimateEnvironmentalNoise(const EngineData &engineData) const noexcept
 {
     int noise {0};
@@ -34,6 +34,7 @@
 class QIODevice;
 class QString;
 class QDateTime;
+class ExportWriter;
 
 #include <Kernel/Settings.h>
 #include <PluginManager/Flight/FlightExportIntf.h>
@@ -86,6 +87,7 @@ private:
     inline QByteArray formatLatitude(double latitude) const noexcept;
     inline QByteArray formatLongitude(double longitude) const noexcept;
     inline QByteArray formatPosition(double latitude, double longitude) const noexcept;
+    inline void appendPosition(double latitude, double longitude, ExportWriter &writer) const noexcept;
 
     inline int estimateEnvironmentalNoise(const EngineData &engineData) const noexcept;
 };
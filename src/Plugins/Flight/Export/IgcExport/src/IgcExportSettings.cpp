@@ -87,6 +87,11 @@ bool IgcExportSettings::isResamplingSupported() const noexcept
     return true;
 }
 
+bool IgcExportSettings::isSimplificationSupported() const noexcept
+{
+    return true;
+}
+
 bool IgcExportSettings::isFormationExportSupported(FormationExport formationExport) const noexcept
 {
     bool supported {false};
@@ -55,6 +55,7 @@ public:
     void setConvertAltitudeEnabled(bool enable) noexcept;
 
     bool isResamplingSupported() const noexcept override;
+    bool isSimplificationSupported() const noexcept override;
     bool isFormationExportSupported(FormationExport formationExport) const noexcept override;
 
 protected:
@@ -47,6 +47,7 @@
 #include <Model/PositionData.h>
 #include <Model/SimType.h>
 #include <PluginManager/Export.h>
+#include <PluginManager/ExportWriter.h>
 #include "JsonExportSettings.h"
 #include "JsonExportPlugin.h"
 
@@ -170,20 +171,18 @@ bool JsonExportPlugin::exportSingleAircraft(const FlightData &flightData, const
 "        \"coordinates\": [\n";
     ok = io.write(trackBegin.toUtf8());
     if (ok) {
+        ExportWriter writer {io};
         std::size_t i = 0;
         for (const auto &positionData : interpolatedPositionData) {
-            ok = exportTrackPoint(positionData, io);
-            if (ok) {
-                if (i < interpolatedPositionData.size() - 1) {
-                    ok = io.write(", ");
-                } else {
-                    ok = io.write("\n");
-                }
-                ++i;
+            exportTrackPoint(positionData, writer);
+            if (i < interpolatedPositionData.size() - 1) {
+                writer.append(", ");
             } else {
-                break;
+                writer.append('\n');
             }
+            ++i;
         }
+        ok = writer.flush();
     }
     if (ok) {
         const QString placemarkEnd =
@@ -232,14 +231,12 @@ bool JsonExportPlugin::exportFooter(QIODevice &io) const noexcept
     return io.write(footer.toUtf8());
 }
 
-inline bool JsonExportPlugin::exportTrackPoint(const PositionData &positionData, QIODevice &io) const noexcept
+inline void JsonExportPlugin::exportTrackPoint(const PositionData &positionData, ExportWriter &writer) const noexcept
 {
-    const QString trackPoint = "[" % Export::formatCoordinate(positionData.longitude) % ", " %
-                                     Export::formatCoordinate(positionData.latitude) % ", " %
-                                     Export::formatNumber(Convert::feetToMeters(positionData.altitude)) %
-                               "]";
-
-    return io.write(trackPoint.toUtf8());
+    writer.append('[').appendCoordinate(positionData.longitude).append(", ")
+          .appendCoordinate(positionData.latitude).append(", ")
+          .appendNumber(Convert::feetToMeters(positionData.altitude))
+          .append(']');
 }
 
 inline bool JsonExportPlugin::exportWaypoint(const Waypoint &waypoint, QIODevice &io) const noexcept
@@ -32,6 +32,7 @@
 
 class QIODevice;
 class QString;
+class ExportWriter;
 
 #include <Kernel/Settings.h>
 #include <PluginManager/Flight/FlightExportIntf.h>
@@ -74,7 +75,7 @@ private:
     bool exportWaypoints(const FlightData &flightData, QIODevice &io) const noexcept;
     bool exportFooter(QIODevice &io) const noexcept;
 
-    inline bool exportTrackPoint(const PositionData &positionData, QIODevice &io) const noexcept;
+    inline void exportTrackPoint(const PositionData &positionData, ExportWriter &writer) const noexcept;
     inline bool exportWaypoint(const Waypoint &waypoint, QIODevice &io) const noexcept;
 };
 
@@ -51,6 +51,11 @@ bool JsonExportSettings::isResamplingSupported() const noexcept
     return true;
 }
 
+bool JsonExportSettings::isSimplificationSupported() const noexcept
+{
+    return false;
+}
+
 bool JsonExportSettings::isFormationExportSupported(FormationExport formationExport) const noexcept
 {
     bool supported {false};
@@ -45,6 +45,7 @@ public:
     ~JsonExportSettings() override;
 
     bool isResamplingSupported() const noexcept override;
+    bool isSimplificationSupported() const noexcept override;
     bool isFormationExportSupported(FormationExport formationExport) const noexcept override;
 
 protected:
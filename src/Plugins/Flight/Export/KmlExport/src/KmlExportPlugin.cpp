@@ -47,6 +47,7 @@
 #include <Model/AttitudeData.h>
 #include <Model/SimType.h>
 #include <PluginManager/Export.h>
+#include <PluginManager/ExportWriter.h>
 #include "KmlExportOptionWidget.h"
 #include "KmlStyleExport.h"
 #include "KmlExportPlugin.h"
@@ -217,7 +218,7 @@ bool KmlExportPlugin::exportSingleAircraft(const Aircraft &aircraft, bool inForm
 "          </coordinates>\n"
 "        </LineString>\n";
 
-    const auto interpolatedPositionData = Export::resamplePositionDataForExport(aircraft, d->pluginSettings.getResamplingPeriod());
+    const auto interpolatedPositionData = Export::resamplePositionDataForExport(aircraft, d->pluginSettings.getResamplingPeriod(), d->pluginSettings.getSimplificationMaxDeviation());
     bool ok {true};
     if (interpolatedPositionData.size() > 0) {
 
@@ -237,6 +238,7 @@ bool KmlExportPlugin::exportSingleAircraft(const Aircraft &aircraft, bool inForm
         ok = io.write(placemarkBegin.toUtf8());
         if (ok) {
 
+            ExportWriter writer {io};
             const std::size_t interpolatedPositionCount = interpolatedPositionData.size();
             std::size_t currentIndex {0};
             std::size_t nextLineSegmentIndex {currentIndex};
@@ -244,33 +246,24 @@ bool KmlExportPlugin::exportSingleAircraft(const Aircraft &aircraft, bool inForm
                 if (currentIndex == nextLineSegmentIndex) {
                     // End the previous line segment (if any)
                     if (currentIndex > 0) {
-                        ok = io.write(lineStringEnd.toUtf8());
+                        writer.append(lineStringEnd);
                     }
                     // Start a new line segment
-                    if (ok) {
-                        ok = io.write(lineStringBegin.toUtf8());
-                    }
-                    if (!ok) {
-                        break;
-                    }
+                    writer.append(lineStringBegin);
                     // Update the index of the next line segment start, but
                     // don't increment the currentIndex just yet: the
                     // last point of the previous line segment is repeated,
                     // in order to connect the segments
                     nextLineSegmentIndex += ::MaxLineSegments;
                 }
-                const PositionData positionData = interpolatedPositionData[currentIndex];
-                ok = io.write((Export::formatCoordinate(positionData.longitude) % "," %
-                               Export::formatCoordinate(positionData.latitude) % "," %
-                               Export::formatCoordinate(Convert::feetToMeters(positionData.altitude))).toUtf8() % " ");
+                const PositionData &positionData = interpolatedPositionData[currentIndex];
+                writer.appendCoordinate(positionData.longitude).append(',')
+                      .appendCoordinate(positionData.latitude).append(',')
+                      .appendCoordinate(Convert::feetToMeters(positionData.altitude)).append(' ');
                 ++currentIndex;
-                if (!ok) {
-                    break;
-                }
-            }
-            if (ok) {
-                ok = io.write(lineStringEnd.toUtf8());
             }
+            writer.append(lineStringEnd);
+            ok = writer.flush();
 
         }
         if (ok) {
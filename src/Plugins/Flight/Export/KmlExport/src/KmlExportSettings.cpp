@@ -260,6 +260,11 @@ bool KmlExportSettings::isResamplingSupported() const noexcept
     return true;
 }
 
+bool KmlExportSettings::isSimplificationSupported() const noexcept
+{
+    return true;
+}
+
 bool KmlExportSettings::isFormationExportSupported(FormationExport formationExport) const noexcept
 {
     bool supported {false};
@@ -90,6 +90,7 @@ public:
     void setAllEndColor(const QColor &color) noexcept;
 
     bool isResamplingSupported() const noexcept override;
+    bool isSimplificationSupported() const noexcept override;
     bool isFormationExportSupported(FormationExport formationExport) const noexcept override;
 
 protected:
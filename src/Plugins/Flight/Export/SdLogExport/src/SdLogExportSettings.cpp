@@ -48,6 +48,11 @@ bool SdLogExportSettings::isResamplingSupported() const noexcept
     return false;
 }
 
+bool SdLogExportSettings::isSimplificationSupported() const noexcept
+{
+    return false;
+}
+
 bool SdLogExportSettings::isFormationExportSupported(FormationExport formationExport) const noexcept
 {
     bool supported {false};
@@ -33,6 +33,7 @@
 #include <Model/PositionData.h>
 #include <Model/Attitude.h>
 #include <Model/AttitudeData.h>
+#include <Model/SampleCursor.h>
 #include "Formation.h"
 
 InitialPosition Formation::calculateInitialRelativePositionToUserAircraft(HorizontalDistance horizontalDistance, VerticalDistance verticalDistance, Bearing bearing, std::int64_t timestamp) noexcept
@@ -55,7 +56,9 @@ std::pair<PositionData, AttitudeData> Formation::calculateRelativePositionToUser
     const auto &aircraft = flight.getUserAircraft();
     const auto &position = aircraft.getPosition();
     if (position.count() > 0) {
-        const auto positionData = position.interpolate(timestamp, TimeVariableData::Access::DiscreteSeek);
+        SampleCursor<PositionData> positionCursor;
+        SampleCursor<AttitudeData> attitudeCursor;
+        const auto &positionData = position.interpolate(timestamp, TimeVariableData::Access::DiscreteSeek, positionCursor);
         const auto &aircraftInfo = aircraft.getAircraftInfo();
         const auto &aircraftType = aircraftInfo.aircraftType;
 
@@ -158,7 +161,7 @@ std::pair<PositionData, AttitudeData> Formation::calculateRelativePositionToUser
             bearingDegrees = 337.5;
             break;
         }
-        attitudeData = aircraft.getAttitude().interpolate(timestamp, TimeVariableData::Access::DiscreteSeek);
+        attitudeData = aircraft.getAttitude().interpolate(timestamp, TimeVariableData::Access::DiscreteSeek, attitudeCursor);
         bearingDegrees += attitudeData.trueHeading;
         SkyMath::Coordinate coordinate = SkyMath::relativePosition(sourcePosition, bearingDegrees, Convert::feetToMeters(distance));
 
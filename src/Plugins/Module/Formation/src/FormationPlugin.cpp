@@ -35,6 +35,7 @@
 #include <Model/Aircraft.h>
 #include <Persistence/Service/AircraftService.h>
 #include <Persistence/PersistenceManager.h>
+#include <Persistence/RecordingJournal.h>
 #include <PluginManager/SkyConnectManager.h>
 #include <PluginManager/Connect/SkyConnectIntf.h>
 #include <PluginManager/Module/ModuleBaseSettings.h>
@@ -130,8 +131,14 @@ void FormationPlugin::onRecordingStopped() noexcept
     const auto sequenceNumber = flight.count();
     if (sequenceNumber > 1) {
         // Sequence starts at 1
-        const bool ok = d->aircraftService->store(flight.getId(), sequenceNumber, flight[sequenceNumber - 1]);
+        // The recording journal may already have stored the aircraft incrementally
+        bool ok = getRecordingJournal().finish(flight);
         if (!ok) {
+            ok = d->aircraftService->store(flight.getId(), sequenceNumber, flight[sequenceNumber - 1]);
+        }
+        if (ok) {
+            compactOnStore(flight[sequenceNumber - 1]);
+        } else {
             flight.removeLastAircraft();
             const auto &persistenceManager = PersistenceManager::getInstance();
             const QString logbookPath = QDir::toNativeSeparators(persistenceManager.getLogbookPath());
@@ -59,6 +59,7 @@
 #include <Model/PositionData.h>
 #include <Model/Attitude.h>
 #include <Model/AttitudeData.h>
+#include <Model/SampleCursor.h>
 #include <Persistence/PersistenceManager.h>
 #include <Persistence/Service/FlightService.h>
 #include <Persistence/Service/AircraftService.h>
@@ -725,9 +726,11 @@ void FormationWidget::updateAndSendUserAircraftPosition() const noexcept
             const auto &aircraft = flight.getUserAircraft();
             const auto timestamp = skyConnectManager.getCurrentTimestamp();
             const auto &position = aircraft.getPosition();
-            const auto &positionData = position.interpolate(timestamp, TimeVariableData::Access::DiscreteSeek);
+            SampleCursor<PositionData> positionCursor;
+            SampleCursor<AttitudeData> attitudeCursor;
+            const auto &positionData = position.interpolate(timestamp, TimeVariableData::Access::DiscreteSeek, positionCursor);
             const auto &attitude = aircraft.getAttitude();
-            const auto &attitudeData = attitude.interpolate(timestamp, TimeVariableData::Access::DiscreteSeek);
+            const auto &attitudeData = attitude.interpolate(timestamp, TimeVariableData::Access::DiscreteSeek, attitudeCursor);
             skyConnectManager.setUserAircraftPositionAndAttitude(positionData, attitudeData);
         }
         break;
@@ -764,9 +767,11 @@ void FormationWidget::updateUserAircraftPosition(SkyConnectIntf::ReplayMode repl
                 const auto &aircraft = flight.getUserAircraft();
                 const auto timestamp = skyConnectManager.getCurrentTimestamp();
                 const auto &position = aircraft.getPosition();
-                const auto &positionData = position.interpolate(timestamp, TimeVariableData::Access::DiscreteSeek);
+                SampleCursor<PositionData> positionCursor;
+                SampleCursor<AttitudeData> attitudeCursor;
+                const auto &positionData = position.interpolate(timestamp, TimeVariableData::Access::DiscreteSeek, positionCursor);
                 const auto &attitude = aircraft.getAttitude();
-                const auto &attitudeData = attitude.interpolate(timestamp, TimeVariableData::Access::DiscreteSeek);
+                const auto &attitudeData = attitude.interpolate(timestamp, TimeVariableData::Access::DiscreteSeek, attitudeCursor);
                 skyConnectManager.setUserAircraftPositionAndAttitude(positionData, attitudeData);
                 break;
             }
@@ -33,6 +33,7 @@
 #include <Persistence/Service/FlightService.h>
 #include <Persistence/Service/AircraftService.h>
 #include <Persistence/PersistenceManager.h>
+#include <Persistence/RecordingJournal.h>
 #include <PluginManager/SkyConnectManager.h>
 #include <PluginManager/Connect/SkyConnectIntf.h>
 #include <PluginManager/Module/ModuleBaseSettings.h>
@@ -92,8 +93,14 @@ void LogbookPlugin::onRecordingStopped() noexcept
     const std::size_t sequenceNumber = flight.count();
     if (sequenceNumber > 1) {
         // Sequence starts at 1
-        const bool ok = d->aircraftService->store(flight.getId(), sequenceNumber, flight[sequenceNumber - 1]);
+        // The recording journal may already have stored the aircraft incrementally
+        bool ok = getRecordingJournal().finish(flight);
         if (!ok) {
+            ok = d->aircraftService->store(flight.getId(), sequenceNumber, flight[sequenceNumber - 1]);
+        }
+        if (ok) {
+            compactOnStore(flight[sequenceNumber - 1]);
+        } else {
             flight.removeLastAircraft();
             const auto &persistenceManager = PersistenceManager::getInstance();
             const QString logbookPath = QDir::toNativeSeparators(persistenceManager.getLogbookPath());
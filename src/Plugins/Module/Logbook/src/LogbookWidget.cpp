@@ -224,7 +224,7 @@ void LogbookWidget::initUi() noexcept
     ui->logTableWidget->setColumnCount(static_cast<int>(headers.count()));
     ui->logTableWidget->setHorizontalHeaderLabels(headers);
     ui->logTableWidget->setSelectionBehavior(QAbstractItemView::SelectRows);
-    ui->logTableWidget->setSelectionMode(QAbstractItemView::SingleSelection);
+    ui->logTableWidget->setSelectionMode(QAbstractItemView::ExtendedSelection);
     ui->logTableWidget->verticalHeader()->hide();
     ui->logTableWidget->setMinimumWidth(::MinimumTableWidth);
     ui->logTableWidget->horizontalHeader()->setStretchLastSection(true);
@@ -497,9 +497,9 @@ void LogbookWidget::updateEditUi() noexcept
 {
     std::optional<std::reference_wrapper<SkyConnectIntf>> skyConnect = SkyConnectManager::getInstance().getCurrentSkyConnect();
     const bool active = skyConnect && skyConnect->get().isActive();
-    const std::int64_t selectedFlightId = getSelectedFlightId();
-    ui->loadPushButton->setEnabled(!active && selectedFlightId != Const::InvalidId);
-    ui->deletePushButton->setEnabled(!active && selectedFlightId != Const::InvalidId);
+    const auto selectedRowCount = ui->logTableWidget->selectionModel()->selectedRows().count();
+    ui->loadPushButton->setEnabled(!active && selectedRowCount == 1);
+    ui->deletePushButton->setEnabled(!active && selectedRowCount > 0);
 }
 
 void LogbookWidget::frenchConnection() noexcept
@@ -694,6 +694,22 @@ std::int64_t LogbookWidget::getSelectedFlightId() const noexcept
     return selectedFlightId;
 }
 
+std::vector<std::int64_t> LogbookWidget::getSelectedFlightIds() const noexcept
+{
+    std::vector<std::int64_t> selectedFlightIds;
+    const auto modelIndices = ui->logTableWidget->selectionModel()->selectedRows(LogbookWidgetPrivate::flightIdColumn);
+    selectedFlightIds.reserve(modelIndices.count());
+    for (const auto &modelIndex : modelIndices) {
+        bool ok {false};
+        const std::int64_t flightId = ui->logTableWidget->item(modelIndex.row(), LogbookWidgetPrivate::flightIdColumn)->data(Qt::DisplayRole).toLongLong(&ok);
+        // The flight being recorded (no valid ID yet) cannot be deleted
+        if (ok) {
+            selectedFlightIds.push_back(flightId);
+        }
+    }
+    return selectedFlightIds;
+}
+
 inline bool LogbookWidget::isMatch(QTableWidgetItem *flightIdItem, std::int64_t flightId) const noexcept
 {
     return flightId != Const::RecordingId && flightIdItem->data(Qt::DisplayRole).toLongLong() == flightId ||
@@ -798,8 +814,8 @@ void LogbookWidget::loadFlight() noexcept
 
 void LogbookWidget::deleteFlight() noexcept
 {
-    const std::int64_t selectedFlightId = getSelectedFlightId();
-    if (selectedFlightId != Const::InvalidId) {
+    const std::vector<std::int64_t> selectedFlightIds = getSelectedFlightIds();
+    if (selectedFlightIds.size() > 0) {
 
         auto &settings = Settings::getInstance();
         bool doDelete {true};
@@ -807,9 +823,15 @@ void LogbookWidget::deleteFlight() noexcept
             auto messageBox = std::make_unique<QMessageBox>(this);
             const auto dontAskAgainCheckBox = new QCheckBox(tr("Do not ask again."), messageBox.get());
 
-            messageBox->setWindowTitle(tr("Delete Flight"));
-            messageBox->setText(tr("The flight %1 is about to be deleted. Deletion cannot be undone.").arg(selectedFlightId));
-            messageBox->setInformativeText(tr("Do you want to delete the flight?"));
+            if (selectedFlightIds.size() == 1) {
+                messageBox->setWindowTitle(tr("Delete Flight"));
+                messageBox->setText(tr("The flight %1 is about to be deleted. Deletion cannot be undone.").arg(selectedFlightIds.front()));
+                messageBox->setInformativeText(tr("Do you want to delete the flight?"));
+            } else {
+                messageBox->setWindowTitle(tr("Delete Flights"));
+                messageBox->setText(tr("%1 flights are about to be deleted. Deletion cannot be undone.").arg(selectedFlightIds.size()));
+                messageBox->setInformativeText(tr("Do you want to delete the flights?"));
+            }
             const auto deleteButton = messageBox->addButton(tr("&Delete"), QMessageBox::AcceptRole);
             const auto keepButton = messageBox->addButton(tr("&Keep"), QMessageBox::RejectRole);
             messageBox->setDefaultButton(keepButton);
@@ -823,8 +845,13 @@ void LogbookWidget::deleteFlight() noexcept
 
         if (doDelete) {
             const auto lastSelectedRow = getSelectedRow();
-            d->flightService->deleteById(selectedFlightId);
+            // All selected flights are deleted within one transaction, and the logbook
+            // is updated only once afterwards
+            const bool ok = d->flightService->deleteByIds(selectedFlightIds);
             updateUi();
+            if (!ok) {
+                QMessageBox::critical(this, tr("Delete Error"), tr("The selected flights could not be deleted from the logbook."));
+            }
             const auto selectedRow = std::min(lastSelectedRow, ui->logTableWidget->rowCount() - 1);
             ui->logTableWidget->selectRow(selectedRow);
             ui->logTableWidget->setFocus();
@@ -866,7 +893,12 @@ void LogbookWidget::onCellChanged(int row, int column) noexcept
     const auto item = ui->logTableWidget->item(row, column);
     const QString value = item->data(Qt::EditRole).toString();
     auto &flight = Logbook::getInstance().getCurrentFlight();
-    const std::int64_t selectedFlightId = getSelectedFlightId();
+    // Multiple rows may be selected: take the flight ID of the edited row
+    bool ok {false};
+    std::int64_t selectedFlightId = ui->logTableWidget->item(row, LogbookWidgetPrivate::flightIdColumn)->data(Qt::DisplayRole).toLongLong(&ok);
+    if (!ok) {
+        selectedFlightId = Const::RecordingId;
+    }
 
     if (column == d->titleColumn) {
         if (flight.getId() == selectedFlightId) {
@@ -26,6 +26,7 @@
 
 #include <memory>
 #include <forward_list>
+#include <vector>
 #include <cstdint>
 
 #include <QWidget>
@@ -81,6 +82,7 @@ private:
 
     int getSelectedRow() const noexcept;
     std::int64_t getSelectedFlightId() const noexcept;
+    std::vector<std::int64_t> getSelectedFlightIds() const noexcept;
     inline bool isMatch(QTableWidgetItem *flightIdItem, std::int64_t flightId) const noexcept;
 
 private slots:
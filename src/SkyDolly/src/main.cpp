@@ -37,6 +37,8 @@
 #endif
 
 #include <Kernel/Version.h>
+#include <Kernel/StartupProfile.h>
+#include <Kernel/Trace.h>
 #include <Kernel/StackTrace.h>
 #include <Kernel/Settings.h>
 #include <Kernel/System.h>
@@ -66,6 +68,7 @@ static void destroySingletons() noexcept
 
 int main(int argc, char **argv) noexcept
 {
+    StartupProfile::start();
     std::set_terminate(ExceptionHandler::onTerminate);
 
     QCoreApplication::setOrganizationName(Version::getOrganisationName());
@@ -76,9 +79,13 @@ int main(int argc, char **argv) noexcept
 
     // Set the user interface style (if not default)
     // Implementation note: must be set AFTER QApplication instantiation
-    const QString styleKey = Settings::getInstance().getStyleKey();
-    if (styleKey != Settings::DefaultStyleKey) {
-        QApplication::setStyle(styleKey);
+    {
+        StartupProfile::Phase phase {"Settings"};
+        Trace::setEnabled(Settings::getInstance().isTracingEnabled());
+        const QString styleKey = Settings::getInstance().getStyleKey();
+        if (styleKey != Settings::DefaultStyleKey) {
+            QApplication::setStyle(styleKey);
+        }
     }
 
     // Signals must be registered after the QApplication instantiation, due
@@ -97,7 +104,11 @@ int main(int argc, char **argv) noexcept
     try {
         // Main window scope
         {
-            std::unique_ptr<MainWindow> mainWindow = std::make_unique<MainWindow>(filePath);
+            std::unique_ptr<MainWindow> mainWindow;
+            {
+                StartupProfile::Phase phase {"Main window"};
+                mainWindow = std::make_unique<MainWindow>(filePath);
+            }
             mainWindow->show();
             res = application.exec();
         }
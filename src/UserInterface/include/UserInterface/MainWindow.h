@@ -68,6 +68,7 @@ public:
     bool connectWithLogbook(const QString &filePath) noexcept;
 
 protected:
+    void paintEvent(QPaintEvent *event) noexcept override;
     void resizeEvent(QResizeEvent *event) noexcept override;
     void closeEvent(QCloseEvent *event) noexcept override;
 
@@ -81,6 +82,12 @@ private:
     void frenchConnection() noexcept;
     void initUi() noexcept;
     void initPlugins() noexcept;
+    /*
+     * Enumerates the import and export plugins and populates the corresponding menus;
+     * only the first call has an effect: the enumeration is deferred until the file
+     * menu is shown for the first time, in order not to delay the application start.
+     */
+    void initImportExportPlugins() noexcept;
     void initModuleSelectorUi() noexcept;
     void initViewUi() noexcept;
     void initControlUi() noexcept;
@@ -201,6 +208,8 @@ private slots:
     void onRecentFileSelected(const QString &filePath, SecurityToken *securityToken) noexcept;
     void updateRecentFileMenu() noexcept;
     void optimiseLogbook() noexcept;
+    void restoreLogbookBackup() noexcept;
+    void vacuumLogbookIncrementally() noexcept;
     void showSettings() noexcept;
     void showLogbookSettings() noexcept;
     void quit() noexcept;
@@ -223,6 +232,7 @@ private slots:
     // Help menu
     void showAboutDialog() noexcept;
     void showOnlineManual() const noexcept;
+    void exportTrace() noexcept;
 
     // Replay
     void toggleRecord(bool checked) noexcept;
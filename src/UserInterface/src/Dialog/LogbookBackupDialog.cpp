@@ -22,11 +22,15 @@
  * DEALINGS IN THE SOFTWARE.
  */
 #include <memory>
+#include <atomic>
+#include <cstdint>
 
 #include <QDialog>
 #include <QPushButton>
 #include <QFileDialog>
 #include <QMessageBox>
+#include <QProgressDialog>
+#include <QMetaObject>
 
 #include <Kernel/Const.h>
 #include <Kernel/Enum.h>
@@ -39,6 +43,13 @@
 #include "LogbookBackupDialog.h"
 #include "ui_LogbookBackupDialog.h"
 
+namespace
+{
+    constexpr int ProgressMaximum {1000};
+    // Milliseconds
+    constexpr int ProgressMinimumDuration {500};
+}
+
 struct LogbookBackupDialogPrivate
 {
     std::unique_ptr<DatabaseService> databaseService {std::make_unique<DatabaseService>()};
@@ -93,12 +104,27 @@ void LogbookBackupDialog::accept() noexcept
     }
 
     // ... the next backup date which is set upon successful backup
+    std::atomic_bool canceled {false};
     if (ok) {
         const auto &persistenceManager = PersistenceManager::getInstance();
-        ok =d->databaseService->backup(persistenceManager.getLogbookPath(), DatabaseService::BackupMode::Normal);
+        QProgressDialog progressDialog {tr("Creating logbook backup..."), tr("&Cancel"), 0, ::ProgressMaximum, parentWidget()};
+        progressDialog.setWindowTitle(tr("Logbook Backup"));
+        progressDialog.setWindowModality(Qt::WindowModal);
+        progressDialog.setMinimumDuration(::ProgressMinimumDuration);
+        connect(&progressDialog, &QProgressDialog::canceled,
+                this, [&canceled]() { canceled = true; });
+        // Called from the backup worker thread
+        const auto progress = [&progressDialog, &canceled](std::int64_t copied, std::int64_t total) {
+            const int value = total > 0 ? static_cast<int>(copied * ::ProgressMaximum / total) : ::ProgressMaximum;
+            QMetaObject::invokeMethod(&progressDialog, [&progressDialog, value]() {
+                progressDialog.setValue(value);
+            }, Qt::QueuedConnection);
+            return !canceled;
+        };
+        ok = d->databaseService->backup(persistenceManager.getLogbookPath(), DatabaseService::BackupMode::Normal, progress);
     }
 
-    if (!ok) {
+    if (!ok && !canceled) {
         QMessageBox::critical(this, tr("Backup Error"), tr("The logbook backup could not be created."));
     }
 }
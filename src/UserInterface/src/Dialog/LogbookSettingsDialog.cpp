@@ -91,7 +91,9 @@ void LogbookSettingsDialog::accept() noexcept
             d->databaseService->setNextBackupDate(QDateTime::currentDateTime());
         }
     }
-    Settings::getInstance().setBackupBeforeMigrationEnabled(ui->backupBeforeMigrationCheckBox->isChecked());
+    auto &settings = Settings::getInstance();
+    settings.setBackupBeforeMigrationEnabled(ui->backupBeforeMigrationCheckBox->isChecked());
+    settings.setBackupDeduplicationEnabled(ui->backupDeduplicationCheckBox->isChecked());
 }
 
 // PROTECTED
@@ -141,7 +143,9 @@ void LogbookSettingsDialog::updateUi() noexcept
         ui->logbookSizeLineEdit->setText(unit.formatMemory(fileSize));
         ui->backupPeriodComboBox->setCurrentId(metadata.backupPeriodId);
     }
-    ui->backupBeforeMigrationCheckBox->setChecked(Settings::getInstance().isBackupBeforeMigrationEnabled());
+    const auto &settings = Settings::getInstance();
+    ui->backupBeforeMigrationCheckBox->setChecked(settings.isBackupBeforeMigrationEnabled());
+    ui->backupDeduplicationCheckBox->setChecked(settings.isBackupDeduplicationEnabled());
 }
 
 void LogbookSettingsDialog::frenchConnection() noexcept
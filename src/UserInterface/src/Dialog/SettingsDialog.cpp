@@ -41,6 +41,7 @@
 #include <Kernel/Settings.h>
 #include <Kernel/System.h>
 #include <Model/SimVar.h>
+#include <Model/SkySearch.h>
 #include <PluginManager/SkyConnectManager.h>
 #include "SettingsDialog.h"
 #include "ui_SettingsDialog.h"
@@ -50,6 +51,16 @@ namespace
     constexpr double MinSeekSeconds {0.001};
     constexpr double MaxSeekSeconds {999.0};
 
+    constexpr int MinIncrementalPersistenceIntervalSeconds {1};
+    constexpr int MaxIncrementalPersistenceIntervalSeconds {600};
+    constexpr int MinAdaptiveSamplingMaxIntervalMSec {100};
+    // Recorded samples must not lie further apart than the interpolation window
+    constexpr int MaxAdaptiveSamplingMaxIntervalMSec {static_cast<int>(SkySearch::DefaultInterpolationWindow)};
+    constexpr double MaxCompactOnStoreMaxDeviation {100.0};
+
+    constexpr int MinUiRefreshRate {1};
+    constexpr int MaxUiRefreshRate {60};
+
     constexpr double MinSeekPercent {0.001};
     constexpr double MaxSeekPercent {100.0};
 
@@ -135,6 +146,8 @@ void SettingsDialog::initUi() noexcept
                                                 "This may help enforcing a consistent canopy animation with certain aircraft.")
                                                 .arg(SimVar::CanopyOpen));
     ui->maximumSimulationRateSpinBox->setToolTip(tr("This option limits the simulation rate in the flight simulator. Note that the actual replay speed may still be set to higher values."));
+    ui->compactSampleMemoryCheckBox->setToolTip(tr("When enabled the position and engine data of loaded flights is kept compactly encoded in memory and only decoded on demand for replay, which notably reduces the memory usage of long flights with many aircraft.\n"
+                                                   "Positions are kept with an accuracy of about 6 mm, altitudes with an accuracy of 0.01 feet."));
 
     // TODO For now we only support "none" and "simulation time"
     ui->timeModeComboBox->addItem(tr("None"), Enum::underly(Replay::TimeMode::None));
@@ -147,6 +160,17 @@ void SettingsDialog::initUi() noexcept
         ui->connectionComboBox->addItem(plugin.second.name, plugin.first);
     }
     initFlightSimulatorOptionWidget();
+    ui->incrementalPersistenceCheckBox->setToolTip(tr("When enabled the recording is periodically stored into the logbook while still recording, so that it can be recovered after an unexpected termination of the application."));
+    ui->incrementalPersistenceIntervalSpinBox->setMinimum(::MinIncrementalPersistenceIntervalSeconds);
+    ui->incrementalPersistenceIntervalSpinBox->setMaximum(::MaxIncrementalPersistenceIntervalSeconds);
+    ui->incrementalPersistenceIntervalSpinBox->setToolTip(tr("The interval at which the recorded samples are stored into the logbook."));
+    ui->adaptiveSamplingCheckBox->setToolTip(tr("When enabled only samples whose values change are recorded, which greatly reduces the size of recordings with mostly static data, such as lights, handles and parked aircraft."));
+    ui->adaptiveSamplingMaxIntervalSpinBox->setMinimum(::MinAdaptiveSamplingMaxIntervalMSec);
+    ui->adaptiveSamplingMaxIntervalSpinBox->setMaximum(::MaxAdaptiveSamplingMaxIntervalMSec);
+    ui->adaptiveSamplingMaxIntervalSpinBox->setToolTip(tr("The maximum time between two recorded samples, also when the values do not change."));
+    ui->compactOnStoreSpinBox->setMinimum(0.0);
+    ui->compactOnStoreSpinBox->setMaximum(::MaxCompactOnStoreMaxDeviation);
+    ui->compactOnStoreSpinBox->setToolTip(tr("When set the recorded positions are simplified after storing the recording, such that the replayed track deviates at most by the given distance from the recorded track."));
 
     // User interface
     const auto defaultStyleName = d->knownStyleNames[Settings::DefaultStyleKey];
@@ -160,6 +184,10 @@ void SettingsDialog::initUi() noexcept
             ui->styleComboBox->addItem(styleName, lowerKey);
         }
     }
+    ui->uiRefreshRateSpinBox->setMinimum(::MinUiRefreshRate);
+    ui->uiRefreshRateSpinBox->setMaximum(::MaxUiRefreshRate);
+    ui->uiRefreshRateSpinBox->setToolTip(tr("The rate at which the simulation variables and the timeline are refreshed during recording and replay. Lower rates reduce the CPU usage."));
+    ui->tracingCheckBox->setToolTip(tr("When enabled the timing of replay frames, recording, logbook access, import and export is recorded in memory, for diagnosing performance issues. The most recent events can be exported with Help | Export Performance Trace."));
 
     ui->settingsTabWidget->setCurrentIndex(::ReplayTab);
     onTabChanged(ui->settingsTabWidget->currentIndex());
@@ -193,6 +221,7 @@ void SettingsDialog::updateReplayTab() noexcept
     ui->seekInPercentSpinBox->setValue(settings.getSeekIntervalPercent());
     ui->repeatCanopyOpenCheckBox->setChecked(settings.isRepeatCanopyOpenEnabled());
     ui->maximumSimulationRateSpinBox->setValue(settings.getMaximumSimulationRate());
+    ui->compactSampleMemoryCheckBox->setChecked(settings.isCompactSampleMemoryEnabled());
 
     const auto replayTimeMode = settings.getReplayTimeMode();
     int currentIndex {0};
@@ -222,6 +251,12 @@ void SettingsDialog::updateFlightSimulatorTab() noexcept
     const bool enabled = !skyConnectManager.isActive();
     ui->connectionComboBox->setEnabled(enabled);
     updateConnectionStatus();
+
+    ui->incrementalPersistenceCheckBox->setChecked(settings.isIncrementalPersistenceEnabled());
+    ui->incrementalPersistenceIntervalSpinBox->setValue(settings.getIncrementalPersistenceIntervalSeconds());
+    ui->adaptiveSamplingCheckBox->setChecked(settings.isAdaptiveSamplingEnabled());
+    ui->adaptiveSamplingMaxIntervalSpinBox->setValue(settings.getAdaptiveSamplingMaxIntervalMSec());
+    ui->compactOnStoreSpinBox->setValue(settings.getCompactOnStoreMaxDeviation());
 }
 
 void SettingsDialog::updateUserInterfaceTab() noexcept
@@ -242,6 +277,8 @@ void SettingsDialog::updateUserInterfaceTab() noexcept
     if (found) {
         ui->styleComboBox->setCurrentIndex(index);
     }
+    ui->uiRefreshRateSpinBox->setValue(settings.getUiRefreshRate());
+    ui->tracingCheckBox->setChecked(settings.isTracingEnabled());
     ui->confirmDeleteFlightCheckBox->setChecked(settings.isDeleteFlightConfirmationEnabled());
     ui->confirmDeleteAircraftCheckBox->setChecked(settings.isDeleteAircraftConfirmationEnabled());
     ui->confirmDeleteLocationCheckBox->setChecked(settings.isDeleteLocationConfirmationEnabled());
@@ -334,15 +371,23 @@ void SettingsDialog::onAccepted() noexcept
     settings.setSeekIntervalPercent(ui->seekInPercentSpinBox->value());
     settings.setRepeatCanopyOpenEnabled(ui->repeatCanopyOpenCheckBox->isChecked());
     settings.setMaximumSimulationRate(ui->maximumSimulationRateSpinBox->value());
+    settings.setCompactSampleMemoryEnabled(ui->compactSampleMemoryCheckBox->isChecked());
     settings.setReplayTimeMode(static_cast<Replay::TimeMode>(ui->timeModeComboBox->currentData().toInt()));
 
     // Flight simulator
     if (d->skyConnectOptionWidget != nullptr) {
         d->skyConnectOptionWidget->accept();
     }
+    settings.setIncrementalPersistenceEnabled(ui->incrementalPersistenceCheckBox->isChecked());
+    settings.setIncrementalPersistenceIntervalSeconds(ui->incrementalPersistenceIntervalSpinBox->value());
+    settings.setAdaptiveSamplingEnabled(ui->adaptiveSamplingCheckBox->isChecked());
+    settings.setAdaptiveSamplingMaxIntervalMSec(ui->adaptiveSamplingMaxIntervalSpinBox->value());
+    settings.setCompactOnStoreMaxDeviation(ui->compactOnStoreSpinBox->value());
 
     // User interface
     settings.setStyleKey(ui->styleComboBox->currentData().toString());
+    settings.setUiRefreshRate(ui->uiRefreshRateSpinBox->value());
+    settings.setTracingEnabled(ui->tracingCheckBox->isChecked());
     settings.setDeleteFlightConfirmationEnabled(ui->confirmDeleteFlightCheckBox->isChecked());
     settings.setDeleteAircraftConfirmationEnabled(ui->confirmDeleteAircraftCheckBox->isChecked());
     settings.setDeleteLocationConfirmationEnabled(ui->confirmDeleteLocationCheckBox->isChecked());
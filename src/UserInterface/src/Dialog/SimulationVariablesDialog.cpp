@@ -46,6 +46,7 @@
 #include <PluginManager/SkyConnectManager.h>
 #include <PluginManager/Connect/SkyConnectIntf.h>
 #include <PluginManager/Connect/Connect.h>
+#include "../Widget/SimulationVariableSnapshot.h"
 #include "../Widget/AircraftWidget.h"
 #include "../Widget/EngineWidget.h"
 #include "../Widget/PrimaryFlightControlWidget.h"
@@ -57,15 +58,20 @@
 
 struct SimulationVariablesDialogPrivate
 {
+    SimulationVariablesDialogPrivate(SimulationVariableSnapshot &snapshot) noexcept
+        : snapshot(snapshot)
+    {}
+
+    SimulationVariableSnapshot &snapshot;
     QShortcut *closeDialogShortcut {nullptr};
 };
 
 // PUBLIC
 
-SimulationVariablesDialog::SimulationVariablesDialog(QWidget *parent) noexcept :
+SimulationVariablesDialog::SimulationVariablesDialog(SimulationVariableSnapshot &snapshot, QWidget *parent) noexcept :
     QDialog {parent},
     ui {std::make_unique<Ui::SimulationVariablesDialog>()},
-    d {std::make_unique<SimulationVariablesDialogPrivate>()}
+    d {std::make_unique<SimulationVariablesDialogPrivate>(snapshot)}
 {
     ui->setupUi(this);
     initUi();
@@ -104,23 +110,23 @@ void SimulationVariablesDialog::initUi() noexcept
 {
     setWindowFlags(Qt::Dialog | Qt::WindowTitleHint | Qt::WindowCloseButtonHint);
 
-    std::unique_ptr<AircraftWidget> aircraftWidget = std::make_unique<AircraftWidget>(this);
+    std::unique_ptr<AircraftWidget> aircraftWidget = std::make_unique<AircraftWidget>(d->snapshot, this);
     // Transfer ownership to Qt
     ui->simulationVariablesTab->addTab(aircraftWidget.release(), tr("&Aircraft"));
 
-    std::unique_ptr<EngineWidget> engineWidget = std::make_unique<EngineWidget>(this);
+    std::unique_ptr<EngineWidget> engineWidget = std::make_unique<EngineWidget>(d->snapshot, this);
     ui->simulationVariablesTab->addTab(engineWidget.release(), tr("&Engine"));
 
-    std::unique_ptr<PrimaryFlightControlWidget> primaryFlightControlWidget = std::make_unique<PrimaryFlightControlWidget>(this);
+    std::unique_ptr<PrimaryFlightControlWidget> primaryFlightControlWidget = std::make_unique<PrimaryFlightControlWidget>(d->snapshot, this);
     ui->simulationVariablesTab->addTab(primaryFlightControlWidget.release(), tr("&Primary Controls"));
 
-    std::unique_ptr<SecondaryFlightControlWidget> secondaryFlightControlWidget = std::make_unique<SecondaryFlightControlWidget>(this);
+    std::unique_ptr<SecondaryFlightControlWidget> secondaryFlightControlWidget = std::make_unique<SecondaryFlightControlWidget>(d->snapshot, this);
     ui->simulationVariablesTab->addTab(secondaryFlightControlWidget.release(), tr("&Secondary Controls"));
 
-    std::unique_ptr<AircraftHandleWidget> aircraftHandleWidget = std::make_unique<AircraftHandleWidget>(this);
+    std::unique_ptr<AircraftHandleWidget> aircraftHandleWidget = std::make_unique<AircraftHandleWidget>(d->snapshot, this);
     ui->simulationVariablesTab->addTab(aircraftHandleWidget.release(), tr("&Handles && Brakes"));
 
-    std::unique_ptr<LightWidget> lightWidget = std::make_unique<LightWidget>(this);
+    std::unique_ptr<LightWidget> lightWidget = std::make_unique<LightWidget>(d->snapshot, this);
     ui->simulationVariablesTab->addTab(lightWidget.release(), tr("&Lights"));
 
     d->closeDialogShortcut = new QShortcut(QKeySequence(tr("V", "Window|Simulation Variables...")), this);
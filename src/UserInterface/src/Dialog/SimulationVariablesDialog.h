@@ -31,6 +31,7 @@
 class QShowEvent;
 class QHideEvent;
 
+class SimulationVariableSnapshot;
 struct SimulationVariablesDialogPrivate;
 
 namespace Ui {
@@ -41,7 +42,7 @@ class SimulationVariablesDialog : public QDialog
 {
     Q_OBJECT
 public:
-    explicit SimulationVariablesDialog(QWidget *parent = nullptr) noexcept;
+    explicit SimulationVariablesDialog(SimulationVariableSnapshot &snapshot, QWidget *parent = nullptr) noexcept;
     SimulationVariablesDialog(const SimulationVariablesDialog &rhs) = delete;
     SimulationVariablesDialog(SimulationVariablesDialog &&rhs) = delete;
     SimulationVariablesDialog &operator=(const SimulationVariablesDialog &rhs) = delete;
@@ -25,6 +25,7 @@
 #include <utility>
 #include <cstdint>
 
+#include <QString>
 #include <QWidget>
 #include <QDialog>
 #include <QShortcut>
@@ -36,6 +37,7 @@
 
 #include <Kernel/Settings.h>
 #include <Kernel/Unit.h>
+#include <Kernel/StartupProfile.h>
 #include <Model/Logbook.h>
 #include <Model/Flight.h>
 #include <Model/Aircraft.h>
@@ -56,6 +58,8 @@
 #include <PluginManager/SkyConnectManager.h>
 #include <PluginManager/Connect/SkyConnectIntf.h>
 #include <PluginManager/Connect/Connect.h>
+#include <PluginManager/Connect/ReplayStatistics.h>
+#include <PluginManager/Connect/CaptureStatistics.h>
 #include "StatisticsDialog.h"
 #include "ui_StatisticsDialog.h"
 
@@ -97,7 +101,7 @@ void StatisticsDialog::showEvent(QShowEvent *event) noexcept
     // Connection
     auto &skyConnectManager = SkyConnectManager::getInstance();
     connect(&skyConnectManager, &SkyConnectManager::timestampChanged,
-            this, &StatisticsDialog::updateRecordUi);    
+            this, &StatisticsDialog::onTimestampChanged);
     connect(&skyConnectManager, &SkyConnectManager::recordingStarted,
             this, &StatisticsDialog::onRecordingStarted);
 
@@ -116,7 +120,7 @@ void StatisticsDialog::hideEvent(QHideEvent *event) noexcept
     // Connection
     auto &skyConnectManager = SkyConnectManager::getInstance();
     disconnect(&skyConnectManager, &SkyConnectManager::timestampChanged,
-               this, &StatisticsDialog::updateRecordUi);
+               this, &StatisticsDialog::onTimestampChanged);
     disconnect(&skyConnectManager, &SkyConnectManager::recordingStarted,
                this, &StatisticsDialog::onRecordingStarted);
 
@@ -138,6 +142,17 @@ void StatisticsDialog::initUi() noexcept
     d->closeDialogShortcut = new QShortcut(QKeySequence(tr("S", "Window|Statistics...")), this);
 }
 
+void StatisticsDialog::updateApplicationUi() noexcept
+{
+    // Application start until the first paint of the main window
+    ui->startupTimeLineEdit->setText(tr("%1 ms").arg(d->unit.formatNumber(StartupProfile::getStartupTime() / 1000.0, 0)));
+    QString phases;
+    for (const auto &phase : StartupProfile::getPhases()) {
+        phases.append(tr("%1: %2 ms\n").arg(QString::fromLatin1(phase.name), d->unit.formatNumber(phase.duration / 1000.0, 1)));
+    }
+    ui->startupTimeLineEdit->setToolTip(tr("Time from the application start until the main window is shown.\n\n%1").arg(phases.trimmed()));
+}
+
 void StatisticsDialog::frenchConnection() noexcept
 {
     connect(d->closeDialogShortcut, &QShortcut::activated,
@@ -196,6 +211,8 @@ std::pair<float, float> StatisticsDialog::calculateRecordedPositionAndAttitudeSa
 void StatisticsDialog::updateUi() noexcept
 {
     updateRecordUi(SkyConnectManager::getInstance().getCurrentTimestamp());
+    updateReplayUi();
+    updateApplicationUi();
 }
 
 void StatisticsDialog::updateRecordUi(std::int64_t timestamp) noexcept
@@ -226,19 +243,53 @@ void StatisticsDialog::updateRecordUi(std::int64_t timestamp) noexcept
         const auto aircraftHandleDataCount = aircraft.getAircraftHandle().count();
         const auto lightDataCount = aircraft.getLight().count();
         totalCount = totalCount + attitudeDataCount + positionDataCount + engineDataCount + primaryFlightControlDataCount + secondaryFlightControlDataCount + aircraftHandleDataCount + lightDataCount;
-
-        const auto positionDataSize = positionDataCount * sizeof(PositionData);
-        const auto attitudeDataSize = attitudeDataCount * sizeof(AttitudeData);
-        const auto engineDataSize = engineDataCount * sizeof(EngineData);
-        const auto primaryFlightControlDataSize = primaryFlightControlDataCount * sizeof(PrimaryFlightControlData);
-        const auto secondaryFlightControlDataSize = secondaryFlightControlDataCount * sizeof(SecondaryFlightControlData);
-        const auto aircraftHandleDataSize = aircraftHandleDataCount * sizeof(AircraftHandleData);
-        const auto lightDataSize = lightDataCount * sizeof(LightData);
-        totalSize = totalSize + positionDataSize + attitudeDataSize + engineDataSize + primaryFlightControlDataSize + secondaryFlightControlDataSize + aircraftHandleDataSize + lightDataSize;
+        // The actually allocated memory, taking compactly encoded sampled data into account
+        totalSize += aircraft.getMemoryUsage();
     }
 
     ui->sampleCountLineEdit->setText(QString::number(totalCount));
     ui->sampleSizeLineEdit->setText(d->unit.formatMemory(totalSize));
+
+    const CaptureStatistics captureStatistics = skyConnectManager.getCaptureStatistics();
+    ui->recordedSamplesLineEdit->setText(tr("%1 / %2").arg(d->unit.formatNumber(static_cast<std::int64_t>(captureStatistics.appendedSamples)),
+                                                           d->unit.formatNumber(static_cast<std::int64_t>(captureStatistics.capturedSamples))));
+}
+
+void StatisticsDialog::updateReplayUi() noexcept
+{
+    const auto replayStatistics = SkyConnectManager::getInstance().getReplayStatistics();
+    const auto &frameIntervals = replayStatistics.frameIntervals;
+    if (frameIntervals.getCount() > 0) {
+        const auto meanInterval = frameIntervals.getMean();
+        ui->frameRateLineEdit->setText(d->unit.formatHz(meanInterval > 0.0 ? 1000.0 / meanInterval : 0.0));
+        ui->frameIntervalLineEdit->setText(tr("%1 / %2 / %3 ms").arg(d->unit.formatNumber(meanInterval, 1),
+                                                                      d->unit.formatNumber(frameIntervals.getPercentile(99.0), 1),
+                                                                      d->unit.formatNumber(frameIntervals.getMaximum(), 1)));
+        const auto &jitter = replayStatistics.jitter;
+        ui->jitterLineEdit->setText(tr("%1 / %2 ms").arg(d->unit.formatNumber(jitter.getPercentile(50.0), 2),
+                                                          d->unit.formatNumber(jitter.getPercentile(99.0), 2)));
+    } else {
+        ui->frameRateLineEdit->clear();
+        ui->frameIntervalLineEdit->clear();
+        ui->jitterLineEdit->clear();
+    }
+    ui->skippedFramesLineEdit->setText(d->unit.formatNumber(static_cast<std::int64_t>(replayStatistics.skippedFrames)));
+
+    // Seeking is also possible outside of the replay state
+    const auto &seekLatencies = replayStatistics.seekLatencies;
+    if (seekLatencies.getCount() > 0) {
+        ui->seekLatencyLineEdit->setText(tr("%1 / %2 ms").arg(d->unit.formatNumber(seekLatencies.getPercentile(50.0), 1),
+                                                              d->unit.formatNumber(seekLatencies.getPercentile(99.0), 1)));
+    } else {
+        ui->seekLatencyLineEdit->clear();
+    }
+    ui->supersededSeeksLineEdit->setText(d->unit.formatNumber(static_cast<std::int64_t>(replayStatistics.supersededSeeks)));
+}
+
+void StatisticsDialog::onTimestampChanged(std::int64_t timestamp) noexcept
+{
+    updateRecordUi(timestamp);
+    updateReplayUi();
 }
 
 void StatisticsDialog::onRecordingStarted() noexcept
@@ -65,9 +65,13 @@ private:
 
     std::pair<float, float> calculateRecordedPositionAndAttitudeSamplesPerSecond() const noexcept;
 
+    void updateApplicationUi() noexcept;
+
 private slots:
     void updateUi() noexcept;
     void updateRecordUi(std::int64_t timestamp) noexcept;
+    void updateReplayUi() noexcept;
+    void onTimestampChanged(std::int64_t timestamp) noexcept;
     void onRecordingStarted() noexcept;
 };
 
@@ -24,6 +24,7 @@
 #include <algorithm>
 #include <memory>
 #include <optional>
+#include <atomic>
 #include <vector>
 #include <cstdint>
 #include <cmath>
@@ -57,6 +58,7 @@
 #include <QDoubleValidator>
 #include <QIcon>
 #include <QEvent>
+#include <QPaintEvent>
 #include <QResizeEvent>
 #include <QCloseEvent>
 #include <QAction>
@@ -67,6 +69,8 @@
 #include <QDragEnterEvent>
 #include <QDropEvent>
 #include <QProcess>
+#include <QProgressDialog>
+#include <QMetaObject>
 
 #include <Kernel/Unit.h>
 #include <Kernel/Const.h>
@@ -77,6 +81,8 @@
 #include <Kernel/SampleRate.h>
 #include <Kernel/SecurityToken.h>
 #include <Kernel/RecentFile.h>
+#include <Kernel/StartupProfile.h>
+#include <Kernel/Trace.h>
 #include <Model/Aircraft.h>
 #include <Model/PositionData.h>
 #include <Model/AircraftInfo.h>
@@ -106,6 +112,7 @@
 #include "Dialog/SimulationVariablesDialog.h"
 #include "Dialog/StatisticsDialog.h"
 #include "Dialog/LogbookBackupDialog.h"
+#include "Widget/SimulationVariableSnapshot.h"
 #include "MainWindow.h"
 #include "./ui_MainWindow.h"
 
@@ -125,6 +132,15 @@ namespace
 
     constexpr const char *ReplaySpeedProperty {"ReplaySpeed"};
 
+    // Unused logbook pages are freed in small portions, in idle periods
+    constexpr auto IncrementalVacuumInterval {30s};
+    // With the default page size of 4 KiB: 1 MiB
+    constexpr int IncrementalVacuumPageCount {256};
+
+    constexpr int RestoreProgressMaximum {1000};
+    // Milliseconds
+    constexpr int RestoreProgressMinimumDuration {500};
+
     enum struct ReplaySpeed: std::uint8_t {
         Slow10,
         Slow25,
@@ -147,10 +163,12 @@ struct MainWindowPrivate
     RecentFileMenu *recentFileMenu {nullptr};
     FlightDialog *flightDialog {nullptr};
     SimulationVariablesDialog *simulationVariablesDialog {nullptr};
+    SimulationVariableSnapshot *simulationVariableSnapshot {nullptr};
     StatisticsDialog *statisticsDialog {nullptr};
 
     QMenu *trayIconMenu {nullptr};
     QSystemTrayIcon *trayIcon {nullptr};
+    QTimer *incrementalVacuumTimer {nullptr};
 
     Unit unit;
     QSize lastNormalUiSize;
@@ -175,6 +193,7 @@ struct MainWindowPrivate
     bool hasFlightExportPlugins {false};
     bool hasLocationImportPlugins {false};
     bool hasLocationExportPlugins {false};
+    bool importExportPluginsInitialised {false};
     bool continuousSeek {false};
 
     std::unique_ptr<ModuleManager> moduleManager;
@@ -190,15 +209,21 @@ MainWindow::MainWindow(const QString &filePath, QWidget *parent) noexcept
     ui->setupUi(this);
 
     // Connect with logbook
-    if (!filePath.isNull()) {
-        d->connectedWithLogbook = connectWithLogbook(filePath);
-    } else {
-        const QString logbookPath = Settings::getInstance().getLogbookPath();
-        d->connectedWithLogbook = connectWithLogbook(logbookPath);
+    {
+        StartupProfile::Phase phase {"Logbook connection"};
+        if (!filePath.isNull()) {
+            d->connectedWithLogbook = connectWithLogbook(filePath);
+        } else {
+            const QString logbookPath = Settings::getInstance().getLogbookPath();
+            d->connectedWithLogbook = connectWithLogbook(logbookPath);
+        }
     }
 
     initPlugins();
-    initUi();
+    {
+        StartupProfile::Phase phase {"User interface"};
+        initUi();
+    }
     updateUi();
     frenchConnection();
 }
@@ -235,6 +260,15 @@ bool MainWindow::connectWithLogbook(const QString &filePath) noexcept
 
 // PROTECTED
 
+void MainWindow::paintEvent(QPaintEvent *event) noexcept
+{
+    QMainWindow::paintEvent(event);
+    // The application has started once the main window is painted for the first time
+    if (!StartupProfile::isFinished()) {
+        StartupProfile::finish();
+    }
+}
+
 void MainWindow::resizeEvent(QResizeEvent *event) noexcept
 {
     if (!isMinimalUiEnabled()) {
@@ -298,7 +332,8 @@ void MainWindow::frenchConnection() noexcept
 {
     // Sky Connect
     auto &skyConnectManager = SkyConnectManager::getInstance();
-    connect(&skyConnectManager, &SkyConnectManager::timestampChanged,
+    // The timeline is refreshed at the user interface refresh rate
+    connect(d->simulationVariableSnapshot, &SimulationVariableSnapshot::refreshed,
             this, &MainWindow::onTimestampChanged);
     connect(&skyConnectManager, &SkyConnectManager::stateChanged,
             this, &MainWindow::updateUi);
@@ -309,6 +344,10 @@ void MainWindow::frenchConnection() noexcept
     connect(&skyConnectManager, &SkyConnectManager::simulationRateReceived,
             this, &MainWindow::onSimulationRateReceived);
 
+    // File menu
+    connect(ui->fileMenu, &QMenu::aboutToShow,
+            this, &MainWindow::initImportExportPlugins);
+
     // Replay speed
     connect(d->replaySpeedActionGroup, &QActionGroup::triggered,
             this, &MainWindow::onReplaySpeedSelected);
@@ -341,6 +380,8 @@ void MainWindow::frenchConnection() noexcept
             this, &MainWindow::onReplayLoopChanged);
     connect(&settings, &Settings::styleKeyChanged,
             this, &MainWindow::onStyleKeyChanged);
+    connect(&settings, &Settings::tracingChanged,
+            this, &Trace::setEnabled);
 
     // Logbook connection
     connect(&PersistenceManager::getInstance(), &PersistenceManager::connectionChanged,
@@ -403,6 +444,10 @@ void MainWindow::frenchConnection() noexcept
             this, &MainWindow::openLogbook);
     connect(ui->optimiseLogbookAction, &QAction::triggered,
             this, &MainWindow::optimiseLogbook);
+    connect(ui->restoreLogbookBackupAction, &QAction::triggered,
+            this, &MainWindow::restoreLogbookBackup);
+    connect(d->incrementalVacuumTimer, &QTimer::timeout,
+            this, &MainWindow::vacuumLogbookIncrementally);
     connect(ui->showSettingsAction, &QAction::triggered,
             this, &MainWindow::showSettings);
     connect(ui->showLogbookSettingsAction, &QAction::triggered,
@@ -456,6 +501,8 @@ void MainWindow::frenchConnection() noexcept
             this, &MainWindow::showAboutDialog);
     connect(ui->onlineManualAction, &QAction::triggered,
             this, &MainWindow::showOnlineManual);
+    connect(ui->exportTraceAction, &QAction::triggered,
+            this, &MainWindow::exportTrace);
 }
 
 void MainWindow::initUi() noexcept
@@ -470,6 +517,13 @@ void MainWindow::initUi() noexcept
     // Window menu
     ui->stayOnTopAction->setChecked(settings.isWindowStaysOnTopEnabled());
 
+    // Shared by the timeline and the simulation variables dialog
+    d->simulationVariableSnapshot = new SimulationVariableSnapshot(this);
+
+    d->incrementalVacuumTimer = new QTimer(this);
+    d->incrementalVacuumTimer->setInterval(::IncrementalVacuumInterval);
+    d->incrementalVacuumTimer->start();
+
     initModuleSelectorUi();
     initViewUi();
     initControlUi();
@@ -520,18 +574,33 @@ void MainWindow::initUi() noexcept
 
 void MainWindow::initPlugins() noexcept
 {
-    std::vector<PluginManager::Handle> flightImportPlugins;
-    std::vector<PluginManager::Handle> flightExportPlugins;
-    std::vector<PluginManager::Handle> locationImportPlugins;
-    std::vector<PluginManager::Handle> locationExportPlugins;
-
     d->flightImportActionGroup = new QActionGroup(this);
     d->flightExportActionGroup = new QActionGroup(this);
     d->locationImportActionGroup = new QActionGroup(this);
     d->locationExportActionGroup = new QActionGroup(this);
 
+    PluginManager::getInstance().initialise(this);
+
+    // The import and export plugins are only enumerated once the file menu is shown
+    // for the first time, only the connection plugin is required right from the start
+    StartupProfile::Phase phase {"Connection plugin"};
+    initSkyConnectPlugin();
+}
+
+void MainWindow::initImportExportPlugins() noexcept
+{
+    if (d->importExportPluginsInitialised) {
+        return;
+    }
+    d->importExportPluginsInitialised = true;
+
+    StartupProfile::Phase phase {"Plugin enumeration"};
+    std::vector<PluginManager::Handle> flightImportPlugins;
+    std::vector<PluginManager::Handle> flightExportPlugins;
+    std::vector<PluginManager::Handle> locationImportPlugins;
+    std::vector<PluginManager::Handle> locationExportPlugins;
+
     auto &pluginManager = PluginManager::getInstance();
-    pluginManager.initialise(this);
 
     // Flight import
     flightImportPlugins = pluginManager.initialiseFlightImportPlugins();
@@ -597,13 +666,16 @@ void MainWindow::initPlugins() noexcept
         ui->locationExportMenu->setEnabled(false);
     }
 
-    initSkyConnectPlugin();
+    updateFileMenu();
 }
 
 void MainWindow::initModuleSelectorUi() noexcept
 {
     // Modules
-    d->moduleManager = std::make_unique<ModuleManager>(*ui->moduleGroupBox->layout());
+    {
+        StartupProfile::Phase phase {"Module initialisation"};
+        d->moduleManager = std::make_unique<ModuleManager>(*ui->moduleGroupBox->layout());
+    }
     auto actionCheckBox = new ActionCheckBox(false, this);
     actionCheckBox->setAction(ui->showModulesAction);
     actionCheckBox->setFocusPolicy(Qt::NoFocus);
@@ -872,7 +944,7 @@ inline bool MainWindow::hasFlightDialog() const noexcept
 SimulationVariablesDialog &MainWindow::getSimulationVariablesDialog() noexcept
 {
     if (d->simulationVariablesDialog == nullptr) {
-        d->simulationVariablesDialog = new SimulationVariablesDialog(this);
+        d->simulationVariablesDialog = new SimulationVariablesDialog(*d->simulationVariableSnapshot, this);
         d->simulationVariablesDialog->setAttribute(Qt::WA_DeleteOnClose);
         connect(d->simulationVariablesDialog, &SimulationVariablesDialog::visibilityChanged,
                 this, &MainWindow::updateWindowMenu);
@@ -1562,6 +1634,7 @@ void MainWindow::updateFileMenu() noexcept
         ui->locationImportMenu->setEnabled(false);
         ui->locationExportMenu->setEnabled(false);
         ui->optimiseLogbookAction->setEnabled(false);
+        ui->restoreLogbookBackupAction->setEnabled(false);
     } else {
         ui->newLogbookAction->setEnabled(true);
         ui->openLogbookAction->setEnabled(true);
@@ -1570,6 +1643,7 @@ void MainWindow::updateFileMenu() noexcept
         ui->locationImportMenu->setEnabled(d->hasFlightImportPlugins && d->connectedWithLogbook);
         ui->locationExportMenu->setEnabled(d->hasFlightExportPlugins && d->connectedWithLogbook);
         ui->optimiseLogbookAction->setEnabled(d->connectedWithLogbook);
+        ui->restoreLogbookBackupAction->setEnabled(true);
     }
 }
 
@@ -1729,6 +1803,57 @@ void MainWindow::optimiseLogbook() noexcept
     }
 }
 
+void MainWindow::restoreLogbookBackup() noexcept
+{
+    const auto &persistenceManager = PersistenceManager::getInstance();
+    bool ok {true};
+    QString backupDirectoryPath = persistenceManager.getMetadata(&ok).backupDirectoryPath;
+    if (!ok || backupDirectoryPath.isEmpty() || QDir::isRelativePath(backupDirectoryPath)) {
+        backupDirectoryPath = QFileInfo(persistenceManager.getLogbookPath()).absolutePath();
+    }
+    const QString backupFilePath = QFileDialog::getOpenFileName(this, tr("Restore Logbook Backup"), backupDirectoryPath, QStringLiteral("*") % Const::DotBackupExtension);
+    if (backupFilePath.isEmpty()) {
+        return;
+    }
+    const QString logbookPath = DatabaseService::getNewLogbookPath(this);
+    if (logbookPath.isNull()) {
+        return;
+    }
+
+    std::atomic_bool canceled {false};
+    {
+        QProgressDialog progressDialog {tr("Restoring logbook backup..."), tr("&Cancel"), 0, ::RestoreProgressMaximum, this};
+        progressDialog.setWindowTitle(tr("Restore Logbook Backup"));
+        progressDialog.setWindowModality(Qt::WindowModal);
+        progressDialog.setMinimumDuration(::RestoreProgressMinimumDuration);
+        connect(&progressDialog, &QProgressDialog::canceled,
+                this, [&canceled]() { canceled = true; });
+        // Called from the restore worker thread
+        const auto progress = [&progressDialog, &canceled](std::int64_t restored, std::int64_t total) {
+            const int value = total > 0 ? static_cast<int>(restored * ::RestoreProgressMaximum / total) : ::RestoreProgressMaximum;
+            QMetaObject::invokeMethod(&progressDialog, [&progressDialog, value]() {
+                progressDialog.setValue(value);
+            }, Qt::QueuedConnection);
+            return !canceled;
+        };
+        ok = DatabaseService::restoreBackup(backupFilePath, logbookPath, progress);
+    }
+    if (ok) {
+        connectWithLogbook(logbookPath);
+    } else if (!canceled) {
+        QMessageBox::critical(this, tr("Restore Error"), tr("The logbook backup %1 could not be restored.").arg(QDir::toNativeSeparators(backupFilePath)));
+    }
+}
+
+void MainWindow::vacuumLogbookIncrementally() noexcept
+{
+    // Neither while recording nor while replaying
+    const auto &persistenceManager = PersistenceManager::getInstance();
+    if (persistenceManager.isConnected() && SkyConnectManager::getInstance().isIdle()) {
+        persistenceManager.incrementalVacuum(::IncrementalVacuumPageCount);
+    }
+}
+
 void MainWindow::showSettings() noexcept
 {
     std::unique_ptr<SettingsDialog> settingsDialog = std::make_unique<SettingsDialog>(this);
@@ -1825,6 +1950,27 @@ void MainWindow::showOnlineManual() const noexcept
     QDesktopServices::openUrl(QUrl("https://till213.github.io/SkyDolly/manual/en/"));
 }
 
+void MainWindow::exportTrace() noexcept
+{
+    if (!Trace::isEnabled() && Trace::getEvents().empty()) {
+        QMessageBox::information(this, tr("Performance Trace"), tr("No performance trace events have been recorded. Enable the performance trace in the application settings first."));
+        return;
+    }
+    const QString suggestedFilePath = Settings::getInstance().getExportPath() % "/" % QStringLiteral("SkyDolly-Trace-") % QDateTime::currentDateTime().toString("yyyyMMdd-hhmmss") % ".json";
+    const QString filePath = QFileDialog::getSaveFileName(this, tr("Export Performance Trace"), suggestedFilePath, tr("Chrome trace (*.json)"));
+    if (!filePath.isEmpty()) {
+        QFile file {filePath};
+        bool ok = file.open(QIODevice::WriteOnly);
+        if (ok) {
+            ok = Trace::exportChromeTrace(file);
+            file.close();
+        }
+        if (!ok) {
+            QMessageBox::critical(this, tr("Export Error"), tr("The performance trace could not be exported to %1.").arg(QDir::toNativeSeparators(filePath)));
+        }
+    }
+}
+
 // Replay
 
 void MainWindow::toggleRecord(bool enable) noexcept
@@ -21,18 +21,29 @@
  * OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
  * DEALINGS IN THE SOFTWARE.
  */
+#include <memory>
+
 #include <QWidget>
+#include <QLineEdit>
+#include <QString>
 
-#include <Model/Logbook.h>
-#include <Model/Flight.h>
-#include <PluginManager/SkyConnectManager.h>
-#include <PluginManager/Connect/SkyConnectIntf.h>
-#include <PluginManager/Connect/Connect.h>
+#include "SimulationVariableSnapshot.h"
 #include "AbstractSimulationVariableWidget.h"
 
+struct AbstractSimulationVariableWidgetPrivate
+{
+    AbstractSimulationVariableWidgetPrivate(SimulationVariableSnapshot &snapshot) noexcept
+        : snapshot(snapshot)
+    {}
+
+    SimulationVariableSnapshot &snapshot;
+};
 
-AbstractSimulationVariableWidget  ::AbstractSimulationVariableWidget(QWidget *parent) noexcept
-    : QWidget {parent}
+// PUBLIC
+
+AbstractSimulationVariableWidget::AbstractSimulationVariableWidget(SimulationVariableSnapshot &snapshot, QWidget *parent) noexcept
+    : QWidget {parent},
+      d {std::make_unique<AbstractSimulationVariableWidgetPrivate>(snapshot)}
 {}
 
 AbstractSimulationVariableWidget::~AbstractSimulationVariableWidget() = default;
@@ -43,33 +54,38 @@ void AbstractSimulationVariableWidget::showEvent(QShowEvent *event) noexcept
 {
     QWidget::showEvent(event);
 
-    const auto &skyConnectManager = SkyConnectManager::getInstance();
-    connect(&skyConnectManager, &SkyConnectManager::timestampChanged,
-            this, &AbstractSimulationVariableWidget::updateUi);
-
-    updateUi(skyConnectManager.getCurrentTimestamp(), TimeVariableData::Access::DiscreteSeek);
-
-    auto &flight = Logbook::getInstance().getCurrentFlight();
-    connect(&flight, &Flight::userAircraftChanged,
-            this, &AbstractSimulationVariableWidget::updateUiWithCurrentTime);
+    d->snapshot.addConsumer();
+    connect(&d->snapshot, &SimulationVariableSnapshot::refreshed,
+            this, &AbstractSimulationVariableWidget::onSnapshotRefreshed);
+    updateUi(d->snapshot);
 }
 
 void AbstractSimulationVariableWidget::hideEvent(QHideEvent *event) noexcept
 {
     QWidget::hideEvent(event);
 
-    const auto &skyConnectManager = SkyConnectManager::getInstance();
-    disconnect(&skyConnectManager, &SkyConnectManager::timestampChanged,
-               this, &AbstractSimulationVariableWidget::updateUi);
-    auto &flight = Logbook::getInstance().getCurrentFlight();
-    disconnect(&flight, &Flight::userAircraftChanged,
-               this, &AbstractSimulationVariableWidget::updateUiWithCurrentTime);
+    disconnect(&d->snapshot, &SimulationVariableSnapshot::refreshed,
+               this, &AbstractSimulationVariableWidget::onSnapshotRefreshed);
+    d->snapshot.removeConsumer();
+}
+
+void AbstractSimulationVariableWidget::updateText(QLineEdit &lineEdit, const QString &text) noexcept
+{
+    if (lineEdit.text() != text) {
+        lineEdit.setText(text);
+    }
+}
+
+void AbstractSimulationVariableWidget::updateStyleSheet(QWidget &widget, const QString &styleSheet) noexcept
+{
+    if (widget.styleSheet() != styleSheet) {
+        widget.setStyleSheet(styleSheet);
+    }
 }
 
 // PRIVATE SLOTS
 
-void AbstractSimulationVariableWidget::updateUiWithCurrentTime() noexcept
+void AbstractSimulationVariableWidget::onSnapshotRefreshed() noexcept
 {
-    const auto &skyConnectManager = SkyConnectManager::getInstance();
-    updateUi(skyConnectManager.getCurrentTimestamp(), TimeVariableData::Access::DiscreteSeek);
+    updateUi(d->snapshot);
 }
@@ -24,20 +24,31 @@
 #ifndef ABSTRACTSIMULATIONVARIABLEWIDGET_H
 #define ABSTRACTSIMULATIONVARIABLEWIDGET_H
 
+#include <memory>
 #include <cstdint>
 
 #include <QWidget>
 
-#include <Model/TimeVariableData.h>
-
 class QShowEvent;
 class QHideEvent;
+class QLineEdit;
+class QString;
+
+#include <Model/TimeVariableData.h>
+
+class SimulationVariableSnapshot;
+struct AbstractSimulationVariableWidgetPrivate;
 
+/*!
+ * The base class of all widgets showing the simulation variables of the user aircraft. The
+ * simulation variables are provided by the shared \c snapshot, which is refreshed at the
+ * user interface refresh rate; the widgets are only updated while they are visible.
+ */
 class AbstractSimulationVariableWidget : public QWidget
 {
     Q_OBJECT
 public:
-    explicit AbstractSimulationVariableWidget(QWidget *parent) noexcept;
+    explicit AbstractSimulationVariableWidget(SimulationVariableSnapshot &snapshot, QWidget *parent) noexcept;
     AbstractSimulationVariableWidget(const AbstractSimulationVariableWidget &rhs) = delete;
     AbstractSimulationVariableWidget(AbstractSimulationVariableWidget &&rhs) = delete;
     AbstractSimulationVariableWidget &operator=(const AbstractSimulationVariableWidget &rhs) = delete;
@@ -48,11 +59,31 @@ protected:
     void showEvent(QShowEvent *event) noexcept override;
     void hideEvent(QHideEvent *event) noexcept override;
 
-protected slots:
-    virtual void updateUi(std::int64_t timestamp, TimeVariableData::Access access) noexcept = 0;
+    /*!
+     * Updates the widget with the simulation variables of the \p snapshot.
+     *
+     * \param snapshot
+     *        the refreshed simulation variables
+     */
+    virtual void updateUi(const SimulationVariableSnapshot &snapshot) noexcept = 0;
+
+    /*!
+     * Sets the \p text of the \p lineEdit, but only if it differs from the current
+     * text, avoiding needless repaints.
+     */
+    static void updateText(QLineEdit &lineEdit, const QString &text) noexcept;
+
+    /*!
+     * Sets the \p styleSheet of the \p widget, but only if it differs from the current
+     * style sheet: setting a style sheet is expensive, as it repolishes the \p widget.
+     */
+    static void updateStyleSheet(QWidget &widget, const QString &styleSheet) noexcept;
+
+private:
+    const std::unique_ptr<AbstractSimulationVariableWidgetPrivate> d;
 
 private slots:
-    void updateUiWithCurrentTime() noexcept;
+    void onSnapshotRefreshed() noexcept;
 };
 
 #endif // ABSTRACTSIMULATIONVARIABLEWIDGET_H
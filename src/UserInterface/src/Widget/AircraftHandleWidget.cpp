@@ -41,6 +41,7 @@
 #include <PluginManager/SkyConnectManager.h>
 #include <PluginManager/Connect/SkyConnectIntf.h>
 #include <PluginManager/Connect/Connect.h>
+#include "SimulationVariableSnapshot.h"
 #include "AircraftHandleWidget.h"
 #include "ui_AircraftHandleWidget.h"
 
@@ -58,8 +59,8 @@ struct AircraftHandleWidgetPrivate
 
 // PUBLIC
 
-AircraftHandleWidget::AircraftHandleWidget(QWidget *parent) noexcept :
-    AbstractSimulationVariableWidget {parent},
+AircraftHandleWidget::AircraftHandleWidget(SimulationVariableSnapshot &snapshot, QWidget *parent) noexcept :
+    AbstractSimulationVariableWidget {snapshot, parent},
     ui {std::make_unique<Ui::AircraftHandleWidget>()},
     d {std::make_unique<AircraftHandleWidgetPrivate>(*this)}
 {
@@ -69,6 +70,45 @@ AircraftHandleWidget::AircraftHandleWidget(QWidget *parent) noexcept :
 
 AircraftHandleWidget::~AircraftHandleWidget() = default;
 
+// PROTECTED
+
+void AircraftHandleWidget::updateUi(const SimulationVariableSnapshot &snapshot) noexcept
+{
+    const AircraftHandleData &aircraftHandleData = snapshot.getAircraftHandleData();
+    QString colorName;
+
+    if (!aircraftHandleData.isNull()) {
+        updateText(*ui->canopyOpenLineEdit, d->unit.formatPercent(aircraftHandleData.canopyOpen));
+        updateText(*ui->gearLineEdit, aircraftHandleData.gearHandlePosition ? tr("Down") : tr("Up"));
+        updateText(*ui->brakeLeftLineEdit, d->unit.formatPosition(aircraftHandleData.brakeLeftPosition));
+        updateText(*ui->brakeRightLineEdit, d->unit.formatPosition(aircraftHandleData.brakeRightPosition));
+        updateText(*ui->gearSteerPositionLineEdit, d->unit.formatPosition(aircraftHandleData.gearSteerPosition));
+        updateText(*ui->waterRudderLineEdit, d->unit.formatPosition(aircraftHandleData.waterRudderHandlePosition));
+        updateText(*ui->tailhookHandleLineEdit, aircraftHandleData.tailhookHandlePosition ? tr("Extended") : tr("Retracted"));
+        updateText(*ui->tailhookPositionLineEdit, d->unit.formatPercent(aircraftHandleData.tailhookPosition));
+        updateText(*ui->wingFoldingHandleLineEdit, aircraftHandleData.foldingWingHandlePosition ? tr("Retracted") : tr("Extended"));
+        updateText(*ui->leftWingFoldingLineEdit, d->unit.formatPercent(aircraftHandleData.leftWingFolding));
+        updateText(*ui->rightWingFoldingLineEdit, d->unit.formatPercent(aircraftHandleData.rightWingFolding));
+
+        colorName = d->ActiveTextColor.name();
+    } else {
+        colorName = d->DisabledTextColor.name();
+    }
+
+    const auto css{QStringLiteral("color: %1;").arg(colorName)};
+    updateStyleSheet(*ui->canopyOpenLineEdit, css);
+    updateStyleSheet(*ui->gearLineEdit, css);
+    updateStyleSheet(*ui->brakeLeftLineEdit, css);
+    updateStyleSheet(*ui->brakeRightLineEdit, css);
+    updateStyleSheet(*ui->gearSteerPositionLineEdit, css);
+    updateStyleSheet(*ui->waterRudderLineEdit, css);
+    updateStyleSheet(*ui->tailhookHandleLineEdit, css);
+    updateStyleSheet(*ui->tailhookPositionLineEdit, css);
+    updateStyleSheet(*ui->wingFoldingHandleLineEdit, css);
+    updateStyleSheet(*ui->leftWingFoldingLineEdit, css);
+    updateStyleSheet(*ui->rightWingFoldingLineEdit, css);
+}
+
 // PRIVATE
 
 void AircraftHandleWidget::initUi() noexcept
@@ -85,61 +125,3 @@ void AircraftHandleWidget::initUi() noexcept
     ui->leftWingFoldingLineEdit->setToolTip(SimVar::FoldingWingLeftPercent);
     ui->rightWingFoldingLineEdit->setToolTip(SimVar::FoldingWingRightPercent);
 }
-
-AircraftHandleData AircraftHandleWidget::getCurrentAircraftHandleData(std::int64_t timestamp, TimeVariableData::Access access) const noexcept
-{
-    AircraftHandleData data;
-    const auto &aircraft = Logbook::getInstance().getCurrentFlight().getUserAircraft();
-    const auto &aircraftHandle = aircraft.getAircraftHandle();
-    const auto &skyConnectManager = SkyConnectManager::getInstance();
-
-    if (skyConnectManager.getState() == Connect::State::Recording) {
-        if (aircraftHandle.count() > 0) {
-            data = aircraftHandle.getLast();
-        }
-    } else {
-        const auto t = timestamp != TimeVariableData::InvalidTime ? timestamp : skyConnectManager.getCurrentTimestamp();
-        data = aircraftHandle.interpolate(t, access);
-    };
-
-    return data;
-}
-
-// PRIVATE SLOTS
-
-void AircraftHandleWidget::updateUi(std::int64_t timestamp, TimeVariableData::Access access) noexcept
-{
-    const AircraftHandleData &aircraftHandleData = getCurrentAircraftHandleData(timestamp, access);
-    QString colorName;
-
-    if (!aircraftHandleData.isNull()) {
-        ui->canopyOpenLineEdit->setText(d->unit.formatPercent(aircraftHandleData.canopyOpen));
-        aircraftHandleData.gearHandlePosition ? ui->gearLineEdit->setText(tr("Down")) : ui->gearLineEdit->setText(tr("Up"));
-        ui->brakeLeftLineEdit->setText(d->unit.formatPosition(aircraftHandleData.brakeLeftPosition));
-        ui->brakeRightLineEdit->setText(d->unit.formatPosition(aircraftHandleData.brakeRightPosition));
-        ui->gearSteerPositionLineEdit->setText(d->unit.formatPosition(aircraftHandleData.gearSteerPosition));
-        ui->waterRudderLineEdit->setText(d->unit.formatPosition(aircraftHandleData.waterRudderHandlePosition));        
-        aircraftHandleData.tailhookHandlePosition ? ui->tailhookHandleLineEdit->setText(tr("Extended")) : ui->tailhookHandleLineEdit->setText(tr("Retracted"));
-        ui->tailhookPositionLineEdit->setText(d->unit.formatPercent(aircraftHandleData.tailhookPosition));
-        aircraftHandleData.foldingWingHandlePosition ? ui->wingFoldingHandleLineEdit->setText(tr("Retracted")) : ui->wingFoldingHandleLineEdit->setText(tr("Extended"));
-        ui->leftWingFoldingLineEdit->setText(d->unit.formatPercent(aircraftHandleData.leftWingFolding));
-        ui->rightWingFoldingLineEdit->setText(d->unit.formatPercent(aircraftHandleData.rightWingFolding));
-
-        colorName = d->ActiveTextColor.name();
-    } else {
-        colorName = d->DisabledTextColor.name();
-    }
-
-    const auto css{QStringLiteral("color: %1;").arg(colorName)};
-    ui->canopyOpenLineEdit->setStyleSheet(css);
-    ui->gearLineEdit->setStyleSheet(css);
-    ui->brakeLeftLineEdit->setStyleSheet(css);
-    ui->brakeRightLineEdit->setStyleSheet(css);
-    ui->gearSteerPositionLineEdit->setStyleSheet(css);
-    ui->waterRudderLineEdit->setStyleSheet(css);    
-    ui->tailhookHandleLineEdit->setStyleSheet(css);
-    ui->tailhookPositionLineEdit->setStyleSheet(css);
-    ui->wingFoldingHandleLineEdit->setStyleSheet(css);
-    ui->leftWingFoldingLineEdit->setStyleSheet(css);
-    ui->rightWingFoldingLineEdit->setStyleSheet(css);
-}
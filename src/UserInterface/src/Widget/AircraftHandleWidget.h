@@ -32,7 +32,7 @@
 #include "AbstractSimulationVariableWidget.h"
 
 class SkyConnectIntf;
-struct AircraftHandleData;
+class SimulationVariableSnapshot;
 struct AircraftHandleWidgetPrivate;
 
 namespace Ui {
@@ -43,22 +43,21 @@ class AircraftHandleWidget : public AbstractSimulationVariableWidget
 {
     Q_OBJECT
 public:
-    explicit AircraftHandleWidget(QWidget *parent) noexcept;
+    explicit AircraftHandleWidget(SimulationVariableSnapshot &snapshot, QWidget *parent) noexcept;
     AircraftHandleWidget(const AircraftHandleWidget &rhs) = delete;
     AircraftHandleWidget(AircraftHandleWidget &&rhs) = delete;
     AircraftHandleWidget &operator=(const AircraftHandleWidget &rhs) = delete;
     AircraftHandleWidget &operator=(AircraftHandleWidget &&rhs) = delete;
     ~AircraftHandleWidget() override;
 
-protected slots:
-    void updateUi(std::int64_t timestamp, TimeVariableData::Access access) noexcept override;
+protected:
+    void updateUi(const SimulationVariableSnapshot &snapshot) noexcept override;
 
 private:
     const std::unique_ptr<Ui::AircraftHandleWidget> ui;
     const std::unique_ptr<AircraftHandleWidgetPrivate> d;
 
     void initUi() noexcept;
-    AircraftHandleData getCurrentAircraftHandleData(std::int64_t timestamp, TimeVariableData::Access access) const noexcept;
 };
 
 #endif // AIRCRAFTHANDLEWIDGET_H
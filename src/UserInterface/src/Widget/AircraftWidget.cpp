@@ -23,7 +23,6 @@
  */
 #include <memory>
 #include <cstdint>
-#include <utility>
 
 #include <QDialog>
 #include <QString>
@@ -42,6 +41,7 @@
 #include <PluginManager/SkyConnectManager.h>
 #include <PluginManager/Connect/SkyConnectIntf.h>
 #include <PluginManager/Connect/Connect.h>
+#include "SimulationVariableSnapshot.h"
 #include "AircraftWidget.h"
 #include "ui_AircraftWidget.h"
 
@@ -59,8 +59,8 @@ struct AircraftWidgetPrivate
 
 // PUBLIC
 
-AircraftWidget::AircraftWidget(QWidget *parent) noexcept :
-    AbstractSimulationVariableWidget {parent},
+AircraftWidget::AircraftWidget(SimulationVariableSnapshot &snapshot, QWidget *parent) noexcept :
+    AbstractSimulationVariableWidget {snapshot, parent},
     ui {std::make_unique<Ui::AircraftWidget>()},
     d {std::make_unique<AircraftWidgetPrivate>(*this)}
 {
@@ -70,24 +70,23 @@ AircraftWidget::AircraftWidget(QWidget *parent) noexcept :
 
 AircraftWidget::~AircraftWidget() = default;
 
-// PROTECTED SLOTS
+// PROTECTED
 
-void AircraftWidget::updateUi(std::int64_t timestamp, TimeVariableData::Access access) noexcept
+void AircraftWidget::updateUi(const SimulationVariableSnapshot &snapshot) noexcept
 {
-    const auto positionAndAttitude = getCurrentPositionData(timestamp, access);
+    const auto &position = snapshot.getPositionData();
+    const auto &attitude = snapshot.getAttitudeData();
     QString positionColorName;
     QString attitudeColorName;
 
-    const auto &position = positionAndAttitude.first;
-    const auto &attitude = positionAndAttitude.second;
     if (!position.isNull()) {
         // Position
-        ui->latitudeLineEdit->setText(d->unit.formatCoordinate(position.latitude) % " (" % d->unit.formatLatitudeDMS(position.latitude) % ")");
-        ui->longitudeLineEdit->setText(d->unit.formatCoordinate(position.longitude) % " (" % d->unit.formatLongitudeDMS(position.longitude) % ")");
-        ui->altitudeLineEdit->setText(d->unit.formatFeet(position.altitude));
-        ui->indicatedAltitudeLineEdit->setText(d->unit.formatFeet(position.indicatedAltitude));
-        ui->calibratedIndicatedAltitudeLineEdit->setText(d->unit.formatFeet(position.calibratedIndicatedAltitude));
-        ui->pressureAltitudeLineEdit->setText(d->unit.formatFeet(position.pressureAltitude));
+        updateText(*ui->latitudeLineEdit, d->unit.formatCoordinate(position.latitude) % " (" % d->unit.formatLatitudeDMS(position.latitude) % ")");
+        updateText(*ui->longitudeLineEdit, d->unit.formatCoordinate(position.longitude) % " (" % d->unit.formatLongitudeDMS(position.longitude) % ")");
+        updateText(*ui->altitudeLineEdit, d->unit.formatFeet(position.altitude));
+        updateText(*ui->indicatedAltitudeLineEdit, d->unit.formatFeet(position.indicatedAltitude));
+        updateText(*ui->calibratedIndicatedAltitudeLineEdit, d->unit.formatFeet(position.calibratedIndicatedAltitude));
+        updateText(*ui->pressureAltitudeLineEdit, d->unit.formatFeet(position.pressureAltitude));
 
         positionColorName = d->ActiveTextColor.name();
     } else {
@@ -96,21 +95,21 @@ void AircraftWidget::updateUi(std::int64_t timestamp, TimeVariableData::Access a
 
     if (!attitude.isNull()) {
         // Attitude
-        ui->pitchLineEdit->setText(d->unit.formatDegrees(attitude.pitch));
-        ui->bankLineEdit->setText(d->unit.formatDegrees(attitude.bank));
-        ui->headingLineEdit->setText(d->unit.formatDegrees(attitude.trueHeading));
+        updateText(*ui->pitchLineEdit, d->unit.formatDegrees(attitude.pitch));
+        updateText(*ui->bankLineEdit, d->unit.formatDegrees(attitude.bank));
+        updateText(*ui->headingLineEdit, d->unit.formatDegrees(attitude.trueHeading));
         ui->onGroundCheckBox->setChecked(attitude.onGround);
 
         // Velocity
         double speedFeetPerSec = attitude.velocityBodyX;
         double speedKnots = Convert::feetPerSecondToKnots(speedFeetPerSec);
-        ui->velocityXLineEdit->setText(d->unit.formatKnots(speedKnots) % " (" % d->unit.formatSpeedInFeetPerSecond(speedFeetPerSec) % ")");
+        updateText(*ui->velocityXLineEdit, d->unit.formatKnots(speedKnots) % " (" % d->unit.formatSpeedInFeetPerSecond(speedFeetPerSec) % ")");
         speedFeetPerSec = attitude.velocityBodyY;
         speedKnots = Convert::feetPerSecondToKnots(speedFeetPerSec);
-        ui->velocityYLineEdit->setText(d->unit.formatKnots(speedKnots) % " (" % d->unit.formatSpeedInFeetPerSecond(speedFeetPerSec) % ")");
+        updateText(*ui->velocityYLineEdit, d->unit.formatKnots(speedKnots) % " (" % d->unit.formatSpeedInFeetPerSecond(speedFeetPerSec) % ")");
         speedFeetPerSec = attitude.velocityBodyZ;
         speedKnots = Convert::feetPerSecondToKnots(speedFeetPerSec);
-        ui->velocityZLineEdit->setText(d->unit.formatKnots(speedKnots) % " (" % d->unit.formatSpeedInFeetPerSecond(speedFeetPerSec) % ")");
+        updateText(*ui->velocityZLineEdit, d->unit.formatKnots(speedKnots) % " (" % d->unit.formatSpeedInFeetPerSecond(speedFeetPerSec) % ")");
 
         attitudeColorName = d->ActiveTextColor.name();
     } else {
@@ -118,23 +117,23 @@ void AircraftWidget::updateUi(std::int64_t timestamp, TimeVariableData::Access a
     }
 
     const QString positionCss {QStringLiteral("color: %1;").arg(positionColorName)};
-    ui->latitudeLineEdit->setStyleSheet(positionCss);
-    ui->longitudeLineEdit->setStyleSheet(positionCss);
-    ui->altitudeLineEdit->setStyleSheet(positionCss);
-    ui->indicatedAltitudeLineEdit->setStyleSheet(positionCss);
-    ui->calibratedIndicatedAltitudeLineEdit->setStyleSheet(positionCss);
-    ui->pressureAltitudeLineEdit->setStyleSheet(positionCss);
+    updateStyleSheet(*ui->latitudeLineEdit, positionCss);
+    updateStyleSheet(*ui->longitudeLineEdit, positionCss);
+    updateStyleSheet(*ui->altitudeLineEdit, positionCss);
+    updateStyleSheet(*ui->indicatedAltitudeLineEdit, positionCss);
+    updateStyleSheet(*ui->calibratedIndicatedAltitudeLineEdit, positionCss);
+    updateStyleSheet(*ui->pressureAltitudeLineEdit, positionCss);
 
     const QString attitudeCss {QStringLiteral("color: %1;").arg(attitudeColorName)};
-    ui->pitchLineEdit->setStyleSheet(attitudeCss);
-    ui->bankLineEdit->setStyleSheet(attitudeCss);
-    ui->headingLineEdit->setStyleSheet(attitudeCss);
-    ui->headingLineEdit->setStyleSheet(attitudeCss);
-    ui->onGroundCheckBox->setStyleSheet(attitudeCss);
-
-    ui->velocityXLineEdit->setStyleSheet(attitudeCss);
-    ui->velocityYLineEdit->setStyleSheet(attitudeCss);
-    ui->velocityZLineEdit->setStyleSheet(attitudeCss);
+    updateStyleSheet(*ui->pitchLineEdit, attitudeCss);
+    updateStyleSheet(*ui->bankLineEdit, attitudeCss);
+    updateStyleSheet(*ui->headingLineEdit, attitudeCss);
+    updateStyleSheet(*ui->headingLineEdit, attitudeCss);
+    updateStyleSheet(*ui->onGroundCheckBox, attitudeCss);
+
+    updateStyleSheet(*ui->velocityXLineEdit, attitudeCss);
+    updateStyleSheet(*ui->velocityYLineEdit, attitudeCss);
+    updateStyleSheet(*ui->velocityZLineEdit, attitudeCss);
 }
 
 // PRIVATE
@@ -164,35 +163,3 @@ void AircraftWidget::initUi() noexcept
     ui->velocityYLineEdit->setToolTip(SimVar::VelocityBodyY);
     ui->velocityZLineEdit->setToolTip(SimVar::VelocityBodyZ);    
 }
-
-std::pair<PositionData, AttitudeData> AircraftWidget::getCurrentPositionData(std::int64_t timestamp, TimeVariableData::Access access) const noexcept
-{
-    PositionData positionData;
-    AttitudeData attitudeData;
-    const auto &aircraft = Logbook::getInstance().getCurrentFlight().getUserAircraft();
-    const auto &position = aircraft.getPosition();
-    const auto &attitude = aircraft.getAttitude();
-    const auto &skyConnectManager = SkyConnectManager::getInstance();
-
-    // Position
-    if (skyConnectManager.getState() == Connect::State::Recording) {
-        if (position.count() > 0) {
-            positionData = position.getLast();
-        }
-    } else {
-        const auto t = timestamp != TimeVariableData::InvalidTime ? timestamp : skyConnectManager.getCurrentTimestamp();
-        positionData = position.interpolate(t, access);
-    };
-
-    // Attitude
-    if (skyConnectManager.getState() == Connect::State::Recording) {
-        if (attitude.count() > 0) {
-            attitudeData = attitude.getLast();
-        }
-    } else {
-        const auto t = timestamp != TimeVariableData::InvalidTime ? timestamp : skyConnectManager.getCurrentTimestamp();
-        attitudeData = attitude.interpolate(t, access);
-    };
-
-    return std::make_pair(positionData, attitudeData);
-}
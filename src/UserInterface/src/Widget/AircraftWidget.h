@@ -25,7 +25,6 @@
 #define AIRCRAFTVARIABLESWIDGET_H
 
 #include <cstdint>
-#include <utility>
 
 #include <QWidget>
 
@@ -36,8 +35,7 @@ class QHideEvent;
 #include "AbstractSimulationVariableWidget.h"
 
 class SkyConnectIntf;
-struct PositionData;
-struct AttitudeData;
+class SimulationVariableSnapshot;
 struct AircraftWidgetPrivate;
 
 namespace Ui {
@@ -48,22 +46,21 @@ class AircraftWidget : public AbstractSimulationVariableWidget
 {
     Q_OBJECT
 public:
-    explicit AircraftWidget(QWidget *parent) noexcept;
+    explicit AircraftWidget(SimulationVariableSnapshot &snapshot, QWidget *parent) noexcept;
     AircraftWidget(const AircraftWidget &rhs) = delete;
     AircraftWidget(AircraftWidget &&rhs) = delete;
     AircraftWidget &operator=(const AircraftWidget &rhs) = delete;
     AircraftWidget &operator=(AircraftWidget &&rhs) = delete;
     ~AircraftWidget() override;
 
-protected slots:
-    void updateUi(std::int64_t timestamp, TimeVariableData::Access access) noexcept override;
+protected:
+    void updateUi(const SimulationVariableSnapshot &snapshot) noexcept override;
 
 private:
     const std::unique_ptr<Ui::AircraftWidget> ui;
     const std::unique_ptr<AircraftWidgetPrivate> d;
 
     void initUi() noexcept;
-    std::pair<PositionData, AttitudeData> getCurrentPositionData(std::int64_t timestamp, TimeVariableData::Access access) const noexcept;
 };
 
 #endif // AIRCRAFTVARIABLESWIDGET_H
@@ -42,6 +42,7 @@
 #include <PluginManager/SkyConnectManager.h>
 #include <PluginManager/Connect/SkyConnectIntf.h>
 #include <PluginManager/Connect/Connect.h>
+#include "SimulationVariableSnapshot.h"
 #include "EngineWidget.h"
 #include "ui_EngineWidget.h"
 
@@ -59,8 +60,8 @@ struct EngineWidgetPrivate
 
 // PUBLIC
 
-EngineWidget::EngineWidget(QWidget *parent) noexcept
-    : AbstractSimulationVariableWidget {parent},
+EngineWidget::EngineWidget(SimulationVariableSnapshot &snapshot, QWidget *parent) noexcept
+    : AbstractSimulationVariableWidget {snapshot, parent},
       ui {std::make_unique<Ui::EngineWidget>()},
       d {std::make_unique<EngineWidgetPrivate>(*this)}
 {
@@ -70,30 +71,30 @@ EngineWidget::EngineWidget(QWidget *parent) noexcept
 
 EngineWidget::~EngineWidget() = default;
 
-// PROTECTED SLOTS
+// PROTECTED
 
-void EngineWidget::updateUi(std::int64_t timestamp, TimeVariableData::Access access) noexcept
+void EngineWidget::updateUi(const SimulationVariableSnapshot &snapshot) noexcept
 {
-    const auto &engineData = getCurrentEngineData(timestamp, access);
+    const auto &engineData = snapshot.getEngineData();
     QString colorName;
 
     if (!engineData.isNull()) {
-        ui->throttle1LineEdit->setText(d->unit.formatPosition(engineData.throttleLeverPosition1));
-        ui->throttle2LineEdit->setText(d->unit.formatPosition(engineData.throttleLeverPosition2));
-        ui->throttle3LineEdit->setText(d->unit.formatPosition(engineData.throttleLeverPosition3));
-        ui->throttle4LineEdit->setText(d->unit.formatPosition(engineData.throttleLeverPosition4));
-        ui->propeller1LineEdit->setText(d->unit.formatPosition(engineData.propellerLeverPosition1));
-        ui->propeller2LineEdit->setText(d->unit.formatPosition(engineData.propellerLeverPosition2));
-        ui->propeller3LineEdit->setText(d->unit.formatPosition(engineData.propellerLeverPosition3));
-        ui->propeller4LineEdit->setText(d->unit.formatPosition(engineData.propellerLeverPosition4));
-        ui->mixture1LineEdit->setText(d->unit.formatPercent(engineData.mixtureLeverPosition1));
-        ui->mixture2LineEdit->setText(d->unit.formatPercent(engineData.mixtureLeverPosition2));
-        ui->mixture3LineEdit->setText(d->unit.formatPercent(engineData.mixtureLeverPosition3));
-        ui->mixture4LineEdit->setText(d->unit.formatPercent(engineData.mixtureLeverPosition4));
-        ui->cowlFlaps1LineEdit->setText(d->unit.formatPercent(engineData.cowlFlapPosition1));
-        ui->cowlFlaps2LineEdit->setText(d->unit.formatPercent(engineData.cowlFlapPosition2));
-        ui->cowlFlaps3LineEdit->setText(d->unit.formatPercent(engineData.cowlFlapPosition3));
-        ui->cowlFlaps4LineEdit->setText(d->unit.formatPercent(engineData.cowlFlapPosition4));
+        updateText(*ui->throttle1LineEdit, d->unit.formatPosition(engineData.throttleLeverPosition1));
+        updateText(*ui->throttle2LineEdit, d->unit.formatPosition(engineData.throttleLeverPosition2));
+        updateText(*ui->throttle3LineEdit, d->unit.formatPosition(engineData.throttleLeverPosition3));
+        updateText(*ui->throttle4LineEdit, d->unit.formatPosition(engineData.throttleLeverPosition4));
+        updateText(*ui->propeller1LineEdit, d->unit.formatPosition(engineData.propellerLeverPosition1));
+        updateText(*ui->propeller2LineEdit, d->unit.formatPosition(engineData.propellerLeverPosition2));
+        updateText(*ui->propeller3LineEdit, d->unit.formatPosition(engineData.propellerLeverPosition3));
+        updateText(*ui->propeller4LineEdit, d->unit.formatPosition(engineData.propellerLeverPosition4));
+        updateText(*ui->mixture1LineEdit, d->unit.formatPercent(engineData.mixtureLeverPosition1));
+        updateText(*ui->mixture2LineEdit, d->unit.formatPercent(engineData.mixtureLeverPosition2));
+        updateText(*ui->mixture3LineEdit, d->unit.formatPercent(engineData.mixtureLeverPosition3));
+        updateText(*ui->mixture4LineEdit, d->unit.formatPercent(engineData.mixtureLeverPosition4));
+        updateText(*ui->cowlFlaps1LineEdit, d->unit.formatPercent(engineData.cowlFlapPosition1));
+        updateText(*ui->cowlFlaps2LineEdit, d->unit.formatPercent(engineData.cowlFlapPosition2));
+        updateText(*ui->cowlFlaps3LineEdit, d->unit.formatPercent(engineData.cowlFlapPosition3));
+        updateText(*ui->cowlFlaps4LineEdit, d->unit.formatPercent(engineData.cowlFlapPosition4));
 
         ui->masterBattery1CheckBox->setChecked(engineData.electricalMasterBattery1);
         ui->masterBattery2CheckBox->setChecked(engineData.electricalMasterBattery2);
@@ -114,34 +115,34 @@ void EngineWidget::updateUi(std::int64_t timestamp, TimeVariableData::Access acc
     }
 
     const QString css{QStringLiteral("color: %1;").arg(colorName)};
-    ui->throttle1LineEdit->setStyleSheet(css);
-    ui->throttle2LineEdit->setStyleSheet(css);
-    ui->throttle3LineEdit->setStyleSheet(css);
-    ui->throttle4LineEdit->setStyleSheet(css);
-    ui->propeller1LineEdit->setStyleSheet(css);
-    ui->propeller2LineEdit->setStyleSheet(css);
-    ui->propeller3LineEdit->setStyleSheet(css);
-    ui->propeller4LineEdit->setStyleSheet(css);
-    ui->mixture1LineEdit->setStyleSheet(css);
-    ui->mixture2LineEdit->setStyleSheet(css);
-    ui->mixture3LineEdit->setStyleSheet(css);
-    ui->mixture4LineEdit->setStyleSheet(css);
-    ui->cowlFlaps1LineEdit->setStyleSheet(css);
-    ui->cowlFlaps2LineEdit->setStyleSheet(css);
-    ui->cowlFlaps3LineEdit->setStyleSheet(css);
-    ui->cowlFlaps4LineEdit->setStyleSheet(css);
-    ui->masterBattery1CheckBox->setStyleSheet(css);
-    ui->masterBattery2CheckBox->setStyleSheet(css);
-    ui->masterBattery3CheckBox->setStyleSheet(css);
-    ui->masterBattery4CheckBox->setStyleSheet(css);
-    ui->generalEngineStarter1CheckBox->setStyleSheet(css);
-    ui->generalEngineStarter2CheckBox->setStyleSheet(css);
-    ui->generalEngineStarter3CheckBox->setStyleSheet(css);
-    ui->generalEngineStarter4CheckBox->setStyleSheet(css);
-    ui->generalEngineCombustion1CheckBox->setStyleSheet(css);
-    ui->generalEngineCombustion2CheckBox->setStyleSheet(css);
-    ui->generalEngineCombustion3CheckBox->setStyleSheet(css);
-    ui->generalEngineCombustion4CheckBox->setStyleSheet(css);
+    updateStyleSheet(*ui->throttle1LineEdit, css);
+    updateStyleSheet(*ui->throttle2LineEdit, css);
+    updateStyleSheet(*ui->throttle3LineEdit, css);
+    updateStyleSheet(*ui->throttle4LineEdit, css);
+    updateStyleSheet(*ui->propeller1LineEdit, css);
+    updateStyleSheet(*ui->propeller2LineEdit, css);
+    updateStyleSheet(*ui->propeller3LineEdit, css);
+    updateStyleSheet(*ui->propeller4LineEdit, css);
+    updateStyleSheet(*ui->mixture1LineEdit, css);
+    updateStyleSheet(*ui->mixture2LineEdit, css);
+    updateStyleSheet(*ui->mixture3LineEdit, css);
+    updateStyleSheet(*ui->mixture4LineEdit, css);
+    updateStyleSheet(*ui->cowlFlaps1LineEdit, css);
+    updateStyleSheet(*ui->cowlFlaps2LineEdit, css);
+    updateStyleSheet(*ui->cowlFlaps3LineEdit, css);
+    updateStyleSheet(*ui->cowlFlaps4LineEdit, css);
+    updateStyleSheet(*ui->masterBattery1CheckBox, css);
+    updateStyleSheet(*ui->masterBattery2CheckBox, css);
+    updateStyleSheet(*ui->masterBattery3CheckBox, css);
+    updateStyleSheet(*ui->masterBattery4CheckBox, css);
+    updateStyleSheet(*ui->generalEngineStarter1CheckBox, css);
+    updateStyleSheet(*ui->generalEngineStarter2CheckBox, css);
+    updateStyleSheet(*ui->generalEngineStarter3CheckBox, css);
+    updateStyleSheet(*ui->generalEngineStarter4CheckBox, css);
+    updateStyleSheet(*ui->generalEngineCombustion1CheckBox, css);
+    updateStyleSheet(*ui->generalEngineCombustion2CheckBox, css);
+    updateStyleSheet(*ui->generalEngineCombustion3CheckBox, css);
+    updateStyleSheet(*ui->generalEngineCombustion4CheckBox, css);
 }
 
 // PRIVATE
@@ -205,22 +206,3 @@ void EngineWidget::initUi() noexcept
     ui->generalEngineCombustion4CheckBox->setFocusPolicy(Qt::NoFocus);
     ui->generalEngineCombustion4CheckBox->setToolTip(SimVar::GeneralEngineCombustion4);
 }
-
-EngineData EngineWidget::getCurrentEngineData(std::int64_t timestamp, TimeVariableData::Access access) const noexcept
-{
-    EngineData data;
-    const auto &aircraft = Logbook::getInstance().getCurrentFlight().getUserAircraft();
-    const auto &engine = aircraft.getEngine();
-    const auto &skyConnectManager = SkyConnectManager::getInstance();
-
-    if (skyConnectManager.getState() == Connect::State::Recording) {
-        if (engine.count() > 0) {
-            data = engine.getLast();
-        }
-    } else {
-        const auto t = timestamp != TimeVariableData::InvalidTime ? timestamp : skyConnectManager.getCurrentTimestamp();
-        data = engine.interpolate(t, access);
-    };
-
-    return data;
-}
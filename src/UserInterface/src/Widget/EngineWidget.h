@@ -30,7 +30,7 @@
 #include "AbstractSimulationVariableWidget.h"
 
 class SkyConnectIntf;
-struct EngineData;
+class SimulationVariableSnapshot;
 struct EngineWidgetPrivate;
 
 namespace Ui {
@@ -41,22 +41,21 @@ class EngineWidget : public AbstractSimulationVariableWidget
 {
     Q_OBJECT
 public:
-    explicit EngineWidget(QWidget *parent) noexcept;
+    explicit EngineWidget(SimulationVariableSnapshot &snapshot, QWidget *parent) noexcept;
     EngineWidget(const EngineWidget &rhs) = delete;
     EngineWidget(EngineWidget &&rhs) = delete;
     EngineWidget &operator=(const EngineWidget &rhs) = delete;
     EngineWidget &operator=(EngineWidget &&rhs) = delete;
     ~EngineWidget() override;
 
-protected slots:
-    void updateUi(std::int64_t timestamp, TimeVariableData::Access access) noexcept override;
+protected:
+    void updateUi(const SimulationVariableSnapshot &snapshot) noexcept override;
 
 private:
     const std::unique_ptr<Ui::EngineWidget> ui;
     const std::unique_ptr<EngineWidgetPrivate> d;
 
     void initUi() noexcept;
-    EngineData getCurrentEngineData(std::int64_t timestamp, TimeVariableData::Access access) const noexcept;
 };
 
 #endif // ENGINEWIDGET_H
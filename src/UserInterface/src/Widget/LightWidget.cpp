@@ -40,6 +40,7 @@
 #include <PluginManager/SkyConnectManager.h>
 #include <PluginManager/Connect/SkyConnectIntf.h>
 #include <PluginManager/Connect/Connect.h>
+#include "SimulationVariableSnapshot.h"
 #include "LightWidget.h"
 #include "ui_LightWidget.h"
 
@@ -56,8 +57,8 @@ struct LightWidgetPrivate
 
 // PUBLIC
 
-LightWidget::LightWidget(QWidget *parent) noexcept :
-    AbstractSimulationVariableWidget {parent},
+LightWidget::LightWidget(SimulationVariableSnapshot &snapshot, QWidget *parent) noexcept :
+    AbstractSimulationVariableWidget {snapshot, parent},
     ui {std::make_unique<Ui::LightWidget>()},
     d {std::make_unique<LightWidgetPrivate>(*this)}
 {
@@ -67,6 +68,46 @@ LightWidget::LightWidget(QWidget *parent) noexcept :
 
 LightWidget::~LightWidget() = default;
 
+// PROTECTED
+
+void LightWidget::updateUi(const SimulationVariableSnapshot &snapshot) noexcept
+{
+    const auto &lightData = snapshot.getLightData();
+    QString colorName;
+
+    if (!lightData.isNull()) {
+        updateText(*ui->lightStateLineEdit, QString::number(lightData.lightStates));
+
+        ui->navigationCheckBox->setChecked(lightData.lightStates.testFlag(SimType::LightState::Navigation));
+        ui->beaconCheckBox->setChecked(lightData.lightStates.testFlag(SimType::LightState::Beacon));
+        ui->landingCheckBox->setChecked(lightData.lightStates.testFlag(SimType::LightState::Landing));
+        ui->taxiCheckBox->setChecked(lightData.lightStates.testFlag(SimType::LightState::Taxi));
+        ui->strobeCheckBox->setChecked(lightData.lightStates.testFlag(SimType::LightState::Strobe));
+        ui->panelCheckBox->setChecked(lightData.lightStates.testFlag(SimType::LightState::Panel));
+        ui->recognitionCheckBox->setChecked(lightData.lightStates.testFlag(SimType::LightState::Recognition));
+        ui->wingCheckBox->setChecked(lightData.lightStates.testFlag(SimType::LightState::Wing));
+        ui->logoCheckBox->setChecked(lightData.lightStates.testFlag(SimType::LightState::Logo));
+        ui->cabinCheckBox->setChecked(lightData.lightStates.testFlag(SimType::LightState::Cabin));
+        colorName = d->ActiveTextColor.name();
+
+    } else {
+        colorName = d->DisabledTextColor.name();
+    }
+
+    const QString css{QStringLiteral("color: %1;").arg(colorName)};
+    updateStyleSheet(*ui->lightStateLineEdit, css);
+    updateStyleSheet(*ui->navigationCheckBox, css);
+    updateStyleSheet(*ui->beaconCheckBox, css);
+    updateStyleSheet(*ui->landingCheckBox, css);
+    updateStyleSheet(*ui->taxiCheckBox, css);
+    updateStyleSheet(*ui->strobeCheckBox, css);
+    updateStyleSheet(*ui->panelCheckBox, css);
+    updateStyleSheet(*ui->recognitionCheckBox, css);
+    updateStyleSheet(*ui->wingCheckBox, css);
+    updateStyleSheet(*ui->logoCheckBox, css);
+    updateStyleSheet(*ui->cabinCheckBox, css);
+}
+
 // PRIVATE
 
 void LightWidget::initUi() noexcept
@@ -104,62 +145,3 @@ void LightWidget::initUi() noexcept
     ui->cabinCheckBox->setAttribute(Qt::WA_TransparentForMouseEvents, true);
     ui->cabinCheckBox->setFocusPolicy(Qt::NoFocus);
 }
-
-LightData LightWidget::getCurrentLightData(std::int64_t timestamp, TimeVariableData::Access access) const noexcept
-{
-    LightData data;
-    const auto &aircraft = Logbook::getInstance().getCurrentFlight().getUserAircraft();
-    const auto &light = aircraft.getLight();
-    const auto &skyConnectManager = SkyConnectManager::getInstance();
-
-    if (skyConnectManager.getState() == Connect::State::Recording) {
-        if (light.count() > 0) {
-            data = light.getLast();
-        }
-    } else {
-        const auto t = timestamp != TimeVariableData::InvalidTime ? timestamp : skyConnectManager.getCurrentTimestamp();
-        data = light.interpolate(t, access);
-    };
-
-    return data;
-}
-
-// PRIVATE SLOTS
-
-void LightWidget::updateUi(std::int64_t timestamp, TimeVariableData::Access access) noexcept
-{
-    const auto &lightData = getCurrentLightData(timestamp, access);
-    QString colorName;
-
-    if (!lightData.isNull()) {
-        ui->lightStateLineEdit->setText(QString::number(lightData.lightStates));
-
-        ui->navigationCheckBox->setChecked(lightData.lightStates.testFlag(SimType::LightState::Navigation));
-        ui->beaconCheckBox->setChecked(lightData.lightStates.testFlag(SimType::LightState::Beacon));
-        ui->landingCheckBox->setChecked(lightData.lightStates.testFlag(SimType::LightState::Landing));
-        ui->taxiCheckBox->setChecked(lightData.lightStates.testFlag(SimType::LightState::Taxi));
-        ui->strobeCheckBox->setChecked(lightData.lightStates.testFlag(SimType::LightState::Strobe));
-        ui->panelCheckBox->setChecked(lightData.lightStates.testFlag(SimType::LightState::Panel));
-        ui->recognitionCheckBox->setChecked(lightData.lightStates.testFlag(SimType::LightState::Recognition));
-        ui->wingCheckBox->setChecked(lightData.lightStates.testFlag(SimType::LightState::Wing));
-        ui->logoCheckBox->setChecked(lightData.lightStates.testFlag(SimType::LightState::Logo));
-        ui->cabinCheckBox->setChecked(lightData.lightStates.testFlag(SimType::LightState::Cabin));
-        colorName = d->ActiveTextColor.name();
-
-    } else {
-        colorName = d->DisabledTextColor.name();
-    }
-
-    const QString css{QStringLiteral("color: %1;").arg(colorName)};
-    ui->lightStateLineEdit->setStyleSheet(css);
-    ui->navigationCheckBox->setStyleSheet(css);
-    ui->beaconCheckBox->setStyleSheet(css);
-    ui->landingCheckBox->setStyleSheet(css);
-    ui->taxiCheckBox->setStyleSheet(css);
-    ui->strobeCheckBox->setStyleSheet(css);
-    ui->panelCheckBox->setStyleSheet(css);
-    ui->recognitionCheckBox->setStyleSheet(css);
-    ui->wingCheckBox->setStyleSheet(css);
-    ui->logoCheckBox->setStyleSheet(css);
-    ui->cabinCheckBox->setStyleSheet(css);
-}
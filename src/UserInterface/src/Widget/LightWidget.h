@@ -32,7 +32,7 @@
 #include "AbstractSimulationVariableWidget.h"
 
 class SkyConnectIntf;
-struct LightData;
+class SimulationVariableSnapshot;
 struct LightWidgetPrivate;
 
 namespace Ui {
@@ -43,22 +43,21 @@ class LightWidget : public AbstractSimulationVariableWidget
 {
     Q_OBJECT
 public:
-    explicit LightWidget(QWidget *parent) noexcept;
+    explicit LightWidget(SimulationVariableSnapshot &snapshot, QWidget *parent) noexcept;
     LightWidget(const LightWidget &rhs) = delete;
     LightWidget(LightWidget &&rhs) = delete;
     LightWidget &operator=(const LightWidget &rhs) = delete;
     LightWidget &operator=(LightWidget &&rhs) = delete;
     ~LightWidget() override;
 
-protected slots:
-    void updateUi(std::int64_t timestamp, TimeVariableData::Access access) noexcept override;
+protected:
+    void updateUi(const SimulationVariableSnapshot &snapshot) noexcept override;
 
 private:
     const std::unique_ptr<Ui::LightWidget> ui;
     const std::unique_ptr<LightWidgetPrivate> d;
 
     void initUi() noexcept;    
-    LightData getCurrentLightData(std::int64_t timestamp, TimeVariableData::Access access) const noexcept;
 };
 
 #endif // LIGHTWIDGET_H
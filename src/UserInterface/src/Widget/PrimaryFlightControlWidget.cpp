@@ -43,6 +43,7 @@
 #include <PluginManager/SkyConnectManager.h>
 #include <PluginManager/Connect/SkyConnectIntf.h>
 #include <PluginManager/Connect/Connect.h>
+#include "SimulationVariableSnapshot.h"
 #include "PrimaryFlightControlWidget.h"
 #include "ui_PrimaryFlightControlWidget.h"
 
@@ -60,8 +61,8 @@ struct PrimaryFlightControlWidgetPrivate
 
 // PUBLIC
 
-PrimaryFlightControlWidget::PrimaryFlightControlWidget(QWidget *parent) noexcept :
-    AbstractSimulationVariableWidget {parent},
+PrimaryFlightControlWidget::PrimaryFlightControlWidget(SimulationVariableSnapshot &snapshot, QWidget *parent) noexcept :
+    AbstractSimulationVariableWidget {snapshot, parent},
     ui {std::make_unique<Ui::PrimaryFlightControlWidget>()},
     d {std::make_unique<PrimaryFlightControlWidgetPrivate>(*this)}
 {
@@ -71,21 +72,21 @@ PrimaryFlightControlWidget::PrimaryFlightControlWidget(QWidget *parent) noexcept
 
 PrimaryFlightControlWidget::~PrimaryFlightControlWidget() = default;
 
-// PROTECED SLOTS
+// PROTECTED
 
-void PrimaryFlightControlWidget::updateUi(std::int64_t timestamp, TimeVariableData::Access access) noexcept
+void PrimaryFlightControlWidget::updateUi(const SimulationVariableSnapshot &snapshot) noexcept
 {
-    const auto &primaryFlightControlData = getCurrentPrimaryFlightControlData(timestamp, access);
+    const auto &primaryFlightControlData = snapshot.getPrimaryFlightControlData();
     QString colorName;
 
     if (!primaryFlightControlData.isNull()) {
-        ui->rudderDeflectionLineEdit->setText(d->unit.formatDegrees(Convert::radiansToDegrees(primaryFlightControlData.rudderDeflection)));
-        ui->elevatorDeflectionLineEdit->setText(d->unit.formatDegrees(Convert::radiansToDegrees(primaryFlightControlData.elevatorDeflection)));
-        ui->leftAileronDeflectionLineEdit->setText(d->unit.formatDegrees(Convert::radiansToDegrees(primaryFlightControlData.leftAileronDeflection)));
-        ui->rightAileronDeflectionLineEdit->setText(d->unit.formatDegrees(Convert::radiansToDegrees(primaryFlightControlData.rightAileronDeflection)));
-        ui->rudderLineEdit->setText(d->unit.formatPosition(primaryFlightControlData.rudderPosition));
-        ui->elevatorLineEdit->setText(d->unit.formatPosition(primaryFlightControlData.elevatorPosition));
-        ui->aileronLineEdit->setText(d->unit.formatPosition(primaryFlightControlData.aileronPosition));
+        updateText(*ui->rudderDeflectionLineEdit, d->unit.formatDegrees(Convert::radiansToDegrees(primaryFlightControlData.rudderDeflection)));
+        updateText(*ui->elevatorDeflectionLineEdit, d->unit.formatDegrees(Convert::radiansToDegrees(primaryFlightControlData.elevatorDeflection)));
+        updateText(*ui->leftAileronDeflectionLineEdit, d->unit.formatDegrees(Convert::radiansToDegrees(primaryFlightControlData.leftAileronDeflection)));
+        updateText(*ui->rightAileronDeflectionLineEdit, d->unit.formatDegrees(Convert::radiansToDegrees(primaryFlightControlData.rightAileronDeflection)));
+        updateText(*ui->rudderLineEdit, d->unit.formatPosition(primaryFlightControlData.rudderPosition));
+        updateText(*ui->elevatorLineEdit, d->unit.formatPosition(primaryFlightControlData.elevatorPosition));
+        updateText(*ui->aileronLineEdit, d->unit.formatPosition(primaryFlightControlData.aileronPosition));
 
         colorName = d->ActiveTextColor.name();
     } else {
@@ -93,13 +94,13 @@ void PrimaryFlightControlWidget::updateUi(std::int64_t timestamp, TimeVariableDa
     }
 
     const QString css{QStringLiteral("color: %1;").arg(colorName)};
-    ui->rudderDeflectionLineEdit->setStyleSheet(css);
-    ui->elevatorDeflectionLineEdit->setStyleSheet(css);
-    ui->leftAileronDeflectionLineEdit->setStyleSheet(css);
-    ui->rightAileronDeflectionLineEdit->setStyleSheet(css);
-    ui->rudderLineEdit->setStyleSheet(css);
-    ui->elevatorLineEdit->setStyleSheet(css);
-    ui->aileronLineEdit->setStyleSheet(css);
+    updateStyleSheet(*ui->rudderDeflectionLineEdit, css);
+    updateStyleSheet(*ui->elevatorDeflectionLineEdit, css);
+    updateStyleSheet(*ui->leftAileronDeflectionLineEdit, css);
+    updateStyleSheet(*ui->rightAileronDeflectionLineEdit, css);
+    updateStyleSheet(*ui->rudderLineEdit, css);
+    updateStyleSheet(*ui->elevatorLineEdit, css);
+    updateStyleSheet(*ui->aileronLineEdit, css);
 }
 
 // PRIVATE
@@ -114,22 +115,3 @@ void PrimaryFlightControlWidget::initUi()
     ui->elevatorLineEdit->setToolTip(SimVar::ElevatorPosition);
     ui->aileronLineEdit->setToolTip(SimVar::AileronPosition);
 }
-
-PrimaryFlightControlData PrimaryFlightControlWidget::getCurrentPrimaryFlightControlData(std::int64_t timestamp, TimeVariableData::Access access) const noexcept
-{
-    PrimaryFlightControlData data;
-    const auto &aircraft = Logbook::getInstance().getCurrentFlight().getUserAircraft();
-    const auto &primaryFlightControl = aircraft.getPrimaryFlightControl();
-    const auto &skyConnectManager = SkyConnectManager::getInstance();
-
-    if (skyConnectManager.getState() == Connect::State::Recording) {
-        if (primaryFlightControl.count() > 0) {
-            data = primaryFlightControl.getLast();
-        }
-    } else {
-        const auto t = timestamp != TimeVariableData::InvalidTime ? timestamp : skyConnectManager.getCurrentTimestamp();
-        data = primaryFlightControl.interpolate(t, access);
-    };
-
-    return data;
-}
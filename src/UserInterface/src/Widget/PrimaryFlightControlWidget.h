@@ -32,7 +32,7 @@
 #include "AbstractSimulationVariableWidget.h"
 
 class SkyConnectIntf;
-struct PrimaryFlightControlData;
+class SimulationVariableSnapshot;
 struct PrimaryFlightControlWidgetPrivate;
 
 namespace Ui {
@@ -43,22 +43,21 @@ class PrimaryFlightControlWidget : public AbstractSimulationVariableWidget
 {
     Q_OBJECT
 public:
-    explicit PrimaryFlightControlWidget(QWidget *parent) noexcept;
+    explicit PrimaryFlightControlWidget(SimulationVariableSnapshot &snapshot, QWidget *parent) noexcept;
     PrimaryFlightControlWidget(const PrimaryFlightControlWidget &rhs) = delete;
     PrimaryFlightControlWidget(PrimaryFlightControlWidget &&rhs) = delete;
     PrimaryFlightControlWidget &operator=(const PrimaryFlightControlWidget &rhs) = delete;
     PrimaryFlightControlWidget &operator=(PrimaryFlightControlWidget &&rhs) = delete;
     ~PrimaryFlightControlWidget() override;
 
-protected slots:
-    void updateUi(std::int64_t timestamp, TimeVariableData::Access access) noexcept override;
+protected:
+    void updateUi(const SimulationVariableSnapshot &snapshot) noexcept override;
 
 private:
     const std::unique_ptr<Ui::PrimaryFlightControlWidget> ui;
     const std::unique_ptr<PrimaryFlightControlWidgetPrivate> d;
 
     void initUi();    
-    PrimaryFlightControlData getCurrentPrimaryFlightControlData(std::int64_t timestamp, TimeVariableData::Access access) const noexcept;
 };
 
 #endif // PRIMARYFLIGHTCONTROLWIDGET_H
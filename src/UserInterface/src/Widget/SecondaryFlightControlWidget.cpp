@@ -42,6 +42,7 @@
 #include <PluginManager/SkyConnectManager.h>
 #include <PluginManager/Connect/SkyConnectIntf.h>
 #include <PluginManager/Connect/Connect.h>
+#include "SimulationVariableSnapshot.h"
 #include "SecondaryFlightControlWidget.h"
 #include "ui_SecondaryFlightControlWidget.h"
 
@@ -59,8 +60,8 @@ struct SecondaryFlightControlWidgetPrivate
 
 // PUBLIC
 
-SecondaryFlightControlWidget::SecondaryFlightControlWidget(QWidget *parent) noexcept :
-    AbstractSimulationVariableWidget {parent},
+SecondaryFlightControlWidget::SecondaryFlightControlWidget(SimulationVariableSnapshot &snapshot, QWidget *parent) noexcept :
+    AbstractSimulationVariableWidget {snapshot, parent},
     ui {std::make_unique<Ui::SecondaryFlightControlWidget>()},
     d {std::make_unique<SecondaryFlightControlWidgetPrivate>(*this)}
 {
@@ -70,25 +71,25 @@ SecondaryFlightControlWidget::SecondaryFlightControlWidget(QWidget *parent) noex
 
 SecondaryFlightControlWidget::~SecondaryFlightControlWidget() = default;
 
-// PROTECTED SLOTS
+// PROTECTED
 
-void SecondaryFlightControlWidget::updateUi(std::int64_t timestamp, TimeVariableData::Access access) noexcept
+void SecondaryFlightControlWidget::updateUi(const SimulationVariableSnapshot &snapshot) noexcept
 {
-    const auto &secondaryFlightControlData = getCurrentSecondaryFlightControlData(timestamp, access);
+    const auto &secondaryFlightControlData = snapshot.getSecondaryFlightControlData();
     QString colorName;
 
     if (!secondaryFlightControlData.isNull()) {
         // Flaps & spoilers (speed brakes)
-        ui->flapsHandleIndexLineEdit->setText(QString::number(secondaryFlightControlData.flapsHandleIndex));
-        ui->leftLeadingEdgeFlapsLineEdit->setText(d->unit.formatPosition(secondaryFlightControlData.leftLeadingEdgeFlapsPosition));
-        ui->rightLeadingEdgeFlapsLineEdit->setText(d->unit.formatPosition(secondaryFlightControlData.rightLeadingEdgeFlapsPosition));
-        ui->leftTrailingEdgeFlapsLineEdit->setText(d->unit.formatPosition(secondaryFlightControlData.leftTrailingEdgeFlapsPosition));
-        ui->rightTrailingEdgeFlapsLineEdit->setText(d->unit.formatPosition(secondaryFlightControlData.rightTrailingEdgeFlapsPosition));
+        updateText(*ui->flapsHandleIndexLineEdit, QString::number(secondaryFlightControlData.flapsHandleIndex));
+        updateText(*ui->leftLeadingEdgeFlapsLineEdit, d->unit.formatPosition(secondaryFlightControlData.leftLeadingEdgeFlapsPosition));
+        updateText(*ui->rightLeadingEdgeFlapsLineEdit, d->unit.formatPosition(secondaryFlightControlData.rightLeadingEdgeFlapsPosition));
+        updateText(*ui->leftTrailingEdgeFlapsLineEdit, d->unit.formatPosition(secondaryFlightControlData.leftTrailingEdgeFlapsPosition));
+        updateText(*ui->rightTrailingEdgeFlapsLineEdit, d->unit.formatPosition(secondaryFlightControlData.rightTrailingEdgeFlapsPosition));
 
-        ui->spoilersHandlePositionLineEdit->setText(d->unit.formatPercent(secondaryFlightControlData.spoilersHandlePercent));
-        secondaryFlightControlData.spoilersArmed ? ui->spoilersArmedLineEdit->setText(tr("Armed")) : ui->spoilersArmedLineEdit->setText(tr("Disarmed"));
-        ui->leftSpoilersPositionLineEdit->setText(d->unit.formatPosition(secondaryFlightControlData.leftSpoilersPosition));
-        ui->rightSpoilersPositionLineEdit->setText(d->unit.formatPosition(secondaryFlightControlData.rightSpoilersPosition));
+        updateText(*ui->spoilersHandlePositionLineEdit, d->unit.formatPercent(secondaryFlightControlData.spoilersHandlePercent));
+        updateText(*ui->spoilersArmedLineEdit, secondaryFlightControlData.spoilersArmed ? tr("Armed") : tr("Disarmed"));
+        updateText(*ui->leftSpoilersPositionLineEdit, d->unit.formatPosition(secondaryFlightControlData.leftSpoilersPosition));
+        updateText(*ui->rightSpoilersPositionLineEdit, d->unit.formatPosition(secondaryFlightControlData.rightSpoilersPosition));
 
         colorName = d->ActiveTextColor.name();
     } else {
@@ -96,16 +97,16 @@ void SecondaryFlightControlWidget::updateUi(std::int64_t timestamp, TimeVariable
     }
 
     const QString css{QStringLiteral("color: %1;").arg(colorName)};
-    ui->flapsHandleIndexLineEdit->setStyleSheet(css);
-    ui->leftLeadingEdgeFlapsLineEdit->setStyleSheet(css);
-    ui->rightLeadingEdgeFlapsLineEdit->setStyleSheet(css);
-    ui->leftTrailingEdgeFlapsLineEdit->setStyleSheet(css);
-    ui->rightTrailingEdgeFlapsLineEdit->setStyleSheet(css);
-
-    ui->spoilersHandlePositionLineEdit->setStyleSheet(css);
-    ui->spoilersArmedLineEdit->setStyleSheet(css);
-    ui->leftSpoilersPositionLineEdit->setStyleSheet(css);
-    ui->rightSpoilersPositionLineEdit->setStyleSheet(css);
+    updateStyleSheet(*ui->flapsHandleIndexLineEdit, css);
+    updateStyleSheet(*ui->leftLeadingEdgeFlapsLineEdit, css);
+    updateStyleSheet(*ui->rightLeadingEdgeFlapsLineEdit, css);
+    updateStyleSheet(*ui->leftTrailingEdgeFlapsLineEdit, css);
+    updateStyleSheet(*ui->rightTrailingEdgeFlapsLineEdit, css);
+
+    updateStyleSheet(*ui->spoilersHandlePositionLineEdit, css);
+    updateStyleSheet(*ui->spoilersArmedLineEdit, css);
+    updateStyleSheet(*ui->leftSpoilersPositionLineEdit, css);
+    updateStyleSheet(*ui->rightSpoilersPositionLineEdit, css);
 }
 
 // PRIVATE
@@ -123,22 +124,3 @@ void SecondaryFlightControlWidget::initUi() noexcept
     ui->leftSpoilersPositionLineEdit->setToolTip(SimVar::SpoilersLeftPosition);
     ui->rightSpoilersPositionLineEdit->setToolTip(SimVar::SpoilersRightPosition);
 }
-
-SecondaryFlightControlData SecondaryFlightControlWidget::getCurrentSecondaryFlightControlData(std::int64_t timestamp, TimeVariableData::Access access) const noexcept
-{
-    SecondaryFlightControlData data;
-    const auto &aircraft = Logbook::getInstance().getCurrentFlight().getUserAircraft();
-    const auto &secondaryFlightControl = aircraft.getSecondaryFlightControl();
-    const auto &skyConnectManager = SkyConnectManager::getInstance();
-
-    if (skyConnectManager.getState() == Connect::State::Recording) {
-        if (secondaryFlightControl.count() > 0) {
-            data = secondaryFlightControl.getLast();
-        }
-    } else {
-        const auto t = timestamp != TimeVariableData::InvalidTime ? timestamp : skyConnectManager.getCurrentTimestamp();
-        data = secondaryFlightControl.interpolate(t, access);
-    };
-
-    return data;
-}
@@ -32,7 +32,7 @@
 #include "AbstractSimulationVariableWidget.h"
 
 class SkyConnectIntf;
-struct SecondaryFlightControlData;
+class SimulationVariableSnapshot;
 struct SecondaryFlightControlWidgetPrivate;
 
 namespace Ui {
@@ -43,22 +43,21 @@ class SecondaryFlightControlWidget : public AbstractSimulationVariableWidget
 {
     Q_OBJECT
 public:
-    explicit SecondaryFlightControlWidget(QWidget *parent) noexcept;
+    explicit SecondaryFlightControlWidget(SimulationVariableSnapshot &snapshot, QWidget *parent) noexcept;
     SecondaryFlightControlWidget(const SecondaryFlightControlWidget &rhs) = delete;
     SecondaryFlightControlWidget(SecondaryFlightControlWidget &&rhs) = delete;
     SecondaryFlightControlWidget &operator=(const SecondaryFlightControlWidget &rhs) = delete;
     SecondaryFlightControlWidget &operator=(SecondaryFlightControlWidget &&rhs) = delete;
     ~SecondaryFlightControlWidget() override;
 
-protected slots:
-    void updateUi(std::int64_t timestamp, TimeVariableData::Access access) noexcept override;
+protected:
+    void updateUi(const SimulationVariableSnapshot &snapshot) noexcept override;
 
 private:
     const std::unique_ptr<Ui::SecondaryFlightControlWidget> ui;
     const std::unique_ptr<SecondaryFlightControlWidgetPrivate> d;
 
     void initUi() noexcept;    
-    SecondaryFlightControlData getCurrentSecondaryFlightControlData(std::int64_t timestamp, TimeVariableData::Access access) const noexcept;
 };
 
 #endif // SECONDARYFLIGHTCONTROLWIDGET_H
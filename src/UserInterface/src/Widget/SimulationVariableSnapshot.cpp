@@ -0,0 +1,260 @@
+/**
+ * Sky Dolly - The Black Sheep for Your Flight Recordings
+ *
+ * Copyright (c) 2020 - 2025 Oliver Knoll
+ *
+ * MIT License
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this
+ * software and associated documentation files (the "Software"), to deal in the Software
+ * without restriction, including without limitation the rights to use, copy, modify, merge,
+ * publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons
+ * to whom the Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or
+ * substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED *AS IS*, WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR
+ * PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE
+ * FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+ * OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ */
+#include <memory>
+#include <algorithm>
+#include <cstdint>
+
+#include <QObject>
+#include <QTimer>
+
+#include <Kernel/Settings.h>
+#include <Kernel/Trace.h>
+#include <Model/Logbook.h>
+#include <Model/Flight.h>
+#include <Model/Aircraft.h>
+#include <Model/Position.h>
+#include <Model/PositionData.h>
+#include <Model/Attitude.h>
+#include <Model/AttitudeData.h>
+#include <Model/Engine.h>
+#include <Model/EngineData.h>
+#include <Model/PrimaryFlightControl.h>
+#include <Model/PrimaryFlightControlData.h>
+#include <Model/SecondaryFlightControl.h>
+#include <Model/SecondaryFlightControlData.h>
+#include <Model/AircraftHandle.h>
+#include <Model/AircraftHandleData.h>
+#include <Model/Light.h>
+#include <Model/LightData.h>
+#include <Model/TimeVariableData.h>
+#include <Model/SampleCursor.h>
+#include <PluginManager/SkyConnectManager.h>
+#include <PluginManager/Connect/Connect.h>
+#include "SimulationVariableSnapshot.h"
+
+namespace
+{
+    constexpr int MillisecondsPerSecond {1000};
+
+    inline int toRefreshInterval(int refreshRate) noexcept
+    {
+        return MillisecondsPerSecond / std::max(refreshRate, 1);
+    }
+
+    template <typename Component, typename Data>
+    inline void updateComponentData(const Component &component, std::int64_t timestamp, TimeVariableData::Access access,
+                                    bool recording, SampleCursor<Data> &cursor, Data &data) noexcept
+    {
+        if (recording) {
+            if (component.count() > 0) {
+                data = component.getLast();
+            } else {
+                data.reset();
+            }
+        } else {
+            data = component.interpolate(timestamp, access, cursor);
+        }
+    }
+}
+
+struct SimulationVariableSnapshotPrivate
+{
+    QTimer refreshTimer;
+    int consumerCount {0};
+    bool refreshPending {false};
+    std::int64_t timestamp {TimeVariableData::InvalidTime};
+    TimeVariableData::Access access {TimeVariableData::Access::DiscreteSeek};
+
+    PositionData positionData;
+    AttitudeData attitudeData;
+    EngineData engineData;
+    PrimaryFlightControlData primaryFlightControlData;
+    SecondaryFlightControlData secondaryFlightControlData;
+    AircraftHandleData aircraftHandleData;
+    LightData lightData;
+
+    SampleCursor<PositionData> positionCursor;
+    SampleCursor<AttitudeData> attitudeCursor;
+    SampleCursor<EngineData> engineCursor;
+    SampleCursor<PrimaryFlightControlData> primaryFlightControlCursor;
+    SampleCursor<SecondaryFlightControlData> secondaryFlightControlCursor;
+    SampleCursor<AircraftHandleData> aircraftHandleCursor;
+    SampleCursor<LightData> lightCursor;
+};
+
+// PUBLIC
+
+SimulationVariableSnapshot::SimulationVariableSnapshot(QObject *parent) noexcept
+    : QObject {parent},
+      d {std::make_unique<SimulationVariableSnapshotPrivate>()}
+{
+    d->refreshTimer.setSingleShot(true);
+    d->refreshTimer.setInterval(::toRefreshInterval(Settings::getInstance().getUiRefreshRate()));
+    frenchConnection();
+}
+
+SimulationVariableSnapshot::~SimulationVariableSnapshot() = default;
+
+void SimulationVariableSnapshot::addConsumer() noexcept
+{
+    ++d->consumerCount;
+    if (d->consumerCount == 1) {
+        d->timestamp = SkyConnectManager::getInstance().getCurrentTimestamp();
+        d->access = TimeVariableData::Access::DiscreteSeek;
+        updateData();
+    }
+}
+
+void SimulationVariableSnapshot::removeConsumer() noexcept
+{
+    if (d->consumerCount > 0) {
+        --d->consumerCount;
+    }
+}
+
+std::int64_t SimulationVariableSnapshot::getTimestamp() const noexcept
+{
+    return d->timestamp;
+}
+
+TimeVariableData::Access SimulationVariableSnapshot::getAccess() const noexcept
+{
+    return d->access;
+}
+
+const PositionData &SimulationVariableSnapshot::getPositionData() const noexcept
+{
+    return d->positionData;
+}
+
+const AttitudeData &SimulationVariableSnapshot::getAttitudeData() const noexcept
+{
+    return d->attitudeData;
+}
+
+const EngineData &SimulationVariableSnapshot::getEngineData() const noexcept
+{
+    return d->engineData;
+}
+
+const PrimaryFlightControlData &SimulationVariableSnapshot::getPrimaryFlightControlData() const noexcept
+{
+    return d->primaryFlightControlData;
+}
+
+const SecondaryFlightControlData &SimulationVariableSnapshot::getSecondaryFlightControlData() const noexcept
+{
+    return d->secondaryFlightControlData;
+}
+
+const AircraftHandleData &SimulationVariableSnapshot::getAircraftHandleData() const noexcept
+{
+    return d->aircraftHandleData;
+}
+
+const LightData &SimulationVariableSnapshot::getLightData() const noexcept
+{
+    return d->lightData;
+}
+
+// PUBLIC SLOTS
+
+void SimulationVariableSnapshot::refresh() noexcept
+{
+    Trace::Scope trace {Trace::UserInterface, "Refresh"};
+    d->refreshPending = false;
+    if (d->consumerCount > 0) {
+        updateData();
+    }
+    emit refreshed(d->timestamp, d->access);
+}
+
+// PRIVATE
+
+void SimulationVariableSnapshot::frenchConnection() noexcept
+{
+    const auto &skyConnectManager = SkyConnectManager::getInstance();
+    connect(&skyConnectManager, &SkyConnectManager::timestampChanged,
+            this, &SimulationVariableSnapshot::onTimestampChanged);
+    const auto &flight = Logbook::getInstance().getCurrentFlight();
+    connect(&flight, &Flight::userAircraftChanged,
+            this, &SimulationVariableSnapshot::onUserAircraftChanged);
+    const auto &settings = Settings::getInstance();
+    connect(&settings, &Settings::uiRefreshRateChanged,
+            this, &SimulationVariableSnapshot::onUiRefreshRateChanged);
+    connect(&d->refreshTimer, &QTimer::timeout,
+            this, &SimulationVariableSnapshot::onRefreshTimeout);
+}
+
+void SimulationVariableSnapshot::updateData() noexcept
+{
+    const auto &skyConnectManager = SkyConnectManager::getInstance();
+    const auto &aircraft = Logbook::getInstance().getCurrentFlight().getUserAircraft();
+    const bool recording = skyConnectManager.getState() == Connect::State::Recording;
+    const auto timestamp = d->timestamp != TimeVariableData::InvalidTime ? d->timestamp : skyConnectManager.getCurrentTimestamp();
+
+    ::updateComponentData(aircraft.getPosition(), timestamp, d->access, recording, d->positionCursor, d->positionData);
+    ::updateComponentData(aircraft.getAttitude(), timestamp, d->access, recording, d->attitudeCursor, d->attitudeData);
+    ::updateComponentData(aircraft.getEngine(), timestamp, d->access, recording, d->engineCursor, d->engineData);
+    ::updateComponentData(aircraft.getPrimaryFlightControl(), timestamp, d->access, recording, d->primaryFlightControlCursor, d->primaryFlightControlData);
+    ::updateComponentData(aircraft.getSecondaryFlightControl(), timestamp, d->access, recording, d->secondaryFlightControlCursor, d->secondaryFlightControlData);
+    ::updateComponentData(aircraft.getAircraftHandle(), timestamp, d->access, recording, d->aircraftHandleCursor, d->aircraftHandleData);
+    ::updateComponentData(aircraft.getLight(), timestamp, d->access, recording, d->lightCursor, d->lightData);
+}
+
+// PRIVATE SLOTS
+
+void SimulationVariableSnapshot::onTimestampChanged(std::int64_t timestamp, TimeVariableData::Access access) noexcept
+{
+    d->timestamp = timestamp;
+    d->access = access;
+    if (access == TimeVariableData::Access::DiscreteSeek || !d->refreshTimer.isActive()) {
+        // Leading edge (or discrete seek): refresh immediately and defer
+        // any further change until the end of the refresh interval
+        refresh();
+        d->refreshTimer.start();
+    } else {
+        d->refreshPending = true;
+    }
+}
+
+void SimulationVariableSnapshot::onRefreshTimeout() noexcept
+{
+    if (d->refreshPending) {
+        refresh();
+        d->refreshTimer.start();
+    }
+}
+
+void SimulationVariableSnapshot::onUserAircraftChanged() noexcept
+{
+    d->timestamp = SkyConnectManager::getInstance().getCurrentTimestamp();
+    d->access = TimeVariableData::Access::DiscreteSeek;
+    refresh();
+}
+
+void SimulationVariableSnapshot::onUiRefreshRateChanged(int refreshRate) noexcept
+{
+    d->refreshTimer.setInterval(::toRefreshInterval(refreshRate));
+}
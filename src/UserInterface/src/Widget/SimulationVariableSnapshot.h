@@ -0,0 +1,132 @@
+/**
+ * Sky Dolly - The Black Sheep for Your Flight Recordings
+ *
+ * Copyright (c) 2020 - 2025 Oliver Knoll
+ *
+ * MIT License
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this
+ * software and associated documentation files (the "Software"), to deal in the Software
+ * without restriction, including without limitation the rights to use, copy, modify, merge,
+ * publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons
+ * to whom the Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or
+ * substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED *AS IS*, WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR
+ * PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE
+ * FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+ * OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ */
+#ifndef SIMULATIONVARIABLESNAPSHOT_H
+#define SIMULATIONVARIABLESNAPSHOT_H
+
+#include <memory>
+#include <cstdint>
+
+#include <QObject>
+
+#include <Model/TimeVariableData.h>
+
+struct PositionData;
+struct AttitudeData;
+struct EngineData;
+struct PrimaryFlightControlData;
+struct SecondaryFlightControlData;
+struct AircraftHandleData;
+struct LightData;
+struct SimulationVariableSnapshotPrivate;
+
+/*!
+ * Provides the simulation variables of the user aircraft at the current timestamp, shared by
+ * all user interface elements.
+ *
+ * The timestamp changes emitted by the SkyConnectManager are coalesced and the user interface
+ * is refreshed at the rate given by the Settings (refresh rate), independent of the replay or
+ * recording rate: the first change is delivered immediately, subsequent changes within the
+ * same refresh interval are deferred until the end of that interval, with only the latest
+ * timestamp being refreshed. Discrete seek operations and changes of the user aircraft are
+ * refreshed immediately.
+ *
+ * The sample data is evaluated once per refresh and only while at least one consumer is
+ * registered. While recording the last recorded sample data is provided instead.
+ *
+ * \sa addConsumer
+ * \sa Settings#getUiRefreshRate
+ */
+class SimulationVariableSnapshot : public QObject
+{
+    Q_OBJECT
+public:
+    explicit SimulationVariableSnapshot(QObject *parent = nullptr) noexcept;
+    SimulationVariableSnapshot(const SimulationVariableSnapshot &rhs) = delete;
+    SimulationVariableSnapshot(SimulationVariableSnapshot &&rhs) = delete;
+    SimulationVariableSnapshot &operator=(const SimulationVariableSnapshot &rhs) = delete;
+    SimulationVariableSnapshot &operator=(SimulationVariableSnapshot &&rhs) = delete;
+    ~SimulationVariableSnapshot() override;
+
+    /*!
+     * Registers a consumer of the sample data. As long as at least one consumer is registered
+     * the sample data of the user aircraft is evaluated with each refresh. The sample data is
+     * evaluated immediately when the first consumer is registered.
+     *
+     * \sa removeConsumer
+     */
+    void addConsumer() noexcept;
+
+    /*!
+     * Unregisters a consumer previously registered with #addConsumer.
+     */
+    void removeConsumer() noexcept;
+
+    /*!
+     * Returns the timestamp of the last refresh.
+     *
+     * \return the timestamp of the last refresh [milliseconds]
+     */
+    std::int64_t getTimestamp() const noexcept;
+    TimeVariableData::Access getAccess() const noexcept;
+
+    const PositionData &getPositionData() const noexcept;
+    const AttitudeData &getAttitudeData() const noexcept;
+    const EngineData &getEngineData() const noexcept;
+    const PrimaryFlightControlData &getPrimaryFlightControlData() const noexcept;
+    const SecondaryFlightControlData &getSecondaryFlightControlData() const noexcept;
+    const AircraftHandleData &getAircraftHandleData() const noexcept;
+    const LightData &getLightData() const noexcept;
+
+public slots:
+    /*!
+     * Refreshes the snapshot immediately with the latest timestamp.
+     */
+    void refresh() noexcept;
+
+signals:
+    /*!
+     * Emitted whenever the snapshot has been refreshed, at most at the user interface refresh
+     * rate (except for discrete seek operations).
+     *
+     * \param timestamp
+     *        the refreshed timestamp [milliseconds]
+     * \param access
+     *        the access type of the latest timestamp change
+     */
+    void refreshed(std::int64_t timestamp, TimeVariableData::Access access);
+
+private:
+    const std::unique_ptr<SimulationVariableSnapshotPrivate> d;
+
+    void frenchConnection() noexcept;
+    void updateData() noexcept;
+
+private slots:
+    void onTimestampChanged(std::int64_t timestamp, TimeVariableData::Access access) noexcept;
+    void onRefreshTimeout() noexcept;
+    void onUserAircraftChanged() noexcept;
+    void onUiRefreshRateChanged(int refreshRate) noexcept;
+};
+
+#endif // SIMULATIONVARIABLESNAPSHOT_H
@@ -0,0 +1,166 @@
+/**
+ * Sky Dolly - The Black Sheep for Your Flight Recordings
+ *
+ * Copyright (c) 2020 - 2025 Oliver Knoll
+ *
+ * MIT License
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this
+ * software and associated documentation files (the "Software"), to deal in the Software
+ * without restriction, including without limitation the rights to use, copy, modify, merge,
+ * publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons
+ * to whom the Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or
+ * substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED *AS IS*, WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR
+ * PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE
+ * FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+ * OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ */
+#ifndef BENCHMARKDATA_H
+#define BENCHMARKDATA_H
+
+#include <vector>
+#include <cstdint>
+
+#include <QDateTime>
+#include <QString>
+
+#include <Model/FlightData.h>
+#include <Model/Aircraft.h>
+#include <Model/AircraftInfo.h>
+#include <Model/AircraftType.h>
+#include <Model/Position.h>
+#include <Model/PositionData.h>
+#include <Model/Attitude.h>
+#include <Model/AttitudeData.h>
+#include <Model/Engine.h>
+#include <Model/EngineData.h>
+#include <Model/PrimaryFlightControl.h>
+#include <Model/PrimaryFlightControlData.h>
+#include <Model/SecondaryFlightControl.h>
+#include <Model/SecondaryFlightControlData.h>
+#include <Model/AircraftHandle.h>
+#include <Model/AircraftHandleData.h>
+#include <Model/Light.h>
+#include <Model/LightData.h>
+
+/*!
+ * Synthetic sampled data shared by the benchmarks, so that the results of the different
+ * benchmark executables (and of different builds) are based on the same data.
+ */
+namespace BenchmarkData
+{
+    /*! The sample period of the synthetic sampled data: 30 Hz, like a typical recording [milliseconds] */
+    constexpr std::int64_t SamplePeriod {33};
+
+    /*! The replay period with which the sampled data is interpolated: 60 Hz [milliseconds] */
+    constexpr std::int64_t ReplayPeriod {16};
+
+    /*!
+     * Creates \p count samples of type \p T with ascending timestamps, starting at 0.
+     *
+     * \param count
+     *        the number of samples to be created
+     * \return the created samples
+     */
+    template <typename T>
+    std::vector<T> createSamples(int count) noexcept
+    {
+        std::vector<T> samples;
+        samples.reserve(count);
+        for (int i = 0; i < count; ++i) {
+            T data;
+            data.timestamp = i * SamplePeriod;
+            samples.push_back(data);
+        }
+        return samples;
+    }
+
+    /*!
+     * Creates \p count positions along a slowly climbing straight track.
+     *
+     * \param count
+     *        the number of positions to be created
+     * \return the created positions
+     */
+    template <>
+    inline std::vector<PositionData> createSamples<PositionData>(int count) noexcept
+    {
+        std::vector<PositionData> samples;
+        samples.reserve(count);
+        for (int i = 0; i < count; ++i) {
+            PositionData positionData {47.0 + i * 1e-5, 8.0 - i * 2e-5, 1000.0 + i * 0.1};
+            positionData.timestamp = i * SamplePeriod;
+            samples.push_back(positionData);
+        }
+        return samples;
+    }
+
+    /*!
+     * Creates \p count attitudes with slowly changing pitch, bank and heading.
+     *
+     * \param count
+     *        the number of attitudes to be created
+     * \return the created attitudes
+     */
+    template <>
+    inline std::vector<AttitudeData> createSamples<AttitudeData>(int count) noexcept
+    {
+        std::vector<AttitudeData> samples;
+        samples.reserve(count);
+        for (int i = 0; i < count; ++i) {
+            AttitudeData attitudeData;
+            attitudeData.timestamp = i * SamplePeriod;
+            attitudeData.pitch = -5.0 + (i % 100) * 0.1;
+            attitudeData.bank = -10.0 + (i % 200) * 0.1;
+            attitudeData.trueHeading = (i % 3600) * 0.1;
+            attitudeData.velocityBodyZ = 120.0;
+            samples.push_back(attitudeData);
+        }
+        return samples;
+    }
+
+    /*!
+     * Creates a flight with a single (user) aircraft, having \p count samples of each
+     * selected component.
+     *
+     * \param count
+     *        the number of samples per component
+     * \param withPosition
+     *        set to \c true in order to create positions
+     * \param withOtherComponents
+     *        set to \c true in order to create the samples of all other components (attitude,
+     *        engine, flight controls, handles and lights)
+     * \return the created flight data
+     */
+    inline FlightData createFlightData(int count, bool withPosition = true, bool withOtherComponents = true) noexcept
+    {
+        FlightData flightData;
+        flightData.creationTime = QDateTime::currentDateTime();
+        flightData.title = QStringLiteral("Benchmark Flight");
+        Aircraft &aircraft = flightData.addUserAircraft();
+        AircraftInfo aircraftInfo {aircraft.getId()};
+        aircraftInfo.aircraftType.type = QStringLiteral("Benchmark Aircraft");
+        aircraftInfo.tailNumber = QStringLiteral("HB-SKY");
+        aircraft.setAircraftInfo(aircraftInfo);
+        if (withPosition) {
+            aircraft.getPosition().setData(createSamples<PositionData>(count));
+        }
+        if (withOtherComponents) {
+            aircraft.getAttitude().setData(createSamples<AttitudeData>(count));
+            aircraft.getEngine().setData(createSamples<EngineData>(count));
+            aircraft.getPrimaryFlightControl().setData(createSamples<PrimaryFlightControlData>(count));
+            aircraft.getSecondaryFlightControl().setData(createSamples<SecondaryFlightControlData>(count));
+            aircraft.getAircraftHandle().setData(createSamples<AircraftHandleData>(count));
+            aircraft.getLight().setData(createSamples<LightData>(count));
+        }
+        return flightData;
+    }
+}
+
+#endif // BENCHMARKDATA_H
@@ -0,0 +1,142 @@
+/**
+ * Sky Dolly - The Black Sheep for Your Flight Recordings
+ *
+ * Copyright (c) 2020 - 2025 Oliver Knoll
+ *
+ * MIT License
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this
+ * software and associated documentation files (the "Software"), to deal in the Software
+ * without restriction, including without limitation the rights to use, copy, modify, merge,
+ * publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons
+ * to whom the Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or
+ * substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED *AS IS*, WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR
+ * PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE
+ * FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+ * OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ */
+#include <vector>
+
+#include <QtTest>
+#include <QByteArray>
+#include <QBuffer>
+#include <QString>
+#include <QUuid>
+#include <QVariant>
+#include <QCoreApplication>
+
+#include <Kernel/Const.h>
+#include <Kernel/Enum.h>
+#include <Kernel/Version.h>
+#include <Kernel/Settings.h>
+#include <Kernel/SampleRate.h>
+#include <Model/FlightData.h>
+#include <Model/Aircraft.h>
+#include <PluginManager/PluginManager.h>
+#include "BenchmarkData.h"
+#include "ExportBenchmark.h"
+
+namespace
+{
+    constexpr const char *ResamplingPeriodKey {"ResamplingPeriod"};
+
+    struct ExportPlugin
+    {
+        const char *name;
+        QUuid uuid;
+        // The format only supports the export of single aircraft, not of entire flights
+        bool singleAircraft;
+    };
+
+    const std::vector<ExportPlugin> ExportPlugins {
+        {"csv", QUuid {Const::CsvExportPluginUuid}, false},
+        {"gpx", QUuid {Const::GpxExportPluginUuid}, false},
+        {"igc", QUuid {Const::IgcExportPluginUuid}, true},
+        {"json", QUuid {Const::JsonExportPluginUuid}, false},
+        {"kml", QUuid {Const::KmlExportPluginUuid}, false}
+    };
+
+    QVariant getPluginSetting(const QUuid &pluginUuid, const QString &key, const QVariant &defaultValue) noexcept
+    {
+        Settings::KeysWithDefaults keysWithDefaults;
+        keysWithDefaults.push_back({key, defaultValue});
+        Settings::ValuesByKey valuesByKey = Settings::getInstance().restorePluginSettings(pluginUuid, keysWithDefaults);
+        return valuesByKey[key];
+    }
+
+    void setPluginSetting(const QUuid &pluginUuid, const QString &key, const QVariant &value) noexcept
+    {
+        Settings::KeyValues keyValues;
+        keyValues.push_back({key, value});
+        Settings::getInstance().storePluginSettings(pluginUuid, keyValues);
+    }
+}
+
+// PRIVATE SLOTS
+
+void ExportBenchmark::initTestCase()
+{
+    QCoreApplication::setOrganizationName(Version::getOrganisationName());
+    QCoreApplication::setApplicationName(Version::getApplicationName());
+
+    const QVariant original {Enum::underly(SampleRate::ResamplingPeriod::Original)};
+    for (const auto &[name, pluginUuid, singleAircraft] : ::ExportPlugins) {
+        m_oldResamplingPeriods[pluginUuid] = ::getPluginSetting(pluginUuid, ::ResamplingPeriodKey, Enum::underly(SampleRate::DefaultResamplingPeriod));
+        ::setPluginSetting(pluginUuid, ::ResamplingPeriodKey, original);
+    }
+
+    const std::vector<PluginManager::Handle> flightExportPlugins = PluginManager::getInstance().initialiseFlightExportPlugins();
+    QVERIFY(flightExportPlugins.size() > 0);
+}
+
+void ExportBenchmark::cleanupTestCase()
+{
+    for (const auto &[pluginUuid, resamplingPeriod] : m_oldResamplingPeriods) {
+        ::setPluginSetting(pluginUuid, ::ResamplingPeriodKey, resamplingPeriod);
+    }
+}
+
+void ExportBenchmark::exportFlightData_data()
+{
+    QTest::addColumn<QUuid>("pluginUuid");
+    QTest::addColumn<bool>("singleAircraft");
+    QTest::addColumn<int>("sampleCount");
+
+    for (const auto &[name, pluginUuid, singleAircraft] : ::ExportPlugins) {
+        QTest::addRow("%s-1k", name) << pluginUuid << singleAircraft << 1000;
+        QTest::addRow("%s-10k", name) << pluginUuid << singleAircraft << 10000;
+    }
+}
+
+void ExportBenchmark::exportFlightData()
+{
+    QFETCH(QUuid, pluginUuid);
+    QFETCH(bool, singleAircraft);
+    QFETCH(int, sampleCount);
+    // A flight with one aircraft, so that all formats export the same samples
+    const FlightData flightData = BenchmarkData::createFlightData(sampleCount);
+    const Aircraft &aircraft = flightData.getUserAircraftConst();
+    const PluginManager &pluginManager = PluginManager::getInstance();
+    bool ok {false};
+    QByteArray exported;
+    QBENCHMARK {
+        exported.clear();
+        QBuffer buffer {&exported};
+        buffer.open(QIODeviceBase::WriteOnly);
+        if (singleAircraft) {
+            ok = pluginManager.exportAircraftData(pluginUuid, flightData, aircraft, buffer);
+        } else {
+            ok = pluginManager.exportFlightData(pluginUuid, flightData, buffer);
+        }
+    }
+    QVERIFY(ok);
+    QVERIFY(exported.size() > 0);
+}
+
+QTEST_MAIN(ExportBenchmark)
@@ -0,0 +1,201 @@
+/**
+ * Sky Dolly - The Black Sheep for Your Flight Recordings
+ *
+ * Copyright (c) 2020 - 2025 Oliver Knoll
+ *
+ * MIT License
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this
+ * software and associated documentation files (the "Software"), to deal in the Software
+ * without restriction, including without limitation the rights to use, copy, modify, merge,
+ * publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons
+ * to whom the Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or
+ * substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED *AS IS*, WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR
+ * PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE
+ * FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+ * OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ */
+#include <vector>
+#include <cstdint>
+
+#include <QtTest>
+
+#include <Model/AircraftInfo.h>
+#include <Model/TimeVariableData.h>
+#include <Model/SampleCursor.h>
+#include <Model/Position.h>
+#include <Model/PositionData.h>
+#include <Model/Attitude.h>
+#include <Model/AttitudeData.h>
+#include <Model/Engine.h>
+#include <Model/EngineData.h>
+#include <Model/PrimaryFlightControl.h>
+#include <Model/PrimaryFlightControlData.h>
+#include <Model/SecondaryFlightControl.h>
+#include <Model/SecondaryFlightControlData.h>
+#include <Model/AircraftHandle.h>
+#include <Model/AircraftHandleData.h>
+#include <Model/Light.h>
+#include <Model/LightData.h>
+#include "BenchmarkData.h"
+#include "InterpolationBenchmark.h"
+
+namespace
+{
+    // The number of seek operations per seek benchmark iteration
+    constexpr int SeekCount {1000};
+
+    // Replays the entire sampled data of the Component, with the sample count given by the current test data row
+    template <typename Component, typename T>
+    void benchmarkReplay(const AircraftInfo &aircraftInfo, bool compact = false) noexcept
+    {
+        QFETCH(int, sampleCount);
+        Component component {aircraftInfo};
+        component.setData(BenchmarkData::createSamples<T>(sampleCount));
+        if (compact) {
+            QVERIFY(component.compact());
+        }
+        const std::int64_t duration = component.getLast().timestamp;
+        SampleCursor<T> cursor;
+        int interpolated {0};
+        QBENCHMARK {
+            interpolated = 0;
+            cursor.reset();
+            for (std::int64_t timestamp = 0; timestamp < duration; timestamp += BenchmarkData::ReplayPeriod) {
+                const T &data = component.interpolate(timestamp, TimeVariableData::Access::Linear, cursor);
+                if (!data.isNull()) {
+                    ++interpolated;
+                }
+            }
+        }
+        QVERIFY(interpolated > 0);
+    }
+}
+
+// PRIVATE SLOTS
+
+void InterpolationBenchmark::interpolatePosition_data()
+{
+    addSampleCountRows();
+}
+
+void InterpolationBenchmark::interpolatePosition()
+{
+    ::benchmarkReplay<Position, PositionData>(m_aircraftInfo);
+}
+
+void InterpolationBenchmark::interpolateCompactPosition_data()
+{
+    addSampleCountRows();
+}
+
+void InterpolationBenchmark::interpolateCompactPosition()
+{
+    ::benchmarkReplay<Position, PositionData>(m_aircraftInfo, true);
+}
+
+void InterpolationBenchmark::seekPosition_data()
+{
+    addSampleCountRows();
+}
+
+void InterpolationBenchmark::seekPosition()
+{
+    QFETCH(int, sampleCount);
+    Position position {m_aircraftInfo};
+    position.setData(BenchmarkData::createSamples<PositionData>(sampleCount));
+    const std::int64_t duration = position.getLast().timestamp;
+    const std::int64_t step = duration / ::SeekCount;
+    SampleCursor<PositionData> cursor;
+    int interpolated {0};
+    QBENCHMARK {
+        interpolated = 0;
+        // Alternately seek "into the past" and "into the future", defeating the linear search
+        for (int i = 0; i < ::SeekCount; ++i) {
+            const std::int64_t timestamp = i % 2 == 0 ? i * step : duration - i * step;
+            const PositionData &data = position.interpolate(timestamp, TimeVariableData::Access::DiscreteSeek, cursor);
+            if (!data.isNull()) {
+                ++interpolated;
+            }
+        }
+    }
+    QVERIFY(interpolated > 0);
+}
+
+void InterpolationBenchmark::interpolateAttitude_data()
+{
+    addSampleCountRows();
+}
+
+void InterpolationBenchmark::interpolateAttitude()
+{
+    ::benchmarkReplay<Attitude, AttitudeData>(m_aircraftInfo);
+}
+
+void InterpolationBenchmark::interpolateEngine_data()
+{
+    addSampleCountRows();
+}
+
+void InterpolationBenchmark::interpolateEngine()
+{
+    ::benchmarkReplay<Engine, EngineData>(m_aircraftInfo);
+}
+
+void InterpolationBenchmark::interpolatePrimaryFlightControl_data()
+{
+    addSampleCountRows();
+}
+
+void InterpolationBenchmark::interpolatePrimaryFlightControl()
+{
+    ::benchmarkReplay<PrimaryFlightControl, PrimaryFlightControlData>(m_aircraftInfo);
+}
+
+void InterpolationBenchmark::interpolateSecondaryFlightControl_data()
+{
+    addSampleCountRows();
+}
+
+void InterpolationBenchmark::interpolateSecondaryFlightControl()
+{
+    ::benchmarkReplay<SecondaryFlightControl, SecondaryFlightControlData>(m_aircraftInfo);
+}
+
+void InterpolationBenchmark::interpolateAircraftHandle_data()
+{
+    addSampleCountRows();
+}
+
+void InterpolationBenchmark::interpolateAircraftHandle()
+{
+    ::benchmarkReplay<AircraftHandle, AircraftHandleData>(m_aircraftInfo);
+}
+
+void InterpolationBenchmark::interpolateLight_data()
+{
+    addSampleCountRows();
+}
+
+void InterpolationBenchmark::interpolateLight()
+{
+    ::benchmarkReplay<Light, LightData>(m_aircraftInfo);
+}
+
+// PRIVATE
+
+void InterpolationBenchmark::addSampleCountRows() noexcept
+{
+    QTest::addColumn<int>("sampleCount");
+    QTest::newRow("1k") << 1000;
+    QTest::newRow("10k") << 10000;
+    QTest::newRow("100k") << 100000;
+}
+
+QTEST_MAIN(InterpolationBenchmark)
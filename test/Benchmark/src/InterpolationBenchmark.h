@@ -0,0 +1,67 @@
+/**
+ * Sky Dolly - The Black Sheep for Your Flight Recordings
+ *
+ * Copyright (c) 2020 - 2025 Oliver Knoll
+ *
+ * MIT License
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this
+ * software and associated documentation files (the "Software"), to deal in the Software
+ * without restriction, including without limitation the rights to use, copy, modify, merge,
+ * publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons
+ * to whom the Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or
+ * substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED *AS IS*, WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR
+ * PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE
+ * FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+ * OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ */
+#ifndef INTERPOLATIONBENCHMARK_H
+#define INTERPOLATIONBENCHMARK_H
+
+#include <QObject>
+
+#include <Model/AircraftInfo.h>
+
+/*!
+ * Benchmarks for AbstractComponent#interpolate, for each component type.
+ *
+ * Each benchmark iteration replays the entire sampled data at 60 Hz, so the reported time
+ * is the time to interpolate the component over the entire flight.
+ */
+class InterpolationBenchmark : public QObject
+{
+    Q_OBJECT
+
+private slots:
+    void interpolatePosition_data();
+    void interpolatePosition();
+    void interpolateCompactPosition_data();
+    void interpolateCompactPosition();
+    void seekPosition_data();
+    void seekPosition();
+    void interpolateAttitude_data();
+    void interpolateAttitude();
+    void interpolateEngine_data();
+    void interpolateEngine();
+    void interpolatePrimaryFlightControl_data();
+    void interpolatePrimaryFlightControl();
+    void interpolateSecondaryFlightControl_data();
+    void interpolateSecondaryFlightControl();
+    void interpolateAircraftHandle_data();
+    void interpolateAircraftHandle();
+    void interpolateLight_data();
+    void interpolateLight();
+
+private:
+    AircraftInfo m_aircraftInfo;
+
+    static void addSampleCountRows() noexcept;
+};
+
+#endif // INTERPOLATIONBENCHMARK_H
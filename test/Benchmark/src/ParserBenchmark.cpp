@@ -0,0 +1,306 @@
+/**
+ * Sky Dolly - The Black Sheep for Your Flight Recordings
+ *
+ * Copyright (c) 2020 - 2025 Oliver Knoll
+ *
+ * MIT License
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this
+ * software and associated documentation files (the "Software"), to deal in the Software
+ * without restriction, including without limitation the rights to use, copy, modify, merge,
+ * publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons
+ * to whom the Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or
+ * substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED *AS IS*, WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR
+ * PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE
+ * FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+ * OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ */
+#include <vector>
+
+#include <QtTest>
+#include <QByteArray>
+#include <QBuffer>
+#include <QTextStream>
+#include <QDate>
+#include <QTime>
+#include <QDateTime>
+#include <QTimeZone>
+#include <QString>
+#include <QUuid>
+#include <QVariant>
+#include <QCoreApplication>
+
+#include <Kernel/Const.h>
+#include <Kernel/Version.h>
+#include <Kernel/Settings.h>
+#include <Kernel/CsvParser.h>
+#include <Model/FlightData.h>
+#include <Model/Aircraft.h>
+#include <Model/Position.h>
+#include <PluginManager/PluginManager.h>
+#include "ParserBenchmark.h"
+
+namespace
+{
+    constexpr const char *WaypointSelectionKey {"WaypointSelection"};
+    constexpr const char *PositionSelectionKey {"PositionSelection"};
+    constexpr const char *FormatKey {"Format"};
+
+    constexpr int GpxWaypointSelection {0};
+    constexpr int GpxTrackSelection {2};
+    constexpr int KmlFlightAwareFormat {0};
+    constexpr int CsvFlightRadar24Format {1};
+
+    constexpr const char *FlightRadar24Header {"Timestamp,UTC,Callsign,Position,Altitude,Speed,Direction"};
+
+    const QDateTime StartTime {QDate(2024, 10, 12), QTime(10, 0, 0), QTimeZone::UTC};
+
+    QVariant getPluginSetting(const QUuid &pluginUuid, const QString &key, const QVariant &defaultValue) noexcept
+    {
+        Settings::KeysWithDefaults keysWithDefaults;
+        keysWithDefaults.push_back({key, defaultValue});
+        Settings::ValuesByKey valuesByKey = Settings::getInstance().restorePluginSettings(pluginUuid, keysWithDefaults);
+        return valuesByKey[key];
+    }
+
+    void setPluginSetting(const QUuid &pluginUuid, const QString &key, const QVariant &value) noexcept
+    {
+        Settings::KeyValues keyValues;
+        keyValues.push_back({key, value});
+        Settings::getInstance().storePluginSettings(pluginUuid, keyValues);
+    }
+
+    // Zero-padded integer
+    inline QByteArray padded(int value, int width) noexcept
+    {
+        return QByteArray::number(value).rightJustified(width, '0');
+    }
+
+    QByteArray createIgc(int pointCount) noexcept
+    {
+        QByteArray igc;
+        igc.append("AXXYBenchmark\r\n");
+        igc.append("HFDTEDATE:121024\r\n");
+        igc.append("HFPLTPILOTINCHARGE:Benchmark\r\n");
+        igc.append("HFGTYGLIDERTYPE:Benchmark Aircraft\r\n");
+        igc.append("I013638ENL\r\n");
+        const QTime startTime = ::StartTime.time();
+        for (int i = 0; i < pointCount; ++i) {
+            const QTime time = startTime.addSecs(i);
+            // Latitude and longitude in thousandths of minutes
+            const int latitude = 47 * 60000 + i;
+            const int longitude = 8 * 60000 + 2 * i;
+            const int altitude = 500 + i % 1000;
+            igc.append('B')
+               .append(time.toString("HHmmss").toLatin1())
+               .append(padded(latitude / 60000, 2)).append(padded(latitude % 60000, 5)).append('N')
+               .append(padded(longitude / 60000, 3)).append(padded(longitude % 60000, 5)).append('E')
+               .append('A')
+               .append(padded(altitude, 5))
+               .append(padded(altitude, 5))
+               .append("000\r\n");
+        }
+        return igc;
+    }
+
+    QByteArray createGpx(int pointCount) noexcept
+    {
+        QByteArray gpx;
+        gpx.append("<?xml version=\"1.0\" encoding=\"UTF-8\"?>\n"
+                   "<gpx xmlns=\"http://www.topografix.com/GPX/1/1\" version=\"1.1\" creator=\"Sky Dolly Benchmark\">\n"
+                   "  <trk>\n"
+                   "    <trkseg>\n");
+        for (int i = 0; i < pointCount; ++i) {
+            gpx.append("      <trkpt lon=\"").append(QByteArray::number(8.0 + i * 2e-5, 'f', 7))
+               .append("\" lat=\"").append(QByteArray::number(47.0 + i * 1e-5, 'f', 7)).append("\">\n")
+               .append("        <ele>").append(QByteArray::number(500.0 + i % 1000, 'f', 2)).append("</ele>\n")
+               .append("        <time>").append(::StartTime.addSecs(i).toString(Qt::ISODate).toLatin1()).append("</time>\n")
+               .append("      </trkpt>\n");
+        }
+        gpx.append("    </trkseg>\n"
+                   "  </trk>\n"
+                   "</gpx>\n");
+        return gpx;
+    }
+
+    QByteArray createKml(int pointCount) noexcept
+    {
+        QByteArray kml;
+        kml.append("<?xml version=\"1.0\" encoding=\"UTF-8\"?>\n"
+                   "<kml xmlns=\"http://www.opengis.net/kml/2.2\" xmlns:gx=\"http://www.google.com/kml/ext/2.2\">\n"
+                   "<Document>\n"
+                   "    <name>FlightAware Benchmark</name>\n"
+                   "    <Placemark>\n"
+                   "        <name>LSZH Airport</name>\n"
+                   "        <Point><coordinates>8.548056,47.458056,0</coordinates></Point>\n"
+                   "    </Placemark>\n"
+                   "    <Placemark>\n"
+                   "        <name>LSGG Airport</name>\n"
+                   "        <Point><coordinates>6.109167,46.238056,0</coordinates></Point>\n"
+                   "    </Placemark>\n"
+                   "    <Placemark>\n"
+                   "        <name>SKY42</name>\n"
+                   "        <description>LSZH - LSGG</description>\n"
+                   "        <gx:Track>\n"
+                   "            <altitudeMode>absolute</altitudeMode>\n");
+        for (int i = 0; i < pointCount; ++i) {
+            kml.append("            <when>").append(::StartTime.addSecs(i).toString(Qt::ISODate).toLatin1()).append("</when>\n");
+        }
+        for (int i = 0; i < pointCount; ++i) {
+            kml.append("            <gx:coord>").append(QByteArray::number(8.0 + i * 2e-5, 'f', 5))
+               .append(' ').append(QByteArray::number(47.0 + i * 1e-5, 'f', 5))
+               .append(' ').append(QByteArray::number(500 + i % 1000)).append("</gx:coord>\n");
+        }
+        kml.append("        </gx:Track>\n"
+                   "    </Placemark>\n"
+                   "</Document>\n"
+                   "</kml>\n");
+        return kml;
+    }
+
+    QByteArray createFlightRadar24Csv(int pointCount) noexcept
+    {
+        QByteArray csv;
+        csv.append(::FlightRadar24Header).append('\n');
+        for (int i = 0; i < pointCount; ++i) {
+            const QDateTime dateTime = ::StartTime.addSecs(i);
+            csv.append(QByteArray::number(dateTime.toSecsSinceEpoch())).append(',')
+               .append(dateTime.toString(Qt::ISODate).toLatin1()).append(",SKY42,\"")
+               .append(QByteArray::number(47.0 + i * 1e-5, 'f', 6)).append(',')
+               .append(QByteArray::number(8.0 + i * 2e-5, 'f', 6)).append("\",")
+               .append(QByteArray::number(500 + i % 1000)).append(",120,")
+               .append(QByteArray::number(i % 360)).append('\n');
+        }
+        return csv;
+    }
+}
+
+// PRIVATE SLOTS
+
+void ParserBenchmark::initTestCase()
+{
+    QCoreApplication::setOrganizationName(Version::getOrganisationName());
+    QCoreApplication::setApplicationName(Version::getApplicationName());
+
+    const QUuid gpxPluginUuid {Const::GpxImportPluginUuid};
+    m_oldGpxWaypointSelection = ::getPluginSetting(gpxPluginUuid, ::WaypointSelectionKey, 0);
+    m_oldGpxPositionSelection = ::getPluginSetting(gpxPluginUuid, ::PositionSelectionKey, 0);
+    ::setPluginSetting(gpxPluginUuid, ::WaypointSelectionKey, ::GpxWaypointSelection);
+    ::setPluginSetting(gpxPluginUuid, ::PositionSelectionKey, ::GpxTrackSelection);
+
+    const QUuid kmlPluginUuid {Const::KmlImportPluginUuid};
+    m_oldKmlFormat = ::getPluginSetting(kmlPluginUuid, ::FormatKey, 0);
+    ::setPluginSetting(kmlPluginUuid, ::FormatKey, ::KmlFlightAwareFormat);
+
+    const QUuid csvPluginUuid {Const::CsvImportPluginUuid};
+    m_oldCsvFormat = ::getPluginSetting(csvPluginUuid, ::FormatKey, 0);
+    ::setPluginSetting(csvPluginUuid, ::FormatKey, ::CsvFlightRadar24Format);
+
+    const std::vector<PluginManager::Handle> flightImportPlugins = PluginManager::getInstance().initialiseFlightImportPlugins();
+    QVERIFY(flightImportPlugins.size() > 0);
+}
+
+void ParserBenchmark::cleanupTestCase()
+{
+    const QUuid gpxPluginUuid {Const::GpxImportPluginUuid};
+    ::setPluginSetting(gpxPluginUuid, ::WaypointSelectionKey, m_oldGpxWaypointSelection);
+    ::setPluginSetting(gpxPluginUuid, ::PositionSelectionKey, m_oldGpxPositionSelection);
+    ::setPluginSetting(QUuid {Const::KmlImportPluginUuid}, ::FormatKey, m_oldKmlFormat);
+    ::setPluginSetting(QUuid {Const::CsvImportPluginUuid}, ::FormatKey, m_oldCsvFormat);
+}
+
+void ParserBenchmark::parseCsv_data()
+{
+    addPointCountRows();
+}
+
+void ParserBenchmark::parseCsv()
+{
+    QFETCH(int, pointCount);
+    QByteArray csv = ::createFlightRadar24Csv(pointCount);
+    CsvParser::Rows rows;
+    QBENCHMARK {
+        QTextStream textStream {&csv, QIODeviceBase::ReadOnly};
+        CsvParser csvParser;
+        rows = csvParser.parse(textStream, ::FlightRadar24Header);
+    }
+    QCOMPARE_EQ(static_cast<int>(rows.size()), pointCount);
+    QVERIFY(CsvParser::validate(rows, 7));
+}
+
+void ParserBenchmark::importIgc_data()
+{
+    addPointCountRows();
+}
+
+void ParserBenchmark::importIgc()
+{
+    QFETCH(int, pointCount);
+    benchmarkImport(QUuid {Const::IgcImportPluginUuid}, ::createIgc(pointCount));
+}
+
+void ParserBenchmark::importGpx_data()
+{
+    addPointCountRows();
+}
+
+void ParserBenchmark::importGpx()
+{
+    QFETCH(int, pointCount);
+    benchmarkImport(QUuid {Const::GpxImportPluginUuid}, ::createGpx(pointCount));
+}
+
+void ParserBenchmark::importKml_data()
+{
+    addPointCountRows();
+}
+
+void ParserBenchmark::importKml()
+{
+    QFETCH(int, pointCount);
+    benchmarkImport(QUuid {Const::KmlImportPluginUuid}, ::createKml(pointCount));
+}
+
+void ParserBenchmark::importCsv_data()
+{
+    addPointCountRows();
+}
+
+void ParserBenchmark::importCsv()
+{
+    QFETCH(int, pointCount);
+    benchmarkImport(QUuid {Const::CsvImportPluginUuid}, ::createFlightRadar24Csv(pointCount));
+}
+
+// PRIVATE
+
+void ParserBenchmark::addPointCountRows() noexcept
+{
+    QTest::addColumn<int>("pointCount");
+    QTest::newRow("1k") << 1000;
+    QTest::newRow("10k") << 10000;
+}
+
+void ParserBenchmark::benchmarkImport(const QUuid &pluginUuid, const QByteArray &document) noexcept
+{
+    const PluginManager &pluginManager = PluginManager::getInstance();
+    bool ok {false};
+    std::vector<FlightData> flights;
+    QBENCHMARK {
+        QBuffer buffer;
+        buffer.setData(document);
+        buffer.open(QIODeviceBase::ReadOnly);
+        flights = pluginManager.importFlightData(pluginUuid, buffer, ok);
+    }
+    QVERIFY(ok);
+    QCOMPARE_EQ(flights.size(), std::size_t(1));
+    QVERIFY(flights.front().getUserAircraftConst().getPosition().count() > 0);
+}
+
+QTEST_MAIN(ParserBenchmark)
@@ -0,0 +1,68 @@
+/**
+ * Sky Dolly - The Black Sheep for Your Flight Recordings
+ *
+ * Copyright (c) 2020 - 2025 Oliver Knoll
+ *
+ * MIT License
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this
+ * software and associated documentation files (the "Software"), to deal in the Software
+ * without restriction, including without limitation the rights to use, copy, modify, merge,
+ * publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons
+ * to whom the Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or
+ * substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED *AS IS*, WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR
+ * PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE
+ * FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+ * OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ */
+#ifndef PARSERBENCHMARK_H
+#define PARSERBENCHMARK_H
+
+#include <QObject>
+#include <QByteArray>
+#include <QUuid>
+#include <QVariant>
+
+/*!
+ * Benchmarks for the parsing throughput of the CsvParser and of the flight import plugins,
+ * based on synthetic in-memory documents with a given number of track points.
+ *
+ * The import plugins are loaded via the PluginManager for each import, just like in the application,
+ * so the reported time includes the (small) plugin loading overhead.
+ */
+class ParserBenchmark : public QObject
+{
+    Q_OBJECT
+
+private slots:
+    void initTestCase();
+    void cleanupTestCase();
+
+    void parseCsv_data();
+    void parseCsv();
+    void importIgc_data();
+    void importIgc();
+    void importGpx_data();
+    void importGpx();
+    void importKml_data();
+    void importKml();
+    void importCsv_data();
+    void importCsv();
+
+private:
+    QVariant m_oldGpxWaypointSelection;
+    QVariant m_oldGpxPositionSelection;
+    QVariant m_oldKmlFormat;
+    QVariant m_oldCsvFormat;
+
+    static void addPointCountRows() noexcept;
+    static void benchmarkImport(const QUuid &pluginUuid, const QByteArray &document) noexcept;
+};
+
+#endif // PARSERBENCHMARK_H
@@ -0,0 +1,229 @@
+/**
+ * Sky Dolly - The Black Sheep for Your Flight Recordings
+ *
+ * Copyright (c) 2020 - 2025 Oliver Knoll
+ *
+ * MIT License
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this
+ * software and associated documentation files (the "Software"), to deal in the Software
+ * without restriction, including without limitation the rights to use, copy, modify, merge,
+ * publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons
+ * to whom the Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or
+ * substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED *AS IS*, WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR
+ * PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE
+ * FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+ * OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ */
+#include <memory>
+#include <vector>
+#include <cstdint>
+
+#include <QtTest>
+#include <QString>
+#include <QCoreApplication>
+
+#include <Kernel/Version.h>
+#include <Model/FlightData.h>
+#include <Model/FlightSummary.h>
+#include <Model/Aircraft.h>
+#include <Model/Position.h>
+#include <Model/PositionData.h>
+#include <Model/Attitude.h>
+#include <Model/AttitudeData.h>
+#include <Model/Engine.h>
+#include <Model/EngineData.h>
+#include <Model/PrimaryFlightControl.h>
+#include <Model/PrimaryFlightControlData.h>
+#include <Model/SecondaryFlightControl.h>
+#include <Model/SecondaryFlightControlData.h>
+#include <Model/AircraftHandle.h>
+#include <Model/AircraftHandleData.h>
+#include <Model/Light.h>
+#include <Model/LightData.h>
+#include <Persistence/Migration.h>
+#include <Persistence/Connection.h>
+#include <Persistence/FlightSelector.h>
+#include <Persistence/Service/DatabaseService.h>
+#include <Persistence/Service/FlightService.h>
+#include <Persistence/Service/LogbookService.h>
+#include "BenchmarkData.h"
+#include "PersistenceBenchmark.h"
+
+namespace
+{
+    constexpr const char *InMemoryLogbook {":memory:"};
+
+    // The number of samples inserted and selected per benchmark iteration
+    constexpr int SampleCount {10000};
+    // The number of positions of the flights in the logbook summary benchmark
+    constexpr int SummaryPositionCount {2};
+
+    enum struct Table: std::uint8_t
+    {
+        Position,
+        Attitude,
+        Engine,
+        PrimaryFlightControl,
+        SecondaryFlightControl,
+        Handle,
+        Light
+    };
+
+    // Creates a flight with a single aircraft, having only samples in the given sample table
+    FlightData createFlightData(Table table, int count) noexcept
+    {
+        FlightData flightData = BenchmarkData::createFlightData(count, false, false);
+        Aircraft &aircraft = flightData.getUserAircraft();
+        switch (table) {
+        case Table::Position:
+            aircraft.getPosition().setData(BenchmarkData::createSamples<PositionData>(count));
+            break;
+        case Table::Attitude:
+            aircraft.getAttitude().setData(BenchmarkData::createSamples<AttitudeData>(count));
+            break;
+        case Table::Engine:
+            aircraft.getEngine().setData(BenchmarkData::createSamples<EngineData>(count));
+            break;
+        case Table::PrimaryFlightControl:
+            aircraft.getPrimaryFlightControl().setData(BenchmarkData::createSamples<PrimaryFlightControlData>(count));
+            break;
+        case Table::SecondaryFlightControl:
+            aircraft.getSecondaryFlightControl().setData(BenchmarkData::createSamples<SecondaryFlightControlData>(count));
+            break;
+        case Table::Handle:
+            aircraft.getAircraftHandle().setData(BenchmarkData::createSamples<AircraftHandleData>(count));
+            break;
+        case Table::Light:
+            aircraft.getLight().setData(BenchmarkData::createSamples<LightData>(count));
+            break;
+        }
+        return flightData;
+    }
+}
+
+// PRIVATE SLOTS
+
+void PersistenceBenchmark::initTestCase()
+{
+    QCoreApplication::setOrganizationName(Version::getOrganisationName());
+    QCoreApplication::setApplicationName(Version::getApplicationName());
+    QVERIFY(connectLogbook());
+}
+
+void PersistenceBenchmark::cleanupTestCase()
+{
+    disconnectLogbook();
+}
+
+void PersistenceBenchmark::insert_data()
+{
+    addTableRows();
+}
+
+void PersistenceBenchmark::insert()
+{
+    QFETCH(int, table);
+    // Each iteration inserts another flight
+    FlightData flightData = ::createFlightData(static_cast<::Table>(table), ::SampleCount);
+    bool ok {false};
+    QBENCHMARK {
+        ok = m_flightService->storeFlightData(flightData);
+    }
+    QVERIFY(ok);
+}
+
+void PersistenceBenchmark::select_data()
+{
+    addTableRows();
+}
+
+void PersistenceBenchmark::select()
+{
+    QFETCH(int, table);
+    FlightData flightData = ::createFlightData(static_cast<::Table>(table), ::SampleCount);
+    QVERIFY(m_flightService->storeFlightData(flightData));
+    const std::int64_t flightId = flightData.id;
+    bool ok {false};
+    FlightData restoredFlightData;
+    QBENCHMARK {
+        restoredFlightData = FlightData();
+        ok = m_flightService->importFlightData(flightId, restoredFlightData);
+    }
+    QVERIFY(ok);
+    QCOMPARE_EQ(restoredFlightData.count(), std::size_t(1));
+}
+
+void PersistenceBenchmark::flightSummaries_data()
+{
+    QTest::addColumn<int>("flightCount");
+    // The rows are executed in order, so the logbook is successively filled up
+    QTest::newRow("1k") << 1000;
+    QTest::newRow("10k") << 10000;
+    QTest::newRow("100k") << 100000;
+}
+
+void PersistenceBenchmark::flightSummaries()
+{
+    QFETCH(int, flightCount);
+    // Start with an empty logbook, without the flights stored by the other benchmarks
+    if (m_summaryFlightCount == 0) {
+        disconnectLogbook();
+        QVERIFY(connectLogbook());
+    }
+    while (m_summaryFlightCount < flightCount) {
+        FlightData flightData = BenchmarkData::createFlightData(::SummaryPositionCount, true, false);
+        QVERIFY(m_flightService->storeFlightData(flightData));
+        ++m_summaryFlightCount;
+    }
+
+    const FlightSelector flightSelector;
+    bool ok {false};
+    std::vector<FlightSummary> summaries;
+    QBENCHMARK {
+        summaries = m_logbookService->getFlightSummaries(flightSelector, &ok);
+    }
+    QVERIFY(ok);
+    QCOMPARE_EQ(static_cast<int>(summaries.size()), flightCount);
+}
+
+// PRIVATE
+
+bool PersistenceBenchmark::connectLogbook() noexcept
+{
+    m_databaseService = std::make_unique<DatabaseService>();
+    const bool ok = m_databaseService->connectAndMigrate(::InMemoryLogbook, DatabaseService::ConnectionMode::Import, Migration::Milestone::Schema);
+    m_flightService = std::make_unique<FlightService>();
+    m_logbookService = std::make_unique<LogbookService>();
+    return ok;
+}
+
+void PersistenceBenchmark::disconnectLogbook() noexcept
+{
+    m_logbookService.reset();
+    m_flightService.reset();
+    if (m_databaseService != nullptr) {
+        m_databaseService->disconnect(Connection::Default::Remove);
+        m_databaseService.reset();
+    }
+}
+
+void PersistenceBenchmark::addTableRows() noexcept
+{
+    QTest::addColumn<int>("table");
+    QTest::newRow("position") << static_cast<int>(::Table::Position);
+    QTest::newRow("attitude") << static_cast<int>(::Table::Attitude);
+    QTest::newRow("engine") << static_cast<int>(::Table::Engine);
+    QTest::newRow("primary_flight_control") << static_cast<int>(::Table::PrimaryFlightControl);
+    QTest::newRow("secondary_flight_control") << static_cast<int>(::Table::SecondaryFlightControl);
+    QTest::newRow("handle") << static_cast<int>(::Table::Handle);
+    QTest::newRow("light") << static_cast<int>(::Table::Light);
+}
+
+QTEST_MAIN(PersistenceBenchmark)
@@ -0,0 +1,72 @@
+/**
+ * Sky Dolly - The Black Sheep for Your Flight Recordings
+ *
+ * Copyright (c) 2020 - 2025 Oliver Knoll
+ *
+ * MIT License
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this
+ * software and associated documentation files (the "Software"), to deal in the Software
+ * without restriction, including without limitation the rights to use, copy, modify, merge,
+ * publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons
+ * to whom the Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or
+ * substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED *AS IS*, WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR
+ * PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE
+ * FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+ * OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ */
+#ifndef PERSISTENCEBENCHMARK_H
+#define PERSISTENCEBENCHMARK_H
+
+#include <memory>
+#include <cstdint>
+
+#include <QObject>
+
+class DatabaseService;
+class FlightService;
+class LogbookService;
+
+/*!
+ * Benchmarks for the persistence of flights: the insert and select of the sampled data,
+ * per sample table, and the logbook summary query for a growing number of flights.
+ *
+ * The benchmarks operate on an in-memory logbook, so they measure the DAOs and the
+ * SQLite engine rather than the disk. The flight cache is not used for in-memory
+ * logbooks, so the selects really query the database.
+ */
+class PersistenceBenchmark : public QObject
+{
+    Q_OBJECT
+
+private slots:
+    void initTestCase();
+    void cleanupTestCase();
+
+    void insert_data();
+    void insert();
+    void select_data();
+    void select();
+    void flightSummaries_data();
+    void flightSummaries();
+
+private:
+    std::unique_ptr<DatabaseService> m_databaseService;
+    std::unique_ptr<FlightService> m_flightService;
+    std::unique_ptr<LogbookService> m_logbookService;
+    // The number of flights stored for the flight summary benchmark
+    int m_summaryFlightCount {0};
+
+    bool connectLogbook() noexcept;
+    void disconnectLogbook() noexcept;
+
+    static void addTableRows() noexcept;
+};
+
+#endif // PERSISTENCEBENCHMARK_H
@@ -0,0 +1,161 @@
+/**
+ * Sky Dolly - The Black Sheep for Your Flight Recordings
+ *
+ * Copyright (c) 2020 - 2025 Oliver Knoll
+ *
+ * MIT License
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this
+ * software and associated documentation files (the "Software"), to deal in the Software
+ * without restriction, including without limitation the rights to use, copy, modify, merge,
+ * publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons
+ * to whom the Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or
+ * substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED *AS IS*, WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR
+ * PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE
+ * FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+ * OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ */
+#include <vector>
+#include <algorithm>
+#include <iterator>
+
+#include <QtTest>
+
+#include <Kernel/SegmentedVector.h>
+#include <Model/AircraftInfo.h>
+#include <Model/Position.h>
+#include <Model/PositionData.h>
+#include "BenchmarkData.h"
+#include "SampleCopyBenchmark.h"
+
+namespace
+{
+    SegmentedVector<PositionData> createData(int sampleCount) noexcept
+    {
+        const auto samples = BenchmarkData::createSamples<PositionData>(sampleCount);
+        SegmentedVector<PositionData> data;
+        data.append(samples.data(), samples.size());
+        return data;
+    }
+}
+
+// PRIVATE SLOTS
+
+void SampleCopyBenchmark::copyElementWise_data()
+{
+    addSampleCountRows();
+}
+
+void SampleCopyBenchmark::copyElementWise()
+{
+    QFETCH(int, sampleCount);
+    const auto data = ::createData(sampleCount);
+    QBENCHMARK {
+        SegmentedVector<PositionData> copy;
+        copy.reserve(data.size());
+        for (const auto &positionData : data) {
+            copy.push_back(positionData);
+        }
+    }
+}
+
+void SampleCopyBenchmark::copyBulk_data()
+{
+    addSampleCountRows();
+}
+
+void SampleCopyBenchmark::copyBulk()
+{
+    QFETCH(int, sampleCount);
+    const auto data = ::createData(sampleCount);
+    QBENCHMARK {
+        SegmentedVector<PositionData> copy {data};
+    }
+}
+
+void SampleCopyBenchmark::resampleElementWise_data()
+{
+    addSampleCountRows();
+}
+
+void SampleCopyBenchmark::resampleElementWise()
+{
+    QFETCH(int, sampleCount);
+    Position position {m_aircraftInfo};
+    position.setData(BenchmarkData::createSamples<PositionData>(sampleCount));
+    const Position &constPosition = position;
+    QBENCHMARK {
+        std::vector<PositionData> resampled;
+        resampled.reserve(constPosition.count());
+        std::copy(constPosition.begin(), constPosition.end(), std::back_inserter(resampled));
+    }
+}
+
+void SampleCopyBenchmark::resampleBulk_data()
+{
+    addSampleCountRows();
+}
+
+void SampleCopyBenchmark::resampleBulk()
+{
+    QFETCH(int, sampleCount);
+    Position position {m_aircraftInfo};
+    position.setData(BenchmarkData::createSamples<PositionData>(sampleCount));
+    QBENCHMARK {
+        const auto resampled = position.copyData();
+    }
+}
+
+void SampleCopyBenchmark::restoreElementWise_data()
+{
+    addSampleCountRows();
+}
+
+void SampleCopyBenchmark::restoreElementWise()
+{
+    QFETCH(int, sampleCount);
+    Position position {m_aircraftInfo};
+    const auto samples = BenchmarkData::createSamples<PositionData>(sampleCount);
+    QBENCHMARK {
+        position.clear();
+        position.reserve(samples.size());
+        for (const auto &positionData : samples) {
+            position.upsertLast(positionData);
+        }
+    }
+    QCOMPARE(position.count(), samples.size());
+}
+
+void SampleCopyBenchmark::restoreBulk_data()
+{
+    addSampleCountRows();
+}
+
+void SampleCopyBenchmark::restoreBulk()
+{
+    QFETCH(int, sampleCount);
+    Position position {m_aircraftInfo};
+    const auto samples = BenchmarkData::createSamples<PositionData>(sampleCount);
+    QBENCHMARK {
+        position.setData(samples);
+    }
+    QCOMPARE(position.count(), samples.size());
+}
+
+// PRIVATE
+
+void SampleCopyBenchmark::addSampleCountRows() noexcept
+{
+    QTest::addColumn<int>("sampleCount");
+    QTest::newRow("1k") << 1000;
+    QTest::newRow("10k") << 10000;
+    QTest::newRow("100k") << 100000;
+}
+
+QTEST_MAIN(SampleCopyBenchmark)
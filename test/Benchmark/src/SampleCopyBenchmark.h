@@ -0,0 +1,67 @@
+/**
+ * Sky Dolly - The Black Sheep for Your Flight Recordings
+ *
+ * Copyright (c) 2020 - 2025 Oliver Knoll
+ *
+ * MIT License
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this
+ * software and associated documentation files (the "Software"), to deal in the Software
+ * without restriction, including without limitation the rights to use, copy, modify, merge,
+ * publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons
+ * to whom the Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or
+ * substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED *AS IS*, WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR
+ * PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE
+ * FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+ * OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ */
+#ifndef SAMPLECOPYBENCHMARK_H
+#define SAMPLECOPYBENCHMARK_H
+
+#include <QObject>
+
+#include <Model/AircraftInfo.h>
+
+/*!
+ * Benchmarks for copying the sampled data element-wise versus in bulk.
+ *
+ * Each pair of benchmarks performs the same operation on the same container, once sample by
+ * sample and once as a bulk copy of the trivially copyable samples:
+ *
+ * - copy: copies a SegmentedVector into a new SegmentedVector
+ * - resample: copies the samples of a Position component into a std::vector, as done when
+ *   exporting a flight
+ * - restore: replaces the samples of a Position component with the samples of a std::vector,
+ *   as done when loading a flight
+ */
+class SampleCopyBenchmark : public QObject
+{
+    Q_OBJECT
+
+private slots:
+    void copyElementWise_data();
+    void copyElementWise();
+    void copyBulk_data();
+    void copyBulk();
+    void resampleElementWise_data();
+    void resampleElementWise();
+    void resampleBulk_data();
+    void resampleBulk();
+    void restoreElementWise_data();
+    void restoreElementWise();
+    void restoreBulk_data();
+    void restoreBulk();
+
+private:
+    AircraftInfo m_aircraftInfo;
+
+    static void addSampleCountRows() noexcept;
+};
+
+#endif // SAMPLECOPYBENCHMARK_H
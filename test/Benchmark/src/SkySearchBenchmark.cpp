@@ -0,0 +1,220 @@
+/**
+ * Sky Dolly - The Black Sheep for Your Flight Recordings
+ *
+ * Copyright (c) 2020 - 2025 Oliver Knoll
+ *
+ * MIT License
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this
+ * software and associated documentation files (the "Software"), to deal in the Software
+ * without restriction, including without limitation the rights to use, copy, modify, merge,
+ * publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons
+ * to whom the Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or
+ * substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED *AS IS*, WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR
+ * PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE
+ * FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+ * OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ */
+#include <vector>
+#include <cmath>
+#include <cstdint>
+
+#include <QtTest>
+
+#include <Kernel/SegmentedVector.h>
+#include <Kernel/SkyMath.h>
+#include <Model/PositionData.h>
+#include <Model/SkySearch.h>
+#include "BenchmarkData.h"
+#include "SkySearchBenchmark.h"
+
+namespace
+{
+    // The number of interpolated values per kernel benchmark iteration
+    constexpr int KernelCount {100000};
+    // The number of random seek operations per seek benchmark iteration
+    constexpr int SeekCount {1000};
+
+    SegmentedVector<PositionData> createData(int count) noexcept
+    {
+        SegmentedVector<PositionData> data;
+        const auto samples = BenchmarkData::createSamples<PositionData>(count);
+        data.append(samples.data(), samples.size());
+        return data;
+    }
+
+    // Deterministic (linear congruential) pseudo-random timestamps, so that all builds seek the same timestamps
+    std::vector<std::int64_t> createSeekTimestamps(std::int64_t duration) noexcept
+    {
+        std::vector<std::int64_t> timestamps;
+        timestamps.reserve(::SeekCount);
+        std::uint32_t state {42};
+        for (int i = 0; i < ::SeekCount; ++i) {
+            state = state * 1664525u + 1013904223u;
+            timestamps.push_back(static_cast<std::int64_t>(state % static_cast<std::uint32_t>(duration)));
+        }
+        return timestamps;
+    }
+}
+
+// PRIVATE SLOTS
+
+void SkySearchBenchmark::updateStartIndexReplay_data()
+{
+    addSampleCountRows();
+}
+
+void SkySearchBenchmark::updateStartIndexReplay()
+{
+    QFETCH(int, sampleCount);
+    const auto data = ::createData(sampleCount);
+    const std::int64_t duration = data.back().timestamp;
+    int index {SkySearch::InvalidIndex};
+    QBENCHMARK {
+        index = SkySearch::InvalidIndex;
+        for (std::int64_t timestamp = 0; timestamp < duration; timestamp += BenchmarkData::ReplayPeriod) {
+            index = SkySearch::updateStartIndex(data, index, timestamp);
+        }
+    }
+    QCOMPARE_EQ(index, sampleCount - 2);
+}
+
+void SkySearchBenchmark::updateStartIndexSeek_data()
+{
+    addSampleCountRows();
+}
+
+void SkySearchBenchmark::updateStartIndexSeek()
+{
+    QFETCH(int, sampleCount);
+    const auto data = ::createData(sampleCount);
+    const auto timestamps = ::createSeekTimestamps(data.back().timestamp);
+    int index {SkySearch::InvalidIndex};
+    QBENCHMARK {
+        for (const std::int64_t timestamp : timestamps) {
+            index = SkySearch::updateStartIndex(data, index, timestamp);
+        }
+    }
+    QVERIFY(index != SkySearch::InvalidIndex);
+}
+
+void SkySearchBenchmark::linearInterpolationSupport_data()
+{
+    addSampleCountRows();
+}
+
+void SkySearchBenchmark::linearInterpolationSupport()
+{
+    QFETCH(int, sampleCount);
+    const auto data = ::createData(sampleCount);
+    const std::int64_t duration = data.back().timestamp;
+    int found {0};
+    QBENCHMARK {
+        found = 0;
+        int index {SkySearch::InvalidIndex};
+        const PositionData *p1 {nullptr}, *p2 {nullptr};
+        for (std::int64_t timestamp = 0; timestamp < duration; timestamp += BenchmarkData::ReplayPeriod) {
+            if (SkySearch::getLinearInterpolationSupportData(data, timestamp, SkySearch::DefaultInterpolationWindow, index, &p1, &p2)) {
+                ++found;
+            }
+        }
+    }
+    QVERIFY(found > 0);
+}
+
+void SkySearchBenchmark::cubicInterpolationSupport_data()
+{
+    addSampleCountRows();
+}
+
+void SkySearchBenchmark::cubicInterpolationSupport()
+{
+    QFETCH(int, sampleCount);
+    const auto data = ::createData(sampleCount);
+    const std::int64_t duration = data.back().timestamp;
+    int found {0};
+    QBENCHMARK {
+        found = 0;
+        int index {SkySearch::InvalidIndex};
+        const PositionData *p0 {nullptr}, *p1 {nullptr}, *p2 {nullptr}, *p3 {nullptr};
+        for (std::int64_t timestamp = 0; timestamp < duration; timestamp += BenchmarkData::ReplayPeriod) {
+            if (SkySearch::getCubicInterpolationSupportData(data, timestamp, SkySearch::InfinitetInterpolationWindow, index, &p0, &p1, &p2, &p3)) {
+                ++found;
+            }
+        }
+    }
+    QVERIFY(found > 0);
+}
+
+void SkySearchBenchmark::interpolateHermite()
+{
+    double sum {0.0};
+    QBENCHMARK {
+        sum = 0.0;
+        for (int i = 0; i < ::KernelCount; ++i) {
+            const double mu = (i % 100) * 0.01;
+            sum += SkyMath::interpolateHermite(1.0, 2.0 + mu, 3.0, 4.0 - mu, mu);
+        }
+    }
+    QVERIFY(std::isfinite(sum));
+}
+
+void SkySearchBenchmark::interpolateTimedHermite()
+{
+    double sum {0.0};
+    QBENCHMARK {
+        sum = 0.0;
+        for (int i = 0; i < ::KernelCount; ++i) {
+            const double mu = (i % 100) * 0.01;
+            const std::int64_t t = i * BenchmarkData::SamplePeriod;
+            sum += SkyMath::interpolateTimedHermite(1.0, 2.0 + mu, 3.0, 4.0 - mu, t, t + 33, t + 66, t + 100, mu);
+        }
+    }
+    QVERIFY(std::isfinite(sum));
+}
+
+void SkySearchBenchmark::interpolateTimedHermite180()
+{
+    double sum {0.0};
+    QBENCHMARK {
+        sum = 0.0;
+        for (int i = 0; i < ::KernelCount; ++i) {
+            const double mu = (i % 100) * 0.01;
+            const std::int64_t t = i * BenchmarkData::SamplePeriod;
+            // Crosses the antimeridian
+            sum += SkyMath::interpolateTimedHermite180(178.0, 179.0 + mu, -180.0, -179.0 - mu, t, t + 33, t + 66, t + 100, mu);
+        }
+    }
+    QVERIFY(std::isfinite(sum));
+}
+
+void SkySearchBenchmark::interpolateLinear()
+{
+    double sum {0.0};
+    QBENCHMARK {
+        sum = 0.0;
+        for (int i = 0; i < ::KernelCount; ++i) {
+            const double mu = (i % 100) * 0.01;
+            sum += SkyMath::interpolateLinear(1.0 + mu, 2.0, mu);
+        }
+    }
+    QVERIFY(std::isfinite(sum));
+}
+
+// PRIVATE
+
+void SkySearchBenchmark::addSampleCountRows() noexcept
+{
+    QTest::addColumn<int>("sampleCount");
+    QTest::newRow("1k") << 1000;
+    QTest::newRow("10k") << 10000;
+    QTest::newRow("100k") << 100000;
+}
+
+QTEST_MAIN(SkySearchBenchmark)
@@ -0,0 +1,59 @@
+/**
+ * Sky Dolly - The Black Sheep for Your Flight Recordings
+ *
+ * Copyright (c) 2020 - 2025 Oliver Knoll
+ *
+ * MIT License
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this
+ * software and associated documentation files (the "Software"), to deal in the Software
+ * without restriction, including without limitation the rights to use, copy, modify, merge,
+ * publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons
+ * to whom the Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or
+ * substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED *AS IS*, WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR
+ * PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE
+ * FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+ * OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ */
+#ifndef SKYSEARCHBENCHMARK_H
+#define SKYSEARCHBENCHMARK_H
+
+#include <QObject>
+
+/*!
+ * Benchmarks for the search of the sample intervals and the interpolation kernels,
+ * which are executed for every replayed frame.
+ *
+ * The replay benchmarks search (or interpolate) the entire sampled data at the replay
+ * rate of 60 Hz, so the reported time is the time to replay the entire flight.
+ */
+class SkySearchBenchmark : public QObject
+{
+    Q_OBJECT
+
+private slots:
+    void updateStartIndexReplay_data();
+    void updateStartIndexReplay();
+    void updateStartIndexSeek_data();
+    void updateStartIndexSeek();
+    void linearInterpolationSupport_data();
+    void linearInterpolationSupport();
+    void cubicInterpolationSupport_data();
+    void cubicInterpolationSupport();
+
+    void interpolateHermite();
+    void interpolateTimedHermite();
+    void interpolateTimedHermite180();
+    void interpolateLinear();
+
+private:
+    static void addSampleCountRows() noexcept;
+};
+
+#endif // SKYSEARCHBENCHMARK_H
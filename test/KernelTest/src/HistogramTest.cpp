@@ -0,0 +1,114 @@
+/**
+ * Sky Dolly - The Black Sheep for Your Flight Recordings
+ *
+ * Copyright (c) 2020 - 2025 Oliver Knoll
+ *
+ * MIT License
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this
+ * software and associated documentation files (the "Software"), to deal in the Software
+ * without restriction, including without limitation the rights to use, copy, modify, merge,
+ * publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons
+ * to whom the Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or
+ * substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED *AS IS*, WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR
+ * PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE
+ * FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+ * OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ */
+#include <cstdint>
+
+#include <QTest>
+
+#include <Kernel/Histogram.h>
+#include "HistogramTest.h"
+
+// PRIVATE SLOTS
+
+void HistogramTest::initTestCase()
+{}
+
+void HistogramTest::cleanupTestCase()
+{}
+
+void HistogramTest::add()
+{
+    // Setup
+    Histogram histogram {1.0, 10};
+
+    // Exercise
+    histogram.add(-1.0);
+    histogram.add(0.5);
+    histogram.add(2.5);
+    histogram.add(42.0);
+
+    // Verify
+    QCOMPARE(histogram.getCount(), std::uint64_t(4));
+    QCOMPARE(histogram.getMinimum(), -1.0);
+    QCOMPARE(histogram.getMaximum(), 42.0);
+    QCOMPARE(histogram.getMean(), 11.0);
+    const auto &buckets = histogram.getBuckets();
+    QCOMPARE(buckets.size(), std::size_t(10));
+    // Negative values are counted in the first bucket
+    QCOMPARE(buckets[0], std::uint64_t(2));
+    QCOMPARE(buckets[2], std::uint64_t(1));
+    // Values beyond the last bucket are counted in the last bucket
+    QCOMPARE(buckets[9], std::uint64_t(1));
+}
+
+void HistogramTest::clear()
+{
+    // Setup
+    Histogram histogram {1.0, 10};
+    histogram.add(5.0);
+
+    // Exercise
+    histogram.clear();
+
+    // Verify
+    QCOMPARE(histogram.getCount(), std::uint64_t(0));
+    QCOMPARE(histogram.getMinimum(), 0.0);
+    QCOMPARE(histogram.getMaximum(), 0.0);
+    QCOMPARE(histogram.getMean(), 0.0);
+    QCOMPARE(histogram.getPercentile(50.0), 0.0);
+    QCOMPARE(histogram.getBuckets()[5], std::uint64_t(0));
+}
+
+void HistogramTest::percentile_data()
+{
+    QTest::addColumn<double>("percentile");
+    QTest::addColumn<double>("expected");
+
+    // Values 0.5, 1.5, ..., 99.5 - one value per bucket
+    QTest::newRow("0th percentile") << 0.0 << 1.0;
+    QTest::newRow("1st percentile") << 1.0 << 1.0;
+    QTest::newRow("50th percentile") << 50.0 << 50.0;
+    QTest::newRow("99th percentile") << 99.0 << 99.0;
+    // Never more than the effective maximum value
+    QTest::newRow("100th percentile") << 100.0 << 99.5;
+    QTest::newRow("Beyond 100th percentile") << 200.0 << 99.5;
+}
+
+void HistogramTest::percentile()
+{
+    // Setup
+    QFETCH(double, percentile);
+    QFETCH(double, expected);
+    Histogram histogram {1.0, 100};
+    for (int i = 0; i < 100; ++i) {
+        histogram.add(static_cast<double>(i) + 0.5);
+    }
+
+    // Exercise
+    const auto result = histogram.getPercentile(percentile);
+
+    // Verify
+    QCOMPARE(result, expected);
+}
+
+QTEST_MAIN(HistogramTest)
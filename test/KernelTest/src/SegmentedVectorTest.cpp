@@ -0,0 +1,228 @@
+/**
+ * Sky Dolly - The Black Sheep for Your Flight Recordings
+ *
+ * Copyright (c) 2020 - 2025 Oliver Knoll
+ *
+ * MIT License
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this
+ * software and associated documentation files (the "Software"), to deal in the Software
+ * without restriction, including without limitation the rights to use, copy, modify, merge,
+ * publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons
+ * to whom the Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or
+ * substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED *AS IS*, WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR
+ * PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE
+ * FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+ * OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ */
+#include <vector>
+#include <algorithm>
+#include <utility>
+#include <cstddef>
+
+#include <QTest>
+#include <QString>
+
+#include <Kernel/SegmentedVector.h>
+#include "SegmentedVectorTest.h"
+
+namespace
+{
+    // A small segment size, such that the tests span several segments
+    constexpr std::size_t SegmentSize = 4;
+    constexpr int ElementCount = 10;
+}
+
+// PRIVATE SLOTS
+
+void SegmentedVectorTest::initTestCase()
+{}
+
+void SegmentedVectorTest::cleanupTestCase()
+{}
+
+void SegmentedVectorTest::pushBack()
+{
+    // Setup
+    SegmentedVector<int, ::SegmentSize> vector;
+
+    // Exercise
+    for (int i = 0; i < ::ElementCount; ++i) {
+        vector.push_back(i);
+    }
+
+    // Verify
+    QCOMPARE(vector.size(), std::size_t(::ElementCount));
+    QCOMPARE(vector.capacity(), std::size_t(12));
+    QCOMPARE(vector.front(), 0);
+    QCOMPARE(vector.back(), ::ElementCount - 1);
+    for (int i = 0; i < ::ElementCount; ++i) {
+        QCOMPARE(vector[i], i);
+        QCOMPARE(vector.at(i), i);
+    }
+    QCOMPARE(vector.end() - vector.begin(), std::ptrdiff_t(::ElementCount));
+}
+
+void SegmentedVectorTest::growingSegments()
+{
+    // Setup: segments of 2, 2, 4, 8, 16, 16, ... elements
+    SegmentedVector<int, 16, 2> vector;
+    std::vector<std::size_t> capacities;
+    std::vector<int> values(::ElementCount * 4);
+    for (std::size_t i = 0; i < values.size(); ++i) {
+        values[i] = static_cast<int>(i);
+    }
+
+    // Exercise
+    for (int i = 0; i < ::ElementCount * 4; ++i) {
+        vector.push_back(i);
+        capacities.push_back(vector.capacity());
+    }
+    vector.append(values.data(), values.size());
+    std::vector<int> copiedValues(values.size());
+    vector.copy(values.size(), copiedValues.size(), copiedValues.data());
+
+    // Verify
+    QCOMPARE(capacities[0], std::size_t(2));
+    QCOMPARE(capacities[2], std::size_t(4));
+    QCOMPARE(capacities[::ElementCount - 1], std::size_t(16));
+    QCOMPARE(capacities.back(), std::size_t(48));
+    QCOMPARE(vector.size(), values.size() * 2);
+    for (std::size_t i = 0; i < vector.size(); ++i) {
+        QCOMPARE(vector[i], values[i % values.size()]);
+    }
+    QCOMPARE(copiedValues, values);
+}
+
+void SegmentedVectorTest::stableAddresses()
+{
+    // Setup
+    SegmentedVector<int, ::SegmentSize> vector;
+    vector.push_back(42);
+    const int *first = &vector.front();
+
+    // Exercise
+    for (int i = 0; i < ::ElementCount * 100; ++i) {
+        vector.push_back(i);
+    }
+
+    // Verify: existing elements have not been moved
+    QCOMPARE(&vector.front(), first);
+    QCOMPARE(*first, 42);
+}
+
+void SegmentedVectorTest::clear()
+{
+    // Setup
+    SegmentedVector<QString, ::SegmentSize> vector;
+    for (int i = 0; i < ::ElementCount; ++i) {
+        vector.push_back(QString::number(i));
+    }
+    const auto capacity = vector.capacity();
+
+    // Exercise
+    vector.clear();
+
+    // Verify: the segments are retained
+    QVERIFY(vector.empty());
+    QCOMPARE(vector.capacity(), capacity);
+    vector.push_back("Sky Dolly");
+    QCOMPARE(vector.size(), std::size_t(1));
+    QCOMPARE(vector.front(), QString("Sky Dolly"));
+}
+
+void SegmentedVectorTest::release()
+{
+    // Setup
+    SegmentedVector<QString, ::SegmentSize> vector;
+    for (int i = 0; i < ::ElementCount; ++i) {
+        vector.push_back(QString::number(i));
+    }
+
+    // Exercise
+    vector.release();
+
+    // Verify: the segments are freed
+    QVERIFY(vector.empty());
+    QCOMPARE(vector.capacity(), std::size_t(0));
+    vector.push_back("Sky Dolly");
+    QCOMPARE(vector.size(), std::size_t(1));
+    QCOMPARE(vector.front(), QString("Sky Dolly"));
+}
+
+void SegmentedVectorTest::appendAndCopy()
+{
+    // Setup
+    std::vector<int> values;
+    std::vector<QString> strings;
+    for (int i = 0; i < ::ElementCount; ++i) {
+        values.push_back(i);
+        strings.push_back(QString::number(i));
+    }
+    SegmentedVector<int, ::SegmentSize> vector;
+    SegmentedVector<QString, ::SegmentSize> stringVector;
+    vector.push_back(-1);
+
+    // Exercise: append across segment boundaries
+    vector.append(values.data(), values.size());
+    stringVector.append(strings.data(), strings.size());
+    std::vector<int> copiedValues(::ElementCount - 2);
+    vector.copy(3, copiedValues.size(), copiedValues.data());
+    std::vector<QString> copiedStrings(::ElementCount);
+    stringVector.copy(0, copiedStrings.size(), copiedStrings.data());
+
+    // Verify
+    QCOMPARE(vector.size(), std::size_t(::ElementCount + 1));
+    QCOMPARE(vector.front(), -1);
+    for (int i = 0; i < ::ElementCount; ++i) {
+        QCOMPARE(vector[i + 1], i);
+        QCOMPARE(stringVector[i], QString::number(i));
+    }
+    for (std::size_t i = 0; i < copiedValues.size(); ++i) {
+        QCOMPARE(copiedValues[i], static_cast<int>(i) + 2);
+    }
+    QCOMPARE(copiedStrings, strings);
+}
+
+void SegmentedVectorTest::copyAndMove()
+{
+    // Setup
+    SegmentedVector<QString, ::SegmentSize> vector;
+    for (int i = 0; i < ::ElementCount; ++i) {
+        vector.push_back(QString::number(i));
+    }
+
+    // Exercise
+    SegmentedVector<QString, ::SegmentSize> copy {vector};
+    SegmentedVector<QString, ::SegmentSize> moved {std::move(vector)};
+
+    // Verify
+    QCOMPARE(copy.size(), std::size_t(::ElementCount));
+    QCOMPARE(moved.size(), std::size_t(::ElementCount));
+    QVERIFY(std::equal(copy.cbegin(), copy.cend(), moved.cbegin()));
+}
+
+void SegmentedVectorTest::sort()
+{
+    // Setup
+    SegmentedVector<int, ::SegmentSize> vector;
+    for (int i = ::ElementCount; i > 0; --i) {
+        vector.push_back(i);
+    }
+
+    // Exercise
+    std::sort(vector.begin(), vector.end());
+
+    // Verify
+    QVERIFY(std::is_sorted(vector.cbegin(), vector.cend()));
+    QCOMPARE(vector.front(), 1);
+    QCOMPARE(vector.back(), ::ElementCount);
+}
+
+QTEST_MAIN(SegmentedVectorTest)
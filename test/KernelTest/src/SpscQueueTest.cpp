@@ -0,0 +1,160 @@
+/**
+ * Sky Dolly - The Black Sheep for Your Flight Recordings
+ *
+ * Copyright (c) 2020 - 2025 Oliver Knoll
+ *
+ * MIT License
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this
+ * software and associated documentation files (the "Software"), to deal in the Software
+ * without restriction, including without limitation the rights to use, copy, modify, merge,
+ * publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons
+ * to whom the Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or
+ * substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED *AS IS*, WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR
+ * PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE
+ * FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+ * OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ */
+#include <thread>
+#include <cstddef>
+
+#include <QTest>
+
+#include <Kernel/SpscQueue.h>
+#include "SpscQueueTest.h"
+
+namespace
+{
+    constexpr std::size_t Capacity = 8;
+    constexpr int ConcurrentElementCount = 100000;
+}
+
+// PRIVATE SLOTS
+
+void SpscQueueTest::initTestCase()
+{}
+
+void SpscQueueTest::cleanupTestCase()
+{}
+
+void SpscQueueTest::pushPop()
+{
+    // Setup
+    SpscQueue<int> queue {::Capacity};
+
+    // Exercise
+    const bool pushed1 = queue.tryPush(1);
+    const bool pushed2 = queue.tryPush(2);
+    const bool pushed3 = queue.tryPush(3);
+
+    // Verify
+    QVERIFY(pushed1);
+    QVERIFY(pushed2);
+    QVERIFY(pushed3);
+    QCOMPARE(queue.size(), std::size_t(3));
+
+    int value {0};
+    QVERIFY(queue.tryPop(value));
+    QCOMPARE(value, 1);
+    QVERIFY(queue.tryPop(value));
+    QCOMPARE(value, 2);
+    QVERIFY(queue.tryPop(value));
+    QCOMPARE(value, 3);
+    QVERIFY(!queue.tryPop(value));
+    QCOMPARE(queue.size(), std::size_t(0));
+}
+
+void SpscQueueTest::full()
+{
+    // Setup
+    SpscQueue<int> queue {::Capacity - 1};
+    QCOMPARE(queue.capacity(), ::Capacity);
+
+    // Exercise
+    for (int i = 0; i < static_cast<int>(::Capacity); ++i) {
+        QVERIFY(queue.tryPush(i));
+    }
+    const bool pushedWhenFull = queue.tryPush(-1);
+
+    // Verify
+    QVERIFY(!pushedWhenFull);
+    QCOMPARE(queue.size(), ::Capacity);
+
+    int value {0};
+    QVERIFY(queue.tryPop(value));
+    QCOMPARE(value, 0);
+    QVERIFY(queue.tryPush(42));
+}
+
+void SpscQueueTest::consumeAll()
+{
+    // Setup
+    SpscQueue<int> queue {::Capacity};
+    // Wrap around the ring buffer
+    for (int i = 0; i < 6; ++i) {
+        QVERIFY(queue.tryPush(i));
+    }
+    int value {0};
+    for (int i = 0; i < 6; ++i) {
+        QVERIFY(queue.tryPop(value));
+    }
+    for (int i = 0; i < 5; ++i) {
+        QVERIFY(queue.tryPush(i));
+    }
+
+    // Exercise
+    int expected {0};
+    bool ordered {true};
+    const std::size_t count = queue.consumeAll([&expected, &ordered](int element) {
+        ordered = ordered && element == expected;
+        ++expected;
+    });
+
+    // Verify
+    QCOMPARE(count, std::size_t(5));
+    QVERIFY(ordered);
+    QCOMPARE(queue.size(), std::size_t(0));
+    QVERIFY(!queue.tryPop(value));
+}
+
+void SpscQueueTest::concurrentProducerConsumer()
+{
+    // Setup
+    SpscQueue<int> queue {::Capacity};
+    std::thread producer([&queue]() {
+        for (int i = 0; i < ::ConcurrentElementCount; ++i) {
+            while (!queue.tryPush(i)) {
+                std::this_thread::yield();
+            }
+        }
+    });
+
+    // Exercise
+    int expected {0};
+    bool ordered {true};
+    while (expected < ::ConcurrentElementCount) {
+        queue.consumeAll([&expected, &ordered](int element) {
+            ordered = ordered && element == expected;
+            ++expected;
+        });
+        int value {0};
+        if (expected < ::ConcurrentElementCount && queue.tryPop(value)) {
+            ordered = ordered && value == expected;
+            ++expected;
+        }
+    }
+    producer.join();
+
+    // Verify
+    QVERIFY(ordered);
+    QCOMPARE(expected, ::ConcurrentElementCount);
+    QCOMPARE(queue.size(), std::size_t(0));
+}
+
+QTEST_MAIN(SpscQueueTest)
@@ -0,0 +1,186 @@
+/**
+ * Sky Dolly - The Black Sheep for Your Flight Recordings
+ *
+ * Copyright (c) 2020 - 2025 Oliver Knoll
+ *
+ * MIT License
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this
+ * software and associated documentation files (the "Software"), to deal in the Software
+ * without restriction, including without limitation the rights to use, copy, modify, merge,
+ * publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons
+ * to whom the Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or
+ * substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED *AS IS*, WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR
+ * PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE
+ * FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+ * OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ */
+#include <algorithm>
+#include <vector>
+#include <thread>
+#include <chrono>
+#include <set>
+#include <cstdint>
+
+#include <QTest>
+#include <QBuffer>
+#include <QByteArray>
+#include <QJsonDocument>
+#include <QJsonObject>
+#include <QJsonArray>
+
+#include <Kernel/Trace.h>
+#include "TraceTest.h"
+
+namespace
+{
+    constexpr int ThreadCount = 4;
+    constexpr int EventsPerThread = 100;
+}
+
+// PRIVATE SLOTS
+
+void TraceTest::initTestCase()
+{}
+
+void TraceTest::cleanupTestCase()
+{
+    Trace::setEnabled(false);
+    Trace::clear();
+}
+
+void TraceTest::init()
+{
+    Trace::setEnabled(false);
+    Trace::clear();
+}
+
+void TraceTest::disabled()
+{
+    // Exercise
+    {
+        Trace::Scope trace {Trace::Replay, "Frame"};
+    }
+    Trace::counter(Trace::Recording, "Samples", 42);
+    Trace::instant(Trace::UserInterface, "Refresh");
+
+    // Verify
+    QVERIFY(!Trace::isEnabled());
+    QVERIFY(Trace::getEvents().empty());
+}
+
+void TraceTest::scope()
+{
+    // Setup
+    Trace::setEnabled(true);
+    const auto start = Trace::now();
+
+    // Exercise
+    {
+        Trace::Scope trace {Trace::Replay, "Frame"};
+        std::this_thread::sleep_for(std::chrono::milliseconds(2));
+    }
+
+    // Verify
+    const auto events = Trace::getEvents();
+    QCOMPARE(events.size(), std::size_t(1));
+    const auto &event = events.front();
+    QCOMPARE(event.type, Trace::Type::Complete);
+    QCOMPARE(QByteArray(event.category), QByteArray(Trace::Replay));
+    QCOMPARE(QByteArray(event.name), QByteArray("Frame"));
+    QVERIFY(event.timestamp >= start);
+    QVERIFY(event.duration >= 2000);
+}
+
+void TraceTest::counterAndInstant()
+{
+    // Setup
+    Trace::setEnabled(true);
+
+    // Exercise
+    Trace::counter(Trace::Recording, "Samples", 42);
+    Trace::instant(Trace::UserInterface, "Refresh");
+
+    // Verify
+    const auto events = Trace::getEvents();
+    QCOMPARE(events.size(), std::size_t(2));
+    QCOMPARE(events[0].type, Trace::Type::Counter);
+    QCOMPARE(events[0].value, std::int64_t(42));
+    QCOMPARE(events[1].type, Trace::Type::Instant);
+    QVERIFY(events[1].timestamp >= events[0].timestamp);
+}
+
+void TraceTest::threads()
+{
+    // Setup
+    Trace::setEnabled(true);
+    std::vector<std::thread> threads;
+
+    // Exercise
+    for (int i = 0; i < ::ThreadCount; ++i) {
+        threads.emplace_back([]() {
+            for (int j = 0; j < ::EventsPerThread; ++j) {
+                Trace::Scope trace {Trace::Persistence, "Query"};
+            }
+        });
+    }
+    for (auto &thread : threads) {
+        thread.join();
+    }
+
+    // Verify
+    const auto events = Trace::getEvents();
+    QCOMPARE(events.size(), std::size_t(::ThreadCount * ::EventsPerThread));
+    std::set<std::uint32_t> threadIds;
+    for (const auto &event : events) {
+        threadIds.insert(event.threadId);
+    }
+    QCOMPARE(threadIds.size(), std::size_t(::ThreadCount));
+    QCOMPARE(Trace::getDroppedEventCount(), std::size_t(0));
+}
+
+void TraceTest::exportChromeTrace()
+{
+    // Setup
+    Trace::setEnabled(true);
+    {
+        Trace::Scope trace {Trace::Import, "Import \"flights\""};
+    }
+    Trace::counter(Trace::Recording, "Samples", 7);
+    QByteArray json;
+    QBuffer buffer {&json};
+    buffer.open(QIODevice::WriteOnly);
+
+    // Exercise
+    const bool ok = Trace::exportChromeTrace(buffer);
+
+    // Verify
+    QVERIFY(ok);
+    QJsonParseError error;
+    const QJsonDocument document = QJsonDocument::fromJson(json, &error);
+    QCOMPARE(error.error, QJsonParseError::NoError);
+    const QJsonArray traceEvents = document.object().value("traceEvents").toArray();
+    QJsonObject complete;
+    QJsonObject counter;
+    for (const auto &value : traceEvents) {
+        const QJsonObject object = value.toObject();
+        const QString phase = object.value("ph").toString();
+        if (phase == "X") {
+            complete = object;
+        } else if (phase == "C") {
+            counter = object;
+        }
+    }
+    QCOMPARE(complete.value("name").toString(), QString("Import \"flights\""));
+    QCOMPARE(complete.value("cat").toString(), QString(Trace::Import));
+    QVERIFY(complete.contains("dur"));
+    QCOMPARE(counter.value("args").toObject().value("value").toInt(), 7);
+}
+
+QTEST_MAIN(TraceTest)
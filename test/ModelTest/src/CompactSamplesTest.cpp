@@ -0,0 +1,263 @@
+/**
+ * Sky Dolly - The Black Sheep for Your Flight Recordings
+ *
+ * Copyright (c) 2020 - 2025 Oliver Knoll
+ *
+ * MIT License
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this
+ * software and associated documentation files (the "Software"), to deal in the Software
+ * without restriction, including without limitation the rights to use, copy, modify, merge,
+ * publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons
+ * to whom the Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or
+ * substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED *AS IS*, WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR
+ * PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE
+ * FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+ * OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ */
+#include <vector>
+#include <thread>
+#include <utility>
+#include <cstdint>
+#include <cmath>
+
+#include <QtTest>
+
+#include <Model/TimeVariableData.h>
+#include <Model/AircraftInfo.h>
+#include <Model/Position.h>
+#include <Model/PositionData.h>
+#include <Model/Engine.h>
+#include <Model/EngineData.h>
+#include <Model/SampleCursor.h>
+#include "CompactSamplesTest.h"
+
+namespace
+{
+    // More than one block of compactly encoded samples
+    constexpr int SampleCount = 10000;
+    // Sample interval [milliseconds]
+    constexpr std::int64_t SampleInterval = 33;
+    constexpr std::int64_t Duration = (::SampleCount - 1) * ::SampleInterval;
+
+    // The maximum error of the interpolated position [degrees] and altitude [feet]
+    constexpr double MaxDegreesError = 2e-7;
+    constexpr double MaxAltitudeError = 0.01;
+
+    constexpr int ThreadCount = 4;
+
+    void initialise(Position &position) noexcept
+    {
+        for (int i = 0; i < ::SampleCount; ++i) {
+            const double t = static_cast<double>(i) / ::SampleCount;
+            PositionData positionData {47.123456789 + t * 0.3, 179.9 - t * 0.1, 1000.0 + std::sin(t * 10.0) * 3000.0};
+            positionData.indicatedAltitude = positionData.altitude + 12.3;
+            positionData.calibratedIndicatedAltitude = positionData.altitude - 4.5;
+            positionData.pressureAltitude = positionData.altitude + 45.6;
+            positionData.timestamp = i * ::SampleInterval;
+            position.upsertLast(positionData);
+        }
+    }
+
+    void initialise(Engine &engine) noexcept
+    {
+        for (int i = 0; i < ::SampleCount; ++i) {
+            EngineData engineData {static_cast<std::int16_t>(i % 200 - 100), static_cast<std::int16_t>(i % 100), static_cast<std::uint8_t>(i % 256), 50};
+            engineData.electricalMasterBattery1 = true;
+            engineData.generalEngineStarter2 = i % 2 == 0;
+            engineData.generalEngineCombustion4 = i % 3 == 0;
+            engineData.timestamp = i * ::SampleInterval;
+            engine.upsertLast(engineData);
+        }
+    }
+}
+
+// PRIVATE SLOTS
+
+void CompactSamplesTest::positionInterpolation()
+{
+    // Setup
+    Position position {m_aircraftInfo};
+    Position compactPosition {m_aircraftInfo};
+    ::initialise(position);
+    ::initialise(compactPosition);
+
+    // Exercise
+    const bool compact = compactPosition.compact();
+
+    // Verify
+    QVERIFY(compact);
+    QVERIFY(compactPosition.isCompact());
+    QCOMPARE(compactPosition.count(), position.count());
+    QVERIFY(compactPosition.getMemoryUsage() < position.getMemoryUsage());
+    SampleCursor<PositionData> cursor;
+    SampleCursor<PositionData> compactCursor;
+    for (std::int64_t timestamp = 0; timestamp <= ::Duration; timestamp += 17) {
+        const auto &positionData = position.interpolate(timestamp, TimeVariableData::Access::Linear, cursor);
+        const auto &compactPositionData = compactPosition.interpolate(timestamp, TimeVariableData::Access::Linear, compactCursor);
+        QCOMPARE(compactPositionData.timestamp, positionData.timestamp);
+        QVERIFY(std::abs(compactPositionData.latitude - positionData.latitude) < ::MaxDegreesError);
+        QVERIFY(std::abs(compactPositionData.longitude - positionData.longitude) < ::MaxDegreesError);
+        QVERIFY(std::abs(compactPositionData.altitude - positionData.altitude) < ::MaxAltitudeError);
+        QVERIFY(std::abs(compactPositionData.pressureAltitude - positionData.pressureAltitude) < ::MaxAltitudeError);
+        QCOMPARE(compactCursor.index, cursor.index);
+    }
+    // Only the support points have been decoded
+    QVERIFY(compactPosition.isCompact());
+}
+
+void CompactSamplesTest::engineInterpolation()
+{
+    // Setup
+    Engine engine {m_aircraftInfo};
+    Engine compactEngine {m_aircraftInfo};
+    ::initialise(engine);
+    ::initialise(compactEngine);
+
+    // Exercise
+    const bool compact = compactEngine.compact();
+
+    // Verify: the engine data is encoded losslessly
+    QVERIFY(compact);
+    for (const auto access : {TimeVariableData::Access::Linear, TimeVariableData::Access::DiscreteSeek}) {
+        SampleCursor<EngineData> cursor;
+        SampleCursor<EngineData> compactCursor;
+        for (std::int64_t timestamp = 0; timestamp <= ::Duration; timestamp += 17) {
+            const auto &engineData = engine.interpolate(timestamp, access, cursor);
+            const auto &compactEngineData = compactEngine.interpolate(timestamp, access, compactCursor);
+            QCOMPARE(compactEngineData.timestamp, engineData.timestamp);
+            QCOMPARE(compactEngineData.throttleLeverPosition1, engineData.throttleLeverPosition1);
+            QCOMPARE(compactEngineData.propellerLeverPosition1, engineData.propellerLeverPosition1);
+            QCOMPARE(compactEngineData.mixtureLeverPosition1, engineData.mixtureLeverPosition1);
+            QCOMPARE(compactEngineData.cowlFlapPosition1, engineData.cowlFlapPosition1);
+            QCOMPARE(compactEngineData.electricalMasterBattery1, engineData.electricalMasterBattery1);
+            QCOMPARE(compactEngineData.generalEngineStarter2, engineData.generalEngineStarter2);
+            QCOMPARE(compactEngineData.generalEngineCombustion4, engineData.generalEngineCombustion4);
+        }
+    }
+}
+
+void CompactSamplesTest::firstAndLast()
+{
+    // Setup
+    Engine engine {m_aircraftInfo};
+    ::initialise(engine);
+    const auto firstTimestamp = engine.getFirst().timestamp;
+    const auto lastTimestamp = engine.getLast().timestamp;
+
+    // Exercise
+    engine.compact();
+
+    // Verify
+    QCOMPARE(engine.getFirst().timestamp, firstTimestamp);
+    QCOMPARE(engine.getLast().timestamp, lastTimestamp);
+    QCOMPARE(engine.count(), std::size_t(::SampleCount));
+}
+
+void CompactSamplesTest::modificationDiscardsCompactData()
+{
+    // Setup
+    Engine engine {m_aircraftInfo};
+    ::initialise(engine);
+    engine.compact();
+    EngineData engineData {42};
+    engineData.timestamp = ::Duration + ::SampleInterval;
+
+    // Exercise
+    engine.upsertLast(engineData);
+
+    // Verify
+    QVERIFY(!engine.isCompact());
+    QCOMPARE(engine.count(), std::size_t(::SampleCount + 1));
+    QCOMPARE(engine[0].throttleLeverPosition1, std::int16_t(-100));
+    QCOMPARE(engine.getLast().throttleLeverPosition1, std::int16_t(42));
+}
+
+void CompactSamplesTest::concurrentExpand()
+{
+    // Setup
+    Engine engine {m_aircraftInfo};
+    ::initialise(engine);
+    std::int64_t expectedSum {0};
+    for (const auto &engineData : std::as_const(engine)) {
+        expectedSum += engineData.throttleLeverPosition1;
+    }
+    engine.compact();
+    const Engine &constEngine = engine;
+
+    // Exercise: the const access by all threads decodes the samples on demand
+    std::vector<std::int64_t> sums(::ThreadCount, 0);
+    std::vector<std::thread> threads;
+    for (int t = 0; t < ::ThreadCount; ++t) {
+        threads.emplace_back([&constEngine, &sums, t]() {
+            for (std::size_t i = 0; i < constEngine.count(); ++i) {
+                sums[t] += constEngine[i].throttleLeverPosition1;
+            }
+        });
+    }
+    for (auto &thread : threads) {
+        thread.join();
+    }
+
+    // Verify: the decoded samples have replaced the compact encoding
+    QVERIFY(!constEngine.isCompact());
+    QCOMPARE(constEngine.count(), std::size_t(::SampleCount));
+    for (const auto sum : sums) {
+        QCOMPARE(sum, expectedSum);
+    }
+}
+
+void CompactSamplesTest::memoryUsage()
+{
+    // Setup
+    Position position {m_aircraftInfo};
+    ::initialise(position);
+    const std::size_t memoryUsage = position.getMemoryUsage();
+
+    // Exercise
+    position.compact();
+    const std::size_t compactMemoryUsage = position.getMemoryUsage();
+    // Decodes all samples
+    const Position &constPosition = position;
+    const double firstLatitude = constPosition[0].latitude;
+    const std::size_t expandedMemoryUsage = position.getMemoryUsage();
+    position.compact();
+    const std::size_t recompactedMemoryUsage = position.getMemoryUsage();
+
+    // Verify: the compact encoding is released once decoded, and re-created by compacting again
+    QVERIFY(compactMemoryUsage < memoryUsage);
+    QVERIFY(expandedMemoryUsage <= memoryUsage);
+    QCOMPARE(recompactedMemoryUsage, compactMemoryUsage);
+    QVERIFY(position.isCompact());
+    QCOMPARE(position.count(), std::size_t(::SampleCount));
+    QVERIFY(std::abs(position.getFirst().latitude - firstLatitude) < ::MaxDegreesError);
+}
+
+void CompactSamplesTest::precisionNotGuaranteed()
+{
+    // Setup: the altitude offset within the same block exceeds the supported range
+    Position position {m_aircraftInfo};
+    PositionData positionData {47.0, 8.0, -1000.0};
+    positionData.timestamp = 0;
+    position.upsertLast(positionData);
+    positionData.altitude = 200000.0;
+    positionData.timestamp = ::SampleInterval;
+    position.upsertLast(positionData);
+
+    // Exercise
+    const bool compact = position.compact();
+
+    // Verify: the position data is left as is
+    QVERIFY(!compact);
+    QVERIFY(!position.isCompact());
+    QCOMPARE(position.count(), std::size_t(2));
+    QCOMPARE(position[1].altitude, 200000.0);
+}
+
+QTEST_MAIN(CompactSamplesTest)
@@ -0,0 +1,108 @@
+/**
+ * Sky Dolly - The Black Sheep for Your Flight Recordings
+ *
+ * Copyright (c) 2020 - 2025 Oliver Knoll
+ *
+ * MIT License
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this
+ * software and associated documentation files (the "Software"), to deal in the Software
+ * without restriction, including without limitation the rights to use, copy, modify, merge,
+ * publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons
+ * to whom the Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or
+ * substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED *AS IS*, WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR
+ * PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE
+ * FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+ * OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ */
+#include <vector>
+#include <type_traits>
+#include <cstdint>
+#include <cstddef>
+
+#include <QtTest>
+
+#include <Model/AircraftInfo.h>
+#include <Model/Position.h>
+#include <Model/PositionData.h>
+#include <Model/EngineData.h>
+#include <Model/AttitudeData.h>
+#include <Model/PrimaryFlightControlData.h>
+#include <Model/SecondaryFlightControlData.h>
+#include <Model/AircraftHandleData.h>
+#include <Model/LightData.h>
+#include "SampleCopyTest.h"
+
+namespace
+{
+    // About one hour of samples, recorded at 30 Hz
+    constexpr int SampleCount = 100000;
+
+    static_assert(std::is_trivially_copyable_v<PositionData>);
+    static_assert(std::is_trivially_copyable_v<EngineData>);
+    static_assert(std::is_trivially_copyable_v<AttitudeData>);
+    static_assert(std::is_trivially_copyable_v<PrimaryFlightControlData>);
+    static_assert(std::is_trivially_copyable_v<SecondaryFlightControlData>);
+    static_assert(std::is_trivially_copyable_v<AircraftHandleData>);
+    static_assert(std::is_trivially_copyable_v<LightData>);
+
+    std::vector<PositionData> createSamples() noexcept
+    {
+        std::vector<PositionData> samples;
+        samples.reserve(::SampleCount);
+        for (int i = 0; i < ::SampleCount; ++i) {
+            PositionData positionData {47.0 + i * 1e-5, 8.0 - i * 2e-5, 1000.0 + i * 0.1};
+            positionData.timestamp = i * 33;
+            samples.push_back(positionData);
+        }
+        return samples;
+    }
+}
+
+// PRIVATE SLOTS
+
+void SampleCopyTest::copyData()
+{
+    // Setup
+    Position position {m_aircraftInfo};
+    position.setData(::createSamples());
+
+    // Exercise
+    const auto all = position.copyData();
+    const auto some = position.copyData(4095, 3);
+
+    // Verify
+    QCOMPARE(all.size(), std::size_t(::SampleCount));
+    for (std::size_t i = 0; i < all.size(); ++i) {
+        QCOMPARE(all[i].timestamp, position[i].timestamp);
+        QCOMPARE(all[i].latitude, position[i].latitude);
+    }
+    QCOMPARE(some.size(), std::size_t(3));
+    QCOMPARE(some.front().timestamp, std::int64_t(4095 * 33));
+    QCOMPARE(some.back().timestamp, std::int64_t(4097 * 33));
+}
+
+void SampleCopyTest::setData()
+{
+    // Setup
+    Position position {m_aircraftInfo};
+    position.upsertLast(PositionData {1.0, 2.0, 3.0});
+    const auto samples = ::createSamples();
+
+    // Exercise
+    position.setData(samples);
+
+    // Verify
+    QCOMPARE(position.count(), std::size_t(::SampleCount));
+    QCOMPARE(position.getFirst().timestamp, samples.front().timestamp);
+    QCOMPARE(position.getLast().timestamp, samples.back().timestamp);
+    QCOMPARE(position.getLast().altitude, samples.back().altitude);
+}
+
+QTEST_MAIN(SampleCopyTest)
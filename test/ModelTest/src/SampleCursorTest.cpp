@@ -0,0 +1,196 @@
+/**
+ * Sky Dolly - The Black Sheep for Your Flight Recordings
+ *
+ * Copyright (c) 2020 - 2025 Oliver Knoll
+ *
+ * MIT License
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this
+ * software and associated documentation files (the "Software"), to deal in the Software
+ * without restriction, including without limitation the rights to use, copy, modify, merge,
+ * publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons
+ * to whom the Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or
+ * substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED *AS IS*, WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR
+ * PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE
+ * FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+ * OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ */
+#include <memory>
+#include <vector>
+#include <thread>
+#include <cstdint>
+
+#include <QtTest>
+
+#include <Model/TimeVariableData.h>
+#include <Model/AircraftInfo.h>
+#include <Model/Engine.h>
+#include <Model/EngineData.h>
+#include <Model/SampleCursor.h>
+#include "SampleCursorTest.h"
+
+namespace
+{
+    constexpr int SampleCount = 100;
+    // Sample interval [milliseconds]
+    constexpr std::int64_t SampleInterval = 100;
+    // The throttle lever position increases by this amount per sample interval
+    constexpr std::int16_t ThrottleIncrement = 10;
+    constexpr int ThreadCount = 4;
+
+    // The expected (linearly interpolated) throttle lever position at the given timestamp
+    constexpr std::int16_t expectedThrottleLeverPosition(std::int64_t timestamp) noexcept
+    {
+        return static_cast<std::int16_t>(timestamp * ::ThrottleIncrement / ::SampleInterval);
+    }
+}
+
+// PRIVATE SLOTS
+
+void SampleCursorTest::initTestCase()
+{
+    m_engine = std::make_unique<Engine>(m_aircraftInfo);
+    for (int i = 0; i < ::SampleCount; ++i) {
+        EngineData data {static_cast<std::int16_t>(i * ::ThrottleIncrement)};
+        data.timestamp = i * ::SampleInterval;
+        m_engine->upsertLast(data);
+    }
+}
+
+void SampleCursorTest::cleanupTestCase()
+{
+    m_engine.reset();
+}
+
+void SampleCursorTest::interpolate_data()
+{
+    QTest::addColumn<std::int64_t>("timestamp");
+    QTest::addColumn<std::int16_t>("expected");
+
+    QTest::newRow("First sample") << std::int64_t(0) << ::expectedThrottleLeverPosition(0);
+    QTest::newRow("Between samples") << std::int64_t(150) << ::expectedThrottleLeverPosition(150);
+    QTest::newRow("Sample") << std::int64_t(4200) << ::expectedThrottleLeverPosition(4200);
+    QTest::newRow("Last sample") << (::SampleCount - 1) * ::SampleInterval << ::expectedThrottleLeverPosition((::SampleCount - 1) * ::SampleInterval);
+}
+
+void SampleCursorTest::interpolate()
+{
+    // Setup
+    QFETCH(std::int64_t, timestamp);
+    QFETCH(std::int16_t, expected);
+    SampleCursor<EngineData> cursor;
+
+    // Exercise
+    const auto &data = m_engine->interpolate(timestamp, TimeVariableData::Access::Linear, cursor);
+
+    // Verify
+    QCOMPARE(data.throttleLeverPosition1, expected);
+    QCOMPARE(data.timestamp, timestamp);
+    QCOMPARE(cursor.timestamp, timestamp);
+    QVERIFY(cursor.index != SkySearch::InvalidIndex);
+}
+
+void SampleCursorTest::interleavedCursors()
+{
+    // Setup
+    SampleCursor<EngineData> cursor1;
+    SampleCursor<EngineData> cursor2;
+    constexpr std::int64_t Offset = 5000;
+
+    // Exercise & verify: the two consumers access the data at different timestamps,
+    // each with its own search hint
+    for (std::int64_t timestamp = 0; timestamp + Offset < (::SampleCount - 1) * ::SampleInterval; timestamp += 50) {
+        const auto &data1 = m_engine->interpolate(timestamp, TimeVariableData::Access::Linear, cursor1);
+        const auto &data2 = m_engine->interpolate(timestamp + Offset, TimeVariableData::Access::Linear, cursor2);
+        QCOMPARE(data1.throttleLeverPosition1, ::expectedThrottleLeverPosition(timestamp));
+        QCOMPARE(data2.throttleLeverPosition1, ::expectedThrottleLeverPosition(timestamp + Offset));
+        QCOMPARE(cursor1.index, static_cast<int>(timestamp / ::SampleInterval));
+        QCOMPARE(cursor2.index, static_cast<int>((timestamp + Offset) / ::SampleInterval));
+    }
+}
+
+void SampleCursorTest::cursorBoundToComponent()
+{
+    // Setup
+    Engine otherEngine {m_aircraftInfo};
+    EngineData otherData {1000};
+    otherData.timestamp = 0;
+    otherEngine.upsertLast(otherData);
+    SampleCursor<EngineData> cursor;
+
+    // Exercise
+    m_engine->interpolate(0, TimeVariableData::Access::Linear, cursor);
+    const auto &data = otherEngine.interpolate(0, TimeVariableData::Access::Linear, cursor);
+
+    // Verify: the cached result of the first engine must not be returned
+    QCOMPARE(data.throttleLeverPosition1, otherData.throttleLeverPosition1);
+    QCOMPARE(cursor.component, static_cast<const void *>(&otherEngine));
+}
+
+void SampleCursorTest::clearThenRefill()
+{
+    // Setup
+    Engine engine {m_aircraftInfo};
+    for (int i = 0; i < ::SampleCount; ++i) {
+        EngineData data {static_cast<std::int16_t>(i * ::ThrottleIncrement)};
+        data.timestamp = i * ::SampleInterval;
+        engine.upsertLast(data);
+    }
+    SampleCursor<EngineData> cursor;
+    constexpr std::int64_t Timestamp = 150;
+    engine.interpolate(Timestamp, TimeVariableData::Access::Linear, cursor);
+    const auto generation = engine.getGeneration();
+
+    // Exercise: same component (address) and sample count, but different sampled data
+    engine.clear();
+    for (int i = 0; i < ::SampleCount; ++i) {
+        EngineData data {static_cast<std::int16_t>(2 * i * ::ThrottleIncrement)};
+        data.timestamp = i * ::SampleInterval;
+        engine.upsertLast(data);
+    }
+    const auto &data = engine.interpolate(Timestamp, TimeVariableData::Access::Linear, cursor);
+
+    // Verify: the cached result of the previous sampled data must not be returned
+    QVERIFY(engine.getGeneration() != generation);
+    QCOMPARE(cursor.generation, engine.getGeneration());
+    QCOMPARE(data.throttleLeverPosition1, static_cast<std::int16_t>(2 * ::expectedThrottleLeverPosition(Timestamp)));
+}
+
+void SampleCursorTest::concurrentInterpolation()
+{
+    // Setup
+    std::vector<std::thread> threads;
+    std::vector<int> errors(::ThreadCount, 0);
+    const auto &engine = *m_engine;
+
+    // Exercise
+    for (int i = 0; i < ::ThreadCount; ++i) {
+        threads.emplace_back([&engine, &errors, i]() {
+            SampleCursor<EngineData> cursor;
+            // Each thread starts at a different timestamp
+            const std::int64_t start = i * ::SampleInterval / 10;
+            for (std::int64_t timestamp = start; timestamp < (::SampleCount - 1) * ::SampleInterval; timestamp += 10) {
+                const auto &data = engine.interpolate(timestamp, TimeVariableData::Access::Linear, cursor);
+                if (data.throttleLeverPosition1 != ::expectedThrottleLeverPosition(timestamp)) {
+                    ++errors[i];
+                }
+            }
+        });
+    }
+    for (auto &thread : threads) {
+        thread.join();
+    }
+
+    // Verify
+    for (int i = 0; i < ::ThreadCount; ++i) {
+        QCOMPARE(errors[i], 0);
+    }
+}
+
+QTEST_MAIN(SampleCursorTest)
@@ -0,0 +1,172 @@
+/**
+ * Sky Dolly - The Black Sheep for Your Flight Recordings
+ *
+ * Copyright (c) 2020 - 2025 Oliver Knoll
+ *
+ * MIT License
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this
+ * software and associated documentation files (the "Software"), to deal in the Software
+ * without restriction, including without limitation the rights to use, copy, modify, merge,
+ * publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons
+ * to whom the Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or
+ * substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED *AS IS*, WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR
+ * PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE
+ * FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+ * OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ */
+#include <vector>
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cmath>
+#include <numbers>
+
+#include <QtTest>
+
+#include <Model/PositionData.h>
+#include <Model/TrackSimplification.h>
+#include "TrackSimplificationTest.h"
+
+Q_DECLARE_METATYPE(TrackSimplification::Interpolation)
+
+namespace
+{
+    // Sample interval [milliseconds]
+    constexpr std::int64_t SampleInterval = 50;
+    constexpr int SampleCount = 2400;
+    // Approximately 10 meters per sample interval [degrees]
+    constexpr double LatitudeIncrement = 0.00009;
+
+    // A straight climb towards north at constant speed
+    std::vector<PositionData> createStraightLine() noexcept
+    {
+        std::vector<PositionData> data;
+        for (int i = 0; i < ::SampleCount; ++i) {
+            PositionData position {47.0 + i * ::LatitudeIncrement, 8.0, 1000.0 + i * 0.5};
+            position.timestamp = i * ::SampleInterval;
+            data.push_back(position);
+        }
+        return data;
+    }
+
+    // Turns and altitude changes, with slightly irregular sample intervals
+    std::vector<PositionData> createCurvedTrack() noexcept
+    {
+        std::vector<PositionData> data;
+        std::int64_t timestamp {0};
+        for (int i = 0; i < ::SampleCount; ++i) {
+            const double angle = 2.0 * std::numbers::pi * i / 600.0;
+            PositionData position {47.0 + 0.01 * std::sin(angle), 8.0 + 0.015 * std::sin(angle / 3.0), 3000.0 + 200.0 * std::cos(angle)};
+            position.timestamp = timestamp;
+            data.push_back(position);
+            timestamp += ::SampleInterval + (i % 3) * 4;
+        }
+        return data;
+    }
+
+    // Returns the maximum deviation of the original data from the track reconstructed from the kept indices
+    double maximumDeviation(const std::vector<PositionData> &data, const std::vector<std::size_t> &indices, TrackSimplification::Interpolation interpolation) noexcept
+    {
+        double maxDistance {0.0};
+        const std::size_t keptCount = indices.size();
+        for (std::size_t k = 0; k + 1 < keptCount; ++k) {
+            const std::size_t i1 = indices[k];
+            const std::size_t i2 = indices[k + 1];
+            const std::size_t i0 = k > 0 ? indices[k - 1] : i1;
+            const std::size_t i3 = k + 2 < keptCount ? indices[k + 2] : i2;
+            for (std::size_t i = i1 + 1; i < i2; ++i) {
+                const double d = interpolation == TrackSimplification::Interpolation::Linear ?
+                    TrackSimplification::synchronisedDistance(data[i1], data[i2], data[i]) :
+                    TrackSimplification::hermiteDistance(data[i0], data[i1], data[i2], data[i3], data[i]);
+                maxDistance = std::max(maxDistance, d);
+            }
+        }
+        return maxDistance;
+    }
+}
+
+// PRIVATE SLOTS
+
+void TrackSimplificationTest::smallInput()
+{
+    // Setup
+    std::vector<PositionData> data {PositionData {47.0, 8.0, 1000.0}, PositionData {47.1, 8.1, 1100.0}};
+    data[1].timestamp = 1000;
+
+    // Exercise
+    const auto indices = TrackSimplification::simplifiedIndices(data, TrackSimplification::DefaultMaxDeviation);
+    const auto empty = TrackSimplification::simplify(std::vector<PositionData> {}, TrackSimplification::DefaultMaxDeviation);
+
+    // Verify
+    QCOMPARE(indices.size(), std::size_t(2));
+    QCOMPARE(indices[0], std::size_t(0));
+    QCOMPARE(indices[1], std::size_t(1));
+    QVERIFY(empty.empty());
+}
+
+void TrackSimplificationTest::straightLine_data()
+{
+    QTest::addColumn<TrackSimplification::Interpolation>("interpolation");
+    QTest::addColumn<std::size_t>("maxCount");
+
+    QTest::newRow("Linear") << TrackSimplification::Interpolation::Linear << std::size_t(2);
+    // The Hermite interpolation eases in and out at the first and last sample, so a few
+    // additional samples are kept near the start and end of the track
+    QTest::newRow("Hermite") << TrackSimplification::Interpolation::Hermite << std::size_t(::SampleCount / 100);
+}
+
+void TrackSimplificationTest::straightLine()
+{
+    // Setup
+    QFETCH(TrackSimplification::Interpolation, interpolation);
+    QFETCH(std::size_t, maxCount);
+    const auto data = ::createStraightLine();
+
+    // Exercise
+    const auto simplifiedData = TrackSimplification::simplify(data, TrackSimplification::DefaultMaxDeviation, interpolation);
+
+    // Verify
+    QVERIFY(simplifiedData.size() <= maxCount);
+    QCOMPARE(simplifiedData.front().timestamp, data.front().timestamp);
+    QCOMPARE(simplifiedData.back().timestamp, data.back().timestamp);
+}
+
+void TrackSimplificationTest::maxDeviation_data()
+{
+    QTest::addColumn<TrackSimplification::Interpolation>("interpolation");
+    QTest::addColumn<double>("maxDeviation");
+
+    QTest::newRow("Linear 0.5m") << TrackSimplification::Interpolation::Linear << 0.5;
+    QTest::newRow("Linear 2m") << TrackSimplification::Interpolation::Linear << 2.0;
+    QTest::newRow("Linear 10m") << TrackSimplification::Interpolation::Linear << 10.0;
+    QTest::newRow("Hermite 0.5m") << TrackSimplification::Interpolation::Hermite << 0.5;
+    QTest::newRow("Hermite 2m") << TrackSimplification::Interpolation::Hermite << 2.0;
+    QTest::newRow("Hermite 10m") << TrackSimplification::Interpolation::Hermite << 10.0;
+}
+
+void TrackSimplificationTest::maxDeviation()
+{
+    // Setup
+    QFETCH(TrackSimplification::Interpolation, interpolation);
+    QFETCH(double, maxDeviation);
+    const auto data = ::createCurvedTrack();
+
+    // Exercise
+    const auto indices = TrackSimplification::simplifiedIndices(data, maxDeviation, interpolation);
+
+    // Verify
+    QVERIFY(indices.size() < data.size());
+    QCOMPARE(indices.front(), std::size_t(0));
+    QCOMPARE(indices.back(), data.size() - 1);
+    QVERIFY(std::is_sorted(indices.cbegin(), indices.cend()));
+    QVERIFY(::maximumDeviation(data, indices, interpolation) <= maxDeviation);
+}
+
+QTEST_MAIN(TrackSimplificationTest)
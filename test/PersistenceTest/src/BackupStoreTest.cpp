@@ -0,0 +1,191 @@
+/**
+ * Sky Dolly - The Black Sheep for Your Flight Recordings
+ *
+ * Copyright (c) 2020 - 2025 Oliver Knoll
+ *
+ * MIT License
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this
+ * software and associated documentation files (the "Software"), to deal in the Software
+ * without restriction, including without limitation the rights to use, copy, modify, merge,
+ * publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons
+ * to whom the Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or
+ * substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED *AS IS*, WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR
+ * PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE
+ * FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+ * OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ */
+#include <cstdint>
+
+#include <QtTest>
+#include <QString>
+#include <QByteArray>
+#include <QFile>
+#include <QFileInfo>
+#include <QTemporaryDir>
+
+#include <BackupStore.h>
+#include "BackupStoreTest.h"
+
+namespace
+{
+    // Spans several chunks (of about 32 KiB on average)
+    constexpr qsizetype LogbookSize {1024 * 1024};
+    // Hash, offset, compressed size, size
+    constexpr qint64 IndexRecordSize {20 + 8 + 4 + 4};
+    constexpr const char *IndexFilePath {"/Chunks/chunks.index"};
+    constexpr const char *PackFilePath {"/Chunks/chunks.pack"};
+
+    // Pseudo-random (xorshift), but reproducible content
+    QByteArray createLogbookData() noexcept
+    {
+        QByteArray data;
+        data.reserve(::LogbookSize);
+        std::uint64_t state {0x536b79446f6c6c79};
+        while (data.size() < ::LogbookSize) {
+            state ^= state << 13;
+            state ^= state >> 7;
+            state ^= state << 17;
+            for (int i = 0; i < 8; ++i) {
+                data.append(static_cast<char>((state >> (i * 8)) & 0xff));
+            }
+        }
+        return data;
+    }
+
+    // A small edit in the middle, which shifts the remaining data
+    QByteArray createEditedLogbookData() noexcept
+    {
+        QByteArray data = createLogbookData();
+        data.insert(::LogbookSize / 2, QByteArray("Sky Dolly").repeated(10));
+        return data;
+    }
+
+    bool writeFile(const QString &filePath, const QByteArray &data) noexcept
+    {
+        QFile file {filePath};
+        return file.open(QIODevice::WriteOnly) && file.write(data) == data.size();
+    }
+
+    bool appendFile(const QString &filePath, const QByteArray &data) noexcept
+    {
+        QFile file {filePath};
+        return file.open(QIODevice::Append) && file.write(data) == data.size();
+    }
+
+    QByteArray readFile(const QString &filePath) noexcept
+    {
+        QFile file {filePath};
+        return file.open(QIODevice::ReadOnly) ? file.readAll() : QByteArray();
+    }
+}
+
+// PRIVATE SLOTS
+
+void BackupStoreTest::deduplication()
+{
+    // Setup
+    QTemporaryDir directory;
+    const QString logbookPath = directory.filePath("Logbook.sdlog");
+    const QString editedLogbookPath = directory.filePath("Edited.sdlog");
+    QVERIFY(::writeFile(logbookPath, ::createLogbookData()));
+    QVERIFY(::writeFile(editedLogbookPath, ::createEditedLogbookData()));
+    const QString indexFilePath = directory.path() + ::IndexFilePath;
+    BackupStore backupStore {directory.path()};
+    int progressCount {0};
+
+    // Exercise
+    const bool added = backupStore.add(logbookPath, directory.filePath("1.sdbackup"), [&progressCount](std::int64_t, std::int64_t) {
+        ++progressCount;
+        return true;
+    });
+    const qint64 indexSize = QFileInfo(indexFilePath).size();
+    const bool addedAgain = backupStore.add(logbookPath, directory.filePath("2.sdbackup"));
+    const qint64 unchangedIndexSize = QFileInfo(indexFilePath).size();
+    const bool editedAdded = backupStore.add(editedLogbookPath, directory.filePath("3.sdbackup"));
+    const qint64 editedIndexSize = QFileInfo(indexFilePath).size();
+
+    // Verify: the same content results in the same chunks, and a small edit only in a few new chunks
+    QVERIFY(added);
+    QVERIFY(addedAgain);
+    QVERIFY(editedAdded);
+    const qint64 chunkCount = indexSize / ::IndexRecordSize;
+    const qint64 newChunkCount = (editedIndexSize - indexSize) / ::IndexRecordSize;
+    QCOMPARE(indexSize % ::IndexRecordSize, qint64(0));
+    QVERIFY(chunkCount > 10);
+    QCOMPARE(::readFile(directory.filePath("2.sdbackup")), ::readFile(directory.filePath("1.sdbackup")));
+    QCOMPARE(unchangedIndexSize, indexSize);
+    QVERIFY(newChunkCount > 0);
+    QVERIFY(newChunkCount <= 2);
+    // The progress is reported at most once per percent (and upon completion)
+    QVERIFY(progressCount > 0);
+    QVERIFY(progressCount <= 101);
+}
+
+void BackupStoreTest::restore()
+{
+    // Setup
+    QTemporaryDir directory;
+    const QString logbookPath = directory.filePath("Logbook.sdlog");
+    const QString editedLogbookPath = directory.filePath("Edited.sdlog");
+    QVERIFY(::writeFile(logbookPath, ::createLogbookData()));
+    QVERIFY(::writeFile(editedLogbookPath, ::createEditedLogbookData()));
+    BackupStore backupStore {directory.path()};
+    QVERIFY(backupStore.add(logbookPath, directory.filePath("1.sdbackup")));
+    QVERIFY(backupStore.add(editedLogbookPath, directory.filePath("2.sdbackup")));
+
+    // Exercise
+    const bool restored = backupStore.restore(directory.filePath("1.sdbackup"), directory.filePath("Restored/Logbook.sdlog"));
+    const bool editedRestored = backupStore.restore(directory.filePath("2.sdbackup"), directory.filePath("Restored/Edited.sdlog"));
+    // The restored logbook must not exist yet
+    const bool overwritten = backupStore.restore(directory.filePath("2.sdbackup"), directory.filePath("Restored/Logbook.sdlog"));
+
+    // Verify
+    QVERIFY(restored);
+    QVERIFY(editedRestored);
+    QVERIFY(!overwritten);
+    QCOMPARE(::readFile(directory.filePath("Restored/Logbook.sdlog")), ::createLogbookData());
+    QCOMPARE(::readFile(directory.filePath("Restored/Edited.sdlog")), ::createEditedLogbookData());
+}
+
+void BackupStoreTest::interruptedBackup()
+{
+    // Setup
+    QTemporaryDir directory;
+    const QString logbookPath = directory.filePath("Logbook.sdlog");
+    const QString editedLogbookPath = directory.filePath("Edited.sdlog");
+    QVERIFY(::writeFile(logbookPath, ::createLogbookData()));
+    QVERIFY(::writeFile(editedLogbookPath, ::createEditedLogbookData()));
+    const QString indexFilePath = directory.path() + ::IndexFilePath;
+    BackupStore backupStore {directory.path()};
+    QVERIFY(backupStore.add(logbookPath, directory.filePath("1.sdbackup")));
+    // Incompletely written chunks and index record, e.g. due to a power failure
+    QVERIFY(::appendFile(directory.path() + ::PackFilePath, QByteArray(100, 'x')));
+    QVERIFY(::appendFile(indexFilePath, QByteArray(10, 'x')));
+
+    // Exercise
+    const bool cancelled = !backupStore.add(editedLogbookPath, directory.filePath("2.sdbackup"), [](std::int64_t, std::int64_t) {
+        return false;
+    });
+    const bool added = backupStore.add(editedLogbookPath, directory.filePath("3.sdbackup"));
+    const bool restored = backupStore.restore(directory.filePath("1.sdbackup"), directory.filePath("Logbook-1.sdlog"));
+    const bool editedRestored = backupStore.restore(directory.filePath("3.sdbackup"), directory.filePath("Edited-3.sdlog"));
+
+    // Verify: the incomplete index record has been discarded, and the cancelled backup left no manifest behind
+    QVERIFY(cancelled);
+    QVERIFY(!QFileInfo::exists(directory.filePath("2.sdbackup")));
+    QVERIFY(added);
+    QCOMPARE(QFileInfo(indexFilePath).size() % ::IndexRecordSize, qint64(0));
+    QVERIFY(restored);
+    QVERIFY(editedRestored);
+    QCOMPARE(::readFile(directory.filePath("Logbook-1.sdlog")), ::createLogbookData());
+    QCOMPARE(::readFile(directory.filePath("Edited-3.sdlog")), ::createEditedLogbookData());
+}
+
+QTEST_MAIN(BackupStoreTest)
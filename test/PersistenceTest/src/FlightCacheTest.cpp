@@ -0,0 +1,295 @@
+/**
+ * Sky Dolly - The Black Sheep for Your Flight Recordings
+ *
+ * Copyright (c) 2020 - 2025 Oliver Knoll
+ *
+ * MIT License
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this
+ * software and associated documentation files (the "Software"), to deal in the Software
+ * without restriction, including without limitation the rights to use, copy, modify, merge,
+ * publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons
+ * to whom the Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or
+ * substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED *AS IS*, WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR
+ * PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE
+ * FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+ * OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ */
+#include <vector>
+#include <cstdint>
+#include <cstddef>
+
+#include <QtTest>
+#include <QString>
+#include <QFile>
+#include <QDir>
+#include <QTemporaryDir>
+#include <QStandardPaths>
+#include <QSqlDatabase>
+#include <QSqlQuery>
+
+#include <Model/Aircraft.h>
+#include <Model/Position.h>
+#include <Model/PositionData.h>
+#include <Model/Engine.h>
+#include <Model/EngineData.h>
+#include <Model/Light.h>
+#include <Model/LightData.h>
+#include <FlightCache.h>
+#include "FlightCacheTest.h"
+
+namespace
+{
+    constexpr std::int64_t FlightId {42};
+    constexpr int SampleCount {10000};
+    constexpr const char *LogbookId {"0123456789abcdef0123456789abcdef"};
+    constexpr const char *DriverName {"QSQLITE"};
+    constexpr const char *ConnectionName {"FlightCacheTest"};
+
+    std::vector<Aircraft> createAircraft() noexcept
+    {
+        std::vector<Aircraft> aircraft;
+        aircraft.emplace_back(1);
+        aircraft.emplace_back(2);
+        for (int i = 0; i < ::SampleCount; ++i) {
+            PositionData positionData {47.0 + i * 1e-5, 8.0, 1000.0 + i};
+            positionData.timestamp = i * 33;
+            aircraft[0].getPosition().upsertLast(positionData);
+            EngineData engineData {static_cast<std::int16_t>(i % 1000)};
+            engineData.timestamp = i * 33;
+            aircraft[1].getEngine().upsertLast(engineData);
+        }
+        LightData lightData;
+        lightData.timestamp = 1000;
+        aircraft[1].getLight().upsertLast(lightData);
+        return aircraft;
+    }
+
+    std::vector<Aircraft> createEmptyAircraft() noexcept
+    {
+        std::vector<Aircraft> aircraft;
+        aircraft.emplace_back(1);
+        aircraft.emplace_back(2);
+        return aircraft;
+    }
+
+    QString getCacheFilePath(const QTemporaryDir &directory) noexcept
+    {
+        return directory.path() + "/" + QString::number(::FlightId) + ".flight";
+    }
+
+    // Creates a new logbook at the given path, with a random identity like the logbook migration,
+    // and writes (or reads) the cached flight with the given operation
+    template <typename Operation>
+    bool withNewLogbook(const QString &logbookPath, Operation &&operation) noexcept
+    {
+        bool ok {false};
+        QFile::remove(logbookPath);
+        {
+            QSqlDatabase db = QSqlDatabase::addDatabase(::DriverName, ::ConnectionName);
+            db.setDatabaseName(logbookPath);
+            if (db.open()) {
+                {
+                    QSqlQuery query {db};
+                    ok = query.exec("create table metadata (logbook_id text);") &&
+                         query.exec("insert into metadata (logbook_id) values (lower(hex(randomblob(16))));");
+                }
+                if (ok) {
+                    FlightCache flightCache {db};
+                    ok = operation(flightCache);
+                }
+                db.close();
+            }
+        }
+        QSqlDatabase::removeDatabase(::ConnectionName);
+        return ok;
+    }
+
+    // Creates the aircraft and sample tables, with the two aircraft of the cached flight
+    // and their position and engine samples
+    bool createFlight(QSqlDatabase &db) noexcept
+    {
+        QSqlQuery query {db};
+        bool ok = query.exec("create table aircraft (id integer primary key, flight_id integer, seq_nr integer);") &&
+                  query.exec(QString("insert into aircraft (id, flight_id, seq_nr) values (1, %1, 1), (2, %1, 2);").arg(::FlightId));
+        for (const char *table : {"position", "attitude", "engine", "primary_flight_control", "secondary_flight_control", "handle", "light"}) {
+            ok = ok && query.exec(QString("create table %1 (aircraft_id integer, timestamp integer, primary key(aircraft_id, timestamp));").arg(table));
+        }
+        ok = ok && query.exec("insert into position (aircraft_id, timestamp) values (1, 0), (1, 33);") &&
+                   query.exec("insert into engine (aircraft_id, timestamp) values (2, 0);");
+        return ok;
+    }
+}
+
+// PRIVATE SLOTS
+
+void FlightCacheTest::writeAndRead()
+{
+    // Setup
+    QTemporaryDir directory;
+    FlightCache flightCache {directory.path(), ::LogbookId};
+    const auto aircraft = ::createAircraft();
+    auto restored = ::createEmptyAircraft();
+
+    // Exercise
+    const bool written = flightCache.write(::FlightId, aircraft);
+    const bool read = flightCache.read(::FlightId, restored);
+
+    // Verify
+    QVERIFY(written);
+    QVERIFY(read);
+    const auto &position = restored[0].getPosition();
+    const auto &engine = restored[1].getEngine();
+    QCOMPARE(position.count(), std::size_t(::SampleCount));
+    QCOMPARE(engine.count(), std::size_t(::SampleCount));
+    QCOMPARE(restored[1].getLight().count(), std::size_t(1));
+    QCOMPARE(restored[0].getEngine().count(), std::size_t(0));
+    for (int i = 0; i < ::SampleCount; ++i) {
+        QCOMPARE(position[i].timestamp, std::int64_t(i * 33));
+        QCOMPARE(position[i].latitude, aircraft[0].getPosition()[i].latitude);
+        QCOMPARE(position[i].altitude, aircraft[0].getPosition()[i].altitude);
+        QCOMPARE(engine[i].throttleLeverPosition1, std::int16_t(i % 1000));
+    }
+    QCOMPARE(restored[1].getLight().getFirst().timestamp, std::int64_t(1000));
+}
+
+void FlightCacheTest::aircraftMismatch()
+{
+    // Setup
+    QTemporaryDir directory;
+    FlightCache flightCache {directory.path(), ::LogbookId};
+    flightCache.write(::FlightId, ::createAircraft());
+    std::vector<Aircraft> otherAircraft;
+    otherAircraft.emplace_back(1);
+    otherAircraft.emplace_back(3);
+    std::vector<Aircraft> fewerAircraft;
+    fewerAircraft.emplace_back(1);
+    auto restored = ::createEmptyAircraft();
+
+    // Exercise
+    const bool otherRead = flightCache.read(::FlightId, otherAircraft);
+    const bool fewerRead = flightCache.read(::FlightId, fewerAircraft);
+    const bool otherFlightRead = flightCache.read(::FlightId + 1, restored);
+
+    // Verify
+    QVERIFY(!otherRead);
+    QVERIFY(!fewerRead);
+    QVERIFY(!otherFlightRead);
+    QCOMPARE(otherAircraft[0].getPosition().count(), std::size_t(0));
+    QCOMPARE(fewerAircraft[0].getPosition().count(), std::size_t(0));
+}
+
+void FlightCacheTest::corruptFile()
+{
+    // Setup
+    QTemporaryDir directory;
+    FlightCache flightCache {directory.path(), ::LogbookId};
+    flightCache.write(::FlightId, ::createAircraft());
+    QFile file {::getCacheFilePath(directory)};
+    QVERIFY(file.open(QIODevice::ReadWrite));
+    QVERIFY(file.seek(file.size() / 2));
+    QByteArray data = file.read(8);
+    data[0] = static_cast<char>(data[0] ^ 0x01);
+    QVERIFY(file.seek(file.size() / 2));
+    file.write(data);
+    file.close();
+    auto restored = ::createEmptyAircraft();
+
+    // Exercise
+    const bool read = flightCache.read(::FlightId, restored);
+
+    // Verify
+    QVERIFY(!read);
+    QCOMPARE(restored[0].getPosition().count(), std::size_t(0));
+}
+
+void FlightCacheTest::invalidate()
+{
+    // Setup
+    QTemporaryDir directory;
+    FlightCache flightCache {directory.path(), ::LogbookId};
+    flightCache.write(::FlightId, ::createAircraft());
+    auto restored = ::createEmptyAircraft();
+
+    // Exercise
+    flightCache.invalidate(::FlightId);
+    const bool read = flightCache.read(::FlightId, restored);
+
+    // Verify
+    QVERIFY(!read);
+    QVERIFY(!QFile::exists(::getCacheFilePath(directory)));
+}
+
+void FlightCacheTest::recreatedLogbook()
+{
+    // Setup
+    QStandardPaths::setTestModeEnabled(true);
+    QTemporaryDir directory;
+    const QString logbookPath = directory.filePath("FlightCacheTest.sdlog");
+    const QString cacheFilePath = FlightCache::getDirectoryPath(logbookPath) + "/" + QString::number(::FlightId) + ".flight";
+    const bool written = ::withNewLogbook(logbookPath, [](FlightCache &flightCache) {
+        return flightCache.write(::FlightId, ::createAircraft());
+    });
+    const bool cached = QFile::exists(cacheFilePath);
+    auto restored = ::createEmptyAircraft();
+
+    // Exercise: the flight with the same ID of the re-created logbook must not be read from the cache
+    bool read {true};
+    ::withNewLogbook(logbookPath, [&restored, &read](FlightCache &flightCache) {
+        read = flightCache.read(::FlightId, restored);
+        return true;
+    });
+
+    // Verify
+    QVERIFY(written);
+    QVERIFY(cached);
+    QVERIFY(!read);
+    QCOMPARE(restored[0].getPosition().count(), std::size_t(0));
+    QVERIFY(!QFile::exists(cacheFilePath));
+
+    QDir(FlightCache::getDirectoryPath(logbookPath)).removeRecursively();
+}
+
+void FlightCacheTest::modifiedLogbook()
+{
+    // Setup
+    QStandardPaths::setTestModeEnabled(true);
+    QTemporaryDir directory;
+    const QString logbookPath = directory.filePath("FlightCacheTest.sdlog");
+    const QString cacheFilePath = FlightCache::getDirectoryPath(logbookPath) + "/" + QString::number(::FlightId) + ".flight";
+    auto unmodified = ::createEmptyAircraft();
+    auto modified = ::createEmptyAircraft();
+    bool written {false};
+    bool unmodifiedRead {false};
+    bool modifiedRead {true};
+
+    // Exercise: samples added to the logbook by other means than the services invalidate the cached flight
+    ::withNewLogbook(logbookPath, [&](FlightCache &flightCache) {
+        QSqlDatabase db = QSqlDatabase::database(::ConnectionName);
+        bool ok = ::createFlight(db);
+        written = ok && flightCache.write(::FlightId, ::createAircraft());
+        unmodifiedRead = flightCache.read(::FlightId, unmodified);
+        QSqlQuery query {db};
+        ok = ok && query.exec("insert into position (aircraft_id, timestamp) values (1, 66);");
+        modifiedRead = flightCache.read(::FlightId, modified);
+        return ok;
+    });
+
+    // Verify
+    QVERIFY(written);
+    QVERIFY(unmodifiedRead);
+    QCOMPARE(unmodified[0].getPosition().count(), std::size_t(::SampleCount));
+    QVERIFY(!modifiedRead);
+    QCOMPARE(modified[0].getPosition().count(), std::size_t(0));
+    QVERIFY(!QFile::exists(cacheFilePath));
+
+    QDir(FlightCache::getDirectoryPath(logbookPath)).removeRecursively();
+}
+
+QTEST_MAIN(FlightCacheTest)
@@ -0,0 +1,135 @@
+/**
+ * Sky Dolly - The Black Sheep for Your Flight Recordings
+ *
+ * Copyright (c) 2020 - 2025 Oliver Knoll
+ *
+ * MIT License
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this
+ * software and associated documentation files (the "Software"), to deal in the Software
+ * without restriction, including without limitation the rights to use, copy, modify, merge,
+ * publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons
+ * to whom the Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or
+ * substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED *AS IS*, WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR
+ * PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE
+ * FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+ * OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ */
+#include <cstdint>
+#include <cstddef>
+
+#include <QTest>
+#include <QString>
+
+#include <Model/AircraftType.h>
+#include <Model/Enumeration.h>
+#include <Model/SimType.h>
+#include <LookupStatistics.h>
+#include <LookupCache.h>
+#include "LookupCacheTest.h"
+
+namespace
+{
+    // The cache is destroyed - together with its counters - as soon as the last test
+    // case releases it, so each test case starts with a fresh cache
+    constexpr const char *ConnectionName {"LookupCacheTest"};
+
+    inline AircraftType createAircraftType(int wingSpan = 36) noexcept
+    {
+        return {"Boeing 737", "Airplane", wingSpan, SimType::EngineType::Jet, 2};
+    }
+
+    inline Enumeration createEnumeration() noexcept
+    {
+        Enumeration enumeration {"LocationType"};
+        enumeration.addItem({1, "S", "System"});
+        enumeration.addItem({2, "I", "Import"});
+        enumeration.addItem({3, "U", "User"});
+        return enumeration;
+    }
+}
+
+// PRIVATE SLOTS
+
+void LookupCacheTest::getAircraftType()
+{
+    // Setup
+    const auto cache = LookupCache::getInstance(::ConnectionName);
+
+    // Exercise
+    const auto miss = cache->getAircraftType("Boeing 737");
+    cache->putAircraftType(::createAircraftType());
+    const auto hit = cache->getAircraftType("Boeing 737");
+
+    // Verify
+    QVERIFY(!miss.has_value());
+    QVERIFY(hit.has_value());
+    QCOMPARE(hit->wingSpan, 36);
+    const auto statistics = cache->getStatistics();
+    QCOMPARE(statistics.aircraftTypeHitCount, std::uint64_t {1});
+    QCOMPARE(statistics.aircraftTypeMissCount, std::uint64_t {1});
+}
+
+void LookupCacheTest::containsAircraftType()
+{
+    // Setup
+    const auto cache = LookupCache::getInstance(::ConnectionName);
+    cache->putAircraftType(::createAircraftType());
+
+    // Exercise & verify: only an aircraft type with equal attributes is considered to be cached
+    QVERIFY(cache->containsAircraftType(::createAircraftType()));
+    QVERIFY(!cache->containsAircraftType(::createAircraftType(35)));
+    const auto statistics = cache->getStatistics();
+    QCOMPARE(statistics.aircraftTypeHitCount, std::uint64_t {1});
+    QCOMPARE(statistics.aircraftTypeMissCount, std::uint64_t {1});
+}
+
+void LookupCacheTest::getEnumeration()
+{
+    // Setup
+    const auto cache = LookupCache::getInstance(::ConnectionName);
+
+    // Exercise
+    QVERIFY(!cache->getEnumeration("LocationType", Enumeration::Order::Id).has_value());
+    cache->putEnumeration(::createEnumeration(), Enumeration::Order::Id);
+    const auto enumeration = cache->getEnumeration("LocationType", Enumeration::Order::Id);
+
+    // Verify
+    QVERIFY(enumeration.has_value());
+    QCOMPARE(enumeration->getName(), QString("LocationType"));
+    QCOMPARE(enumeration->count(), std::size_t {3});
+    QCOMPARE(enumeration->getItemBySymId("I").id, std::int64_t {2});
+    // Each order is cached separately
+    QVERIFY(cache->containsEnumeration("LocationType", Enumeration::Order::Id));
+    QVERIFY(!cache->containsEnumeration("LocationType", Enumeration::Order::Name));
+    const auto statistics = cache->getStatistics();
+    QCOMPARE(statistics.enumerationHitCount, std::uint64_t {1});
+    QCOMPARE(statistics.enumerationMissCount, std::uint64_t {1});
+}
+
+void LookupCacheTest::invalidate()
+{
+    // Setup
+    const auto cache = LookupCache::getInstance(::ConnectionName);
+    cache->putAircraftType(::createAircraftType());
+    cache->putEnumeration(::createEnumeration(), Enumeration::Order::SymId);
+    QVERIFY(cache->getAircraftType("Boeing 737").has_value());
+
+    // Exercise
+    LookupCache::invalidate(::ConnectionName);
+
+    // Verify: the cached values are gone, but the counters are kept
+    QVERIFY(!cache->containsEnumeration("LocationType", Enumeration::Order::SymId));
+    QVERIFY(!cache->getAircraftType("Boeing 737").has_value());
+    const auto statistics = cache->getStatistics();
+    QCOMPARE(statistics.aircraftTypeHitCount, std::uint64_t {1});
+    QCOMPARE(statistics.aircraftTypeMissCount, std::uint64_t {1});
+}
+
+QTEST_MAIN(LookupCacheTest)
@@ -0,0 +1,225 @@
+/**
+ * Sky Dolly - The Black Sheep for Your Flight Recordings
+ *
+ * Copyright (c) 2020 - 2025 Oliver Knoll
+ *
+ * MIT License
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this
+ * software and associated documentation files (the "Software"), to deal in the Software
+ * without restriction, including without limitation the rights to use, copy, modify, merge,
+ * publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons
+ * to whom the Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or
+ * substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED *AS IS*, WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR
+ * PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE
+ * FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+ * OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ */
+#include <vector>
+#include <utility>
+#include <cstdint>
+
+#include <QtTest>
+#include <QString>
+#include <QVariant>
+#include <QTemporaryDir>
+#include <QSqlDatabase>
+#include <QSqlQuery>
+
+#include <SqlBackup.h>
+#include "SqlBackupTest.h"
+
+namespace
+{
+    // Spans several batches of the backup (4096 rows each)
+    constexpr int RowCount {10000};
+    constexpr std::int64_t BatchSize {4096};
+    // The number of restarts after which all data is copied within a single transaction
+    constexpr int MaxRestarts {3};
+    constexpr const char *DriverName {"QSQLITE"};
+    constexpr const char *WriterConnectionName {"SqlBackupTest-Writer"};
+    constexpr const char *ReaderConnectionName {"SqlBackupTest-Reader"};
+    constexpr const char *LogbookId {"0123456789abcdef0123456789abcdef"};
+
+    QVariant queryValue(const QString &filePath, const QString &sql) noexcept
+    {
+        QVariant value;
+        {
+            QSqlDatabase db = QSqlDatabase::addDatabase(::DriverName, ::ReaderConnectionName);
+            db.setDatabaseName(filePath);
+            if (db.open()) {
+                QSqlQuery query {db};
+                if (query.exec(sql) && query.next()) {
+                    value = query.value(0);
+                }
+            }
+            db.close();
+        }
+        QSqlDatabase::removeDatabase(::ReaderConnectionName);
+        return value;
+    }
+
+    // Creates a logbook with a sample table spanning several batches, in WAL mode, such that
+    // concurrent writers are not blocked by the read transaction of the backup
+    bool createLogbook(const QString &logbookPath) noexcept
+    {
+        bool ok {false};
+        {
+            QSqlDatabase db = QSqlDatabase::addDatabase(::DriverName, ::WriterConnectionName);
+            db.setDatabaseName(logbookPath);
+            if (db.open()) {
+                QSqlQuery query {db};
+                ok = query.exec("pragma journal_mode = wal;") &&
+                     query.exec("create table sample (id integer primary key, value integer);") &&
+                     query.exec("create index sample_idx1 on sample (value);") &&
+                     query.exec("create table metadata (logbook_id text);");
+                if (ok) {
+                    query.prepare("insert into metadata (logbook_id) values (:logbook_id);");
+                    query.bindValue(":logbook_id", ::LogbookId);
+                    ok = query.exec();
+                }
+                if (ok) {
+                    ok = db.transaction();
+                }
+                if (ok) {
+                    query.prepare("insert into sample (value) values (:value);");
+                    for (int i = 0; ok && i < ::RowCount; ++i) {
+                        query.bindValue(":value", i);
+                        ok = query.exec();
+                    }
+                    ok = ok && db.commit();
+                }
+                query.finish();
+                db.close();
+            }
+        }
+        QSqlDatabase::removeDatabase(::WriterConnectionName);
+        return ok;
+    }
+
+    // Counts the copy attempts: the first batch of the (first) sample table is reported once per attempt
+    int getAttemptCount(const std::vector<std::pair<std::int64_t, std::int64_t>> &progress) noexcept
+    {
+        int count {0};
+        for (const auto &[copied, total] : progress) {
+            if (copied == ::BatchSize) {
+                ++count;
+            }
+        }
+        return count;
+    }
+}
+
+// PRIVATE SLOTS
+
+void SqlBackupTest::initTestCase()
+{}
+
+void SqlBackupTest::cleanupTestCase()
+{}
+
+void SqlBackupTest::roundTrip()
+{
+    // Setup
+    QTemporaryDir directory;
+    const QString logbookPath = directory.filePath("Logbook.sdlog");
+    const QString backupPath = directory.filePath("Backup.sdlog");
+    QVERIFY(::createLogbook(logbookPath));
+    std::vector<std::pair<std::int64_t, std::int64_t>> progress;
+    SqlBackup backup {logbookPath, backupPath};
+
+    // Exercise
+    const bool ok = backup.run([&progress](std::int64_t copied, std::int64_t total) {
+        progress.emplace_back(copied, total);
+        return true;
+    });
+
+    // Verify
+    QVERIFY(ok);
+    QCOMPARE(::queryValue(backupPath, "select count(*) from sample;").toInt(), ::RowCount);
+    QCOMPARE(::queryValue(backupPath, "select sum(value) from sample;"), ::queryValue(logbookPath, "select sum(value) from sample;"));
+    QCOMPARE(::queryValue(backupPath, "select count(*) from sqlite_master where type = 'index' and name = 'sample_idx1';").toInt(), 1);
+    QCOMPARE(::queryValue(backupPath, "pragma auto_vacuum;").toInt(), 2);
+    // The backup is a logbook of its own
+    QVERIFY(::queryValue(backupPath, "select logbook_id from metadata;").toString() != QString(::LogbookId));
+    QCOMPARE(::getAttemptCount(progress), 1);
+    QVERIFY(progress.size() > 2);
+    QCOMPARE(progress.back().first, progress.back().second);
+}
+
+void SqlBackupTest::restart()
+{
+    // Setup
+    QTemporaryDir directory;
+    const QString logbookPath = directory.filePath("Logbook.sdlog");
+    const QString backupPath = directory.filePath("Backup.sdlog");
+    QVERIFY(::createLogbook(logbookPath));
+    std::vector<std::pair<std::int64_t, std::int64_t>> progress;
+    SqlBackup backup {logbookPath, backupPath};
+    bool ok {false};
+
+    // Exercise: the logbook is modified once, in between two batches
+    {
+        QSqlDatabase writer = QSqlDatabase::addDatabase(::DriverName, ::WriterConnectionName);
+        writer.setDatabaseName(logbookPath);
+        QVERIFY(writer.open());
+        ok = backup.run([&progress, &writer](std::int64_t copied, std::int64_t total) {
+            if (progress.empty()) {
+                QSqlQuery query {writer};
+                query.exec("insert into sample (value) values (-1);");
+            }
+            progress.emplace_back(copied, total);
+            return true;
+        });
+        writer.close();
+    }
+    QSqlDatabase::removeDatabase(::WriterConnectionName);
+
+    // Verify: the backup has been restarted and contains the modification
+    QVERIFY(ok);
+    QCOMPARE(::getAttemptCount(progress), 2);
+    QCOMPARE(::queryValue(backupPath, "select count(*) from sample;").toInt(), ::RowCount + 1);
+    QCOMPARE(::queryValue(backupPath, "select count(*) from sample where value = -1;").toInt(), 1);
+}
+
+void SqlBackupTest::singleTransactionFallback()
+{
+    // Setup
+    QTemporaryDir directory;
+    const QString logbookPath = directory.filePath("Logbook.sdlog");
+    const QString backupPath = directory.filePath("Backup.sdlog");
+    QVERIFY(::createLogbook(logbookPath));
+    std::vector<std::pair<std::int64_t, std::int64_t>> progress;
+    SqlBackup backup {logbookPath, backupPath};
+    bool ok {false};
+
+    // Exercise: the logbook is modified in between any two batches
+    {
+        QSqlDatabase writer = QSqlDatabase::addDatabase(::DriverName, ::WriterConnectionName);
+        writer.setDatabaseName(logbookPath);
+        QVERIFY(writer.open());
+        ok = backup.run([&progress, &writer](std::int64_t copied, std::int64_t total) {
+            QSqlQuery query {writer};
+            query.exec("insert into sample (value) values (-1);");
+            progress.emplace_back(copied, total);
+            return true;
+        });
+        writer.close();
+    }
+    QSqlDatabase::removeDatabase(::WriterConnectionName);
+
+    // Verify: after the maximum number of restarts all data has been copied within a single
+    // read transaction, which does not see the modifications made in the meantime
+    QVERIFY(ok);
+    QCOMPARE(::getAttemptCount(progress), ::MaxRestarts + 1);
+    QCOMPARE(::queryValue(backupPath, "select count(*) from sample;").toInt(), ::RowCount + ::MaxRestarts);
+    QVERIFY(::queryValue(logbookPath, "select count(*) from sample;").toInt() > ::RowCount + ::MaxRestarts);
+}
+
+QTEST_MAIN(SqlBackupTest)
@@ -0,0 +1,280 @@
+/**
+ * Sky Dolly - The Black Sheep for Your Flight Recordings
+ *
+ * Copyright (c) 2020 - 2025 Oliver Knoll
+ *
+ * MIT License
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this
+ * software and associated documentation files (the "Software"), to deal in the Software
+ * without restriction, including without limitation the rights to use, copy, modify, merge,
+ * publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons
+ * to whom the Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or
+ * substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED *AS IS*, WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR
+ * PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE
+ * FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+ * OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ */
+#include <memory>
+#include <cstdint>
+#include <cstddef>
+
+#include <QTest>
+#include <QString>
+#include <QTemporaryDir>
+#include <QSqlDatabase>
+#include <QSqlQuery>
+#include <QVariant>
+
+#include <SqlStatementCache.h>
+#include "SqlStatementCacheTest.h"
+
+namespace
+{
+    constexpr const char *DriverName {"QSQLITE"};
+    constexpr const char *ConnectionName {"SqlStatementCacheTest"};
+    constexpr const char *ReaderConnectionName {"SqlStatementCacheTest-Reader"};
+    constexpr const char *WriterConnectionName {"SqlStatementCacheTest-Writer"};
+    constexpr int SampleCount {1000};
+
+    constexpr const char *InsertSql {
+        "insert into sample (timestamp, latitude, longitude, altitude) "
+        "values (:timestamp, :latitude, :longitude, :altitude);"
+    };
+    constexpr const char *SelectByIdSql {
+        "select s.latitude, s.longitude, s.altitude "
+        "from   sample s "
+        "where  s.id = :id;"
+    };
+
+    constexpr const char *CreateTableSql {
+        "create table sample ("
+        "  id integer primary key,"
+        "  timestamp integer not null,"
+        "  latitude real,"
+        "  longitude real,"
+        "  altitude real"
+        ");"
+    };
+
+    std::int64_t timestamp {0};
+
+    // Binds and executes the sample insert, the same way as the DAOs do
+    inline bool insert(QSqlQuery &query) noexcept
+    {
+        ++::timestamp;
+        query.bindValue(":timestamp", QVariant::fromValue(::timestamp));
+        query.bindValue(":latitude", 47.0);
+        query.bindValue(":longitude", 8.0);
+        query.bindValue(":altitude", 1000.0);
+        return query.exec();
+    }
+
+    inline double selectById(QSqlQuery &query, std::int64_t id) noexcept
+    {
+        double altitude {0.0};
+        query.bindValue(":id", QVariant::fromValue(id));
+        if (query.exec() && query.next()) {
+            altitude = query.value(2).toDouble();
+        }
+        return altitude;
+    }
+}
+
+// PRIVATE SLOTS
+
+void SqlStatementCacheTest::initTestCase()
+{
+    QSqlDatabase db = QSqlDatabase::addDatabase(::DriverName, ::ConnectionName);
+    db.setDatabaseName(":memory:");
+    QVERIFY(db.open());
+    QSqlQuery query {db};
+    QVERIFY(query.exec(::CreateTableSql));
+    for (int i = 0; i < ::SampleCount; ++i) {
+        query.prepare(::InsertSql);
+        QVERIFY(::insert(query));
+    }
+}
+
+void SqlStatementCacheTest::cleanupTestCase()
+{
+    SqlStatementCache::invalidate(::ConnectionName);
+    {
+        QSqlDatabase db = QSqlDatabase::database(::ConnectionName);
+        db.close();
+    }
+    QSqlDatabase::removeDatabase(::ConnectionName);
+}
+
+void SqlStatementCacheTest::init()
+{
+    SqlStatementCache::invalidate(::ConnectionName);
+}
+
+void SqlStatementCacheTest::prepareReusesStatement()
+{
+    // Setup
+    const auto cache = SqlStatementCache::getInstance(::ConnectionName);
+
+    // Exercise
+    QSqlQuery &query1 = cache->prepare(::SelectByIdSql);
+    const double altitude1 = ::selectById(query1, 1);
+    QSqlQuery &query2 = cache->prepare(::SelectByIdSql);
+    const double altitude2 = ::selectById(query2, 2);
+
+    // Verify
+    QCOMPARE(&query1, &query2);
+    QCOMPARE(cache->getStatementCount(), std::size_t(1));
+    QCOMPARE(altitude1, 1000.0);
+    QCOMPARE(altitude2, 1000.0);
+}
+
+void SqlStatementCacheTest::getInstanceSharesCache()
+{
+    // Exercise
+    const auto cache1 = SqlStatementCache::getInstance(::ConnectionName);
+    const auto cache2 = SqlStatementCache::getInstance(::ConnectionName);
+    const auto otherCache = SqlStatementCache::getInstance("SqlStatementCacheTest-Other");
+
+    // Verify
+    QCOMPARE(cache1.get(), cache2.get());
+    QVERIFY(cache1.get() != otherCache.get());
+}
+
+void SqlStatementCacheTest::invalidateClearsStatements()
+{
+    // Setup
+    const auto cache = SqlStatementCache::getInstance(::ConnectionName);
+    cache->prepare(::InsertSql);
+    cache->prepare(::SelectByIdSql);
+    const std::size_t countBefore = cache->getStatementCount();
+
+    // Exercise
+    SqlStatementCache::invalidate(::ConnectionName);
+
+    // Verify
+    QCOMPARE(countBefore, std::size_t(2));
+    QCOMPARE(cache->getStatementCount(), std::size_t(0));
+    QVERIFY(cache->getDatabase().isOpen());
+}
+
+void SqlStatementCacheTest::finishKeepsStatements()
+{
+    // Setup
+    const auto cache = SqlStatementCache::getInstance(::ConnectionName);
+    QSqlQuery &query = cache->prepare(::SelectByIdSql);
+    ::selectById(query, 1);
+
+    // Exercise
+    const bool activeBefore = query.isActive();
+    cache->finish();
+
+    // Verify
+    QVERIFY(activeBefore);
+    QVERIFY(!query.isActive());
+    QCOMPARE(cache->getStatementCount(), std::size_t(1));
+    QCOMPARE(::selectById(cache->prepare(::SelectByIdSql), 3), 1000.0);
+}
+
+void SqlStatementCacheTest::finisherReleasesReadLock()
+{
+    // Setup
+    QTemporaryDir tempDir;
+    QVERIFY(tempDir.isValid());
+    const QString databasePath = tempDir.filePath("SqlStatementCacheTest.sqlite");
+    bool written {false};
+    double altitude {0.0};
+    std::size_t statementCount {0};
+    {
+        QSqlDatabase writerDb = QSqlDatabase::addDatabase(::DriverName, ::WriterConnectionName);
+        writerDb.setDatabaseName(databasePath);
+        // Fail immediately instead of waiting for the lock to be released
+        writerDb.setConnectOptions("QSQLITE_BUSY_TIMEOUT=0");
+        QVERIFY(writerDb.open());
+        QSqlQuery writerQuery {writerDb};
+        QVERIFY(writerQuery.exec(::CreateTableSql));
+        for (int i = 0; i < 2; ++i) {
+            writerQuery.prepare(::InsertSql);
+            QVERIFY(::insert(writerQuery));
+        }
+
+        QSqlDatabase readerDb = QSqlDatabase::addDatabase(::DriverName, ::ReaderConnectionName);
+        readerDb.setDatabaseName(databasePath);
+        QVERIFY(readerDb.open());
+        const auto cache = SqlStatementCache::getInstance(::ReaderConnectionName);
+        {
+            // A lookup which does not step the statement to its end, as the DAOs do
+            QSqlQuery &query = cache->prepare(::SelectByIdSql);
+            const SqlQueryFinisher finisher {query};
+            altitude = ::selectById(query, 1);
+        }
+
+        // Exercise
+        writerQuery.prepare(::InsertSql);
+        written = ::insert(writerQuery);
+        statementCount = cache->getStatementCount();
+
+        SqlStatementCache::invalidate(::ReaderConnectionName);
+        readerDb.close();
+        writerQuery.finish();
+        writerDb.close();
+    }
+    QSqlDatabase::removeDatabase(::ReaderConnectionName);
+    QSqlDatabase::removeDatabase(::WriterConnectionName);
+
+    // Verify
+    QCOMPARE(altitude, 1000.0);
+    QVERIFY(written);
+    QCOMPARE(statementCount, std::size_t(1));
+}
+
+void SqlStatementCacheTest::benchmarkInsertUncached()
+{
+    QBENCHMARK {
+        const auto db {QSqlDatabase::database(::ConnectionName)};
+        QSqlQuery query {db};
+        query.prepare(::InsertSql);
+        ::insert(query);
+    }
+}
+
+void SqlStatementCacheTest::benchmarkInsertCached()
+{
+    const auto cache = SqlStatementCache::getInstance(::ConnectionName);
+    QBENCHMARK {
+        QSqlQuery &query = cache->prepare(::InsertSql);
+        ::insert(query);
+    }
+}
+
+void SqlStatementCacheTest::benchmarkSelectByIdUncached()
+{
+    std::int64_t id {0};
+    QBENCHMARK {
+        const auto db {QSqlDatabase::database(::ConnectionName)};
+        QSqlQuery query {db};
+        query.setForwardOnly(true);
+        query.prepare(::SelectByIdSql);
+        ::selectById(query, id % ::SampleCount + 1);
+        ++id;
+    }
+}
+
+void SqlStatementCacheTest::benchmarkSelectByIdCached()
+{
+    const auto cache = SqlStatementCache::getInstance(::ConnectionName);
+    std::int64_t id {0};
+    QBENCHMARK {
+        QSqlQuery &query = cache->prepare(::SelectByIdSql);
+        ::selectById(query, id % ::SampleCount + 1);
+        ++id;
+    }
+}
+
+QTEST_MAIN(SqlStatementCacheTest)
@@ -0,0 +1,225 @@
+/**
+ * Sky Dolly - The Black Sheep for Your Flight Recordings
+ *
+ * Copyright (c) 2020 - 2025 Oliver Knoll
+ *
+ * MIT License
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this
+ * software and associated documentation files (the "Software"), to deal in the Software
+ * without restriction, including without limitation the rights to use, copy, modify, merge,
+ * publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons
+ * to whom the Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or
+ * substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED *AS IS*, WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR
+ * PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE
+ * FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+ * OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ */
+#include <cstdint>
+#include <cstddef>
+
+#include <QTest>
+
+#include <Model/Aircraft.h>
+#include <Model/Position.h>
+#include <Model/PositionData.h>
+#include <Model/Engine.h>
+#include <Model/EngineData.h>
+#include <Model/Light.h>
+#include <Model/LightData.h>
+#include <Model/SimType.h>
+#include <PluginManager/Connect/CaptureQueue.h>
+#include <PluginManager/Connect/DeadbandTolerance.h>
+#include "CaptureQueueTest.h"
+
+namespace
+{
+    // Roughly 60 Hz
+    constexpr std::int64_t SampleIntervalMSec = 16;
+    constexpr int SampleCount = 126;
+    constexpr std::int64_t MaxIntervalMSec = 1000;
+    // More than a minute worth of samples, captured without being drained
+    constexpr int LargeSampleCount = 4000;
+
+    DeadbandTolerance createTolerance() noexcept
+    {
+        DeadbandTolerance tolerance;
+        tolerance.maxIntervalMSec = ::MaxIntervalMSec;
+        return tolerance;
+    }
+
+    LightData createLightData(std::int64_t timestamp, SimType::LightStates lightStates) noexcept
+    {
+        LightData lightData;
+        lightData.timestamp = timestamp;
+        lightData.lightStates = lightStates;
+        return lightData;
+    }
+}
+
+// PRIVATE SLOTS
+
+void CaptureQueueTest::initTestCase()
+{}
+
+void CaptureQueueTest::cleanupTestCase()
+{}
+
+void CaptureQueueTest::allSamples()
+{
+    // Setup
+    CaptureQueue captureQueue;
+    Aircraft aircraft;
+    captureQueue.setAdaptiveSamplingEnabled(false);
+    for (int i = 0; i < ::SampleCount; ++i) {
+        captureQueue.push(::createLightData(i * ::SampleIntervalMSec, SimType::LightState::Navigation));
+    }
+
+    // Exercise
+    const std::size_t appended = captureQueue.drain(aircraft);
+    const std::size_t flushed = captureQueue.flush(aircraft);
+
+    // Verify
+    QCOMPARE(appended, std::size_t(::SampleCount));
+    QCOMPARE(flushed, std::size_t(0));
+    QCOMPARE(aircraft.getLight().count(), std::size_t(::SampleCount));
+}
+
+void CaptureQueueTest::staticSamples()
+{
+    // Setup
+    CaptureQueue captureQueue;
+    Aircraft aircraft;
+    captureQueue.setAdaptiveSamplingEnabled(true, ::createTolerance());
+    for (int i = 0; i < ::SampleCount; ++i) {
+        captureQueue.push(::createLightData(i * ::SampleIntervalMSec, SimType::LightState::Navigation));
+    }
+
+    // Exercise
+    captureQueue.drain(aircraft);
+    captureQueue.flush(aircraft);
+
+    // Verify
+    const Light &light = aircraft.getLight();
+    // The first sample, one sample after each maximum interval and the last sample
+    QCOMPARE(light.count(), std::size_t(3));
+    QCOMPARE(light[0].timestamp, std::int64_t(0));
+    QVERIFY(light[1].timestamp >= ::MaxIntervalMSec);
+    QVERIFY(light[1].timestamp < ::MaxIntervalMSec + ::SampleIntervalMSec);
+    QCOMPARE(light[2].timestamp, (::SampleCount - 1) * ::SampleIntervalMSec);
+
+    const CaptureStatistics statistics = captureQueue.getStatistics();
+    QCOMPARE(statistics.capturedSamples, std::uint64_t(::SampleCount));
+    QCOMPARE(statistics.appendedSamples, std::uint64_t(3));
+}
+
+void CaptureQueueTest::discreteChange()
+{
+    // Setup
+    CaptureQueue captureQueue;
+    Aircraft aircraft;
+    captureQueue.setAdaptiveSamplingEnabled(true, ::createTolerance());
+    for (int i = 0; i < 10; ++i) {
+        EngineData engineData;
+        engineData.timestamp = i * ::SampleIntervalMSec;
+        engineData.electricalMasterBattery1 = i >= 5;
+        captureQueue.push(engineData);
+    }
+
+    // Exercise
+    captureQueue.drain(aircraft);
+    captureQueue.flush(aircraft);
+
+    // Verify
+    const Engine &engine = aircraft.getEngine();
+    // The first sample, the last sample before the change, the changed sample and the last sample
+    QCOMPARE(engine.count(), std::size_t(4));
+    QCOMPARE(engine[0].timestamp, std::int64_t(0));
+    QCOMPARE(engine[0].electricalMasterBattery1, false);
+    QCOMPARE(engine[1].timestamp, 4 * ::SampleIntervalMSec);
+    QCOMPARE(engine[1].electricalMasterBattery1, false);
+    QCOMPARE(engine[2].timestamp, 5 * ::SampleIntervalMSec);
+    QCOMPARE(engine[2].electricalMasterBattery1, true);
+    QCOMPARE(engine[3].timestamp, 9 * ::SampleIntervalMSec);
+    QCOMPARE(engine[3].electricalMasterBattery1, true);
+}
+
+void CaptureQueueTest::toleranceBand()
+{
+    // Setup
+    CaptureQueue captureQueue;
+    Aircraft aircraft;
+    DeadbandTolerance tolerance = ::createTolerance();
+    tolerance.altitudeFeet = 1.0;
+    captureQueue.setAdaptiveSamplingEnabled(true, tolerance);
+    // Climb by 0.25 feet per sample: every fifth sample leaves the tolerance band
+    for (int i = 0; i < 11; ++i) {
+        PositionData positionData {47.0, 8.0, 1000.0 + i * 0.25};
+        positionData.timestamp = i * ::SampleIntervalMSec;
+        captureQueue.push(positionData);
+    }
+
+    // Exercise
+    captureQueue.drain(aircraft);
+    captureQueue.flush(aircraft);
+
+    // Verify
+    const Position &position = aircraft.getPosition();
+    QCOMPARE(position.count(), std::size_t(5));
+    QCOMPARE(position[0].altitude, 1000.0);
+    QCOMPARE(position[1].altitude, 1001.0);
+    QCOMPARE(position[2].altitude, 1001.25);
+    QCOMPARE(position[3].altitude, 1002.25);
+    QCOMPARE(position[4].altitude, 1002.5);
+}
+
+void CaptureQueueTest::flush()
+{
+    // Setup
+    CaptureQueue captureQueue;
+    Aircraft aircraft;
+    captureQueue.setAdaptiveSamplingEnabled(true, ::createTolerance());
+    captureQueue.push(::createLightData(0, SimType::LightState::Beacon));
+    captureQueue.push(::createLightData(::SampleIntervalMSec, SimType::LightState::Beacon));
+    captureQueue.drain(aircraft);
+
+    // Exercise
+    const std::size_t flushed1 = captureQueue.flush(aircraft);
+    const std::size_t flushed2 = captureQueue.flush(aircraft);
+
+    // Verify
+    QCOMPARE(flushed1, std::size_t(1));
+    QCOMPARE(flushed2, std::size_t(0));
+    QCOMPARE(aircraft.getLight().count(), std::size_t(2));
+    QCOMPARE(aircraft.getLight()[1].timestamp, ::SampleIntervalMSec);
+}
+
+void CaptureQueueTest::largeBatch()
+{
+    // Setup
+    CaptureQueue captureQueue;
+    Aircraft aircraft;
+    captureQueue.setAdaptiveSamplingEnabled(false);
+    for (int i = 0; i < ::LargeSampleCount; ++i) {
+        captureQueue.push(::createLightData(i * ::SampleIntervalMSec, SimType::LightState::Navigation));
+    }
+
+    // Exercise
+    const std::size_t appended1 = captureQueue.drain(aircraft);
+    const std::size_t appended2 = captureQueue.drain(aircraft);
+
+    // Verify
+    QCOMPARE(appended1, std::size_t(::LargeSampleCount));
+    QCOMPARE(appended2, std::size_t(0));
+    QCOMPARE(aircraft.getLight().count(), std::size_t(::LargeSampleCount));
+    QCOMPARE(captureQueue.getStatistics().capturedSamples, std::uint64_t(::LargeSampleCount));
+    QCOMPARE(aircraft.getLight()[::LargeSampleCount - 1].timestamp, (::LargeSampleCount - 1) * ::SampleIntervalMSec);
+}
+
+QTEST_MAIN(CaptureQueueTest)
@@ -0,0 +1,220 @@
+/**
+ * Sky Dolly - The Black Sheep for Your Flight Recordings
+ *
+ * Copyright (c) 2020 - 2025 Oliver Knoll
+ *
+ * MIT License
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this
+ * software and associated documentation files (the "Software"), to deal in the Software
+ * without restriction, including without limitation the rights to use, copy, modify, merge,
+ * publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons
+ * to whom the Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or
+ * substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED *AS IS*, WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR
+ * PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE
+ * FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+ * OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ */
+#include <limits>
+
+#include <QTest>
+#include <QBuffer>
+#include <QByteArray>
+#include <QString>
+#include <QStringBuilder>
+#include <QDateTime>
+#include <QTimeZone>
+
+#include <PluginManager/Export.h>
+#include <PluginManager/ExportWriter.h>
+#include "ExportWriterTest.h"
+
+namespace
+{
+    // 2024-02-28T23:59:58.500Z: the timestamps cross a leap day
+    const QDateTime BaseDateTime {QDate(2024, 2, 28), QTime(23, 59, 58, 500), QTimeZone::UTC};
+}
+
+// PRIVATE SLOTS
+
+void ExportWriterTest::initTestCase()
+{}
+
+void ExportWriterTest::cleanupTestCase()
+{}
+
+void ExportWriterTest::appendInteger_data()
+{
+    QTest::addColumn<qint64>("value");
+    QTest::addColumn<int>("width");
+    QTest::addColumn<QByteArray>("expected");
+
+    QTest::newRow("Zero") << qint64(0) << 0 << QByteArray("0");
+    QTest::newRow("Positive") << qint64(1234) << 0 << QByteArray("1234");
+    QTest::newRow("Negative") << qint64(-1234) << 0 << QByteArray("-1234");
+    QTest::newRow("Padded") << qint64(42) << 5 << QByteArray("00042");
+    // The sign is placed before the zeros and counts towards the width
+    QTest::newRow("Padded negative") << qint64(-42) << 5 << QByteArray("-0042");
+    QTest::newRow("Wider than padding") << qint64(123456) << 3 << QByteArray("123456");
+    QTest::newRow("Minimum") << std::numeric_limits<qint64>::min() << 0 << QByteArray("-9223372036854775808");
+}
+
+void ExportWriterTest::appendInteger()
+{
+    // Setup
+    QFETCH(qint64, value);
+    QFETCH(int, width);
+    QFETCH(QByteArray, expected);
+    QBuffer buffer;
+    buffer.open(QIODevice::WriteOnly);
+
+    // Exercise
+    ExportWriter writer {buffer};
+    writer.appendInteger(value, width);
+    const bool ok = writer.flush();
+
+    // Verify
+    QVERIFY(ok);
+    QCOMPARE(buffer.data(), expected);
+}
+
+void ExportWriterTest::appendFixed_data()
+{
+    QTest::addColumn<double>("value");
+
+    QTest::newRow("Zero") << 0.0;
+    QTest::newRow("Latitude") << 47.3769;
+    QTest::newRow("Longitude") << -122.419415999;
+    QTest::newRow("Rounding") << 0.1234565;
+    QTest::newRow("Small negative") << -0.0000001;
+    QTest::newRow("Altitude") << 10972.8;
+    QTest::newRow("Large") << 1.0e15;
+}
+
+void ExportWriterTest::appendFixed()
+{
+    // Setup
+    QFETCH(double, value);
+    QBuffer buffer;
+    buffer.open(QIODevice::WriteOnly);
+
+    // Exercise
+    ExportWriter writer {buffer};
+    writer.appendCoordinate(value).append(' ').appendNumber(value);
+    const bool ok = writer.flush();
+
+    // Verify
+    QVERIFY(ok);
+    const QString expected = Export::formatCoordinate(value) % ' ' % Export::formatNumber(value);
+    QCOMPARE(buffer.data(), expected.toUtf8());
+}
+
+void ExportWriterTest::appendIsoDateTime_data()
+{
+    QTest::addColumn<qint64>("timestamp");
+
+    QTest::newRow("Start") << qint64(0);
+    QTest::newRow("Next second") << qint64(500);
+    QTest::newRow("Leap day") << qint64(1500);
+    QTest::newRow("Leap day milliseconds") << qint64(1567);
+    QTest::newRow("March") << qint64(24 * 60 * 60 * 1000 + 1500);
+    QTest::newRow("Next year") << qint64(366LL * 24 * 60 * 60 * 1000);
+}
+
+void ExportWriterTest::appendIsoDateTime()
+{
+    // Setup
+    QFETCH(qint64, timestamp);
+    QBuffer buffer;
+    buffer.open(QIODevice::WriteOnly);
+
+    // Exercise
+    ExportWriter writer {buffer};
+    writer.setBaseDateTime(::BaseDateTime);
+    writer.appendIsoDateTime(timestamp).append(' ').appendIsoDateTime(timestamp, true);
+    const bool ok = writer.flush();
+
+    // Verify
+    QVERIFY(ok);
+    const QDateTime dateTime = ::BaseDateTime.addMSecs(timestamp);
+    const QString expected = dateTime.toString(Qt::ISODate) % ' ' % dateTime.toString(Qt::ISODateWithMs);
+    QCOMPARE(buffer.data(), expected.toUtf8());
+}
+
+void ExportWriterTest::appendTime()
+{
+    // Setup
+    QBuffer buffer;
+    buffer.open(QIODevice::WriteOnly);
+
+    // Exercise
+    ExportWriter writer {buffer};
+    writer.setBaseDateTime(::BaseDateTime);
+    writer.appendTime(0).append(' ').appendTime(3723000);
+    // Invalid base date and time: nothing is appended
+    writer.setBaseDateTime(QDateTime());
+    writer.appendTime(0).appendIsoDateTime(0);
+    const bool ok = writer.flush();
+
+    // Verify
+    QVERIFY(ok);
+    QCOMPARE(buffer.data(), QByteArray("235958 010201"));
+}
+
+void ExportWriterTest::blocks()
+{
+    // Setup
+    QBuffer buffer;
+    buffer.open(QIODevice::WriteOnly);
+    QByteArray expected;
+
+    // Exercise
+    {
+        // Block size smaller than some of the appended texts
+        ExportWriter writer {buffer, 8};
+        for (int i = 0; i < 100; ++i) {
+            writer.append("Sky Dolly ").appendInteger(i).append(',');
+            expected.append("Sky Dolly ").append(QByteArray::number(i)).append(',');
+        }
+        // The last block is written when the writer is destroyed
+    }
+
+    // Verify
+    QCOMPARE(buffer.data(), expected);
+}
+
+void ExportWriterTest::largestValues()
+{
+    // Setup
+    QBuffer buffer;
+    buffer.open(QIODevice::WriteOnly);
+    constexpr double LargestNumber {std::numeric_limits<double>::max()};
+    constexpr qint64 LargestInteger {std::numeric_limits<qint64>::min()};
+    const QDateTime dateTime = ::BaseDateTime.addMSecs(1567);
+    const QString expected = Export::formatCoordinate(-LargestNumber) % ' ' %
+                             Export::formatNumber(-LargestNumber) % ' ' %
+                             QStringLiteral("-0000000009223372036854775808") % ' ' %
+                             dateTime.toString(Qt::ISODateWithMs);
+
+    // Exercise
+    {
+        // Block size smaller than any of the formatted values
+        ExportWriter writer {buffer, 8};
+        writer.setBaseDateTime(::BaseDateTime);
+        writer.appendCoordinate(-LargestNumber).append(' ')
+              .appendNumber(-LargestNumber).append(' ')
+              .appendInteger(LargestInteger, 29).append(' ')
+              .appendIsoDateTime(1567, true);
+    }
+
+    // Verify
+    QCOMPARE(buffer.data(), expected.toUtf8());
+}
+
+QTEST_MAIN(ExportWriterTest)